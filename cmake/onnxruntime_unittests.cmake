@@ -583,7 +583,8 @@ install(TARGETS onnx_test_runner
 
 if(onnxruntime_BUILD_BENCHMARKS)
   SET(BENCHMARK_DIR ${TEST_SRC_DIR}/onnx/microbenchmark)
-  add_executable(onnxruntime_benchmark ${TEST_SRC_DIR}/onnx/microbenchmark/main.cc ${TEST_SRC_DIR}/onnx/microbenchmark/modeltest.cc)
+  add_executable(onnxruntime_benchmark ${TEST_SRC_DIR}/onnx/microbenchmark/main.cc ${TEST_SRC_DIR}/onnx/microbenchmark/modeltest.cc
+               ${TEST_SRC_DIR}/onnx/microbenchmark/op_bench.cc)
   target_include_directories(onnxruntime_benchmark PRIVATE ${ONNXRUNTIME_ROOT} ${onnxruntime_graph_header} benchmark)
   if(WIN32)
     target_compile_options(onnxruntime_benchmark PRIVATE "$<$<COMPILE_LANGUAGE:CUDA>:-Xcompiler /wd4141>"
@@ -745,6 +746,21 @@ if(WIN32)
 endif()
 set_target_properties(onnxruntime_mlas_test PROPERTIES FOLDER "ONNXRuntimeTest")
 
+if(onnxruntime_BUILD_BENCHMARKS)
+  file(GLOB onnxruntime_mlas_benchmark_src CONFIGURE_DEPENDS
+    "${TEST_SRC_DIR}/mlas/bench/*.cpp"
+    "${TEST_SRC_DIR}/mlas/bench/*.h"
+  )
+  add_executable(onnxruntime_mlas_benchmark ${onnxruntime_mlas_benchmark_src})
+  target_include_directories(onnxruntime_mlas_benchmark PRIVATE ${ONNXRUNTIME_ROOT}/core/mlas/inc ${ONNXRUNTIME_ROOT})
+  if(WIN32)
+    target_compile_definitions(onnxruntime_mlas_benchmark PRIVATE _CRT_SECURE_NO_WARNINGS)
+  endif()
+  target_link_libraries(onnxruntime_mlas_benchmark PRIVATE benchmark ${onnxruntime_mlas_test_libs})
+  add_dependencies(onnxruntime_mlas_benchmark ${onnxruntime_EXTERNAL_DEPENDENCIES})
+  set_target_properties(onnxruntime_mlas_benchmark PROPERTIES FOLDER "ONNXRuntimeTest")
+endif()
+
 add_library(custom_op_library SHARED ${REPO_ROOT}/onnxruntime/test/testdata/custom_op_library/custom_op_library.cc)
 target_include_directories(custom_op_library PRIVATE ${REPO_ROOT}/include)
 if(UNIX)
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -64,6 +65,15 @@ class KernelDef {
     return alias_map_;
   }
 
+  const std::vector<std::pair<int, int>>& MayStridedOutput() const {
+    return may_strided_output_map_;
+  }
+
+  bool MayStridedInput(size_t input_index) const {
+    return std::find(may_strided_inputs_.begin(), may_strided_inputs_.end(), static_cast<int>(input_index)) !=
+           may_strided_inputs_.end();
+  }
+
   OrtMemType InputMemoryType(size_t input_index) const {
     auto it = input_memory_type_args_.find(input_index);
     if (it == input_memory_type_args_.end())
@@ -118,6 +128,12 @@ class KernelDef {
   // An element <i, j> means that output j is an alias of input i.
   std::vector<std::pair<int, int>> alias_map_;
 
+  // An element <i, j> means that output j may be produced as a strided view over the buffer of input i.
+  std::vector<std::pair<int, int>> may_strided_output_map_;
+
+  // The indices of inputs that can be consumed as non-contiguous strided views.
+  std::vector<int> may_strided_inputs_;
+
   // The memory types of inputs/outputs of this kernel
   MemTypeMap input_memory_type_args_;
   MemTypeMap output_memory_type_args_;
@@ -201,6 +217,19 @@ class KernelDefBuilder {
   KernelDefBuilder& Alias(const std::vector<std::pair<int, int>>& aliases);
   KernelDefBuilder& Alias(int input_index, int output_index);
 
+  /**
+     Specify that output output_index may be produced as a strided view of input input_index.
+     The allocation planner only does so if every consumer of the output accepts strided input,
+     in which case the output shares the input's buffer and the kernel is expected to describe
+     its layout with Tensor::SetShapeAndStrides instead of writing any data.
+  */
+  KernelDefBuilder& MayStridedOutput(int input_index, int output_index);
+
+  /**
+     Specify that this kernel can consume input input_index when it is a non-contiguous strided view.
+  */
+  KernelDefBuilder& MayStridedInput(int input_index);
+
   /**
      Specify that this kernel requires an input arg
      in certain memory type (instead of the default, device memory).
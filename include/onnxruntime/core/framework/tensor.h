@@ -187,14 +187,41 @@ class Tensor final {
     ORT_ENFORCE(shape_.Size() == new_shape.Size(),
                 "Tensor size (" + std::to_string(shape_.Size()) +
                     ") != new size (" + std::to_string(new_shape.Size()) + ")");
+    ORT_ENFORCE(IsContiguous(), "Reshape of a strided tensor view is not supported.");
     shape_ = new_shape;
   }
 
+  /**
+     Returns true if the tensor releases its buffer when it is destroyed, i.e. the buffer lives as long as the tensor.
+  */
+  bool OwnsBuffer() const noexcept { return buffer_deleter_ != nullptr; }
+
   /**
   The number of bytes of data.
   */
   size_t SizeInBytes() const;
 
+  /**
+   * Returns true if the tensor data is laid out densely in row-major order.
+   * A tensor is only non-contiguous if it is a strided view produced by a kernel that declared
+   * KernelDefBuilder::MayStridedOutput, and will only be seen by kernels that declared MayStridedInput.
+   */
+  bool IsContiguous() const noexcept { return strides_.empty(); }
+
+  /**
+   * Returns the strides of the tensor, in elements. For a contiguous tensor these are the
+   * row-major strides computed from Shape().
+   */
+  std::vector<int64_t> Strides() const;
+
+  /**
+   * Turns the tensor into a strided view over its existing buffer without touching the underlying storage.
+   * Strides are in elements and must have the same rank as new_shape. A stride of 0 broadcasts the dimension.
+   * If the strides describe a dense row-major layout the tensor is marked as contiguous.
+   * @warning this function is NOT thread-safe.
+   */
+  void SetShapeAndStrides(const TensorShape& new_shape, const std::vector<int64_t>& new_strides);
+
   // More API methods.
  private:
   void Init(MLDataType p_type,
@@ -214,6 +241,9 @@ class Tensor final {
   AllocatorPtr buffer_deleter_;
 
   TensorShape shape_;
+  // strides in elements. empty if the tensor is contiguous, which is the case for all tensors other than
+  // strided views.
+  std::vector<int64_t> strides_;
   const PrimitiveDataTypeBase* dtype_;
   OrtMemoryInfo alloc_info_;
   ptrdiff_t byte_offset_;
@@ -161,6 +161,7 @@ ORT_RUNTIME_CLASS(SequenceTypeInfo);
 ORT_RUNTIME_CLASS(ModelMetadata);
 ORT_RUNTIME_CLASS(ThreadPoolParams);
 ORT_RUNTIME_CLASS(ThreadingOptions);
+ORT_RUNTIME_CLASS(IoBinding);
 
 // When passing in an allocator to any ORT function, be sure that the allocator object
 // is not destroyed until the last allocated object using it is freed.
@@ -772,6 +773,74 @@ struct OrtApi {
       NO_EXCEPTION;
 
   ORT_CLASS_RELEASE(ThreadingOptions);
+
+  /**
+   * Creates a binding of inputs and outputs to values owned by the caller, for use with RunWithBinding.
+   * Bound values are kept until they are rebound or cleared, so the same binding can be run repeatedly.
+   * \param out should be freed by calling ReleaseIoBinding. The session must outlive the binding.
+   */
+  OrtStatus*(ORT_API_CALL* CreateIoBinding)(_Inout_ OrtSession* sess, _Outptr_ OrtIoBinding** out)NO_EXCEPTION;
+
+  ORT_CLASS_RELEASE(IoBinding);
+
+  /**
+   * Binds an input. An input that is not at the location required by the model is copied there once, when it is
+   * bound, rather than on every run. Binding the same name again replaces the previous value.
+   */
+  OrtStatus*(ORT_API_CALL* BindInput)(_Inout_ OrtIoBinding* binding, _In_ const char* name,
+                                      _In_ const OrtValue* value)NO_EXCEPTION;
+
+  /**
+   * Binds an output to a preallocated value. Every run writes the output directly into the memory of 'value', so its
+   * shape must match the shape of the output.
+   */
+  OrtStatus*(ORT_API_CALL* BindOutput)(_Inout_ OrtIoBinding* binding, _In_ const char* name,
+                                       _In_ const OrtValue* value)NO_EXCEPTION;
+
+  /**
+   * Binds an output whose shape is not known in advance. The session allocates it on every run and it can be read
+   * with GetBoundOutputValues. Only CPU memory is currently supported.
+   */
+  OrtStatus*(ORT_API_CALL* BindOutputToDevice)(_Inout_ OrtIoBinding* binding, _In_ const char* name,
+                                               _In_ const OrtMemoryInfo* mem_info)NO_EXCEPTION;
+
+  /**
+   * \param buffer is set to the names of the bound outputs, one after the other without separators, allocated using
+   * 'allocator'. \param lengths is set to an array with the length of each name, allocated using 'allocator'.
+   * The caller is responsible for freeing both. Nothing is allocated and 'count' is 0 if no outputs are bound.
+   */
+  OrtStatus*(ORT_API_CALL* GetBoundOutputNames)(_In_ const OrtIoBinding* binding, _Inout_ OrtAllocator* allocator,
+                                                _Out_ char** buffer, _Out_ size_t** lengths,
+                                                _Out_ size_t* count)NO_EXCEPTION;
+
+  /**
+   * \param output is set to an array of the bound output values, in the order they were bound, allocated using
+   * 'allocator'. Each value must be released with ReleaseValue and the array freed using 'allocator'.
+   * Values refer to the memory of the binding, so no data is copied.
+   */
+  OrtStatus*(ORT_API_CALL* GetBoundOutputValues)(_In_ const OrtIoBinding* binding, _Inout_ OrtAllocator* allocator,
+                                                 _Out_ OrtValue*** output, _Out_ size_t* count)NO_EXCEPTION;
+
+  void(ORT_API_CALL* ClearBoundInputs)(_Inout_ OrtIoBinding* binding) NO_EXCEPTION ORT_ALL_ARGS_NONNULL;
+  void(ORT_API_CALL* ClearBoundOutputs)(_Inout_ OrtIoBinding* binding) NO_EXCEPTION ORT_ALL_ARGS_NONNULL;
+
+  /**
+   * Runs the session with the inputs and outputs of 'binding'. The outputs are stored in the binding.
+   */
+  OrtStatus*(ORT_API_CALL* RunWithBinding)(_Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions* run_options,
+                                           _Inout_ OrtIoBinding* binding)NO_EXCEPTION;
+
+  /**
+   * Reads the statistics of the arena of the default memory of an execution provider of the session, e.g.
+   * "CPUExecutionProvider". All values are 0 if the provider does not allocate from an arena.
+   * \param bytes_in_use is set to the bytes currently allocated from the arena.
+   * \param total_allocated_bytes is set to the bytes the arena has reserved from the system.
+   * \param max_bytes_in_use is set to the largest value of bytes_in_use so far.
+   * \param num_allocs is set to the number of allocations made from the arena.
+   */
+  OrtStatus*(ORT_API_CALL* SessionGetArenaStats)(_In_ const OrtSession* sess, _In_ const char* provider_type,
+                                                 _Out_ int64_t* bytes_in_use, _Out_ int64_t* total_allocated_bytes,
+                                                 _Out_ int64_t* max_bytes_in_use, _Out_ int64_t* num_allocs)NO_EXCEPTION;
 };
 
 /*
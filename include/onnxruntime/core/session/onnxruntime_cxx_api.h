@@ -72,6 +72,7 @@ ORT_DEFINE_RELEASE(TypeInfo);
 ORT_DEFINE_RELEASE(Value);
 ORT_DEFINE_RELEASE(ModelMetadata);
 ORT_DEFINE_RELEASE(ThreadingOptions);
+ORT_DEFINE_RELEASE(IoBinding);
 
 // This is used internally by the C++ API. This is the common base class used by the wrapper objects.
 template <typename T>
@@ -120,6 +121,7 @@ struct Env;
 struct TypeInfo;
 struct Value;
 struct ModelMetadata;
+struct IoBinding;
 
 struct Env : Base<OrtEnv> {
   Env(std::nullptr_t) {}
@@ -203,6 +205,13 @@ struct ModelMetadata : Base<OrtModelMetadata> {
   int64_t GetVersion() const;
 };
 
+struct ArenaStats {
+  int64_t bytes_in_use;
+  int64_t total_allocated_bytes;
+  int64_t max_bytes_in_use;
+  int64_t num_allocs;
+};
+
 struct Session : Base<OrtSession> {
   explicit Session(std::nullptr_t) {}
   Session(Env& env, const ORTCHAR_T* model_path, const SessionOptions& options);
@@ -214,6 +223,8 @@ struct Session : Base<OrtSession> {
   // Run for when there is a list of prealloated outputs
   void Run(const RunOptions& run_options, const char* const* input_names, const Value* input_values, size_t input_count,
            const char* const* output_names, Value* output_values, size_t output_count);
+  // Run with the inputs and outputs bound to 'io_binding'. The outputs are stored in the binding
+  void Run(const RunOptions& run_options, IoBinding& io_binding);
 
   size_t GetInputCount() const;
   size_t GetOutputCount() const;
@@ -224,12 +235,32 @@ struct Session : Base<OrtSession> {
   char* GetOverridableInitializerName(size_t index, OrtAllocator* allocator) const;
   char* EndProfiling(OrtAllocator* allocator) const;
   ModelMetadata GetModelMetadata() const;
+  // Statistics of the arena of 'provider_type'. All values are 0 if the provider does not use an arena
+  ArenaStats GetArenaStats(const char* provider_type) const;
 
   TypeInfo GetInputTypeInfo(size_t index) const;
   TypeInfo GetOutputTypeInfo(size_t index) const;
   TypeInfo GetOverridableInitializerTypeInfo(size_t index) const;
 };
 
+// Inputs and outputs bound to a session once and reused by every Session::Run that uses the binding.
+// Outputs bound to a preallocated Value are written directly into its memory, so no copy is needed after a run.
+struct IoBinding : Base<OrtIoBinding> {
+  explicit IoBinding(std::nullptr_t) {}
+  explicit IoBinding(Session& session);
+
+  void BindInput(const char* name, const Value& value);
+  void BindOutput(const char* name, const Value& value);
+  // Binds an output that the session allocates on each run, for outputs whose shape is not known in advance
+  void BindOutput(const char* name, const MemoryInfo& memory_info);
+
+  std::vector<std::string> GetOutputNames() const;
+  std::vector<Value> GetOutputValues() const;
+
+  void ClearBoundInputs();
+  void ClearBoundOutputs();
+};
+
 struct TensorTypeAndShapeInfo : Base<OrtTensorTypeAndShapeInfo> {
   explicit TensorTypeAndShapeInfo(std::nullptr_t) {}
   explicit TensorTypeAndShapeInfo(OrtTensorTypeAndShapeInfo* p) : Base<OrtTensorTypeAndShapeInfo>{p} {}
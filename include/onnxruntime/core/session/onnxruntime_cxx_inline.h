@@ -246,6 +246,10 @@ inline void Session::Run(const RunOptions& run_options, const char* const* input
   ThrowOnError(Global<void>::api_.Run(p_, run_options, input_names, ort_input_values, input_count, output_names, output_count, ort_output_values));
 }
 
+inline void Session::Run(const RunOptions& run_options, IoBinding& io_binding) {
+  ThrowOnError(Global<void>::api_.RunWithBinding(p_, run_options, io_binding));
+}
+
 inline size_t Session::GetInputCount() const {
   size_t out;
   ThrowOnError(Global<void>::api_.SessionGetInputCount(p_, &out));
@@ -294,6 +298,75 @@ inline ModelMetadata Session::GetModelMetadata() const {
   return ModelMetadata{out};
 }
 
+inline ArenaStats Session::GetArenaStats(const char* provider_type) const {
+  ArenaStats stats;
+  ThrowOnError(Global<void>::api_.SessionGetArenaStats(p_, provider_type, &stats.bytes_in_use, &stats.total_allocated_bytes,
+                                                       &stats.max_bytes_in_use, &stats.num_allocs));
+  return stats;
+}
+
+inline IoBinding::IoBinding(Session& session) {
+  ThrowOnError(Global<void>::api_.CreateIoBinding(session, &p_));
+}
+
+inline void IoBinding::BindInput(const char* name, const Value& value) {
+  ThrowOnError(Global<void>::api_.BindInput(p_, name, value));
+}
+
+inline void IoBinding::BindOutput(const char* name, const Value& value) {
+  ThrowOnError(Global<void>::api_.BindOutput(p_, name, value));
+}
+
+inline void IoBinding::BindOutput(const char* name, const MemoryInfo& memory_info) {
+  ThrowOnError(Global<void>::api_.BindOutputToDevice(p_, name, memory_info));
+}
+
+inline std::vector<std::string> IoBinding::GetOutputNames() const {
+  AllocatorWithDefaultOptions allocator;
+  char* buffer = nullptr;
+  size_t* lengths = nullptr;
+  size_t count = 0;
+  ThrowOnError(Global<void>::api_.GetBoundOutputNames(p_, allocator, &buffer, &lengths, &count));
+
+  std::vector<std::string> result;
+  result.reserve(count);
+  const char* name = buffer;
+  for (size_t i = 0; i < count; ++i) {
+    result.emplace_back(name, lengths[i]);
+    name += lengths[i];
+  }
+  if (count > 0) {
+    allocator.Free(buffer);
+    allocator.Free(lengths);
+  }
+  return result;
+}
+
+inline std::vector<Value> IoBinding::GetOutputValues() const {
+  AllocatorWithDefaultOptions allocator;
+  OrtValue** output = nullptr;
+  size_t count = 0;
+  ThrowOnError(Global<void>::api_.GetBoundOutputValues(p_, allocator, &output, &count));
+
+  std::vector<Value> result;
+  result.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    result.emplace_back(output[i]);
+  }
+  if (count > 0) {
+    allocator.Free(output);
+  }
+  return result;
+}
+
+inline void IoBinding::ClearBoundInputs() {
+  Global<void>::api_.ClearBoundInputs(p_);
+}
+
+inline void IoBinding::ClearBoundOutputs() {
+  Global<void>::api_.ClearBoundOutputs(p_);
+}
+
 inline char* ModelMetadata::GetProducerName(OrtAllocator* allocator) const {
   char* out;
   ThrowOnError(Global<void>::api_.ModelMetadataGetProducerName(p_, allocator, &out));
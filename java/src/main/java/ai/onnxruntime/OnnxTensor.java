@@ -121,6 +121,29 @@ public class OnnxTensor implements OnnxValue {
     close(OnnxRuntime.ortApiHandle, nativeHandle);
   }
 
+  /**
+   * Returns a read-only view of the underlying OnnxTensor's memory as a ByteBuffer in native byte
+   * order, without copying it.
+   *
+   * <p>The view aliases native memory, so it must not be used after the OnnxTensor is closed, and
+   * it reflects later writes into the tensor (e.g. when it is a pinned output of {@link
+   * OrtSession#run(java.util.Map, java.util.Map)}).
+   *
+   * <p>This method returns null if the OnnxTensor contains Strings as they are stored externally to
+   * the OnnxTensor.
+   *
+   * @return A read-only ByteBuffer view of the OnnxTensor.
+   */
+  public ByteBuffer getByteBufferView() {
+    if (info.type != OnnxJavaType.STRING) {
+      return getBuffer(OnnxRuntime.ortApiHandle, nativeHandle)
+          .asReadOnlyBuffer()
+          .order(ByteOrder.nativeOrder());
+    } else {
+      return null;
+    }
+  }
+
   /**
    * Returns a copy of the underlying OnnxTensor as a ByteBuffer.
    *
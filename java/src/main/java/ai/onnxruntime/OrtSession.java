@@ -7,6 +7,7 @@ package ai.onnxruntime;
 import java.io.IOException;
 import java.util.ArrayList;
 import java.util.Arrays;
+import java.util.Collections;
 import java.util.Iterator;
 import java.util.LinkedHashMap;
 import java.util.LinkedHashSet;
@@ -208,17 +209,64 @@ public class OrtSession implements AutoCloseable {
    */
   public Result run(Map<String, OnnxTensor> inputs, Set<String> requestedOutputs)
       throws OrtException {
+    return run(inputs, requestedOutputs, Collections.emptyMap());
+  }
+
+  /**
+   * Scores an input feed dict, writing all the outputs into the supplied pinned output tensors.
+   *
+   * <p>See {@link #run(Map, Set, Map)}.
+   *
+   * @param inputs The inputs to score.
+   * @param pinnedOutputs The tensors to write the outputs into, keyed by output name.
+   * @return The pinned outputs.
+   * @throws OrtException If there was an error in native code, the input or output names are
+   *     invalid, or if a pinned output does not have the shape and type of the output.
+   */
+  public Result run(Map<String, OnnxTensor> inputs, Map<String, OnnxTensor> pinnedOutputs)
+      throws OrtException {
+    return run(inputs, Collections.emptySet(), pinnedOutputs);
+  }
+
+  /**
+   * Scores an input feed dict, returning the map of requested inferred outputs and writing the
+   * pinned outputs in place.
+   *
+   * <p>Pinned outputs are tensors created by the caller, usually backed by a direct {@link
+   * java.nio.ByteBuffer} (see {@link OnnxTensor#createTensor(OrtEnvironment, java.nio.ByteBuffer,
+   * long[], OnnxJavaType)}), which must have the exact shape and type the output will have. The
+   * runtime writes the output straight into their memory, so reusing the same tensors across runs
+   * avoids allocating new native buffers and Java objects for the outputs.
+   *
+   * <p>The returned Result contains the requested outputs followed by the pinned outputs. Closing
+   * it closes only the requested outputs; the pinned outputs remain owned by the caller.
+   *
+   * @param inputs The inputs to score.
+   * @param requestedOutputs The requested outputs, allocated by the runtime.
+   * @param pinnedOutputs The tensors to write the outputs into, keyed by output name. Must not
+   *     overlap the requested outputs.
+   * @return The inferred outputs.
+   * @throws OrtException If there was an error in native code, the input or output names are
+   *     invalid, if there are zero or too many inputs or outputs, or if a pinned output does not
+   *     have the shape and type of the output.
+   */
+  public Result run(
+      Map<String, OnnxTensor> inputs,
+      Set<String> requestedOutputs,
+      Map<String, OnnxTensor> pinnedOutputs)
+      throws OrtException {
     if (!closed) {
       if (inputs.isEmpty() || (inputs.size() > numInputs)) {
         throw new OrtException(
             "Unexpected number of inputs, expected [1," + numInputs + ") found " + inputs.size());
       }
-      if (requestedOutputs.isEmpty() || (requestedOutputs.size() > numOutputs)) {
+      int totalOutputs = requestedOutputs.size() + pinnedOutputs.size();
+      if ((totalOutputs == 0) || (totalOutputs > numOutputs)) {
         throw new OrtException(
-            "Unexpected number of requestedOutputs, expected [1,"
+            "Unexpected number of requestedOutputs and pinnedOutputs, expected [1,"
                 + numOutputs
                 + ") found "
-                + requestedOutputs.size());
+                + totalOutputs);
       }
       String[] inputNamesArray = new String[inputs.size()];
       long[] inputHandles = new long[inputs.size()];
@@ -233,7 +281,9 @@ public class OrtSession implements AutoCloseable {
               "Unknown input name " + t.getKey() + ", expected one of " + inputNames.toString());
         }
       }
-      String[] outputNamesArray = new String[requestedOutputs.size()];
+      String[] outputNamesArray = new String[totalOutputs];
+      // Zero for outputs the runtime allocates, the native handle of the tensor for pinned outputs.
+      long[] outputHandles = new long[totalOutputs];
       i = 0;
       for (String s : requestedOutputs) {
         if (outputNames.contains(s)) {
@@ -244,6 +294,21 @@ public class OrtSession implements AutoCloseable {
               "Unknown output name " + s + ", expected one of " + outputNames.toString());
         }
       }
+      int numRequested = i;
+      for (Map.Entry<String, OnnxTensor> t : pinnedOutputs.entrySet()) {
+        if (!outputNames.contains(t.getKey())) {
+          throw new OrtException(
+              "Unknown output name " + t.getKey() + ", expected one of " + outputNames.toString());
+        } else if (requestedOutputs.contains(t.getKey())) {
+          throw new OrtException(
+              "Output " + t.getKey() + " is both requested and pinned, it must be one or the other");
+        } else if (t.getValue().getInfo().type == OnnxJavaType.STRING) {
+          throw new OrtException("Output " + t.getKey() + " can't be pinned to a String tensor");
+        }
+        outputNamesArray[i] = t.getKey();
+        outputHandles[i] = t.getValue().getNativeHandle();
+        i++;
+      }
       OnnxValue[] outputValues =
           run(
               OnnxRuntime.ortApiHandle,
@@ -253,8 +318,14 @@ public class OrtSession implements AutoCloseable {
               inputHandles,
               inputNamesArray.length,
               outputNamesArray,
+              outputHandles,
               outputNamesArray.length);
-      return new Result(outputNamesArray, outputValues);
+      i = numRequested;
+      for (OnnxTensor t : pinnedOutputs.values()) {
+        outputValues[i] = t;
+        i++;
+      }
+      return new Result(outputNamesArray, outputValues, numRequested);
     } else {
       throw new IllegalStateException("Trying to score a closed OrtSession.");
     }
@@ -326,6 +397,7 @@ public class OrtSession implements AutoCloseable {
       long[] inputs,
       long numInputs,
       String[] outputNamesArray,
+      long[] outputs,
       long numOutputs)
       throws OrtException;
 
@@ -606,7 +678,8 @@ public class OrtSession implements AutoCloseable {
   /**
    * An {@link AutoCloseable} wrapper around a {@link Map} containing {@link OnnxValue}s.
    *
-   * <p>When this is closed it closes all the {@link OnnxValue}s inside it. If you maintain a
+   * <p>When this is closed it closes all the {@link OnnxValue}s inside it, except pinned outputs
+   * which are owned by the caller of {@link OrtSession#run(Map, Set, Map)}. If you maintain a
    * reference to a value after this object has been closed it will throw an {@link
    * IllegalStateException} upon access.
    */
@@ -618,15 +691,21 @@ public class OrtSession implements AutoCloseable {
 
     private final List<OnnxValue> list;
 
+    /** The number of leading values owned by this Result, the rest are pinned outputs. */
+    private final int numOwned;
+
     private boolean closed;
 
     /**
-     * Creates a Result from the names and values produced by {@link OrtSession#run(Map)}.
+     * Creates a Result from the names and values produced by {@link OrtSession#run(Map, Set,
+     * Map)}.
      *
      * @param names The output names.
      * @param values The output values.
+     * @param numOwned The number of leading values which are closed when this Result is closed.
      */
-    Result(String[] names, OnnxValue[] values) {
+    Result(String[] names, OnnxValue[] values, int numOwned) {
+      this.numOwned = numOwned;
       map = new LinkedHashMap<>();
       list = new ArrayList<>();
 
@@ -649,8 +728,8 @@ public class OrtSession implements AutoCloseable {
     public void close() {
       if (!closed) {
         closed = true;
-        for (OnnxValue t : map.values()) {
-          t.close();
+        for (int i = 0; i < numOwned; i++) {
+          list.get(i).close();
         }
       } else {
         logger.warning("Closing an already closed Result");
@@ -236,11 +236,11 @@ JNIEXPORT jobjectArray JNICALL Java_ai_onnxruntime_OrtSession_getOutputInfo
 /*
  * Class:     ai_onnxruntime_OrtSession
  * Method:    run
- * Signature: (JJJ[Ljava/lang/String;[JJ[Ljava/lang/String;J)[Lai/onnxruntime/OnnxValue;
- * private native OnnxValue[] run(long apiHandle, long nativeHandle, long allocatorHandle, String[] inputNamesArray, long[] inputs, long numInputs, String[] outputNamesArray, long numOutputs)
+ * Signature: (JJJ[Ljava/lang/String;[JJ[Ljava/lang/String;[JJ)[Lai/onnxruntime/OnnxValue;
+ * private native OnnxValue[] run(long apiHandle, long nativeHandle, long allocatorHandle, String[] inputNamesArray, long[] inputs, long numInputs, String[] outputNamesArray, long[] outputs, long numOutputs)
  */
 JNIEXPORT jobjectArray JNICALL Java_ai_onnxruntime_OrtSession_run
-  (JNIEnv * jniEnv, jobject jobj, jlong apiHandle, jlong sessionHandle, jlong allocatorHandle, jobjectArray inputNamesArr, jlongArray tensorArr, jlong numInputs, jobjectArray outputNamesArr, jlong numOutputs) {
+  (JNIEnv * jniEnv, jobject jobj, jlong apiHandle, jlong sessionHandle, jlong allocatorHandle, jobjectArray inputNamesArr, jlongArray tensorArr, jlong numInputs, jobjectArray outputNamesArr, jlongArray outputTensorArr, jlong numOutputs) {
     (void) jobj; // Required JNI parameter not needed by functions which don't need to access their host object.
     const OrtApi* api = (const OrtApi*) apiHandle;
     OrtAllocator* allocator = (OrtAllocator*) allocatorHandle;
@@ -265,12 +265,14 @@ JNIEXPORT jobjectArray JNICALL Java_ai_onnxruntime_OrtSession_run
     jlong* inputTensors = (*jniEnv)->GetLongArrayElements(jniEnv,tensorArr,NULL);
 
     // Extract the names of the output values, and allocate their output array.
+    // Pinned outputs are passed to Run as preallocated values which it writes into in place.
+    jlong* pinnedTensors = (*jniEnv)->GetLongArrayElements(jniEnv,outputTensorArr,NULL);
     OrtValue** outputValues;
     checkOrtStatus(jniEnv,api,api->AllocatorAlloc(allocator,sizeof(OrtValue*)*numOutputs,(void**)&outputValues));
     for (int i = 0; i < numOutputs; i++) {
         javaOutputStrings[i] = (*jniEnv)->GetObjectArrayElement(jniEnv,outputNamesArr,i);
         outputNames[i] = (*jniEnv)->GetStringUTFChars(jniEnv,javaOutputStrings[i],NULL);
-        outputValues[i] = NULL;
+        outputValues[i] = (OrtValue*) pinnedTensors[i];
     }
 
     // Actually score the inputs.
@@ -286,13 +288,15 @@ JNIEXPORT jobjectArray JNICALL Java_ai_onnxruntime_OrtSession_run
     jobjectArray outputArray = (*jniEnv)->NewObjectArray(jniEnv,numOutputs,onnxValueClass,NULL);
 
     // Convert the output tensors into ONNXValues and release the output strings.
+    // Pinned outputs are left null, the Java side already holds their OnnxTensors.
     for (int i = 0; i < numOutputs; i++) {
-        if (outputValues[i] != NULL) {
+        if ((outputValues[i] != NULL) && (pinnedTensors[i] == 0)) {
             jobject onnxValue = convertOrtValueToONNXValue(jniEnv,api,allocator,outputValues[i]);
             (*jniEnv)->SetObjectArrayElement(jniEnv,outputArray,i,onnxValue);
         }
         (*jniEnv)->ReleaseStringUTFChars(jniEnv,javaOutputStrings[i],outputNames[i]);
     }
+    (*jniEnv)->ReleaseLongArrayElements(jniEnv,outputTensorArr,pinnedTensors,JNI_ABORT);
     checkOrtStatus(jniEnv,api,api->AllocatorFree(allocator,outputValues));
 
     // Release the Java input strings
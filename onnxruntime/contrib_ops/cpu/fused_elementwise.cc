@@ -0,0 +1,302 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "contrib_ops/cpu/fused_elementwise.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "core/mlas/inc/mlas.h"
+#include "core/platform/threadpool.h"
+#include "core/util/math_cpuonly.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+ONNX_OPERATOR_KERNEL_EX(
+    FusedElementwise,
+    kMSDomain,
+    1,
+    kCpuExecutionProvider,
+    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    FusedElementwise);
+
+namespace {
+
+// Number of output elements evaluated at a time. Small enough that the inputs, intermediate results and output
+// for the tile stay resident in the L2 cache for typical expression sizes.
+constexpr int64_t kTileSize = 4096;
+
+struct OpInfo {
+  FusedElementwise::OpKind kind;
+  bool is_binary;
+};
+
+const std::unordered_map<std::string, OpInfo>& SupportedOps() {
+  using OpKind = FusedElementwise::OpKind;
+  static const std::unordered_map<std::string, OpInfo> supported_ops{
+      {"Add", {OpKind::Add, true}},
+      {"Sub", {OpKind::Sub, true}},
+      {"Mul", {OpKind::Mul, true}},
+      {"Div", {OpKind::Div, true}},
+      {"Abs", {OpKind::Abs, false}},
+      {"Neg", {OpKind::Neg, false}},
+      {"Sqrt", {OpKind::Sqrt, false}},
+      {"Reciprocal", {OpKind::Reciprocal, false}},
+      {"Exp", {OpKind::Exp, false}},
+      {"Log", {OpKind::Log, false}},
+      {"Relu", {OpKind::Relu, false}},
+      {"Sigmoid", {OpKind::Sigmoid, false}},
+      {"Tanh", {OpKind::Tanh, false}},
+      {"Erf", {OpKind::Erf, false}},
+  };
+  return supported_ops;
+}
+
+// An operand of an instruction for the current tile. Scalar operands are not expanded.
+struct Operand {
+  const float* data;
+  bool is_scalar;
+};
+
+template <typename Op>
+void ApplyBinary(const Operand& a, const Operand& b, float* output, int64_t count, Op op) {
+  if (a.is_scalar && b.is_scalar) {
+    const float value = op(*a.data, *b.data);
+    std::fill_n(output, count, value);
+  } else if (a.is_scalar) {
+    const float value = *a.data;
+    for (int64_t i = 0; i < count; ++i) {
+      output[i] = op(value, b.data[i]);
+    }
+  } else if (b.is_scalar) {
+    const float value = *b.data;
+    for (int64_t i = 0; i < count; ++i) {
+      output[i] = op(a.data[i], value);
+    }
+  } else {
+    for (int64_t i = 0; i < count; ++i) {
+      output[i] = op(a.data[i], b.data[i]);
+    }
+  }
+}
+
+void ApplyUnary(FusedElementwise::OpKind kind, const Operand& a, float* output, int64_t count) {
+  using OpKind = FusedElementwise::OpKind;
+
+  const float* input = a.data;
+  if (a.is_scalar) {
+    std::fill_n(output, count, *a.data);
+    input = output;
+  }
+
+  ConstEigenVectorArrayMap<float> x(input, count);
+  EigenVectorArrayMap<float> y(output, count);
+  switch (kind) {
+    case OpKind::Abs:
+      y = x.abs();
+      break;
+    case OpKind::Neg:
+      y = -x;
+      break;
+    case OpKind::Sqrt:
+      y = x.sqrt();
+      break;
+    case OpKind::Reciprocal:
+      y = x.inverse();
+      break;
+    case OpKind::Exp:
+      y = x.exp();
+      break;
+    case OpKind::Log:
+      y = x.log();
+      break;
+    case OpKind::Relu:
+      y = x.cwiseMax(0.0f);
+      break;
+    case OpKind::Sigmoid:
+      MlasComputeLogistic(input, output, static_cast<size_t>(count));
+      break;
+    case OpKind::Tanh:
+      MlasComputeTanh(input, output, static_cast<size_t>(count));
+      break;
+    case OpKind::Erf:
+      MlasComputeErf(input, output, static_cast<size_t>(count));
+      break;
+    default:
+      ORT_THROW("Unexpected unary op in FusedElementwise");
+  }
+}
+
+// How an input is read relative to the output.
+enum class InputKind {
+  Full,      // same shape as the output
+  Scalar,    // a single element broadcast to every output element
+  Periodic,  // the shape matches the trailing dimensions of the output, so the input repeats every period elements
+};
+
+}  // namespace
+
+FusedElementwise::FusedElementwise(const OpKernelInfo& info) : OpKernel(info) {
+  std::vector<std::string> ops = info.GetAttrsOrDefault<std::string>("ops");
+  std::vector<int64_t> operands = info.GetAttrsOrDefault<int64_t>("operands");
+  ORT_ENFORCE(!ops.empty(), "FusedElementwise requires at least one op.");
+  ORT_ENFORCE(operands.size() == 2 * ops.size(), "FusedElementwise requires two operand indices per op.");
+
+  const int64_t num_inputs = static_cast<int64_t>(info.GetInputCount());
+  const auto& supported_ops = SupportedOps();
+  instructions_.reserve(ops.size());
+  for (size_t i = 0; i < ops.size(); ++i) {
+    auto it = supported_ops.find(ops[i]);
+    ORT_ENFORCE(it != supported_ops.end(), "FusedElementwise: unsupported op ", ops[i]);
+
+    Instruction instruction{it->second.kind, {operands[2 * i], operands[2 * i + 1]}, it->second.is_binary};
+    const int64_t num_available = num_inputs + static_cast<int64_t>(i);
+    for (int j = 0; j < (instruction.is_binary ? 2 : 1); ++j) {
+      ORT_ENFORCE(instruction.operands[j] >= 0 && instruction.operands[j] < num_available,
+                  "FusedElementwise: invalid operand index ", instruction.operands[j], " for op ", i);
+    }
+    instructions_.push_back(instruction);
+  }
+}
+
+Status FusedElementwise::Compute(OpKernelContext* context) const {
+  const int num_inputs = context->InputCount();
+
+  // the output has the shape of the largest input. every other input must be a scalar or match the
+  // trailing dimensions of the output.
+  const Tensor* largest = nullptr;
+  for (int i = 0; i < num_inputs; ++i) {
+    const Tensor* input = context->Input<Tensor>(i);
+    if (largest == nullptr || input->Shape().Size() > largest->Shape().Size() ||
+        (input->Shape().Size() == largest->Shape().Size() &&
+         input->Shape().NumDimensions() > largest->Shape().NumDimensions())) {
+      largest = input;
+    }
+  }
+
+  const TensorShape& output_shape = largest->Shape();
+  Tensor* Y = context->Output(0, output_shape);
+  const int64_t output_size = output_shape.Size();
+  if (output_size == 0) {
+    return Status::OK();
+  }
+
+  const auto& output_dims = output_shape.GetDims();
+  std::vector<InputKind> input_kinds(num_inputs);
+  std::vector<int64_t> input_periods(num_inputs);
+  std::vector<const float*> input_data(num_inputs);
+  for (int i = 0; i < num_inputs; ++i) {
+    const Tensor* input = context->Input<Tensor>(i);
+    const auto& dims = input->Shape().GetDims();
+    const int64_t size = input->Shape().Size();
+    input_data[i] = input->Data<float>();
+    input_periods[i] = size;
+
+    if (size == 1) {
+      input_kinds[i] = InputKind::Scalar;
+      continue;
+    }
+
+    // leading 1s of the input don't change the layout
+    size_t first = 0;
+    while (first < dims.size() && dims[first] == 1) ++first;
+    const size_t trailing_rank = dims.size() - first;
+    ORT_RETURN_IF_NOT(trailing_rank <= output_dims.size() &&
+                          std::equal(dims.begin() + first, dims.end(), output_dims.end() - trailing_rank),
+                      "FusedElementwise: input ", i, " with shape ", input->Shape(),
+                      " can't be broadcast to the output shape ", output_shape);
+    input_kinds[i] = (size == output_size) ? InputKind::Full : InputKind::Periodic;
+  }
+
+  const auto num_instructions = static_cast<int64_t>(instructions_.size());
+  const int64_t num_tiles = (output_size + kTileSize - 1) / kTileSize;
+  float* output_data = Y->MutableData<float>();
+
+  // split the tiles into one contiguous range per thread so the scratch space is allocated once per thread
+  concurrency::ThreadPool* tp = context->GetOperatorThreadPool();
+  const int64_t num_ranges = (tp == nullptr) ? 1 : std::max<int64_t>(1, std::min<int64_t>(num_tiles, tp->NumThreads()));
+
+  // scratch space for the periodic inputs and the intermediate results of one tile, per range.
+  // every element is written before it is read, so the buffer is left uninitialized.
+  const int64_t scratch_per_range = (num_inputs + num_instructions) * kTileSize;
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+  auto scratch_buffer = IAllocator::MakeUniquePtr<float>(alloc, static_cast<size_t>(num_ranges * scratch_per_range));
+
+  auto compute_tiles = [&](std::ptrdiff_t range) {
+    const int64_t first = num_tiles * range / num_ranges;
+    const int64_t last = num_tiles * (range + 1) / num_ranges;
+    float* scratch = scratch_buffer.get() + range * scratch_per_range;
+    std::vector<Operand> operands(static_cast<size_t>(num_inputs + num_instructions));
+
+    for (int64_t tile = first; tile < last; ++tile) {
+      const int64_t start = tile * kTileSize;
+      const int64_t count = std::min(kTileSize, output_size - start);
+
+      for (int i = 0; i < num_inputs; ++i) {
+        switch (input_kinds[i]) {
+          case InputKind::Full:
+            operands[i] = {input_data[i] + start, false};
+            break;
+          case InputKind::Scalar:
+            operands[i] = {input_data[i], true};
+            break;
+          case InputKind::Periodic: {
+            float* buffer = scratch + i * kTileSize;
+            const int64_t period = input_periods[i];
+            int64_t offset = start % period;
+            for (int64_t copied = 0; copied < count;) {
+              const int64_t run = std::min(period - offset, count - copied);
+              memcpy(buffer + copied, input_data[i] + offset, static_cast<size_t>(run) * sizeof(float));
+              copied += run;
+              offset = 0;
+            }
+            operands[i] = {buffer, false};
+            break;
+          }
+        }
+      }
+
+      for (int64_t n = 0; n < num_instructions; ++n) {
+        const Instruction& instruction = instructions_[n];
+        // the final result is written straight into the output
+        float* result = (n == num_instructions - 1) ? output_data + start
+                                                    : scratch + (num_inputs + n) * kTileSize;
+        const Operand& a = operands[instruction.operands[0]];
+
+        if (instruction.is_binary) {
+          const Operand& b = operands[instruction.operands[1]];
+          switch (instruction.kind) {
+            case OpKind::Add:
+              ApplyBinary(a, b, result, count, [](float x, float y) { return x + y; });
+              break;
+            case OpKind::Sub:
+              ApplyBinary(a, b, result, count, [](float x, float y) { return x - y; });
+              break;
+            case OpKind::Mul:
+              ApplyBinary(a, b, result, count, [](float x, float y) { return x * y; });
+              break;
+            case OpKind::Div:
+              ApplyBinary(a, b, result, count, [](float x, float y) { return x / y; });
+              break;
+            default:
+              ORT_THROW("Unexpected binary op in FusedElementwise");
+          }
+        } else {
+          ApplyUnary(instruction.kind, a, result, count);
+        }
+
+        operands[num_inputs + n] = {result, false};
+      }
+    }
+  };
+
+  concurrency::ThreadPool::TryBatchParallelFor(tp, static_cast<std::ptrdiff_t>(num_ranges), compute_tiles,
+                                               static_cast<std::ptrdiff_t>(num_ranges));
+
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
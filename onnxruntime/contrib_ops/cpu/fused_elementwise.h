@@ -0,0 +1,52 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/common/common.h"
+#include "core/framework/op_kernel.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+/**
+Evaluates a fused expression of elementwise operators, as produced by the ElementwiseFusion transformer.
+The expression is evaluated one cache sized tile of the output at a time, so intermediate values never leave
+the cache and each input and the output are touched exactly once.
+*/
+class FusedElementwise final : public OpKernel {
+ public:
+  explicit FusedElementwise(const OpKernelInfo& info);
+
+  Status Compute(OpKernelContext* context) const override;
+
+  enum class OpKind {
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Abs,
+    Neg,
+    Sqrt,
+    Reciprocal,
+    Exp,
+    Log,
+    Relu,
+    Sigmoid,
+    Tanh,
+    Erf,
+  };
+
+  struct Instruction {
+    OpKind kind;
+    // operand index < number of inputs refers to an input, otherwise to the result of a previous instruction.
+    int64_t operands[2];
+    bool is_binary;
+  };
+
+ private:
+  std::vector<Instruction> instructions_;
+};
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "nchwc_ops.h"
+#include "core/providers/common.h"
 #include "core/mlas/inc/mlas.h"
 
 namespace onnxruntime {
@@ -10,37 +11,60 @@ namespace contrib {
 #define ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(name, ver, type, builder, ...) \
   ONNX_OPERATOR_TYPED_KERNEL_EX(name, kMSNchwcDomain, ver, type, kCpuExecutionProvider, builder, __VA_ARGS__)
 
+#define REGISTER_NCHWC_REORDER_KERNELS(type)                           \
+  ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(                                \
+      ReorderInput,                                                    \
+      1,                                                               \
+      type,                                                            \
+      KernelDefBuilder()                                               \
+          .TypeConstraint("T", DataTypeImpl::GetTensorType<type>()),   \
+      ReorderInput<type>);                                             \
+                                                                       \
+  ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(                                \
+      ReorderOutput,                                                   \
+      1,                                                               \
+      type,                                                            \
+      KernelDefBuilder()                                               \
+          .TypeConstraint("T", DataTypeImpl::GetTensorType<type>()),   \
+      ReorderOutput<type>);
+
+REGISTER_NCHWC_REORDER_KERNELS(float)
+REGISTER_NCHWC_REORDER_KERNELS(uint8_t)
+
 ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
-    ReorderInput,
+    Conv,
     1,
     float,
     KernelDefBuilder()
+        .MayInplace(3, 0)
         .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
-    ReorderInput);
+    NchwcConv);
 
 ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
-    ReorderOutput,
+    QLinearConv,
     1,
-    float,
+    uint8_t,
     KernelDefBuilder()
-        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
-    ReorderOutput);
+        .TypeConstraint("T1", DataTypeImpl::GetTensorType<uint8_t>())
+        .TypeConstraint("T2", DataTypeImpl::GetTensorType<uint8_t>())
+        .TypeConstraint("T3", DataTypeImpl::GetTensorType<uint8_t>())
+        .TypeConstraint("T4", DataTypeImpl::GetTensorType<int32_t>()),
+    NchwcQLinearConv);
 
 ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
-    Conv,
+    MaxPool,
     1,
     float,
     KernelDefBuilder()
-        .MayInplace(3, 0)
         .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
-    NchwcConv);
+    NchwcMaxPool);
 
 ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
     MaxPool,
     1,
-    float,
+    uint8_t,
     KernelDefBuilder()
-        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<uint8_t>()),
     NchwcMaxPool);
 
 ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
@@ -75,19 +99,21 @@ ONNX_CPU_OPERATOR_TYPED_NCHWC_KERNEL(
         .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
     NchwcUpsample);
 
-Status ReorderInput::Compute(OpKernelContext* context) const {
+template <typename T>
+Status ReorderInput<T>::Compute(OpKernelContext* context) const {
   const auto* X = context->Input<Tensor>(0);
   const auto& X_shape = X->Shape();
   ORT_ENFORCE(X_shape.NumDimensions() == 4);
   ORT_ENFORCE((X_shape[1] % MlasNchwcGetBlockSize()) == 0);
 
   auto* Y = context->Output(0, X_shape);
-  MlasReorderInput(X_shape.GetDims().data(), X->template Data<float>(), Y->template MutableData<float>());
+  MlasReorderInput(X_shape.GetDims().data(), X->template Data<T>(), Y->template MutableData<T>());
 
   return Status::OK();
 }
 
-Status ReorderOutput::Compute(OpKernelContext* context) const {
+template <typename T>
+Status ReorderOutput<T>::Compute(OpKernelContext* context) const {
   const auto* X = context->Input<Tensor>(0);
   const auto& X_shape = X->Shape();
   const auto X_rank = X_shape.NumDimensions();
@@ -104,8 +130,8 @@ Status ReorderOutput::Compute(OpKernelContext* context) const {
   }
   auto* Y = context->Output(0, Y_shape);
 
-  const auto* x_data = X->template Data<float>();
-  auto* y_data = Y->template MutableData<float>();
+  const auto* x_data = X->template Data<T>();
+  auto* y_data = Y->template MutableData<T>();
   if (channels_last_) {
     MlasReorderOutputNhwc(Y_shape.data(), x_data, y_data);
   } else {
@@ -185,6 +211,82 @@ Status NchwcConv::Compute(OpKernelContext* context) const {
   return Status::OK();
 }
 
+Status NchwcQLinearConv::Compute(OpKernelContext* context) const {
+  const auto* X = context->Input<Tensor>(0);
+  const auto* W = context->Input<Tensor>(3);
+  const auto* B = context->Input<Tensor>(8);
+
+  const auto* X_scale = context->Input<Tensor>(1);
+  const auto* W_scale = context->Input<Tensor>(4);
+  const auto* Y_scale = context->Input<Tensor>(6);
+  ORT_ENFORCE(IsScalarOr1ElementVector(X_scale), "input scale must be a scalar or 1D tensor of size 1");
+  ORT_ENFORCE(IsScalarOr1ElementVector(W_scale), "filter scale must be a scalar or 1D tensor of size 1");
+  ORT_ENFORCE(IsScalarOr1ElementVector(Y_scale), "result scale must be a scalar or 1D tensor of size 1");
+
+  const auto* X_zero_point = context->Input<Tensor>(2);
+  const auto* W_zero_point = context->Input<Tensor>(5);
+  const auto* Y_zero_point = context->Input<Tensor>(7);
+  ORT_ENFORCE(IsScalarOr1ElementVector(X_zero_point), "input zero point must be a scalar or 1D tensor of size 1");
+  ORT_ENFORCE(IsScalarOr1ElementVector(W_zero_point), "filter zero point must be a scalar or 1D tensor of size 1");
+  ORT_ENFORCE(IsScalarOr1ElementVector(Y_zero_point), "result zero point must be a scalar or 1D tensor of size 1");
+
+  ORT_RETURN_IF_ERROR(conv_attrs_.ValidateInputShape(X, W));
+
+  const auto& X_shape = X->Shape();
+  const auto& W_shape = W->Shape();
+  ORT_ENFORCE(X_shape.NumDimensions() == 4);
+
+  const size_t nchwc_block_size = MlasNchwcGetBlockSize();
+  ORT_ENFORCE((static_cast<size_t>(X_shape[1]) < nchwc_block_size) || ((X_shape[1] % nchwc_block_size) == 0));
+
+  std::vector<int64_t> kernel_shape;
+  ORT_RETURN_IF_ERROR(conv_attrs_.ComputeKernelShape(W_shape, kernel_shape));
+  if (kernel_shape.size() != 2) {
+    return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT, "Unsupported convolution size.");
+  }
+
+  std::vector<int64_t> pads(conv_attrs_.pads);
+  if (pads.empty()) {
+    pads.resize(kernel_shape.size() * 2, 0);
+  }
+  std::vector<int64_t> dilations(conv_attrs_.dilations);
+  if (dilations.empty()) {
+    dilations.resize(kernel_shape.size(), 1);
+  }
+  std::vector<int64_t> strides(conv_attrs_.strides);
+  if (strides.empty()) {
+    strides.resize(kernel_shape.size(), 1);
+  }
+
+  std::vector<int64_t> Y_dims;
+  Y_dims.insert(Y_dims.begin(), {X_shape[0], W_shape[0]});
+  TensorShape input_shape = X->Shape().Slice(2);
+  ORT_RETURN_IF_ERROR(conv_attrs_.InferOutputShape(input_shape, kernel_shape, strides, dilations, &pads, &Y_dims));
+  auto* Y = context->Output(0, Y_dims);
+
+  const float real_multiplier = (*X_scale->template Data<float>() * *W_scale->template Data<float>()) /
+                                *Y_scale->template Data<float>();
+
+  MlasNchwcConv(X_shape.GetDims().data(),
+                kernel_shape.data(),
+                dilations.data(),
+                pads.data(),
+                strides.data(),
+                Y_dims.data(),
+                static_cast<size_t>(conv_attrs_.group),
+                X->template Data<uint8_t>(),
+                *X_zero_point->template Data<uint8_t>(),
+                W->template Data<uint8_t>(),
+                *W_zero_point->template Data<uint8_t>(),
+                B != nullptr ? B->template Data<int32_t>() : nullptr,
+                Y->template MutableData<uint8_t>(),
+                real_multiplier,
+                *Y_zero_point->template Data<uint8_t>(),
+                context->GetOperatorThreadPool());
+
+  return Status::OK();
+}
+
 Status NchwcPoolBase::NchwcPool(OpKernelContext* context, MLAS_POOLING_KIND kind) const {
   const auto* X = context->Input<Tensor>(0);
   const auto& X_shape = X->Shape();
@@ -195,16 +297,34 @@ Status NchwcPoolBase::NchwcPool(OpKernelContext* context, MLAS_POOLING_KIND kind
   std::vector<int64_t> output_dims = pool_attrs_.SetOutputSize(X_shape, X_shape[1], &pads);
   auto* Y = context->Output(0, output_dims);
 
-  MlasNchwcPool(kind,
-                X_shape.GetDims().data(),
-                pool_attrs_.global_pooling ? nullptr : pool_attrs_.kernel_shape.data(),
-                pool_attrs_.global_pooling ? nullptr : pool_attrs_.dilations.data(),
-                pool_attrs_.global_pooling ? nullptr : pads.data(),
-                pool_attrs_.global_pooling ? nullptr : pool_attrs_.strides.data(),
-                output_dims.data(),
-                X->template Data<float>(),
-                Y->template MutableData<float>(),
-                context->GetOperatorThreadPool());
+  const int64_t* kernel_shape = pool_attrs_.global_pooling ? nullptr : pool_attrs_.kernel_shape.data();
+  const int64_t* dilations = pool_attrs_.global_pooling ? nullptr : pool_attrs_.dilations.data();
+  const int64_t* padding = pool_attrs_.global_pooling ? nullptr : pads.data();
+  const int64_t* strides = pool_attrs_.global_pooling ? nullptr : pool_attrs_.strides.data();
+
+  if (X->IsDataType<uint8_t>()) {
+    MlasNchwcPool(kind,
+                  X_shape.GetDims().data(),
+                  kernel_shape,
+                  dilations,
+                  padding,
+                  strides,
+                  output_dims.data(),
+                  X->template Data<uint8_t>(),
+                  Y->template MutableData<uint8_t>(),
+                  context->GetOperatorThreadPool());
+  } else {
+    MlasNchwcPool(kind,
+                  X_shape.GetDims().data(),
+                  kernel_shape,
+                  dilations,
+                  padding,
+                  strides,
+                  output_dims.data(),
+                  X->template Data<float>(),
+                  Y->template MutableData<float>(),
+                  context->GetOperatorThreadPool());
+  }
 
   return Status::OK();
 }
@@ -12,6 +12,7 @@
 namespace onnxruntime {
 namespace contrib {
 
+template <typename T>
 class ReorderInput : public OpKernel {
  public:
   ReorderInput(const OpKernelInfo& info) : OpKernel(info) {
@@ -20,6 +21,7 @@ class ReorderInput : public OpKernel {
   Status Compute(OpKernelContext* context) const override;
 };
 
+template <typename T>
 class ReorderOutput : public OpKernel {
  public:
   ReorderOutput(const OpKernelInfo& info) : OpKernel(info) {
@@ -49,6 +51,17 @@ class NchwcConv : public OpKernel {
   MLAS_ACTIVATION activation_;
 };
 
+class NchwcQLinearConv : public OpKernel {
+ public:
+  NchwcQLinearConv(const OpKernelInfo& info) : OpKernel(info), conv_attrs_(info) {
+  }
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  ConvAttributes conv_attrs_;
+};
+
 class NchwcPoolBase : public PoolBase {
  public:
   NchwcPoolBase(const OpKernelInfo& info) : PoolBase(info) {
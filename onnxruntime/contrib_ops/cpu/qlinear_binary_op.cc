@@ -0,0 +1,103 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "qlinear_binary_op.h"
+#include "core/providers/common.h"
+#include "core/providers/cpu/math/element_wise_ops.h"
+
+#include <array>
+
+namespace onnxruntime {
+namespace contrib {
+
+ONNX_CPU_OPERATOR_TYPED_MS_KERNEL(
+    QLinearAdd,
+    1,
+    uint8_t,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<uint8_t>()),
+    QLinearAdd<uint8_t>);
+
+namespace {
+
+float GetQuantizationScale(OpKernelContext* context, int index) {
+  const auto* scale = context->Input<Tensor>(index);
+  ORT_ENFORCE(IsScalarOr1ElementVector(scale), "QLinearAdd : scale must be a scalar or 1D tensor of size 1");
+  return *scale->template Data<float>();
+}
+
+template <typename T>
+T GetQuantizationZeroPoint(OpKernelContext* context, int index) {
+  const auto* zero_point = context->Input<Tensor>(index);
+  if (zero_point == nullptr) {
+    return T{0};
+  }
+  ORT_ENFORCE(IsScalarOr1ElementVector(zero_point), "QLinearAdd : zero point must be a scalar or 1D tensor of size 1");
+  return *zero_point->template Data<T>();
+}
+
+}  // namespace
+
+template <typename T>
+Status QLinearAdd<T>::Compute(OpKernelContext* context) const {
+  const float A_scale = GetQuantizationScale(context, 1);
+  const float B_scale = GetQuantizationScale(context, 4);
+  const float C_scale = GetQuantizationScale(context, 6);
+  const T A_zero_point = GetQuantizationZeroPoint<T>(context, 2);
+  const T B_zero_point = GetQuantizationZeroPoint<T>(context, 5);
+  const T C_zero_point = GetQuantizationZeroPoint<T>(context, 7);
+
+  // Each input only has 256 possible values, so dequantize them to the output scale once through a lookup table.
+  // The output is then the rounded sum of two table entries offset by the output zero point.
+  constexpr int kValueCount = 1 << (8 * sizeof(T));
+  std::array<float, kValueCount> A_lookup;
+  std::array<float, kValueCount> B_lookup;
+  for (int i = 0; i < kValueCount; i++) {
+    const T value = static_cast<T>(i);
+    A_lookup[i] = A_scale * (static_cast<float>(value) - static_cast<float>(A_zero_point)) / C_scale;
+    B_lookup[i] = B_scale * (static_cast<float>(value) - static_cast<float>(B_zero_point)) / C_scale;
+  }
+
+  const float minimum_value = static_cast<float>(std::numeric_limits<T>::lowest()) - static_cast<float>(C_zero_point);
+  const float maximum_value = static_cast<float>(std::numeric_limits<T>::max()) - static_cast<float>(C_zero_point);
+
+  auto requantize = [&](float a, float b) -> T {
+    float value = std::min(std::max(a + b, minimum_value), maximum_value);
+    return static_cast<T>(static_cast<int>(std::nearbyint(value)) + static_cast<int>(C_zero_point));
+  };
+
+  auto lookup_index = [](T value) {
+    return static_cast<typename std::make_unsigned<T>::type>(value);
+  };
+
+  TBroadcaster<T, T> bc(*context->Input<Tensor>(0), *context->Input<Tensor>(3));
+  Tensor& output_tensor = *context->Output(0, bc.GetOutputShape());
+  ParallelBroadcastLoop<T>(
+      context->GetOperatorThreadPool(), bc, output_tensor,
+      [&](TBroadcaster<T, T>& chunk_bc, TBroadcastOutput<T>& output) {
+        BroadcastLoopSpan(
+            chunk_bc, output,
+            [&](gsl::span<T> out, T input0, gsl::span<const T> input1) {
+              const float a = A_lookup[lookup_index(input0)];
+              for (size_t i = 0; i < out.size(); i++) {
+                out[i] = requantize(a, B_lookup[lookup_index(input1[i])]);
+              }
+            },
+            [&](gsl::span<T> out, gsl::span<const T> input0, T input1) {
+              const float b = B_lookup[lookup_index(input1)];
+              for (size_t i = 0; i < out.size(); i++) {
+                out[i] = requantize(A_lookup[lookup_index(input0[i])], b);
+              }
+            },
+            [&](gsl::span<T> out, gsl::span<const T> input0, gsl::span<const T> input1) {
+              for (size_t i = 0; i < out.size(); i++) {
+                out[i] = requantize(A_lookup[lookup_index(input0[i])], B_lookup[lookup_index(input1[i])]);
+              }
+            });
+      });
+
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
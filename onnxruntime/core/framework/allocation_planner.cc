@@ -63,6 +63,7 @@ std::ostream& operator<<(std::ostream& out, std::pair<const SequentialExecutionP
       auto& elt_plan = plan.allocation_plan[index];
       out << elt_plan.alloc_kind;
       if (elt_plan.alloc_kind == AllocKind::kReuse) out << " " << elt_plan.reused_buffer;
+      if (elt_plan.is_strided_view) out << " (strided view)";
 
       auto& loc = elt_plan.location;
       out << ", " << loc.ToString();
@@ -134,6 +135,7 @@ class PlannerImpl {
     const onnxruntime::NodeArg* p_def_site;  // the (unique) NodeArg corresponding to the MLValue
     int usecount = 0;                        // static reference-count
     OrtValueIndex reused_buffer_index;       // index of original buffer to reuse
+    bool consumers_accept_strided = true;    // whether all consumers can read the OrtValue as a strided view
   };
 
   // ort_value_info_ is indexed by an OrtValueIndex
@@ -185,6 +187,7 @@ class PlannerImpl {
     info.usecount = 0;
     info.reused_buffer_index = id;  // initially, no reuse; the ml-value uses its own buffer
     info.p_def_site = p_def_site;
+    info.consumers_accept_strided = true;
   }
 
   // Reuse/Alias/Share between two OrtValue indexes
@@ -235,7 +238,8 @@ class PlannerImpl {
           if (p_input_arg->Exists()) {
             auto input_arg_index = Index(p_input_arg->Name());
             auto original = Buffer(input_arg_index);
-            if (1 == UseCount(original)) {
+            // a strided view may broadcast elements of its buffer, so it can't be updated in-place
+            if (1 == UseCount(original) && !AllocPlan(input_arg_index).is_strided_view) {
               if (SameSize(*p_input_arg, *p_output_arg)) {
                 // we can reuse this input since it is its last use and permitted for in-place update
                 *reusable_input = input_arg_index;  // or original; both should be okay
@@ -249,6 +253,42 @@ class PlannerImpl {
     return false;
   }
 
+  // Find if output_arg can be produced as a strided view over one of the node's inputs. This is only done if
+  // the kernel supports it and every consumer of the output can read a strided view.
+  bool FindStridedViewInput(const onnxruntime::Node& node, int output_arg_num, OrtValueIndex* viewed_input) {
+    auto p_output_arg = node.OutputDefs()[output_arg_num];
+    if (!ort_value_info_[Index(p_output_arg->Name())].consumers_accept_strided) {
+      return false;
+    }
+
+    const KernelCreateInfo* ci;
+    Status st = kernel_registry_.SearchKernelRegistry(node, &ci);
+    if (!st.IsOK() || ci == nullptr || ci->kernel_def == nullptr) {
+      return false;
+    }
+
+    auto input_args = node.InputDefs();
+    for (auto pair : ci->kernel_def->MayStridedOutput()) {
+      if (pair.second == output_arg_num &&
+          (0 <= pair.first) && (static_cast<size_t>(pair.first) < input_args.size())) {
+        auto p_input_arg = input_args[pair.first];
+        if (!p_input_arg->Exists() || IsNonTensor(*p_input_arg)) {
+          continue;
+        }
+
+        auto input_arg_index = Index(p_input_arg->Name());
+        const auto& input_plan = AllocPlan(input_arg_index);
+        if (input_plan.is_strided_view || input_plan.location != AllocPlan(p_output_arg->Name()).location) {
+          continue;
+        }
+
+        *viewed_input = input_arg_index;
+        return true;
+      }
+    }
+    return false;
+  }
+
   static bool SameShape(const TensorShapeProto& shape1, const TensorShapeProto& shape2) {
     // TODO: This should probably be defined to be the equality operator on TensorShapeProto.
     namespace on = ONNX_NAMESPACE;
@@ -419,6 +459,11 @@ class PlannerImpl {
         const auto& name = input.Name();
         UseCount(name)++;
 
+        // implicit inputs are consumed by subgraphs, which may use them with any kernel
+        if (is_implicit_input || !p_kernel_def->MayStridedInput(arg_idx)) {
+          ort_value_info_[Index(name)].consumers_accept_strided = false;
+        }
+
         // If it's a graph input or outer scope node arg, set its plan.
         // NOTE: Copy nodes should have already been added if a graph input is fed as input
         // to nodes assigned to different providers.
@@ -471,6 +516,7 @@ class PlannerImpl {
 
     for (auto graph_output : graph_viewer_.GetOutputs()) {
       UseCount(graph_output->Name())++;  // Models caller's usage post-inference; ensures it will not be reused.
+      ort_value_info_[Index(graph_output->Name())].consumers_accept_strided = false;
     }
 
     return Status::OK();
@@ -582,6 +628,11 @@ class PlannerImpl {
         } else if (IsNonTensor(*node_output)) {
           // we do not try sharing-optimization for non-tensors
           AllocPlan(current).alloc_kind = AllocKind::kAllocate;
+        } else if (FindStridedViewInput(*pnode, output_arg_num, &reused)) {
+          // Expose the output as a strided view over one of this node's input buffers. The input buffer
+          // is kept alive by Reuse() until all consumers of the view have run.
+          Reuse(reused, current, AllocKind::kReuse);
+          AllocPlan(current).is_strided_view = true;
         } else if (FindReusableInput(*pnode, output_arg_num, &reused)) {
           // Reuse one of this node's input buffers as the output buffer (for in-place update)
           Reuse(reused, current, AllocKind::kReuse);
@@ -207,11 +207,20 @@ ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const
 
     //if there are some traditional ml value type in inputs disable the memory pattern optimization.
     if (all_tensors) {
-      mem_patterns_ = session_state.GetMemoryPatternGroup(input_shapes);
-      // if no existing patterns, generate one in this executionframe
-      if (!mem_patterns_) {
+      bool is_validated = true;
+      mem_patterns_ = session_state.GetMemoryPatternGroup(input_shapes, &is_validated);
+      if (!mem_patterns_ && GenerateSymbolicPatterns(feed_mlvalue_idxs, feeds, input_shapes)) {
+        mem_patterns_ = session_state.GetMemoryPatternGroup(input_shapes, &is_validated);
+      }
+
+      // if no existing patterns, generate one in this executionframe.
+      // a pattern generated from the symbolic shapes is traced as well, so that it can be replaced by the trace
+      // if this run finds it wrong.
+      if (!mem_patterns_ || !is_validated) {
         planner_ = onnxruntime::make_unique<OrtValuePatternPlanner>(*session_state.GetExecutionPlan());
-      } else {
+      }
+
+      if (mem_patterns_) {
         // pre-allocate the big chunk requested in memory pattern.
         // all the internal kernel's input/output tensors will be allocated on these buffer.
         for (size_t i = 0; i < mem_patterns_->locations.size(); i++) {
@@ -283,6 +292,7 @@ Status ExecutionFrame::AllocateMLValueTensorSelfOwnBufferHelper(OrtValue& ort_va
           auto status = AllocateTensorWithPreAllocateBufferHelper(
               ort_value, static_cast<void*>(static_cast<char*>(buffer) + block->offset_), element_type, location,
               shape);
+          TraceAllocate(ort_value_index, size);
           return status;
         }
         if (block->size_ != size) {
@@ -302,6 +312,11 @@ Status ExecutionFrame::AllocateMLValueTensorSelfOwnBufferHelper(OrtValue& ort_va
     }
   }
   //no memory pattern, or the pattern is not correct.
+  if (mem_patterns_ && per_alloc_plan.alloc_kind != AllocKind::kAllocateOutput &&
+      !utils::IsDataTypeString(element_type)) {
+    mem_pattern_mismatch_ = true;
+  }
+
   std::unique_ptr<Tensor> p_tensor = onnxruntime::make_unique<Tensor>(element_type, shape, alloc);
 
   {
@@ -321,15 +336,17 @@ Status ExecutionFrame::AllocateMLValueTensorSelfOwnBufferHelper(OrtValue& ort_va
 
 Status ExecutionFrame::AllocateMLValueTensorPreAllocateBuffer(OrtValue& ort_value, int ort_value_index_reuse,
                                                               MLDataType element_type, const OrtMemoryInfo& location,
-                                                              const TensorShape& shape, bool create_fence) {
+                                                              const TensorShape& shape, bool create_fence,
+                                                              bool is_strided_view) {
   OrtValue& ort_value_reuse = GetMutableMLValue(ort_value_index_reuse);
 
   auto* reuse_tensor = ort_value_reuse.GetMutable<Tensor>();
   auto buffer_num_elements = reuse_tensor->Shape().Size();
   auto required_num_elements = shape.Size();
 
-  // check number of elements matches. shape may not be an exact match (e.g. Reshape op)
-  if (buffer_num_elements != required_num_elements) {
+  // check number of elements matches. shape may not be an exact match (e.g. Reshape op).
+  // a strided view (e.g. the output of Expand) can address more elements than its buffer holds, so skip the check.
+  if (!is_strided_view && buffer_num_elements != required_num_elements) {
     // could be an allocation planner bug (less likely) or the model incorrectly uses something like 'None'
     // as a dim_param, or -1 in dim_value in multiple places making the planner think those shapes are equal.
     auto message = onnxruntime::MakeString(
@@ -449,7 +466,8 @@ Status ExecutionFrame::AllocateAsPerAllocationPlan(OrtValue& ort_value, int ort_
       case AllocKind::kReuse: {
         int reuse_mlvalue_index = per_alloc_plan.reused_buffer;
         ORT_RETURN_IF_ERROR(AllocateMLValueTensorPreAllocateBuffer(
-            ort_value, reuse_mlvalue_index, ml_data_type, alloc_info, *shape, per_alloc_plan.create_fence_if_async));
+            ort_value, reuse_mlvalue_index, ml_data_type, alloc_info, *shape, per_alloc_plan.create_fence_if_async,
+            per_alloc_plan.is_strided_view));
         break;
       }
       case AllocKind::kShare: {
@@ -536,6 +554,82 @@ void ExecutionFrame::TraceFree(int ort_value_idx) {
   }
 }
 
+// replay the allocations and frees of the execution plan with sizes computed from the symbolic shapes
+bool ExecutionFrame::GenerateSymbolicPatterns(
+    const std::vector<int>& feed_mlvalue_idxs, const std::vector<OrtValue>& feeds,
+    const std::vector<std::reference_wrapper<const TensorShape>>& input_shapes) const {
+  const SymbolicShapeInference* symbolic_shapes = session_state_.GetSymbolicShapes();
+  const SequentialExecutionPlan* p_seq_exec_plan = session_state_.GetExecutionPlan();
+  const GraphViewer* graph_viewer = session_state_.GetGraphViewer();
+  if (symbolic_shapes == nullptr || p_seq_exec_plan == nullptr || graph_viewer == nullptr) {
+    return false;
+  }
+
+  const auto& name_idx_map = session_state_.GetOrtValueNameIdxMap();
+  std::vector<const std::string*> names(name_idx_map.MaxIdx() + 1, nullptr);
+  for (const auto& entry : name_idx_map) {
+    names[entry.second] = &entry.first;
+  }
+
+  // feeds that are not graph inputs (e.g. outer scope values of a subgraph) don't define symbols
+  SymbolBindings bindings;
+  for (size_t i = 0, end = feeds.size(); i < end; ++i) {
+    const std::string& name = *names[feed_mlvalue_idxs[i]];
+    if (symbolic_shapes->GetShape(name) != nullptr &&
+        !symbolic_shapes->BindInputShape(name, input_shapes[i].get().GetDims(), bindings)) {
+      return false;
+    }
+  }
+  symbolic_shapes->ResolveDerivedSymbols(bindings);
+
+  OrtValuePatternPlanner planner(*p_seq_exec_plan);
+  const auto& alloc_plan = p_seq_exec_plan->allocation_plan;
+  for (const auto& node_exec_plan : p_seq_exec_plan->execution_plan) {
+    const Node* node = graph_viewer->GetNode(node_exec_plan.node_index);
+    if (node == nullptr) {
+      return false;
+    }
+
+    for (const auto* output : node->OutputDefs()) {
+      int ort_value_idx;
+      if (!output->Exists() || !name_idx_map.GetIdx(output->Name(), ort_value_idx).IsOK()) {
+        continue;
+      }
+
+      // only values that get their own buffer are traced, as in TraceAllocate
+      const auto& per_alloc_plan = alloc_plan[ort_value_idx];
+      if (per_alloc_plan.alloc_kind != AllocKind::kAllocate || per_alloc_plan.value_type == nullptr ||
+          !per_alloc_plan.value_type->IsTensorType()) {
+        continue;
+      }
+      auto element_type = static_cast<const TensorTypeBase*>(per_alloc_plan.value_type)->GetElementType();
+      if (utils::IsDataTypeString(element_type)) {
+        continue;
+      }
+
+      std::vector<int64_t> dims;
+      size_t size;
+      if (!symbolic_shapes->EvaluateShape(output->Name(), bindings, dims) ||
+          !IAllocator::CalcMemSizeForArrayWithAlignment<64>(static_cast<size_t>(TensorShape(dims).Size()),
+                                                            element_type->Size(), &size) ||
+          !planner.TraceAllocation(ort_value_idx, size).IsOK()) {
+        return false;
+      }
+    }
+
+    for (int i = node_exec_plan.free_from_index; i <= node_exec_plan.free_to_index; ++i) {
+      auto ort_value_idx = p_seq_exec_plan->to_be_freed[i];
+      if (!IsOutput(ort_value_idx)) {
+        ORT_IGNORE_RETURN_VALUE(planner.TraceFree(ort_value_idx));
+      }
+    }
+  }
+
+  auto mem_patterns = onnxruntime::make_unique<MemoryPatternGroup>();
+  return planner.GeneratePatterns(mem_patterns.get()).IsOK() &&
+         session_state_.AddSymbolicMemoryPatternGroup(input_shapes, std::move(mem_patterns)).IsOK();
+}
+
 // generate memory pattern based on the tracing of memory allocation/free in current execution
 // return error if the planner is not setup.
 Status ExecutionFrame::GeneratePatterns(MemoryPatternGroup* out) const {
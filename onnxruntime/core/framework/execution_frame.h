@@ -116,7 +116,7 @@ class ExecutionFrame final : public IExecutionFrame {
 
   Status AllocateMLValueTensorPreAllocateBuffer(OrtValue& ort_value, int ort_value_index_reuse, MLDataType element_type,
                                                 const OrtMemoryInfo& location, const TensorShape& shape,
-                                                bool create_fence = false);
+                                                bool create_fence = false, bool is_strided_view = false);
 
   // thread-safe
   Status GeneratePatterns(MemoryPatternGroup* out) const;
@@ -125,6 +125,11 @@ class ExecutionFrame final : public IExecutionFrame {
     return planner_ != nullptr;
   }
 
+  // Returns true if a value that should have been allocated from the cached memory pattern was not.
+  bool HasMemoryPatternMismatch() const {
+    return mem_pattern_mismatch_;
+  }
+
  private:
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ExecutionFrame);
 
@@ -145,6 +150,11 @@ class ExecutionFrame final : public IExecutionFrame {
   void TraceAllocate(int ort_value_idx, size_t size);
   void TraceFree(int ort_value_idx);
 
+  // Computes the memory pattern for the shapes of 'feeds' from the symbolic shapes of the graph, and adds it to the
+  // SessionState cache. Returns false if any allocated value has a shape that can't be computed.
+  bool GenerateSymbolicPatterns(const std::vector<int>& feed_mlvalue_idxs, const std::vector<OrtValue>& feeds,
+                                const std::vector<std::reference_wrapper<const TensorShape>>& input_shapes) const;
+
   const AllocPlanPerValue& GetAllocationPlan(int ort_value_idx);
 
   const SessionState& session_state_;
@@ -159,8 +169,12 @@ class ExecutionFrame final : public IExecutionFrame {
 
   // If no cached memory pattern, and we enable the memory pattern optimization
   // use this planner_ to trace the memory allocation in current executor.
+  // Also used if the cached memory pattern was generated from the symbolic shapes and still has to be validated.
   std::unique_ptr<OrtValuePatternPlanner> planner_;
 
+  // Set if a value fell back to the default allocation although mem_patterns_ is used.
+  bool mem_pattern_mismatch_{false};
+
   // Big chunks on different locations that will be used by mem_pattern.
   std::map<OrtMemoryInfo, BufferUniquePtr> buffers_;
 };
@@ -13,7 +13,7 @@ class MiMallocArena : public IArenaAllocator {
     void Free(void* p) override;
 
     // mimalloc only maintains stats when compiled under debug, or when MI_STAT >= 2
-    void GetStats(AllocatorStats* stats);
+    void GetStats(AllocatorStats* stats) override;
 
     void* Reserve(size_t size) override;
 
@@ -96,7 +96,8 @@ Status ParallelExecutor::Execute(const SessionState& session_state, const std::v
     if (all_tensors) {
       auto mem_patterns = onnxruntime::make_unique<MemoryPatternGroup>();
       ORT_RETURN_IF_ERROR(root_frame_->GeneratePatterns(mem_patterns.get()));
-      ORT_RETURN_IF_ERROR(session_state.UpdateMemoryPatternGroupCache(input_shapes, std::move(mem_patterns)));
+      ORT_RETURN_IF_ERROR(session_state.UpdateMemoryPatternGroupCache(input_shapes, std::move(mem_patterns),
+                                                                      root_frame_->HasMemoryPatternMismatch()));
     }
   }
 
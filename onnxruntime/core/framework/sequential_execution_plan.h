@@ -31,6 +31,9 @@ struct AllocPlanPerValue {
   // if the value is used in async kernel, a fence object would be created
   // note the fence object would be shared between MLValues reusing the same buffer
   bool create_fence_if_async{false};
+  // if true, alloc_kind is kReuse and the producing kernel exposes the OrtValue as a (possibly non-contiguous)
+  // strided view over reused_buffer. all consumers of the OrtValue accept strided inputs.
+  bool is_strided_view{false};
 
  public:
   AllocPlanPerValue() : location(CPU, Invalid) {}
@@ -269,7 +269,8 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
     if (all_tensors) {
       auto mem_patterns = onnxruntime::make_unique<MemoryPatternGroup>();
       ORT_RETURN_IF_ERROR(frame.GeneratePatterns(mem_patterns.get()));
-      ORT_RETURN_IF_ERROR(session_state.UpdateMemoryPatternGroupCache(input_shapes, std::move(mem_patterns)));
+      ORT_RETURN_IF_ERROR(session_state.UpdateMemoryPatternGroupCache(input_shapes, std::move(mem_patterns),
+                                                                      frame.HasMemoryPatternMismatch()));
     }
   }
 
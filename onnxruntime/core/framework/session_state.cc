@@ -157,17 +157,49 @@ static int64_t CalculateMemoryPatternsKey(const std::vector<std::reference_wrapp
 }
 
 const MemoryPatternGroup* SessionState::GetMemoryPatternGroup(
-    const std::vector<std::reference_wrapper<const TensorShape>>& input_shapes) const {
+    const std::vector<std::reference_wrapper<const TensorShape>>& input_shapes, bool* is_validated) const {
   int64_t key = CalculateMemoryPatternsKey(input_shapes);
 
   std::lock_guard<OrtMutex> lock(mem_patterns_lock_);
   auto it = mem_patterns_.find(key);
   if (it == mem_patterns_.end()) return nullptr;
 
+  if (is_validated) {
+    auto symbolic = symbolic_mem_patterns_.find(key);
+    *is_validated = symbolic == symbolic_mem_patterns_.end() || symbolic->second;
+  }
+
   return it->second.get();
 }
 
 Status SessionState::UpdateMemoryPatternGroupCache(
+    const std::vector<std::reference_wrapper<const TensorShape>>& input_shapes,
+    std::unique_ptr<MemoryPatternGroup> mem_patterns, bool pattern_mismatch) const {
+  int64_t key = CalculateMemoryPatternsKey(input_shapes);
+
+  std::lock_guard<OrtMutex> lock(mem_patterns_lock_);
+  auto it = mem_patterns_.find(key);
+  if (it == mem_patterns_.end()) {
+    mem_patterns_[key] = std::move(mem_patterns);
+    return Status::OK();
+  }
+
+  // the first run that used a symbolic pattern either validates it or replaces it with its trace
+  auto symbolic = symbolic_mem_patterns_.find(key);
+  if (symbolic != symbolic_mem_patterns_.end() && !symbolic->second) {
+    if (pattern_mismatch) {
+      replaced_mem_patterns_.push_back(std::move(it->second));
+      it->second = std::move(mem_patterns);
+      symbolic_mem_patterns_.erase(symbolic);
+    } else {
+      symbolic->second = true;
+    }
+  }
+
+  return Status::OK();
+}
+
+Status SessionState::AddSymbolicMemoryPatternGroup(
     const std::vector<std::reference_wrapper<const TensorShape>>& input_shapes,
     std::unique_ptr<MemoryPatternGroup> mem_patterns) const {
   int64_t key = CalculateMemoryPatternsKey(input_shapes);
@@ -176,13 +208,29 @@ Status SessionState::UpdateMemoryPatternGroupCache(
   auto it = mem_patterns_.find(key);
   if (it == mem_patterns_.end()) {
     mem_patterns_[key] = std::move(mem_patterns);
+    symbolic_mem_patterns_[key] = false;
   }
 
   return Status::OK();
 }
 
+bool SessionState::IsValidatedSymbolicMemoryPatternGroup(
+    const std::vector<std::reference_wrapper<const TensorShape>>& input_shapes) const {
+  int64_t key = CalculateMemoryPatternsKey(input_shapes);
+
+  std::lock_guard<OrtMutex> lock(mem_patterns_lock_);
+  auto symbolic = symbolic_mem_patterns_.find(key);
+  return symbolic != symbolic_mem_patterns_.end() && symbolic->second;
+}
+
 bool SessionState::GetEnableMemoryPattern() const { return enable_mem_pattern_; }
 
+void SessionState::SetSymbolicShapes(std::unique_ptr<SymbolicShapeInference> symbolic_shapes) {
+  symbolic_shapes_ = std::move(symbolic_shapes);
+}
+
+const SymbolicShapeInference* SessionState::GetSymbolicShapes() const { return symbolic_shapes_.get(); }
+
 common::Status SessionState::AddInputNameToNodeInfoMapping(const std::string& input_name, const NodeInfo& node_info) {
   // Graph partitioning should ensure an input is only consumed from one device. Copy nodes should have been inserted
   // to handle a scenario where an input is required on different devices by different nodes. Validate that.
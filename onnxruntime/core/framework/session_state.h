@@ -23,6 +23,7 @@
 #include "core/framework/ort_value_name_idx_map.h"
 #include "core/framework/node_index_info.h"
 #include "core/graph/graph_viewer.h"
+#include "core/graph/symbolic_shape_inference.h"
 #include "core/framework/fuse_nodes_funcs.h"
 #include "core/platform/threadpool.h"
 #include "core/platform/ort_mutex.h"
@@ -142,23 +143,54 @@ class SessionState {
   profiling::Profiler& Profiler() const;
 
   /**
-  Get cached memory pattern based on input shapes
+  Get cached memory pattern based on input shapes.
+  If is_validated is given, it is set to false for a pattern generated from the symbolic shapes that no run has
+  checked yet, and to true otherwise.
   */
   const MemoryPatternGroup* GetMemoryPatternGroup(
-      const std::vector<std::reference_wrapper<const TensorShape>>& input_shapes) const;
+      const std::vector<std::reference_wrapper<const TensorShape>>& input_shapes,
+      bool* is_validated = nullptr) const;
 
   /**
   Set generated memory pattern with a given input shapes.
+  If the cached pattern for the input shapes was generated from the symbolic shapes and not checked yet,
+  mem_patterns is the trace of a run that used it. That run validates the cached pattern, unless it had to allocate
+  a value outside of it (pattern_mismatch), in which case mem_patterns replaces the cached pattern.
   Const as it's an internal cache update only.
   */
   Status UpdateMemoryPatternGroupCache(const std::vector<std::reference_wrapper<const TensorShape>>& input_shape,
+                                       std::unique_ptr<MemoryPatternGroup> mem_patterns,
+                                       bool pattern_mismatch = false) const;
+
+  /**
+  Add a memory pattern generated from the symbolic shapes for the given input shapes, to be validated by the first
+  run that uses it. Const as it's an internal cache update only.
+  */
+  Status AddSymbolicMemoryPatternGroup(const std::vector<std::reference_wrapper<const TensorShape>>& input_shapes,
                                        std::unique_ptr<MemoryPatternGroup> mem_patterns) const;
 
+  /**
+  Returns true if the cached memory pattern for the input shapes was generated from the symbolic shapes and a run
+  has validated it.
+  */
+  bool IsValidatedSymbolicMemoryPatternGroup(
+      const std::vector<std::reference_wrapper<const TensorShape>>& input_shapes) const;
+
   /**
   Get enable memory pattern flag
   */
   bool GetEnableMemoryPattern() const;
 
+  /**
+  Set the symbolic shapes of the graph, used to compute memory patterns for new input shapes without tracing a run.
+  */
+  void SetSymbolicShapes(std::unique_ptr<SymbolicShapeInference> symbolic_shapes);
+
+  /**
+  Get the symbolic shapes of the graph. Returns nullptr if they were not inferred.
+  */
+  const SymbolicShapeInference* GetSymbolicShapes() const;
+
   struct NodeInfo {
     /**
      *
@@ -248,6 +280,13 @@ class SessionState {
   mutable OrtMutex mem_patterns_lock_;
   // cache for the generated mem_patterns. key is calculated based on input shapes.
   mutable std::map<int64_t, std::unique_ptr<MemoryPatternGroup>> mem_patterns_;
+  // keys of the mem_patterns_ generated from the symbolic shapes, mapped to whether a run has validated them
+  mutable std::map<int64_t, bool> symbolic_mem_patterns_;
+  // symbolic mem_patterns_ replaced by the trace of the run that failed to validate them. kept alive as concurrent
+  // runs may still be using them.
+  mutable std::vector<std::unique_ptr<MemoryPatternGroup>> replaced_mem_patterns_;
+  // symbolic shapes of all values, used to generate mem_patterns_ for input shapes that have not been run yet
+  std::unique_ptr<SymbolicShapeInference> symbolic_shapes_;
 
   NameNodeInfoMapType input_names_to_nodeinfo_mapping_;
   NameNodeInfoMapType output_names_to_nodeinfo_mapping_;
@@ -84,6 +84,13 @@ common::Status SessionStateInitializer::CreatePlan(
                                                     ort_value_name_idx_map, context, exec_plan));
   session_state_.SetExecutionPlan(std::move(exec_plan));
 
+  // infer the symbolic shapes so memory patterns can be computed for new input shapes before they are run
+  if (enable_mem_pattern_) {
+    auto symbolic_shapes = onnxruntime::make_unique<SymbolicShapeInference>(graph_);
+    symbolic_shapes->Run();
+    session_state_.SetSymbolicShapes(std::move(symbolic_shapes));
+  }
+
   const auto* exec_plan_ptr = session_state_.GetExecutionPlan();
   ORT_ENFORCE(exec_plan_ptr, "Execution plan was not found in SessionState. CreatePlan must be called first.");
 
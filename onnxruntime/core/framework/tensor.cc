@@ -47,6 +47,45 @@ size_t Tensor::SizeInBytes() const {
   return ret;
 }
 
+std::vector<int64_t> Tensor::Strides() const {
+  if (!strides_.empty()) {
+    return strides_;
+  }
+
+  const auto& dims = shape_.GetDims();
+  std::vector<int64_t> strides(dims.size());
+  int64_t running_size = 1;
+  for (size_t i = dims.size(); i-- > 0;) {
+    strides[i] = running_size;
+    running_size *= dims[i];
+  }
+  return strides;
+}
+
+void Tensor::SetShapeAndStrides(const TensorShape& new_shape, const std::vector<int64_t>& new_strides) {
+  const auto& dims = new_shape.GetDims();
+  ORT_ENFORCE(dims.size() == new_strides.size(),
+              "Rank of strides (", new_strides.size(), ") != rank of shape (", dims.size(), ")");
+
+  // dimensions of size 1 can have any stride without changing the layout
+  bool is_contiguous = true;
+  int64_t running_size = 1;
+  for (size_t i = dims.size(); i-- > 0;) {
+    if (dims[i] != 1 && new_strides[i] != running_size) {
+      is_contiguous = false;
+      break;
+    }
+    running_size *= dims[i];
+  }
+
+  shape_ = new_shape;
+  if (is_contiguous) {
+    strides_.clear();
+  } else {
+    strides_ = new_strides;
+  }
+}
+
 void Tensor::Init(MLDataType p_type, const TensorShape& shape, void* p_raw_data, AllocatorPtr deleter, ptrdiff_t offset) {
   int64_t shape_size = shape.Size();
   if (shape_size < 0) ORT_THROW("shape.Size() must >=0");
@@ -54,6 +93,7 @@ void Tensor::Init(MLDataType p_type, const TensorShape& shape, void* p_raw_data,
   ORT_ENFORCE(dtype_ != nullptr, "Tensor is expected to contain one of the primitive data types. Got: ",
               DataTypeImpl::ToString(p_type));
   shape_ = shape;
+  strides_.clear();
   p_data_ = p_raw_data;
   // if caller passed in a deleter, that means this tensor own this buffer
   // we will release the buffer when this tensor is deconstructed.
@@ -73,11 +113,13 @@ Tensor::Tensor(Tensor&& other) noexcept
     : p_data_(other.p_data_),
       buffer_deleter_(other.buffer_deleter_),
       shape_(other.shape_),
+      strides_(std::move(other.strides_)),
       dtype_(other.dtype_),
       alloc_info_(other.alloc_info_),
       byte_offset_(other.byte_offset_) {
   other.dtype_ = DataTypeImpl::GetType<float>()->AsPrimitiveDataType();
   other.shape_ = TensorShape(std::vector<int64_t>(1, 0));
+  other.strides_.clear();
   other.p_data_ = nullptr;
   other.buffer_deleter_ = nullptr;
   other.byte_offset_ = 0;
@@ -89,6 +131,7 @@ Tensor& Tensor::operator=(Tensor&& other) noexcept {
 
     dtype_ = other.dtype_;
     shape_ = other.shape_;
+    strides_ = std::move(other.strides_);
     alloc_info_ = other.alloc_info_;
     byte_offset_ = other.byte_offset_;
     p_data_ = other.p_data_;
@@ -96,6 +139,7 @@ Tensor& Tensor::operator=(Tensor&& other) noexcept {
 
     other.dtype_ = DataTypeImpl::GetType<float>()->AsPrimitiveDataType();
     other.shape_ = TensorShape(std::vector<int64_t>(1, 0));
+    other.strides_.clear();
     other.p_data_ = nullptr;
     other.byte_offset_ = 0;
     other.buffer_deleter_ = nullptr;
@@ -2324,6 +2324,41 @@ It's an extension of Gelu. It takes the sum of input A and bias input B as the i
           "Constrain input and output types to float tensors.")
       .TypeAndShapeInferenceFunction(ONNX_NAMESPACE::propagateShapeAndTypeFromFirstInput);
 
+  static const char* FusedElementwise_ver1_doc = R"DOC(
+Evaluates an expression of elementwise operators as a single operator. The expression is a list of
+instructions given by 'ops' and 'operands'. Instruction i applies ops[i] to operands[2*i] and, for binary
+operators, operands[2*i+1]. An operand index less than the number of inputs refers to that input, otherwise it
+refers to the result of instruction (index - number of inputs). The output is the result of the last instruction.
+Every input must either be a scalar, or have a shape that matches the trailing dimensions of the output.
+Supported operators are Add, Sub, Mul, Div, Abs, Neg, Sqrt, Reciprocal, Exp, Log, Relu, Sigmoid, Tanh and Erf.)DOC";
+
+  ONNX_CONTRIB_OPERATOR_SCHEMA(FusedElementwise)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .SetSupportLevel(OpSchema::SupportType::EXPERIMENTAL)
+      .SetDoc(FusedElementwise_ver1_doc)
+      .Attr("ops", "The operator of each instruction.", AttributeProto::STRINGS)
+      .Attr("operands", "Two operand indices per instruction. Unused operands of unary operators are -1.",
+            AttributeProto::INTS)
+      .Input(0, "inputs", "The inputs of the expression.", "T", OpSchema::Variadic)
+      .Output(0, "Y", "The result of the expression.", "T")
+      .TypeConstraint(
+          "T",
+          {"tensor(float)"},
+          "Constrain input and output types to float tensors.")
+      .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+        propagateElemTypeFromInputToOutput(ctx, 0, 0);
+        std::vector<const TensorShapeProto*> shapes;
+        for (size_t i = 0; i < ctx.getNumInputs(); ++i) {
+          if (!hasInputShape(ctx, static_cast<int>(i))) {
+            return;
+          }
+          shapes.push_back(&ctx.getInputType(i)->tensor_type().shape());
+        }
+        multidirectionalBroadcastShapeInference(
+            shapes, *ctx.getOutputType(0)->mutable_tensor_type()->mutable_shape());
+      });
+
   RegisterBertSchemas();
 
 }
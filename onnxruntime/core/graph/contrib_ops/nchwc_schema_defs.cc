@@ -35,7 +35,6 @@ void NchwcPoolOpSchemaGenerator(OpSchema& schema) {
   schema.Attr("ceil_mode", "", AttributeProto::INT, static_cast<int64_t>(0));
   schema.Input(0, "X", "", "T");
   schema.Output(0, "Y", "", "T");
-  schema.TypeConstraint("T", {"tensor(float)"}, "Constrain input and output types to float tensors");
   schema.TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
     ONNX_NAMESPACE::propagateElemTypeFromInputToOutput(ctx, 0, 0);
     ONNX_NAMESPACE::convPoolShapeInference(ctx, true, true, 0, 1);
@@ -61,7 +60,7 @@ void RegisterNchwcSchemas() {
       .SetDoc(R"DOC(For internal use.)DOC")
       .Input(0, "X", "", "T")
       .Output(0, "Y", "", "T")
-      .TypeConstraint("T", {"tensor(float)"}, "Constrain input and output types to float tensors")
+      .TypeConstraint("T", {"tensor(float)", "tensor(uint8)"}, "Constrain input and output types to float or uint8 tensors")
       .TypeAndShapeInferenceFunction(ONNX_NAMESPACE::propagateShapeAndTypeFromFirstInput);
 
   ONNX_CONTRIB_OPERATOR_SCHEMA(ReorderOutput)
@@ -72,7 +71,7 @@ void RegisterNchwcSchemas() {
       .Attr("channels_last", "", AttributeProto::INT, static_cast<int64_t>(0))
       .Input(0, "X", "", "T")
       .Output(0, "Y", "", "T")
-      .TypeConstraint("T", {"tensor(float)"}, "Constrain input and output types to float tensors")
+      .TypeConstraint("T", {"tensor(float)", "tensor(uint8)"}, "Constrain input and output types to float or uint8 tensors")
       .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
         propagateElemTypeFromInputToOutput(ctx, 0, 0);
         if (!hasNInputShapes(ctx, 1)) {
@@ -134,13 +133,44 @@ void RegisterNchwcSchemas() {
         ONNX_NAMESPACE::convPoolShapeInference(ctx, true, false, 0, 1);
       });
 
+  ONNX_CONTRIB_OPERATOR_SCHEMA(QLinearConv)
+      .SetDomain(kMSNchwcDomain)
+      .SinceVersion(1)
+      .SetDoc(R"DOC(For internal use.)DOC")
+      .Attr("auto_pad", "", AttributeProto::STRING, std::string("NOTSET"))
+      .Attr("kernel_shape", "", AttributeProto::INTS, OPTIONAL_VALUE)
+      .Attr("dilations", "", AttributeProto::INTS, OPTIONAL_VALUE)
+      .Attr("strides", "", AttributeProto::INTS, OPTIONAL_VALUE)
+      .Attr("pads", "", AttributeProto::INTS, OPTIONAL_VALUE)
+      .Attr("group", "", AttributeProto::INT, static_cast<int64_t>(1))
+      .Input(0, "x", "", "T1")
+      .Input(1, "x_scale", "", "tensor(float)")
+      .Input(2, "x_zero_point", "", "T1")
+      .Input(3, "w", "", "T2")
+      .Input(4, "w_scale", "", "tensor(float)")
+      .Input(5, "w_zero_point", "", "T2")
+      .Input(6, "y_scale", "", "tensor(float)")
+      .Input(7, "y_zero_point", "", "T3")
+      .Input(8, "B", "", "T4", OpSchema::Optional)
+      .Output(0, "y", "", "T3")
+      .TypeConstraint("T1", {"tensor(uint8)"}, "Constrain input type to uint8 tensors")
+      .TypeConstraint("T2", {"tensor(uint8)"}, "Constrain filter type to uint8 tensors")
+      .TypeConstraint("T3", {"tensor(uint8)"}, "Constrain output type to uint8 tensors")
+      .TypeConstraint("T4", {"tensor(int32)"}, "Constrain bias type to int32 tensors")
+      .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+        ONNX_NAMESPACE::propagateElemTypeFromInputToOutput(ctx, 7, 0);
+        ONNX_NAMESPACE::convPoolShapeInference(ctx, true, false, 0, 3);
+      });
+
   ONNX_CONTRIB_OPERATOR_SCHEMA(MaxPool)
       .FillUsing(NchwcPoolOpSchemaGenerator)
-      .Attr("storage_order", "", AttributeProto::INT, static_cast<int64_t>(0));
+      .Attr("storage_order", "", AttributeProto::INT, static_cast<int64_t>(0))
+      .TypeConstraint("T", {"tensor(float)", "tensor(uint8)"}, "Constrain input and output types to float or uint8 tensors");
 
   ONNX_CONTRIB_OPERATOR_SCHEMA(AveragePool)
       .FillUsing(NchwcPoolOpSchemaGenerator)
-      .Attr("count_include_pad", "", AttributeProto::INT, static_cast<int64_t>(0));
+      .Attr("count_include_pad", "", AttributeProto::INT, static_cast<int64_t>(0))
+      .TypeConstraint("T", {"tensor(float)"}, "Constrain input and output types to float tensors");
 
   ONNX_CONTRIB_OPERATOR_SCHEMA(GlobalMaxPool)
       .FillUsing(NchwcGlobalPoolOpSchemaGenerator);
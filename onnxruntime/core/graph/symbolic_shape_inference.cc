@@ -0,0 +1,1241 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/graph/symbolic_shape_inference.h"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <unordered_set>
+
+#include "core/framework/tensorprotoutils.h"
+#include "core/graph/graph_utils.h"
+#include "core/graph/graph_viewer.h"
+
+using namespace ONNX_NAMESPACE;
+namespace onnxruntime {
+
+//
+// DimExpr
+//
+
+DimExpr::DimExpr(int64_t value) {
+  if (value != 0) {
+    terms_[Monomial{}] = value;
+  }
+}
+
+DimExpr DimExpr::Symbol(const std::string& name) {
+  DimExpr expr;
+  expr.terms_[Monomial{name}] = 1;
+  return expr;
+}
+
+bool DimExpr::IsConstant() const noexcept {
+  return terms_.empty() || (terms_.size() == 1 && terms_.begin()->first.empty());
+}
+
+int64_t DimExpr::ConstantValue() const {
+  ORT_ENFORCE(IsConstant(), "Dimension expression ", ToString(), " is not a constant.");
+  return terms_.empty() ? 0 : terms_.begin()->second;
+}
+
+bool DimExpr::IsSymbol(std::string* name) const {
+  if (terms_.size() != 1 || terms_.begin()->first.size() != 1 || terms_.begin()->second != 1) {
+    return false;
+  }
+  if (name != nullptr) {
+    *name = terms_.begin()->first.front();
+  }
+  return true;
+}
+
+DimExpr DimExpr::operator+(const DimExpr& other) const {
+  DimExpr result(*this);
+  for (const auto& term : other.terms_) {
+    int64_t coefficient = (result.terms_[term.first] += term.second);
+    if (coefficient == 0) {
+      result.terms_.erase(term.first);
+    }
+  }
+  return result;
+}
+
+DimExpr DimExpr::operator-(const DimExpr& other) const {
+  return *this + other * DimExpr(-1);
+}
+
+DimExpr DimExpr::operator*(const DimExpr& other) const {
+  DimExpr result;
+  for (const auto& term1 : terms_) {
+    for (const auto& term2 : other.terms_) {
+      Monomial monomial;
+      monomial.reserve(term1.first.size() + term2.first.size());
+      std::merge(term1.first.cbegin(), term1.first.cend(), term2.first.cbegin(), term2.first.cend(),
+                 std::back_inserter(monomial));
+      int64_t coefficient = (result.terms_[monomial] += term1.second * term2.second);
+      if (coefficient == 0) {
+        result.terms_.erase(monomial);
+      }
+    }
+  }
+  return result;
+}
+
+bool DimExpr::DivideExact(const DimExpr& divisor, DimExpr& result) const {
+  if (divisor.terms_.size() != 1) {
+    return false;
+  }
+
+  const Monomial& divisor_monomial = divisor.terms_.begin()->first;
+  const int64_t divisor_coefficient = divisor.terms_.begin()->second;
+
+  DimExpr quotient;
+  for (const auto& term : terms_) {
+    if (term.second % divisor_coefficient != 0 ||
+        !std::includes(term.first.cbegin(), term.first.cend(), divisor_monomial.cbegin(), divisor_monomial.cend())) {
+      return false;
+    }
+
+    Monomial monomial;
+    std::set_difference(term.first.cbegin(), term.first.cend(), divisor_monomial.cbegin(), divisor_monomial.cend(),
+                        std::back_inserter(monomial));
+    quotient.terms_[monomial] = term.second / divisor_coefficient;
+  }
+
+  result = std::move(quotient);
+  return true;
+}
+
+bool DimExpr::Evaluate(const SymbolBindings& bindings, int64_t& value) const {
+  value = 0;
+  for (const auto& term : terms_) {
+    int64_t term_value = term.second;
+    for (const auto& symbol : term.first) {
+      auto binding = bindings.find(symbol);
+      if (binding == bindings.end()) {
+        return false;
+      }
+      term_value *= binding->second;
+    }
+    value += term_value;
+  }
+  return true;
+}
+
+std::string DimExpr::ToString() const {
+  if (terms_.empty()) {
+    return "0";
+  }
+
+  std::ostringstream out;
+  bool first = true;
+  for (const auto& term : terms_) {
+    int64_t coefficient = term.second;
+    if (coefficient < 0) {
+      out << "-";
+      coefficient = -coefficient;
+    } else if (!first) {
+      out << "+";
+    }
+    first = false;
+
+    bool need_separator = false;
+    if (coefficient != 1 || term.first.empty()) {
+      out << coefficient;
+      need_separator = true;
+    }
+    for (const auto& symbol : term.first) {
+      out << (need_separator ? "*" : "") << symbol;
+      need_separator = true;
+    }
+  }
+  return out.str();
+}
+
+//
+// SymbolicShapeInference
+//
+
+namespace {
+
+// integer tensors larger than this are not shapes, so their values are not tracked
+constexpr int64_t kMaxTrackedValues = 64;
+
+// large 'ends' values used by Slice to mean "to the end of the dimension"
+constexpr int64_t kSliceToEnd = std::numeric_limits<int32_t>::max();
+
+int64_t GetIntAttribute(const Node& node, const std::string& name, int64_t default_value) {
+  const auto* attr = graph_utils::GetNodeAttribute(node, name);
+  return attr != nullptr && attr->has_i() ? attr->i() : default_value;
+}
+
+std::string GetStringAttribute(const Node& node, const std::string& name, const std::string& default_value) {
+  const auto* attr = graph_utils::GetNodeAttribute(node, name);
+  return attr != nullptr && attr->has_s() ? attr->s() : default_value;
+}
+
+int64_t HandleNegativeAxis(int64_t axis, size_t rank) {
+  return axis < 0 ? axis + static_cast<int64_t>(rank) : axis;
+}
+
+bool ReadIntegerTensor(const TensorProto& tensor, std::vector<int64_t>& values) {
+  int64_t count = 1;
+  for (auto dim : tensor.dims()) {
+    count *= dim;
+  }
+  if (tensor.dims_size() > 1 || count > kMaxTrackedValues ||
+      tensor.data_location() == TensorProto_DataLocation_EXTERNAL) {
+    return false;
+  }
+
+  values.resize(static_cast<size_t>(count));
+  if (tensor.data_type() == TensorProto_DataType_INT64) {
+    return utils::UnpackTensor<int64_t>(tensor, values.data(), values.size()).IsOK();
+  }
+  if (tensor.data_type() == TensorProto_DataType_INT32) {
+    std::vector<int32_t> int32_values(values.size());
+    if (!utils::UnpackTensor<int32_t>(tensor, int32_values.data(), int32_values.size()).IsOK()) {
+      return false;
+    }
+    std::copy(int32_values.cbegin(), int32_values.cend(), values.begin());
+    return true;
+  }
+  return false;
+}
+
+std::vector<DimExpr> ToExprs(const std::vector<int64_t>& values) {
+  return std::vector<DimExpr>(values.cbegin(), values.cend());
+}
+
+DimExpr Product(SymbolicShape::const_iterator begin, SymbolicShape::const_iterator end) {
+  DimExpr product(1);
+  for (auto it = begin; it != end; ++it) {
+    product = product * *it;
+  }
+  return product;
+}
+
+// operators whose first output has the shape of their first input
+const std::unordered_set<std::string>& SameShapeOps() {
+  static const std::unordered_set<std::string> ops{
+      "Abs", "Acos", "Acosh", "Asin", "Asinh", "Atan", "Atanh", "BatchNormalization", "BiasGelu", "Cast", "Ceil",
+      "Clip", "Cos", "Cosh", "CumSum", "DequantizeLinear", "Dropout", "Elu", "Erf", "Exp", "FastGelu", "Floor",
+      "Gelu", "HardSigmoid", "Hardmax", "Identity", "InstanceNormalization", "IsInf", "IsNaN", "LRN",
+      "LayerNormalization", "LeakyRelu", "Log", "LogSoftmax", "MeanVarianceNormalization", "Neg", "Not",
+      "QuantizeLinear", "Reciprocal", "Relu", "Round", "Selu", "Shrink", "Sigmoid", "Sign", "Sin", "Sinh",
+      "SkipLayerNormalization", "Softmax", "Softplus", "Softsign", "Sqrt", "Tan", "Tanh", "ThresholdedRelu"};
+  return ops;
+}
+
+// operators with multidirectional broadcasting of all inputs
+const std::unordered_set<std::string>& BroadcastOps() {
+  static const std::unordered_set<std::string> ops{
+      "Add", "And", "BitShift", "Div", "Equal", "FusedElementwise", "Greater", "GreaterOrEqual", "Less",
+      "LessOrEqual", "Max", "Mean", "Min", "Mod", "Mul", "Or", "PRelu", "Pow", "Sub", "Sum", "Where", "Xor"};
+  return ops;
+}
+
+const std::unordered_set<std::string>& ReduceOps() {
+  static const std::unordered_set<std::string> ops{
+      "ReduceL1", "ReduceL2", "ReduceLogSum", "ReduceLogSumExp", "ReduceMax", "ReduceMean", "ReduceMin",
+      "ReduceProd", "ReduceSum", "ReduceSumSquare"};
+  return ops;
+}
+
+}  // namespace
+
+SymbolicShapeInference::SymbolicShapeInference(const Graph& graph) : graph_(graph) {
+}
+
+void SymbolicShapeInference::Run() {
+  shapes_.clear();
+  values_.clear();
+  derived_symbols_.clear();
+  next_symbol_id_ = 0;
+
+  for (const auto* input : graph_.GetInputs()) {
+    SetShapeFromGraph(*input);
+  }
+
+  for (const auto& entry : graph_.GetAllInitializedTensors()) {
+    const TensorProto& tensor = *entry.second;
+    SymbolicShape shape;
+    for (auto dim : tensor.dims()) {
+      shape.push_back(dim);
+    }
+    shapes_[entry.first] = std::move(shape);
+
+    // the values of an initializer that can be overridden by a graph input are not known
+    std::vector<int64_t> values;
+    if (graph_utils::IsConstantInitializer(graph_, entry.first, false) && ReadIntegerTensor(tensor, values)) {
+      values_[entry.first] = ToExprs(values);
+    }
+  }
+
+  GraphViewer graph_viewer(graph_);
+  for (auto node_index : graph_viewer.GetNodesInTopologicalOrder()) {
+    InferNode(*graph_.GetNode(node_index));
+  }
+}
+
+const SymbolicShape* SymbolicShapeInference::GetShape(const std::string& name) const {
+  auto it = shapes_.find(name);
+  return it != shapes_.end() ? &it->second : nullptr;
+}
+
+bool SymbolicShapeInference::BindInputShape(const std::string& name, const std::vector<int64_t>& dims,
+                                            SymbolBindings& bindings) const {
+  const auto* shape = GetShape(name);
+  if (shape == nullptr || shape->size() != dims.size()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < dims.size(); ++i) {
+    const DimExpr& dim = (*shape)[i];
+    std::string symbol;
+    if (dim.IsConstant()) {
+      if (dim.ConstantValue() != dims[i]) {
+        return false;
+      }
+    } else if (dim.IsSymbol(&symbol)) {
+      auto result = bindings.emplace(symbol, dims[i]);
+      if (!result.second && result.first->second != dims[i]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void SymbolicShapeInference::ResolveDerivedSymbols(SymbolBindings& bindings) const {
+  // derived symbols are only defined in terms of earlier symbols, so a single pass resolves all of them
+  for (const auto& entry : derived_symbols_) {
+    const DerivedSymbol& symbol = entry.second;
+    int64_t lhs, rhs;
+    if (!symbol.lhs.Evaluate(bindings, lhs) || !symbol.rhs.Evaluate(bindings, rhs)) {
+      continue;
+    }
+
+    if (symbol.kind == DerivedSymbol::Kind::kFloorDiv) {
+      if (rhs == 0) {
+        continue;
+      }
+      int64_t quotient = lhs / rhs;
+      if ((lhs % rhs != 0) && ((lhs < 0) != (rhs < 0))) {
+        --quotient;
+      }
+      bindings[entry.first] = quotient;
+    } else {
+      bindings[entry.first] = std::max(lhs, rhs);
+    }
+  }
+}
+
+bool SymbolicShapeInference::EvaluateShape(const std::string& name, const SymbolBindings& bindings,
+                                           std::vector<int64_t>& dims) const {
+  const auto* shape = GetShape(name);
+  if (shape == nullptr) {
+    return false;
+  }
+
+  dims.resize(shape->size());
+  for (size_t i = 0; i < shape->size(); ++i) {
+    if (!(*shape)[i].Evaluate(bindings, dims[i]) || dims[i] < 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+DimExpr SymbolicShapeInference::NewSymbol(const std::string& prefix) {
+  return DimExpr::Symbol(prefix + "__" + std::to_string(next_symbol_id_++));
+}
+
+DimExpr SymbolicShapeInference::FloorDiv(const DimExpr& numerator, int64_t denominator) {
+  DimExpr quotient;
+  if (numerator.DivideExact(DimExpr(denominator), quotient)) {
+    return quotient;
+  }
+
+  if (numerator.IsConstant()) {
+    int64_t value = numerator.ConstantValue();
+    int64_t result = value / denominator;
+    if ((value % denominator != 0) && ((value < 0) != (denominator < 0))) {
+      --result;
+    }
+    return result;
+  }
+
+  // reuse an existing symbol so the same computation on the same inputs produces equal shapes
+  for (const auto& entry : derived_symbols_) {
+    const DerivedSymbol& symbol = entry.second;
+    if (symbol.kind == DerivedSymbol::Kind::kFloorDiv && symbol.lhs == numerator && symbol.rhs == denominator) {
+      return DimExpr::Symbol(entry.first);
+    }
+  }
+
+  std::string name;
+  NewSymbol("floordiv").IsSymbol(&name);
+  derived_symbols_.emplace_back(name, DerivedSymbol{DerivedSymbol::Kind::kFloorDiv, numerator, denominator});
+  return DimExpr::Symbol(name);
+}
+
+DimExpr SymbolicShapeInference::BroadcastDim(const DimExpr& dim1, const DimExpr& dim2) {
+  if (dim1 == dim2 || (dim2.IsConstant() && dim2.ConstantValue() == 1)) {
+    return dim1;
+  }
+  if (dim1.IsConstant() && dim1.ConstantValue() == 1) {
+    return dim2;
+  }
+  // a dimension other than 1 broadcast against a symbol requires the symbol to be 1 or equal to it
+  if (dim1.IsConstant()) {
+    return dim1;
+  }
+  if (dim2.IsConstant()) {
+    return dim2;
+  }
+
+  for (const auto& entry : derived_symbols_) {
+    const DerivedSymbol& symbol = entry.second;
+    if (symbol.kind == DerivedSymbol::Kind::kMax &&
+        ((symbol.lhs == dim1 && symbol.rhs == dim2) || (symbol.lhs == dim2 && symbol.rhs == dim1))) {
+      return DimExpr::Symbol(entry.first);
+    }
+  }
+
+  std::string name;
+  NewSymbol("max").IsSymbol(&name);
+  derived_symbols_.emplace_back(name, DerivedSymbol{DerivedSymbol::Kind::kMax, dim1, dim2});
+  return DimExpr::Symbol(name);
+}
+
+bool SymbolicShapeInference::Broadcast(const std::vector<const SymbolicShape*>& shapes, SymbolicShape& result) {
+  size_t rank = 0;
+  for (const auto* shape : shapes) {
+    if (shape == nullptr) {
+      return false;
+    }
+    rank = std::max(rank, shape->size());
+  }
+
+  result.assign(rank, DimExpr(1));
+  for (const auto* shape : shapes) {
+    const size_t offset = rank - shape->size();
+    for (size_t i = 0; i < shape->size(); ++i) {
+      result[offset + i] = BroadcastDim(result[offset + i], (*shape)[i]);
+    }
+  }
+  return true;
+}
+
+void SymbolicShapeInference::SetShapeFromGraph(const NodeArg& node_arg) {
+  const auto* shape = node_arg.Shape();
+  if (!node_arg.Exists() || shape == nullptr) {
+    return;
+  }
+
+  SymbolicShape result;
+  for (const auto& dim : shape->dim()) {
+    if (utils::HasDimValue(dim)) {
+      result.push_back(dim.dim_value());
+    } else if (utils::HasDimParam(dim)) {
+      result.push_back(DimExpr::Symbol(dim.dim_param()));
+    } else {
+      result.push_back(NewSymbol("unk"));
+    }
+  }
+  shapes_[node_arg.Name()] = std::move(result);
+}
+
+void SymbolicShapeInference::SetOutputShape(const Node& node, size_t index, SymbolicShape shape) {
+  const auto& output_defs = node.OutputDefs();
+  if (index < output_defs.size() && output_defs[index]->Exists()) {
+    shapes_[output_defs[index]->Name()] = std::move(shape);
+  }
+}
+
+void SymbolicShapeInference::SetOutputValues(const Node& node, size_t index, std::vector<DimExpr> values) {
+  const auto& output_defs = node.OutputDefs();
+  if (index < output_defs.size() && output_defs[index]->Exists()) {
+    values_[output_defs[index]->Name()] = std::move(values);
+  }
+}
+
+const SymbolicShape* SymbolicShapeInference::InputShape(const Node& node, size_t index) const {
+  const auto& input_defs = node.InputDefs();
+  if (index >= input_defs.size() || !input_defs[index]->Exists()) {
+    return nullptr;
+  }
+  return GetShape(input_defs[index]->Name());
+}
+
+const std::vector<DimExpr>* SymbolicShapeInference::InputValues(const Node& node, size_t index) const {
+  const auto& input_defs = node.InputDefs();
+  if (index >= input_defs.size() || !input_defs[index]->Exists()) {
+    return nullptr;
+  }
+  auto it = values_.find(input_defs[index]->Name());
+  return it != values_.end() ? &it->second : nullptr;
+}
+
+bool SymbolicShapeInference::ConstantInputValues(const Node& node, size_t index, std::vector<int64_t>& values) const {
+  const auto* exprs = InputValues(node, index);
+  if (exprs == nullptr) {
+    return false;
+  }
+
+  values.clear();
+  for (const auto& expr : *exprs) {
+    if (!expr.IsConstant()) {
+      return false;
+    }
+    values.push_back(expr.ConstantValue());
+  }
+  return true;
+}
+
+void SymbolicShapeInference::InferNode(const Node& node) {
+  const std::string& op_type = node.OpType();
+  bool inferred = false;
+
+  if (node.Domain() == kOnnxDomain || node.Domain() == kMSDomain) {
+    if (SameShapeOps().count(op_type) != 0) {
+      const auto* shape = InputShape(node, 0);
+      if (shape != nullptr) {
+        SetOutputShape(node, 0, *shape);
+        if (op_type == "Dropout") {
+          SetOutputShape(node, 1, *shape);
+        }
+        // Cast and Identity of a shape tensor keep its values
+        const auto* values = InputValues(node, 0);
+        if (values != nullptr && (op_type == "Cast" || op_type == "Identity")) {
+          SetOutputValues(node, 0, *values);
+        }
+        inferred = true;
+      }
+    } else if (BroadcastOps().count(op_type) != 0) {
+      inferred = InferElementwise(node);
+      if (inferred) {
+        InferArithmeticValues(node);
+      }
+    } else if (ReduceOps().count(op_type) != 0) {
+      inferred = InferReduce(node, false);
+    } else if (op_type == "ArgMax" || op_type == "ArgMin") {
+      inferred = InferReduce(node, true);
+    } else if (op_type == "MatMul" || op_type == "MatMulInteger") {
+      inferred = InferMatMul(node);
+    } else if (op_type == "Gemm") {
+      inferred = InferGemm(node);
+    } else if (op_type == "Transpose") {
+      inferred = InferTranspose(node);
+    } else if (op_type == "Reshape") {
+      inferred = InferReshape(node);
+    } else if (op_type == "Flatten") {
+      inferred = InferFlatten(node);
+    } else if (op_type == "Squeeze" || op_type == "Unsqueeze") {
+      inferred = InferSqueeze(node, op_type == "Unsqueeze");
+    } else if (op_type == "Concat") {
+      inferred = InferConcat(node);
+    } else if (op_type == "Split") {
+      inferred = InferSplit(node);
+    } else if (op_type == "Slice") {
+      inferred = InferSlice(node);
+    } else if (op_type == "Gather") {
+      inferred = InferGather(node);
+    } else if (op_type == "Expand") {
+      inferred = InferExpand(node);
+    } else if (op_type == "Tile") {
+      inferred = InferTile(node);
+    } else if (op_type == "Conv" || op_type == "ConvInteger" || op_type == "FusedConv") {
+      inferred = InferConvPool(node, true);
+    } else if (op_type == "MaxPool" || op_type == "AveragePool" || op_type == "LpPool") {
+      inferred = InferConvPool(node, false);
+    } else if (op_type == "GlobalAveragePool" || op_type == "GlobalMaxPool" || op_type == "GlobalLpPool") {
+      inferred = InferGlobalPool(node);
+    } else if (op_type == "Pad") {
+      inferred = InferPad(node);
+    } else if (op_type == "Shape" || op_type == "Size" || op_type == "Constant" || op_type == "ConstantOfShape") {
+      inferred = InferShapeOps(node);
+    }
+  }
+
+  // Use the shapes inferred by ONNX for the outputs without a symbolic shape. Dimensions that ONNX knows to be
+  // constant are exact, so they replace the symbolic expression.
+  for (const auto* output : node.OutputDefs()) {
+    if (!output->Exists()) {
+      continue;
+    }
+
+    auto it = shapes_.find(output->Name());
+    const auto* onnx_shape = output->Shape();
+    if (!inferred || it == shapes_.end() ||
+        (onnx_shape != nullptr && static_cast<size_t>(onnx_shape->dim_size()) != it->second.size())) {
+      SetShapeFromGraph(*output);
+      continue;
+    }
+
+    if (onnx_shape != nullptr) {
+      for (int i = 0; i < onnx_shape->dim_size(); ++i) {
+        if (utils::HasDimValue(onnx_shape->dim(i))) {
+          it->second[i] = onnx_shape->dim(i).dim_value();
+        }
+      }
+    }
+  }
+}
+
+bool SymbolicShapeInference::InferElementwise(const Node& node) {
+  std::vector<const SymbolicShape*> shapes;
+  for (size_t i = 0; i < node.InputDefs().size(); ++i) {
+    if (node.InputDefs()[i]->Exists()) {
+      shapes.push_back(InputShape(node, i));
+    }
+  }
+
+  SymbolicShape result;
+  if (shapes.empty() || !Broadcast(shapes, result)) {
+    return false;
+  }
+  SetOutputShape(node, 0, std::move(result));
+  return true;
+}
+
+bool SymbolicShapeInference::InferArithmeticValues(const Node& node) {
+  const std::string& op_type = node.OpType();
+  if (op_type != "Add" && op_type != "Sub" && op_type != "Mul" && op_type != "Div") {
+    return false;
+  }
+
+  const auto* lhs = InputValues(node, 0);
+  const auto* rhs = InputValues(node, 1);
+  if (lhs == nullptr || rhs == nullptr ||
+      (lhs->size() != rhs->size() && lhs->size() != 1 && rhs->size() != 1)) {
+    return false;
+  }
+
+  const size_t count = std::max(lhs->size(), rhs->size());
+  std::vector<DimExpr> values;
+  for (size_t i = 0; i < count; ++i) {
+    const DimExpr& a = (*lhs)[lhs->size() == 1 ? 0 : i];
+    const DimExpr& b = (*rhs)[rhs->size() == 1 ? 0 : i];
+    if (op_type == "Add") {
+      values.push_back(a + b);
+    } else if (op_type == "Sub") {
+      values.push_back(a - b);
+    } else if (op_type == "Mul") {
+      values.push_back(a * b);
+    } else {
+      // integer division of (non-negative) dimensions
+      if (!b.IsConstant() || b.ConstantValue() <= 0) {
+        return false;
+      }
+      values.push_back(FloorDiv(a, b.ConstantValue()));
+    }
+  }
+
+  SetOutputValues(node, 0, std::move(values));
+  return true;
+}
+
+bool SymbolicShapeInference::InferMatMul(const Node& node) {
+  const auto* a = InputShape(node, 0);
+  const auto* b = InputShape(node, 1);
+  if (a == nullptr || b == nullptr || a->empty() || b->empty()) {
+    return false;
+  }
+
+  // 1-D operands are promoted to matrices, and the promoted dimension is removed from the result
+  SymbolicShape a_shape(*a);
+  SymbolicShape b_shape(*b);
+  if (a->size() == 1) {
+    a_shape.insert(a_shape.begin(), DimExpr(1));
+  }
+  if (b->size() == 1) {
+    b_shape.push_back(DimExpr(1));
+  }
+
+  SymbolicShape a_batch(a_shape.begin(), a_shape.end() - 2);
+  SymbolicShape b_batch(b_shape.begin(), b_shape.end() - 2);
+  SymbolicShape result;
+  if (!Broadcast({&a_batch, &b_batch}, result)) {
+    return false;
+  }
+
+  if (a->size() != 1) {
+    result.push_back(a_shape[a_shape.size() - 2]);
+  }
+  if (b->size() != 1) {
+    result.push_back(b_shape.back());
+  }
+
+  SetOutputShape(node, 0, std::move(result));
+  return true;
+}
+
+bool SymbolicShapeInference::InferGemm(const Node& node) {
+  const auto* a = InputShape(node, 0);
+  const auto* b = InputShape(node, 1);
+  if (a == nullptr || b == nullptr || a->size() != 2 || b->size() != 2) {
+    return false;
+  }
+
+  const bool trans_a = GetIntAttribute(node, "transA", 0) != 0;
+  const bool trans_b = GetIntAttribute(node, "transB", 0) != 0;
+  SetOutputShape(node, 0, {(*a)[trans_a ? 1 : 0], (*b)[trans_b ? 0 : 1]});
+  return true;
+}
+
+bool SymbolicShapeInference::InferTranspose(const Node& node) {
+  const auto* input = InputShape(node, 0);
+  if (input == nullptr) {
+    return false;
+  }
+
+  std::vector<int64_t> perm;
+  if (!graph_utils::GetRepeatedNodeAttributeValues(node, "perm", perm)) {
+    for (int64_t i = static_cast<int64_t>(input->size()) - 1; i >= 0; --i) {
+      perm.push_back(i);
+    }
+  }
+  if (perm.size() != input->size()) {
+    return false;
+  }
+
+  SymbolicShape result;
+  for (auto axis : perm) {
+    if (axis < 0 || axis >= static_cast<int64_t>(input->size())) {
+      return false;
+    }
+    result.push_back((*input)[axis]);
+  }
+
+  SetOutputShape(node, 0, std::move(result));
+  return true;
+}
+
+bool SymbolicShapeInference::InferReshape(const Node& node) {
+  const auto* input = InputShape(node, 0);
+  std::vector<DimExpr> requested;
+  std::vector<int64_t> shape_attr;
+  if (graph_utils::GetRepeatedNodeAttributeValues(node, "shape", shape_attr)) {
+    requested = ToExprs(shape_attr);  // Reshape-1
+  } else if (const auto* values = InputValues(node, 1)) {
+    requested = *values;
+  }
+
+  if (input == nullptr || requested.empty()) {
+    return false;
+  }
+
+  SymbolicShape result;
+  int64_t unknown_index = -1;
+  DimExpr known_size(1);
+  for (size_t i = 0; i < requested.size(); ++i) {
+    const DimExpr& dim = requested[i];
+    if (dim.IsConstant() && dim.ConstantValue() == 0) {
+      if (i >= input->size()) {
+        return false;
+      }
+      result.push_back((*input)[i]);
+    } else if (dim.IsConstant() && dim.ConstantValue() == -1) {
+      unknown_index = static_cast<int64_t>(i);
+      result.push_back(DimExpr(1));
+      continue;
+    } else {
+      result.push_back(dim);
+    }
+    known_size = known_size * result.back();
+  }
+
+  if (unknown_index >= 0) {
+    DimExpr total = Product(input->cbegin(), input->cend());
+    if (!total.DivideExact(known_size, result[unknown_index])) {
+      return false;
+    }
+  }
+
+  SetOutputShape(node, 0, std::move(result));
+  return true;
+}
+
+bool SymbolicShapeInference::InferFlatten(const Node& node) {
+  const auto* input = InputShape(node, 0);
+  if (input == nullptr) {
+    return false;
+  }
+
+  int64_t axis = HandleNegativeAxis(GetIntAttribute(node, "axis", 1), input->size());
+  if (axis < 0 || axis > static_cast<int64_t>(input->size())) {
+    return false;
+  }
+
+  SetOutputShape(node, 0, {Product(input->cbegin(), input->cbegin() + axis),
+                           Product(input->cbegin() + axis, input->cend())});
+  return true;
+}
+
+bool SymbolicShapeInference::InferSqueeze(const Node& node, bool unsqueeze) {
+  const auto* input = InputShape(node, 0);
+  if (input == nullptr) {
+    return false;
+  }
+
+  std::vector<int64_t> axes;
+  graph_utils::GetRepeatedNodeAttributeValues(node, "axes", axes);
+
+  SymbolicShape result;
+  if (unsqueeze) {
+    const size_t output_rank = input->size() + axes.size();
+    std::vector<bool> is_inserted(output_rank, false);
+    for (auto axis : axes) {
+      axis = HandleNegativeAxis(axis, output_rank);
+      if (axis < 0 || axis >= static_cast<int64_t>(output_rank)) {
+        return false;
+      }
+      is_inserted[axis] = true;
+    }
+    for (size_t i = 0, j = 0; i < output_rank; ++i) {
+      result.push_back(is_inserted[i] ? DimExpr(1) : (*input)[j++]);
+    }
+  } else {
+    std::vector<bool> is_removed(input->size(), false);
+    for (auto axis : axes) {
+      axis = HandleNegativeAxis(axis, input->size());
+      if (axis < 0 || axis >= static_cast<int64_t>(input->size())) {
+        return false;
+      }
+      is_removed[axis] = true;
+    }
+    for (size_t i = 0; i < input->size(); ++i) {
+      const DimExpr& dim = (*input)[i];
+      if (axes.empty()) {
+        // without axes every dimension of size 1 is removed, which isn't known for symbolic dimensions
+        if (!dim.IsConstant()) {
+          return false;
+        }
+        is_removed[i] = dim.ConstantValue() == 1;
+      }
+      if (!is_removed[i]) {
+        result.push_back(dim);
+      }
+    }
+  }
+
+  SetOutputShape(node, 0, std::move(result));
+
+  const auto* values = InputValues(node, 0);
+  if (values != nullptr) {
+    SetOutputValues(node, 0, *values);
+  }
+  return true;
+}
+
+bool SymbolicShapeInference::InferConcat(const Node& node) {
+  const auto* first = InputShape(node, 0);
+  if (first == nullptr) {
+    return false;
+  }
+
+  const int64_t axis = HandleNegativeAxis(GetIntAttribute(node, "axis", 0), first->size());
+  if (axis < 0 || axis >= static_cast<int64_t>(first->size())) {
+    return false;
+  }
+
+  SymbolicShape result(*first);
+  std::vector<DimExpr> values;
+  bool has_values = true;
+  for (size_t i = 0; i < node.InputDefs().size(); ++i) {
+    const auto* shape = InputShape(node, i);
+    if (shape == nullptr || shape->size() != first->size()) {
+      return false;
+    }
+    if (i > 0) {
+      result[axis] = result[axis] + (*shape)[axis];
+    }
+
+    const auto* input_values = InputValues(node, i);
+    if (input_values != nullptr && has_values) {
+      values.insert(values.end(), input_values->cbegin(), input_values->cend());
+    } else {
+      has_values = false;
+    }
+  }
+
+  SetOutputShape(node, 0, std::move(result));
+  if (has_values && first->size() == 1) {
+    SetOutputValues(node, 0, std::move(values));
+  }
+  return true;
+}
+
+bool SymbolicShapeInference::InferSplit(const Node& node) {
+  const auto* input = InputShape(node, 0);
+  if (input == nullptr) {
+    return false;
+  }
+
+  const int64_t axis = HandleNegativeAxis(GetIntAttribute(node, "axis", 0), input->size());
+  if (axis < 0 || axis >= static_cast<int64_t>(input->size())) {
+    return false;
+  }
+
+  const size_t num_outputs = node.OutputDefs().size();
+  std::vector<int64_t> split;
+  if (graph_utils::GetRepeatedNodeAttributeValues(node, "split", split) && split.size() != num_outputs) {
+    return false;
+  }
+
+  for (size_t i = 0; i < num_outputs; ++i) {
+    SymbolicShape result(*input);
+    result[axis] = split.empty() ? FloorDiv((*input)[axis], static_cast<int64_t>(num_outputs)) : DimExpr(split[i]);
+    SetOutputShape(node, i, std::move(result));
+  }
+  return true;
+}
+
+bool SymbolicShapeInference::InferSlice(const Node& node) {
+  const auto* input = InputShape(node, 0);
+  if (input == nullptr) {
+    return false;
+  }
+
+  std::vector<int64_t> starts, ends, axes, steps;
+  if (node.Op() != nullptr && node.Op()->SinceVersion() < 10) {
+    if (!graph_utils::GetRepeatedNodeAttributeValues(node, "starts", starts) ||
+        !graph_utils::GetRepeatedNodeAttributeValues(node, "ends", ends)) {
+      return false;
+    }
+    graph_utils::GetRepeatedNodeAttributeValues(node, "axes", axes);
+  } else {
+    if (!ConstantInputValues(node, 1, starts) || !ConstantInputValues(node, 2, ends)) {
+      return false;
+    }
+    if (InputShape(node, 3) != nullptr && !ConstantInputValues(node, 3, axes)) {
+      return false;
+    }
+    if (InputShape(node, 4) != nullptr && !ConstantInputValues(node, 4, steps)) {
+      return false;
+    }
+  }
+
+  if (axes.empty()) {
+    for (size_t i = 0; i < starts.size(); ++i) {
+      axes.push_back(static_cast<int64_t>(i));
+    }
+  }
+  if (steps.empty()) {
+    steps.assign(starts.size(), 1);
+  }
+  if (starts.size() != ends.size() || starts.size() != axes.size() || starts.size() != steps.size()) {
+    return false;
+  }
+
+  SymbolicShape result(*input);
+  for (size_t i = 0; i < axes.size(); ++i) {
+    const int64_t axis = HandleNegativeAxis(axes[i], input->size());
+    if (axis < 0 || axis >= static_cast<int64_t>(input->size()) || steps[i] == 0) {
+      return false;
+    }
+
+    const DimExpr& dim = (*input)[axis];
+    int64_t start = starts[i];
+    int64_t end = ends[i];
+    const int64_t step = steps[i];
+
+    if (dim.IsConstant()) {
+      // same clamping as the Slice kernel
+      const int64_t size = dim.ConstantValue();
+      start = start < 0 ? start + size : start;
+      end = end < 0 ? end + size : end;
+      if (step < 0) {
+        start = std::max<int64_t>(-1, std::min(start, size - 1));
+        end = std::max<int64_t>(-1, std::min(end, size - 1));
+        result[axis] = std::max<int64_t>(0, (start - end - step - 1) / -step);
+      } else {
+        start = std::max<int64_t>(0, std::min(start, size));
+        end = std::max<int64_t>(0, std::min(end, size));
+        result[axis] = std::max<int64_t>(0, (end - start + step - 1) / step);
+      }
+      continue;
+    }
+
+    // For a symbolic dimension the bounds are assumed to be within the dimension.
+    if (step < 0) {
+      return false;
+    }
+    const DimExpr start_expr = start < 0 ? dim + DimExpr(start) : DimExpr(start);
+    const DimExpr end_expr = end >= kSliceToEnd ? dim : (end < 0 ? dim + DimExpr(end) : DimExpr(end));
+    result[axis] = FloorDiv(end_expr - start_expr + DimExpr(step - 1), step);
+  }
+
+  SetOutputShape(node, 0, result);
+
+  // slicing a shape tensor
+  const auto* values = InputValues(node, 0);
+  if (values != nullptr && input->size() == 1 && result[0].IsConstant() && axes.size() == 1) {
+    const int64_t size = static_cast<int64_t>(values->size());
+    int64_t start = starts[0] < 0 ? starts[0] + size : starts[0];
+    if (steps[0] > 0) {
+      start = std::max<int64_t>(0, std::min(start, size));
+      std::vector<DimExpr> sliced;
+      for (int64_t j = 0; j < result[0].ConstantValue(); ++j) {
+        sliced.push_back((*values)[start + j * steps[0]]);
+      }
+      SetOutputValues(node, 0, std::move(sliced));
+    }
+  }
+  return true;
+}
+
+bool SymbolicShapeInference::InferGather(const Node& node) {
+  const auto* data = InputShape(node, 0);
+  const auto* indices = InputShape(node, 1);
+  if (data == nullptr || indices == nullptr) {
+    return false;
+  }
+
+  const int64_t axis = HandleNegativeAxis(GetIntAttribute(node, "axis", 0), data->size());
+  if (axis < 0 || axis >= static_cast<int64_t>(data->size())) {
+    return false;
+  }
+
+  SymbolicShape result(data->cbegin(), data->cbegin() + axis);
+  result.insert(result.end(), indices->cbegin(), indices->cend());
+  result.insert(result.end(), data->cbegin() + axis + 1, data->cend());
+  SetOutputShape(node, 0, std::move(result));
+
+  // gathering from a shape tensor
+  const auto* values = InputValues(node, 0);
+  std::vector<int64_t> index_values;
+  if (values != nullptr && ConstantInputValues(node, 1, index_values)) {
+    std::vector<DimExpr> gathered;
+    for (auto index : index_values) {
+      index = HandleNegativeAxis(index, values->size());
+      if (index < 0 || index >= static_cast<int64_t>(values->size())) {
+        return true;
+      }
+      gathered.push_back((*values)[index]);
+    }
+    SetOutputValues(node, 0, std::move(gathered));
+  }
+  return true;
+}
+
+bool SymbolicShapeInference::InferExpand(const Node& node) {
+  const auto* input = InputShape(node, 0);
+  const auto* shape = InputValues(node, 1);
+  if (input == nullptr || shape == nullptr) {
+    return false;
+  }
+
+  SymbolicShape result;
+  if (!Broadcast({input, shape}, result)) {
+    return false;
+  }
+  SetOutputShape(node, 0, std::move(result));
+  return true;
+}
+
+bool SymbolicShapeInference::InferTile(const Node& node) {
+  const auto* input = InputShape(node, 0);
+  const auto* repeats = InputValues(node, 1);
+  if (input == nullptr || repeats == nullptr || repeats->size() != input->size()) {
+    return false;
+  }
+
+  SymbolicShape result;
+  for (size_t i = 0; i < input->size(); ++i) {
+    result.push_back((*input)[i] * (*repeats)[i]);
+  }
+  SetOutputShape(node, 0, std::move(result));
+  return true;
+}
+
+bool SymbolicShapeInference::InferReduce(const Node& node, bool single_axis) {
+  const auto* input = InputShape(node, 0);
+  if (input == nullptr) {
+    return false;
+  }
+
+  std::vector<int64_t> axes;
+  if (single_axis) {
+    axes.push_back(GetIntAttribute(node, "axis", 0));
+  } else if (!graph_utils::GetRepeatedNodeAttributeValues(node, "axes", axes)) {
+    for (size_t i = 0; i < input->size(); ++i) {
+      axes.push_back(static_cast<int64_t>(i));
+    }
+  }
+
+  std::vector<bool> is_reduced(input->size(), false);
+  for (auto axis : axes) {
+    axis = HandleNegativeAxis(axis, input->size());
+    if (axis < 0 || axis >= static_cast<int64_t>(input->size())) {
+      return false;
+    }
+    is_reduced[axis] = true;
+  }
+
+  const bool keepdims = GetIntAttribute(node, "keepdims", 1) != 0;
+  SymbolicShape result;
+  for (size_t i = 0; i < input->size(); ++i) {
+    if (!is_reduced[i]) {
+      result.push_back((*input)[i]);
+    } else if (keepdims) {
+      result.push_back(DimExpr(1));
+    }
+  }
+  SetOutputShape(node, 0, std::move(result));
+  return true;
+}
+
+bool SymbolicShapeInference::InferConvPool(const Node& node, bool is_conv) {
+  const auto* input = InputShape(node, 0);
+  const auto* weights = is_conv ? InputShape(node, 1) : nullptr;
+  if (input == nullptr || input->size() < 3 || (is_conv && (weights == nullptr || weights->size() != input->size()))) {
+    return false;
+  }
+
+  const size_t spatial_rank = input->size() - 2;
+  std::vector<int64_t> kernel_shape, strides, dilations, pads;
+  if (!graph_utils::GetRepeatedNodeAttributeValues(node, "kernel_shape", kernel_shape)) {
+    if (!is_conv) {
+      return false;
+    }
+    for (size_t i = 0; i < spatial_rank; ++i) {
+      const DimExpr& dim = (*weights)[2 + i];
+      if (!dim.IsConstant()) {
+        return false;
+      }
+      kernel_shape.push_back(dim.ConstantValue());
+    }
+  }
+  if (!graph_utils::GetRepeatedNodeAttributeValues(node, "strides", strides)) {
+    strides.assign(spatial_rank, 1);
+  }
+  if (!graph_utils::GetRepeatedNodeAttributeValues(node, "dilations", dilations)) {
+    dilations.assign(spatial_rank, 1);
+  }
+  if (!graph_utils::GetRepeatedNodeAttributeValues(node, "pads", pads)) {
+    pads.assign(2 * spatial_rank, 0);
+  }
+  if (kernel_shape.size() != spatial_rank || strides.size() != spatial_rank ||
+      dilations.size() != spatial_rank || pads.size() != 2 * spatial_rank) {
+    return false;
+  }
+
+  const std::string auto_pad = GetStringAttribute(node, "auto_pad", "NOTSET");
+  const bool ceil_mode = GetIntAttribute(node, "ceil_mode", 0) != 0;
+
+  SymbolicShape result{(*input)[0], is_conv ? (*weights)[0] : (*input)[1]};
+  for (size_t i = 0; i < spatial_rank; ++i) {
+    const DimExpr& dim = (*input)[2 + i];
+    const int64_t stride = strides[i];
+    if (stride <= 0) {
+      return false;
+    }
+
+    if (auto_pad == "SAME_UPPER" || auto_pad == "SAME_LOWER") {
+      result.push_back(FloorDiv(dim + DimExpr(stride - 1), stride));
+      continue;
+    }
+
+    const int64_t effective_kernel = (kernel_shape[i] - 1) * dilations[i] + 1;
+    DimExpr padded = dim - DimExpr(effective_kernel);
+    if (auto_pad != "VALID") {
+      padded = padded + DimExpr(pads[i] + pads[i + spatial_rank]);
+    }
+    if (ceil_mode) {
+      padded = padded + DimExpr(stride - 1);
+    }
+    result.push_back(FloorDiv(padded, stride) + DimExpr(1));
+  }
+
+  SetOutputShape(node, 0, result);
+  if (node.OpType() == "MaxPool") {
+    SetOutputShape(node, 1, std::move(result));  // indices
+  }
+  return true;
+}
+
+bool SymbolicShapeInference::InferGlobalPool(const Node& node) {
+  const auto* input = InputShape(node, 0);
+  if (input == nullptr || input->size() < 2) {
+    return false;
+  }
+
+  SymbolicShape result{(*input)[0], (*input)[1]};
+  result.resize(input->size(), DimExpr(1));
+  SetOutputShape(node, 0, std::move(result));
+  return true;
+}
+
+bool SymbolicShapeInference::InferPad(const Node& node) {
+  const auto* input = InputShape(node, 0);
+  std::vector<DimExpr> pads;
+  std::vector<int64_t> pads_attr;
+  if (graph_utils::GetRepeatedNodeAttributeValues(node, "pads", pads_attr)) {
+    pads = ToExprs(pads_attr);  // Pad-2
+  } else if (const auto* values = InputValues(node, 1)) {
+    pads = *values;
+  }
+
+  if (input == nullptr || pads.size() != 2 * input->size()) {
+    return false;
+  }
+
+  SymbolicShape result;
+  for (size_t i = 0; i < input->size(); ++i) {
+    result.push_back((*input)[i] + pads[i] + pads[i + input->size()]);
+  }
+  SetOutputShape(node, 0, std::move(result));
+  return true;
+}
+
+bool SymbolicShapeInference::InferShapeOps(const Node& node) {
+  const std::string& op_type = node.OpType();
+
+  if (op_type == "Constant") {
+    const auto* value = graph_utils::GetNodeAttribute(node, "value");
+    if (value == nullptr || !value->has_t()) {
+      return false;
+    }
+    SymbolicShape shape;
+    for (auto dim : value->t().dims()) {
+      shape.push_back(dim);
+    }
+    SetOutputShape(node, 0, std::move(shape));
+
+    std::vector<int64_t> values;
+    if (ReadIntegerTensor(value->t(), values)) {
+      SetOutputValues(node, 0, ToExprs(values));
+    }
+    return true;
+  }
+
+  if (op_type == "ConstantOfShape") {
+    const auto* shape = InputValues(node, 0);
+    if (shape == nullptr) {
+      return false;
+    }
+    SetOutputShape(node, 0, *shape);
+    return true;
+  }
+
+  const auto* input = InputShape(node, 0);
+  if (input == nullptr) {
+    return false;
+  }
+
+  if (op_type == "Shape") {
+    SetOutputShape(node, 0, {static_cast<int64_t>(input->size())});
+    SetOutputValues(node, 0, *input);
+  } else {
+    SetOutputShape(node, 0, {});
+    SetOutputValues(node, 0, {Product(input->cbegin(), input->cend())});
+  }
+  return true;
+}
+
+}  // namespace onnxruntime
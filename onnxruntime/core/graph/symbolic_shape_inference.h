@@ -0,0 +1,166 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core/graph/graph.h"
+
+namespace onnxruntime {
+
+/** Values of the symbols used in dimension expressions. */
+using SymbolBindings = std::unordered_map<std::string, int64_t>;
+
+/**
+@class DimExpr
+A tensor dimension expressed as a polynomial with integer coefficients over named symbols, e.g. 2*batch*seq + 1.
+Symbols are either free dimensions of graph inputs, or symbols defined by SymbolicShapeInference for
+operations that are not polynomial (floor division, max).
+*/
+class DimExpr {
+ public:
+  /** Creates the constant expression 'value'. */
+  DimExpr(int64_t value = 0);  // NOLINT(runtime/explicit)
+
+  /** Creates an expression consisting of a single symbol. */
+  static DimExpr Symbol(const std::string& name);
+
+  bool IsConstant() const noexcept;
+
+  /** Returns the value of a constant expression. */
+  int64_t ConstantValue() const;
+
+  /** Returns true if the expression is a single symbol with coefficient 1, and sets 'name' to it. */
+  bool IsSymbol(std::string* name = nullptr) const;
+
+  DimExpr operator+(const DimExpr& other) const;
+  DimExpr operator-(const DimExpr& other) const;
+  DimExpr operator*(const DimExpr& other) const;
+  bool operator==(const DimExpr& other) const { return terms_ == other.terms_; }
+  bool operator!=(const DimExpr& other) const { return terms_ != other.terms_; }
+
+  /**
+  Divides the expression by 'divisor' if the division is exact term by term.
+  @param divisor A constant or a single term (coefficient times a product of symbols).
+  @returns false if the division is not exact or the divisor is not a single term.
+  */
+  bool DivideExact(const DimExpr& divisor, DimExpr& result) const;
+
+  /** Evaluates the expression. Returns false if a symbol has no value in 'bindings'. */
+  bool Evaluate(const SymbolBindings& bindings, int64_t& value) const;
+
+  /** Returns a string form of the expression, e.g. "2*batch*seq+1". */
+  std::string ToString() const;
+
+ private:
+  // sorted names of the symbols in a term, with repetition for powers. the empty term is the constant.
+  using Monomial = std::vector<std::string>;
+
+  // terms with non-zero coefficients
+  std::map<Monomial, int64_t> terms_;
+};
+
+using SymbolicShape = std::vector<DimExpr>;
+
+/**
+@class SymbolicShapeInference
+Propagates symbolic dimension expressions through a graph.
+
+Shapes of graph inputs are taken from the model, with each free dimension becoming a symbol. Small integer tensors
+that hold shapes (the output of Shape, Gather/Slice/Concat/Unsqueeze of it, arithmetic on it, and constants) are
+tracked element by element, so that the outputs of Reshape, Expand, ConstantOfShape, Tile and similar operators
+remain expressions of the input symbols. Operators without a symbolic implementation use the shape inferred by
+ONNX; dimensions unknown to ONNX become symbols that cannot be bound.
+
+Once the input shapes of a run are known, BindInputShape() and ResolveDerivedSymbols() assign values to the symbols
+and EvaluateShape() instantiates the shape of any value in the graph without executing it.
+*/
+class SymbolicShapeInference {
+ public:
+  explicit SymbolicShapeInference(const Graph& graph);
+
+  /** Infers the shapes of all values in the graph. */
+  void Run();
+
+  /** Gets the inferred shape of the value with the given name, or nullptr if it is not known. */
+  const SymbolicShape* GetShape(const std::string& name) const;
+
+  /**
+  Binds the symbols in the shape of graph input 'name' to the dimensions of a concrete input.
+  @returns false if the dimensions contradict the model or earlier bindings.
+  */
+  bool BindInputShape(const std::string& name, const std::vector<int64_t>& dims, SymbolBindings& bindings) const;
+
+  /**
+  Assigns values to the symbols defined by the inference (floor divisions, maxima) from the bound input symbols.
+  Call once after binding all inputs.
+  */
+  void ResolveDerivedSymbols(SymbolBindings& bindings) const;
+
+  /**
+  Computes the concrete shape of the value with the given name.
+  @returns false if the shape is unknown or depends on a symbol that is not bound.
+  */
+  bool EvaluateShape(const std::string& name, const SymbolBindings& bindings, std::vector<int64_t>& dims) const;
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(SymbolicShapeInference);
+
+  // Symbols defined by a non-polynomial operation on other expressions.
+  struct DerivedSymbol {
+    enum class Kind { kFloorDiv,
+                      kMax };
+    Kind kind;
+    DimExpr lhs;
+    DimExpr rhs;
+  };
+
+  void InferNode(const Node& node);
+  void SetShapeFromGraph(const NodeArg& node_arg);
+  void SetOutputShape(const Node& node, size_t index, SymbolicShape shape);
+  void SetOutputValues(const Node& node, size_t index, std::vector<DimExpr> values);
+
+  // Returns floor(numerator / denominator). Creates a derived symbol if the result is not polynomial.
+  DimExpr FloorDiv(const DimExpr& numerator, int64_t denominator);
+  // Returns the broadcast of two dimensions, creating a derived symbol if they cannot be compared statically.
+  DimExpr BroadcastDim(const DimExpr& dim1, const DimExpr& dim2);
+  bool Broadcast(const std::vector<const SymbolicShape*>& shapes, SymbolicShape& result);
+  DimExpr NewSymbol(const std::string& prefix);
+
+  const SymbolicShape* InputShape(const Node& node, size_t index) const;
+  const std::vector<DimExpr>* InputValues(const Node& node, size_t index) const;
+  bool ConstantInputValues(const Node& node, size_t index, std::vector<int64_t>& values) const;
+
+  bool InferElementwise(const Node& node);
+  bool InferMatMul(const Node& node);
+  bool InferGemm(const Node& node);
+  bool InferTranspose(const Node& node);
+  bool InferReshape(const Node& node);
+  bool InferFlatten(const Node& node);
+  bool InferSqueeze(const Node& node, bool unsqueeze);
+  bool InferConcat(const Node& node);
+  bool InferSplit(const Node& node);
+  bool InferSlice(const Node& node);
+  bool InferGather(const Node& node);
+  bool InferExpand(const Node& node);
+  bool InferTile(const Node& node);
+  bool InferReduce(const Node& node, bool single_axis);
+  bool InferConvPool(const Node& node, bool is_conv);
+  bool InferGlobalPool(const Node& node);
+  bool InferPad(const Node& node);
+  bool InferShapeOps(const Node& node);
+  bool InferArithmeticValues(const Node& node);
+
+  const Graph& graph_;
+  std::unordered_map<std::string, SymbolicShape> shapes_;
+  // element values of small integer tensors that describe shapes
+  std::unordered_map<std::string, std::vector<DimExpr>> values_;
+  std::vector<std::pair<std::string, DerivedSymbol>> derived_symbols_;
+  int next_symbol_id_{0};
+};
+
+}  // namespace onnxruntime
@@ -189,6 +189,9 @@ enum MLAS_CONV_ALGORITHM {
     MlasConvAlgorithmGemmDirect,
     MlasConvAlgorithmExpandThenGemm,
     MlasConvAlgorithmExpandThenGemmSegmented,
+    MlasConvAlgorithmDepthwise,
+    MlasConvAlgorithmWinograd,
+    MlasConvAlgorithmTranspose,
 };
 
 struct MLAS_CONV_PARAMETERS {
@@ -217,6 +220,34 @@ struct MLAS_CONV_PARAMETERS {
         struct {
             size_t ThreadStrideN;
         } ExpandThenGemmSegmented;
+        struct {
+            size_t OutputTile;
+            size_t TileRowsPerBlock;
+            size_t PaddedTileCount;
+            //
+            // MlasConvPrepare sets this to nullptr, so that MlasConv transforms
+            // the filter into the working buffer. Callers that reuse a filter
+            // may instead store the output of MlasConvTransformFilter here,
+            // and then allocate MlasConvTransformedFilterSize fewer elements
+            // for the working buffer.
+            //
+            const float* TransformedFilter;
+        } Winograd;
+        struct {
+            size_t RowsPerBlock;
+            size_t RowBlockCount;
+            size_t FilterCountPerBlock;
+            size_t ExpandedInputSize;
+            //
+            // MlasConvTransposePrepare sets this to nullptr, so that
+            // MlasConvTranspose repacks the filter into the working buffer.
+            // Callers that reuse a filter may instead store the output of
+            // MlasConvTransformFilter here, and then allocate
+            // MlasConvTransformedFilterSize fewer elements for the working
+            // buffer.
+            //
+            const float* TransformedFilter;
+        } ConvTranspose;
     } u;
 };
 
@@ -252,6 +283,52 @@ MlasConv(
     MLAS_THREADPOOL* ThreadPool
     );
 
+size_t
+MLASCALL
+MlasConvTransformedFilterSize(
+    const MLAS_CONV_PARAMETERS* Parameters
+    );
+
+void
+MLASCALL
+MlasConvTransformFilter(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Filter,
+    float* TransformedFilter
+    );
+
+void
+MLASCALL
+MlasConvTransposePrepare(
+    MLAS_CONV_PARAMETERS* Parameters,
+    size_t Dimensions,
+    size_t BatchCount,
+    size_t GroupCount,
+    size_t InputChannels,
+    const int64_t* InputShape,
+    const int64_t* KernelShape,
+    const int64_t* DilationShape,
+    const int64_t* Padding,
+    const int64_t* StrideShape,
+    const int64_t* OutputShape,
+    size_t FilterCount,
+    const MLAS_ACTIVATION* Activation,
+    size_t* WorkingBufferSize,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+void
+MLASCALL
+MlasConvTranspose(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    const float* Filter,
+    const float* Bias,
+    float* WorkingBuffer,
+    float* Output,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 //
 // Pooling routines.
 //
@@ -310,7 +387,6 @@ MlasComputeErf(
 // Half-precision floating-point routines.
 //
 
-extern "C"
 void
 MLASCALL
 MlasConvertHalfToFloatBuffer(
@@ -319,6 +395,14 @@ MlasConvertHalfToFloatBuffer(
     size_t Count
     );
 
+void
+MLASCALL
+MlasConvertFloatToHalfBuffer(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    );
+
 //
 // Buffer reordering routines.
 //
@@ -363,6 +447,46 @@ MlasReorderFilterOIHWBo(
     float* D
     );
 
+void
+MLASCALL
+MlasReorderInput(
+    const int64_t* InputShape,
+    const uint8_t* S,
+    uint8_t* D
+    );
+
+void
+MLASCALL
+MlasReorderOutputNchw(
+    const int64_t* OutputShape,
+    const uint8_t* S,
+    uint8_t* D
+    );
+
+void
+MLASCALL
+MlasReorderOutputNhwc(
+    const int64_t* OutputShape,
+    const uint8_t* S,
+    uint8_t* D
+    );
+
+void
+MLASCALL
+MlasReorderFilterOIHWBiBo(
+    const int64_t* FilterShape,
+    const uint8_t* S,
+    uint8_t* D
+    );
+
+void
+MLASCALL
+MlasReorderFilterOIHWBo(
+    const int64_t* FilterShape,
+    const uint8_t* S,
+    uint8_t* D
+    );
+
 //
 // Single precision NCHWc routines.
 //
@@ -416,6 +540,46 @@ MlasNchwcUpsample(
     float* Output
     );
 
+//
+// Quantized NCHWc routines.
+//
+
+void
+MLASCALL
+MlasNchwcConv(
+    const int64_t* InputShape,
+    const int64_t* KernelShape,
+    const int64_t* DilationShape,
+    const int64_t* Padding,
+    const int64_t* StrideShape,
+    const int64_t* OutputShape,
+    size_t GroupCount,
+    const uint8_t* Input,
+    uint8_t InputZeroPoint,
+    const uint8_t* Filter,
+    uint8_t FilterZeroPoint,
+    const int32_t* Bias,
+    uint8_t* Output,
+    float OutputScale,
+    uint8_t OutputZeroPoint,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+void
+MLASCALL
+MlasNchwcPool(
+    MLAS_POOLING_KIND PoolingKind,
+    const int64_t* InputShape,
+    const int64_t* KernelShape,
+    const int64_t* DilationShape,
+    const int64_t* Padding,
+    const int64_t* StrideShape,
+    const int64_t* OutputShape,
+    const uint8_t* Input,
+    uint8_t* Output,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 //
 // Linear quantization routines.
 //
@@ -442,3 +606,16 @@ MlasRequantizeOutput(
     float Scale,
     uint8_t ZeroPoint
     );
+
+void
+MLASCALL
+MlasRequantizeOutput(
+    const int32_t* Input,
+    uint8_t* Output,
+    const int32_t* Bias,
+    size_t M,
+    size_t N,
+    const float* Scale,
+    bool PerColumnScale,
+    uint8_t ZeroPoint
+    );
@@ -23,6 +23,13 @@ Abstract:
 #define MLAS_CONV_WORKING_BUFFER_SIZE_PER_THREAD \
     (MLAS_SGEMM_STRIDEN * MLAS_SGEMM_STRIDEK)
 
+//
+// Define the maximum number of input channels and filters per group that are
+// convolved directly instead of with a GEMM per group.
+//
+
+#define MLAS_CONV_DEPTHWISE_MAXIMUM_CHANNELS 8
+
 //
 // Define the parameters to execute segments of a convolution operation on
 // worker threads.
@@ -736,6 +743,291 @@ Return Value:
     }
 }
 
+MLAS_FORCEINLINE
+void
+MlasConvDepthwiseAccumulate(
+    float* Output,
+    const float* Input,
+    float Weight,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine accumulates a contiguous row of input elements scaled by a
+    filter weight to a row of output elements.
+
+Arguments:
+
+    Output - Supplies the output row.
+
+    Input - Supplies the input row.
+
+    Weight - Supplies the filter weight.
+
+    Count - Supplies the number of elements to accumulate.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_FLOAT32X4 WeightVector = MlasBroadcastFloat32x4(Weight);
+
+    while (Count >= 8) {
+
+        MLAS_FLOAT32X4 Output0 = MlasLoadFloat32x4(Output);
+        MLAS_FLOAT32X4 Output1 = MlasLoadFloat32x4(Output + 4);
+
+        Output0 = MlasMultiplyAddFloat32x4(MlasLoadFloat32x4(Input), WeightVector, Output0);
+        Output1 = MlasMultiplyAddFloat32x4(MlasLoadFloat32x4(Input + 4), WeightVector, Output1);
+
+        MlasStoreFloat32x4(Output, Output0);
+        MlasStoreFloat32x4(Output + 4, Output1);
+
+        Output += 8;
+        Input += 8;
+        Count -= 8;
+    }
+
+    if (Count >= 4) {
+
+        MLAS_FLOAT32X4 Output0 = MlasLoadFloat32x4(Output);
+        Output0 = MlasMultiplyAddFloat32x4(MlasLoadFloat32x4(Input), WeightVector, Output0);
+        MlasStoreFloat32x4(Output, Output0);
+
+        Output += 4;
+        Input += 4;
+        Count -= 4;
+    }
+
+    while (Count > 0) {
+
+        *Output++ += *Input++ * Weight;
+        Count--;
+    }
+}
+
+void
+MlasConvDepthwiseOperation(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    const float* Filter,
+    const float* Bias,
+    float* Output
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the convolution of the input channels of a group
+    with a single filter, without expanding the input tensor. This is used for
+    depthwise convolutions and for grouped convolutions with few channels per
+    group, where a GEMM per group would be too small to be efficient.
+
+    Every output row is accumulated from the input rows under the kernel. For
+    each kernel element, the range of output columns that read inside the
+    input is computed once, so padding does not need to be checked per
+    element.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    Input - Supplies the input channels of the group.
+
+    Filter - Supplies the filter weights for the output channel.
+
+    Bias - Optionally supplies the bias for the output channel.
+
+    Output - Supplies the output channel.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t InputChannels = Parameters->InputChannels;
+    const size_t InputHeight = Parameters->InputShape[0];
+    const size_t InputWidth = Parameters->InputShape[1];
+    const size_t InputSize = Parameters->InputSize;
+    const size_t OutputHeight = Parameters->OutputShape[0];
+    const size_t OutputWidth = Parameters->OutputShape[1];
+    const size_t KernelHeight = Parameters->KernelShape[0];
+    const size_t KernelWidth = Parameters->KernelShape[1];
+    const size_t DilationHeight = Parameters->DilationShape[0];
+    const size_t DilationWidth = Parameters->DilationShape[1];
+    const size_t PaddingLeftY = Parameters->Padding[0];
+    const size_t PaddingLeftX = Parameters->Padding[1];
+    const size_t StrideHeight = Parameters->StrideShape[0];
+    const size_t StrideWidth = Parameters->StrideShape[1];
+
+    for (size_t oh = 0; oh < OutputHeight; oh++) {
+
+        float* output = Output + oh * OutputWidth;
+
+        std::fill_n(output, OutputWidth, 0.0f);
+
+        const float* filter = Filter;
+
+        for (size_t ic = 0; ic < InputChannels; ic++) {
+
+            const float* input = Input + ic * InputSize;
+
+            for (size_t ky = 0; ky < KernelHeight; ky++) {
+
+                size_t ih = oh * StrideHeight + ky * DilationHeight - PaddingLeftY;
+
+                //
+                // Skip the kernel rows that read the padding.
+                //
+
+                if (ih >= InputHeight) {
+                    filter += KernelWidth;
+                    continue;
+                }
+
+                const float* input_row = input + ih * InputWidth;
+
+                for (size_t kx = 0; kx < KernelWidth; kx++) {
+
+                    const float Weight = *filter++;
+
+                    //
+                    // Compute the range of output columns where the input
+                    // column (ow * StrideWidth + Offset) is inside the input.
+                    //
+
+                    const ptrdiff_t Offset = ptrdiff_t(kx * DilationWidth) - ptrdiff_t(PaddingLeftX);
+
+                    size_t ow_start = 0;
+
+                    if (Offset < 0) {
+                        ow_start = (size_t(-Offset) + StrideWidth - 1) / StrideWidth;
+                    }
+
+                    if (Offset >= ptrdiff_t(InputWidth)) {
+                        continue;
+                    }
+
+                    size_t ow_end = (InputWidth - 1 - Offset) / StrideWidth + 1;
+
+                    if (ow_end > OutputWidth) {
+                        ow_end = OutputWidth;
+                    }
+
+                    if (ow_start >= ow_end) {
+                        continue;
+                    }
+
+                    const float* input_column = input_row + (ow_start * StrideWidth + Offset);
+
+                    if (StrideWidth == 1) {
+
+                        MlasConvDepthwiseAccumulate(output + ow_start, input_column, Weight,
+                            ow_end - ow_start);
+
+                    } else {
+
+                        for (size_t ow = ow_start; ow < ow_end; ow++) {
+                            output[ow] += *input_column * Weight;
+                            input_column += StrideWidth;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    //
+    // Apply the activation with optional bias.
+    //
+
+    MlasActivation(Parameters->Activation, Output, Bias, 1, OutputHeight * OutputWidth,
+        OutputHeight * OutputWidth);
+}
+
+void
+MlasConvDepthwiseThreaded(
+    void* Context,
+    int32_t Index
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of a
+    depthwise or grouped convolution operation.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    Index - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_CONV_WORK_BLOCK* WorkBlock = (MLAS_CONV_WORK_BLOCK*)Context;
+
+    const MLAS_CONV_PARAMETERS* Parameters = WorkBlock->Parameters;
+
+    //
+    // Compute the range of output channels to use for this thread.
+    //
+
+    const size_t GroupCount = Parameters->GroupCount;
+    const size_t FilterCount = Parameters->FilterCount;
+    const size_t TotalFilterCount = Parameters->BatchCount * GroupCount * FilterCount;
+
+    const size_t TargetThreadCount = WorkBlock->TargetThreadCount;
+
+    const size_t FilterCountPerThread = TotalFilterCount / TargetThreadCount;
+    const size_t FilterCountExtra = TotalFilterCount % TargetThreadCount;
+
+    size_t FilterStart;
+    size_t FilterEnd;
+
+    if (uint32_t(Index) < FilterCountExtra) {
+        FilterStart = (FilterCountPerThread + 1) * Index;
+        FilterEnd = FilterStart + FilterCountPerThread + 1;
+    } else {
+        FilterStart = FilterCountPerThread * Index + FilterCountExtra;
+        FilterEnd = FilterStart + FilterCountPerThread;
+    }
+
+    //
+    // Iterate over the output channels allocated to this thread.
+    //
+
+    const size_t OutputSize = Parameters->OutputSize;
+    const size_t K = Parameters->K;
+
+    const size_t InputGroupSize = Parameters->InputChannels * Parameters->InputSize;
+
+    for (size_t f = FilterStart; f < FilterEnd; f++) {
+
+        const size_t bg = f / FilterCount;
+        const size_t filter = f % (GroupCount * FilterCount);
+
+        const float* bias = WorkBlock->Bias;
+
+        if (bias != nullptr) {
+            bias += filter;
+        }
+
+        MlasConvDepthwiseOperation(Parameters, WorkBlock->Input + bg * InputGroupSize,
+            WorkBlock->Filter + filter * K, bias, WorkBlock->Output + f * OutputSize);
+    }
+}
+
 inline
 bool
 MlasConvTryMultithread(
@@ -855,7 +1147,8 @@ Arguments:
     Bias - Optionally supplies the bias vector.
 
     WorkingBuffer - Supplies a working buffer sized to the number of elements
-        returned by MlasConvPrepare.
+        returned by MlasConvPrepare, less MlasConvTransformedFilterSize
+        elements if the parameters supply a transformed filter.
 
     Output - Supplies the output tensor.
 
@@ -881,6 +1174,33 @@ Return Value:
 
     const MLAS_CONV_ALGORITHM Algorithm = Parameters->Algorithm;
 
+    //
+    // Schedule the output channels of all batches and groups of a depthwise
+    // convolution across multiple threads.
+    //
+
+    if (Algorithm == MlasConvAlgorithmDepthwise) {
+
+        MLAS_CONV_WORK_BLOCK WorkBlock;
+
+        WorkBlock.Parameters = Parameters;
+        WorkBlock.Input = Input;
+        WorkBlock.Filter = Filter;
+        WorkBlock.Bias = Bias;
+        WorkBlock.WorkingBuffer = nullptr;
+        WorkBlock.Output = Output;
+        WorkBlock.TargetThreadCount = Parameters->ThreadCount;
+
+        MlasExecuteThreaded(MlasConvDepthwiseThreaded, &WorkBlock, Parameters->ThreadCount, ThreadPool);
+
+        return;
+    }
+
+    if (Algorithm == MlasConvAlgorithmWinograd) {
+        MlasConvWinograd(Parameters, Input, Filter, Bias, WorkingBuffer, Output, ThreadPool);
+        return;
+    }
+
     //
     // Schedule batches of GEMMs across multiple threads.
     //
@@ -988,6 +1308,18 @@ Return Value:
 
                     break;
                 }
+
+                case MlasConvAlgorithmDepthwise:
+                case MlasConvAlgorithmWinograd:
+                case MlasConvAlgorithmTranspose:
+                {
+                    //
+                    // These algorithms process every batch and group and are
+                    // dispatched above, or only apply to MlasConvTranspose.
+                    //
+
+                    break;
+                }
             }
 
             //
@@ -1148,6 +1480,47 @@ Return Value:
 
     *WorkingBufferSize = 0;
 
+    if (Dimensions == 2 && GroupCount > 1 &&
+        InputChannels <= MLAS_CONV_DEPTHWISE_MAXIMUM_CHANNELS &&
+        FilterCount <= MLAS_CONV_DEPTHWISE_MAXIMUM_CHANNELS) {
+
+        //
+        // Convolve the groups directly, as a GEMM per group would be too small
+        // to be efficient. The output channels of all batches and groups are
+        // sliced across threads given the complexity of the operation.
+        //
+
+        size_t TotalFilterCount = BatchCount * GroupCount * FilterCount;
+        double Complexity = double(TotalFilterCount) * double(OutputSize) * double(K);
+
+        int32_t TargetThreadCount;
+
+        if (Complexity < double(MLAS_SGEMM_THREAD_COMPLEXITY * MLAS_MAXIMUM_THREAD_COUNT)) {
+            TargetThreadCount = int32_t(Complexity / double(MLAS_SGEMM_THREAD_COMPLEXITY)) + 1;
+        } else {
+            TargetThreadCount = MLAS_MAXIMUM_THREAD_COUNT;
+        }
+
+        int32_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+        if (TargetThreadCount >= MaximumThreadCount) {
+            TargetThreadCount = MaximumThreadCount;
+        }
+
+        if (size_t(TargetThreadCount) >= TotalFilterCount) {
+            TargetThreadCount = int32_t(TotalFilterCount);
+        }
+
+        Parameters->Algorithm = MlasConvAlgorithmDepthwise;
+        Parameters->ThreadCount = TargetThreadCount;
+
+        return;
+    }
+
+    if (MlasConvWinogradPrepare(Parameters, WorkingBufferSize, ThreadPool)) {
+        return;
+    }
+
     if (AllStridesAreOne && AllPaddingIsZero) {
 
         //
@@ -1257,3 +1630,89 @@ Return Value:
         *WorkingBufferSize = TargetThreadCount * MLAS_CONV_WORKING_BUFFER_SIZE_PER_THREAD;
     }
 }
+
+size_t
+MLASCALL
+MlasConvTransformedFilterSize(
+    const MLAS_CONV_PARAMETERS* Parameters
+    )
+/*++
+
+Routine Description:
+
+    This routine returns the number of elements of the transformed filter
+    used by the convolution algorithm selected by MlasConvPrepare or
+    MlasConvTransposePrepare.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+Return Value:
+
+    Returns the number of elements of the transformed filter, or zero if the
+    convolution algorithm uses the filter directly.
+
+--*/
+{
+    switch (Parameters->Algorithm) {
+
+        case MlasConvAlgorithmWinograd:
+            return MlasConvWinogradTransformedFilterSize(Parameters);
+
+        case MlasConvAlgorithmTranspose:
+            return Parameters->GroupCount * Parameters->FilterCount * Parameters->K;
+
+        default:
+            return 0;
+    }
+}
+
+void
+MLASCALL
+MlasConvTransformFilter(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Filter,
+    float* TransformedFilter
+    )
+/*++
+
+Routine Description:
+
+    This routine transforms the filter for the convolution algorithm selected
+    by MlasConvPrepare or MlasConvTransposePrepare. The transformed filter can
+    be reused by convolutions with the same filter and algorithm by storing it
+    to the parameters (see MLAS_CONV_PARAMETERS).
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    Filter - Supplies the filter tensor.
+
+    TransformedFilter - Supplies the buffer to receive the transformed filter,
+        sized to the number of elements returned by
+        MlasConvTransformedFilterSize.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    switch (Parameters->Algorithm) {
+
+        case MlasConvAlgorithmWinograd:
+            MlasConvWinogradTransformFilter(Parameters, Filter, TransformedFilter);
+            break;
+
+        case MlasConvAlgorithmTranspose:
+            MlasConvTransposePackFilter(Parameters, Filter, TransformedFilter);
+            break;
+
+        default:
+            break;
+    }
+}
@@ -0,0 +1,922 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    convtranspose.cpp
+
+Abstract:
+
+    This module implements the transposed convolution operation.
+
+    The output is decomposed into StrideHeight * StrideWidth phases, where each
+    phase holds the output positions that share the same offset modulo the
+    stride. Every output position of a phase is reached by the same subset of
+    the kernel taps, so a phase is a unit stride convolution of the input with
+    a subset of the filter. Blocks of output rows of a phase are computed with
+    a GEMM of the repacked filter and an expanded block of the input, then the
+    bias and activation are applied before the block is stored to the output.
+
+    Unlike the GEMM and col2im formulation, the operation does not allocate a
+    column buffer for the whole image and does not accumulate into the output.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Define the target number of output positions of a phase to compute per
+// block. Blocks are made of whole rows of a phase.
+//
+
+#define MLAS_CONV_TRANSPOSE_TILE_ELEMENTS 256
+
+//
+// Define the alignment of the number of filters per block when the filters
+// are partitioned across threads.
+//
+
+#define MLAS_CONV_TRANSPOSE_FILTER_ALIGN 16
+
+//
+// Define the output positions and kernel taps of a phase of the transposed
+// convolution. The output positions of a phase along a dimension are
+// (GridStart + i) * Stride + Residue - Padding for i in [0, GridCount) and
+// the kernel taps are TapStart + t * TapStep for t in [0, TapCount).
+//
+
+struct MLAS_CONV_TRANSPOSE_PHASE {
+    size_t Residue[2];
+    size_t TapStart[2];
+    size_t TapStep[2];
+    size_t TapCount[2];
+    size_t GridStart[2];
+    size_t GridCount[2];
+    size_t FilterOffset;
+};
+
+//
+// Define the parameters to execute segments of a transposed convolution on
+// worker threads.
+//
+
+struct MLAS_CONV_TRANSPOSE_WORK_BLOCK {
+    const MLAS_CONV_PARAMETERS* Parameters;
+    const float* Input;
+    const float* PackedFilter;
+    const float* Bias;
+    float* WorkingBuffer;
+    float* Output;
+    size_t WorkingBufferSizePerThread;
+    int32_t TargetThreadCount;
+};
+
+size_t
+MlasConvTransposeGetTaps(
+    size_t KernelSize,
+    size_t Dilation,
+    size_t Stride,
+    size_t Residue,
+    size_t* TapStart,
+    size_t* TapStep
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the kernel taps along a dimension that reach the
+    output positions of the phase with the specified residue, which are the
+    taps k where k * Dilation is congruent to the residue modulo the stride.
+
+Arguments:
+
+    KernelSize - Supplies the size of the kernel along the dimension.
+
+    Dilation - Supplies the dilation along the dimension.
+
+    Stride - Supplies the stride along the dimension.
+
+    Residue - Supplies the residue of the phase along the dimension.
+
+    TapStart - Receives the first kernel tap.
+
+    TapStep - Receives the distance between kernel taps.
+
+Return Value:
+
+    Returns the number of kernel taps.
+
+--*/
+{
+    //
+    // The residue of k * Dilation repeats with a period of Stride divided by
+    // the greatest common divisor of the dilation and stride.
+    //
+
+    size_t a = Dilation;
+    size_t b = Stride;
+
+    while (b != 0) {
+        size_t t = a % b;
+        a = b;
+        b = t;
+    }
+
+    const size_t Period = Stride / a;
+
+    *TapStep = Period;
+
+    for (size_t k = 0; k < Period && k < KernelSize; k++) {
+        if ((k * Dilation) % Stride == Residue) {
+            *TapStart = k;
+            return (KernelSize - k + Period - 1) / Period;
+        }
+    }
+
+    *TapStart = KernelSize;
+
+    return 0;
+}
+
+void
+MlasConvTransposeGetPhase(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    size_t PhaseIndex,
+    MLAS_CONV_TRANSPOSE_PHASE* Phase
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the output positions and kernel taps of a phase of
+    the transposed convolution.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    PhaseIndex - Supplies the index of the phase.
+
+    Phase - Receives the output positions and kernel taps of the phase.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t StrideWidth = Parameters->StrideShape[1];
+
+    Phase->Residue[0] = PhaseIndex / StrideWidth;
+    Phase->Residue[1] = PhaseIndex % StrideWidth;
+
+    for (size_t dim = 0; dim < 2; dim++) {
+
+        const size_t Stride = Parameters->StrideShape[dim];
+        const size_t Padding = Parameters->Padding[dim];
+        const size_t Residue = Phase->Residue[dim];
+
+        Phase->TapCount[dim] = MlasConvTransposeGetTaps(Parameters->KernelShape[dim],
+            Parameters->DilationShape[dim], Stride, Residue, &Phase->TapStart[dim],
+            &Phase->TapStep[dim]);
+
+        size_t GridStart = (Padding > Residue) ? (Padding - Residue + Stride - 1) / Stride : 0;
+        size_t GridEnd = (Parameters->OutputShape[dim] + Padding - Residue + Stride - 1) / Stride;
+
+        Phase->GridStart[dim] = GridStart;
+        Phase->GridCount[dim] = (GridEnd > GridStart) ? GridEnd - GridStart : 0;
+    }
+
+    //
+    // The packed filter stores the taps of each phase in phase order.
+    //
+
+    size_t TapOffset = 0;
+
+    for (size_t p = 0; p < PhaseIndex; p++) {
+
+        size_t TapStart;
+        size_t TapStep;
+
+        TapOffset += MlasConvTransposeGetTaps(Parameters->KernelShape[0],
+                Parameters->DilationShape[0], Parameters->StrideShape[0], p / StrideWidth,
+                &TapStart, &TapStep) *
+            MlasConvTransposeGetTaps(Parameters->KernelShape[1],
+                Parameters->DilationShape[1], StrideWidth, p % StrideWidth, &TapStart, &TapStep);
+    }
+
+    Phase->FilterOffset = TapOffset * Parameters->FilterCount * Parameters->InputChannels;
+}
+
+void
+MlasConvTransposePackFilter(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Filter,
+    float* PackedFilter
+    )
+/*++
+
+Routine Description:
+
+    This routine repacks the filter of every group to a matrix of shape
+    FilterCount by InputChannels * TapCount for each phase, in phase order.
+
+    The filter tensor has the shape GroupCount * InputChannels by FilterCount
+    by KernelHeight by KernelWidth.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    Filter - Supplies the filter tensor.
+
+    PackedFilter - Supplies the buffer to receive the packed filter.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t InputChannels = Parameters->InputChannels;
+    const size_t FilterCount = Parameters->FilterCount;
+    const size_t KernelHeight = Parameters->KernelShape[0];
+    const size_t KernelWidth = Parameters->KernelShape[1];
+    const size_t KernelSize = KernelHeight * KernelWidth;
+    const size_t PhaseCount = Parameters->StrideShape[0] * Parameters->StrideShape[1];
+
+    for (size_t group = 0; group < Parameters->GroupCount; group++) {
+
+        const float* filter = Filter + group * InputChannels * FilterCount * KernelSize;
+
+        for (size_t phase = 0; phase < PhaseCount; phase++) {
+
+            MLAS_CONV_TRANSPOSE_PHASE Phase;
+
+            MlasConvTransposeGetPhase(Parameters, phase, &Phase);
+
+            for (size_t f = 0; f < FilterCount; f++) {
+
+                for (size_t c = 0; c < InputChannels; c++) {
+
+                    const float* filter_cf = filter + (c * FilterCount + f) * KernelSize;
+
+                    for (size_t kh = Phase.TapStart[0]; kh < KernelHeight; kh += Phase.TapStep[0]) {
+
+                        for (size_t kw = Phase.TapStart[1]; kw < KernelWidth; kw += Phase.TapStep[1]) {
+                            *PackedFilter++ = filter_cf[kh * KernelWidth + kw];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+void
+MlasConvTransposeExpandInput(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const MLAS_CONV_TRANSPOSE_PHASE* Phase,
+    const float* Input,
+    size_t RowStart,
+    size_t RowCount,
+    float* ExpandedInput
+    )
+/*++
+
+Routine Description:
+
+    This routine expands a block of rows of a phase to a matrix of shape
+    InputChannels * TapCount by RowCount * GridWidth, matching the order of
+    the packed filter.
+
+    The output position at grid index (i, j) of a phase is reached by the
+    input position (i - eh, j - ew) through the kernel tap (kh, kw), where
+    eh = (kh * DilationHeight - ResidueHeight) / StrideHeight and likewise for
+    ew. Input positions outside of the image are zero.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    Phase - Supplies the output positions and kernel taps of the phase.
+
+    Input - Supplies the input tensor for the batch and group.
+
+    RowStart - Supplies the first grid row of the block.
+
+    RowCount - Supplies the number of grid rows of the block.
+
+    ExpandedInput - Supplies the buffer to receive the expanded input.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t InputHeight = Parameters->InputShape[0];
+    const size_t InputWidth = Parameters->InputShape[1];
+    const size_t InputSize = Parameters->InputSize;
+    const size_t KernelHeight = Parameters->KernelShape[0];
+    const size_t KernelWidth = Parameters->KernelShape[1];
+    const size_t DilationHeight = Parameters->DilationShape[0];
+    const size_t DilationWidth = Parameters->DilationShape[1];
+    const size_t StrideHeight = Parameters->StrideShape[0];
+    const size_t StrideWidth = Parameters->StrideShape[1];
+
+    const size_t ResidueHeight = Phase->Residue[0];
+    const size_t ResidueWidth = Phase->Residue[1];
+    const size_t GridRowStart = Phase->GridStart[0] + RowStart;
+    const size_t GridColumnStart = Phase->GridStart[1];
+    const size_t GridWidth = Phase->GridCount[1];
+
+    for (size_t c = 0; c < Parameters->InputChannels; c++) {
+
+        const float* input = Input + c * InputSize;
+
+        for (size_t kh = Phase->TapStart[0]; kh < KernelHeight; kh += Phase->TapStep[0]) {
+
+            const size_t eh = (kh * DilationHeight - ResidueHeight) / StrideHeight;
+
+            for (size_t kw = Phase->TapStart[1]; kw < KernelWidth; kw += Phase->TapStep[1]) {
+
+                const size_t ew = (kw * DilationWidth - ResidueWidth) / StrideWidth;
+
+                //
+                // Compute the range of grid columns that map to input columns
+                // inside of the image, where iw = GridColumnStart + j - ew.
+                //
+
+                size_t ValidStart = (ew > GridColumnStart) ? ew - GridColumnStart : 0;
+                size_t ValidEnd = InputWidth + ew;
+
+                ValidEnd = (ValidEnd > GridColumnStart) ? ValidEnd - GridColumnStart : 0;
+
+                if (ValidEnd > GridWidth) {
+                    ValidEnd = GridWidth;
+                }
+
+                if (ValidStart > ValidEnd) {
+                    ValidStart = ValidEnd;
+                }
+
+                for (size_t row = 0; row < RowCount; row++) {
+
+                    size_t ih = GridRowStart + row - eh;
+
+                    if (GridRowStart + row < eh || ih >= InputHeight) {
+                        std::fill_n(ExpandedInput, GridWidth, 0.0f);
+                    } else {
+
+                        const float* input_row = input + ih * InputWidth + (GridColumnStart + ValidStart - ew);
+
+                        std::fill_n(ExpandedInput, ValidStart, 0.0f);
+                        std::copy(input_row, input_row + (ValidEnd - ValidStart), ExpandedInput + ValidStart);
+                        std::fill_n(ExpandedInput + ValidEnd, GridWidth - ValidEnd, 0.0f);
+                    }
+
+                    ExpandedInput += GridWidth;
+                }
+            }
+        }
+    }
+}
+
+void
+MlasConvTransposeStoreOutput(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const MLAS_CONV_TRANSPOSE_PHASE* Phase,
+    const float* Buffer,
+    size_t FilterCount,
+    size_t RowStart,
+    size_t RowCount,
+    float* Output
+    )
+/*++
+
+Routine Description:
+
+    This routine stores a block of rows of a phase to the output positions of
+    the phase.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    Phase - Supplies the output positions and kernel taps of the phase.
+
+    Buffer - Supplies the block of rows of the phase, as a matrix of shape
+        FilterCount by RowCount * GridWidth.
+
+    FilterCount - Supplies the number of filters of the block.
+
+    RowStart - Supplies the first grid row of the block.
+
+    RowCount - Supplies the number of grid rows of the block.
+
+    Output - Supplies the output tensor for the first filter of the block.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t OutputWidth = Parameters->OutputShape[1];
+    const size_t OutputSize = Parameters->OutputSize;
+    const size_t StrideHeight = Parameters->StrideShape[0];
+    const size_t StrideWidth = Parameters->StrideShape[1];
+    const size_t GridWidth = Phase->GridCount[1];
+
+    const size_t OutputRowStart = (Phase->GridStart[0] + RowStart) * StrideHeight +
+        Phase->Residue[0] - Parameters->Padding[0];
+    const size_t OutputColumnStart = Phase->GridStart[1] * StrideWidth +
+        Phase->Residue[1] - Parameters->Padding[1];
+
+    for (size_t f = 0; f < FilterCount; f++) {
+
+        float* output = Output + f * OutputSize + OutputRowStart * OutputWidth + OutputColumnStart;
+
+        for (size_t row = 0; row < RowCount; row++) {
+
+            if (StrideWidth == 1) {
+                std::copy(Buffer, Buffer + GridWidth, output);
+            } else {
+                for (size_t j = 0; j < GridWidth; j++) {
+                    output[j * StrideWidth] = Buffer[j];
+                }
+            }
+
+            Buffer += GridWidth;
+            output += StrideHeight * OutputWidth;
+        }
+    }
+}
+
+void
+MlasConvTransposeThreaded(
+    void* Context,
+    int32_t Index
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of a
+    transposed convolution operation.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    Index - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_CONV_TRANSPOSE_WORK_BLOCK* WorkBlock = (MLAS_CONV_TRANSPOSE_WORK_BLOCK*)Context;
+
+    const MLAS_CONV_PARAMETERS* Parameters = WorkBlock->Parameters;
+
+    //
+    // Compute the range of blocks to use for this thread. The blocks are
+    // ordered by batch, group, phase, row block and then filter block, so
+    // that a thread reuses the expanded input for consecutive filter blocks.
+    //
+
+    const size_t GroupCount = Parameters->GroupCount;
+    const size_t FilterCount = Parameters->FilterCount;
+    const size_t PhaseCount = Parameters->StrideShape[0] * Parameters->StrideShape[1];
+    const size_t RowsPerBlock = Parameters->u.ConvTranspose.RowsPerBlock;
+    const size_t RowBlockCount = Parameters->u.ConvTranspose.RowBlockCount;
+    const size_t FilterCountPerBlock = Parameters->u.ConvTranspose.FilterCountPerBlock;
+    const size_t FilterBlockCount = (FilterCount + FilterCountPerBlock - 1) / FilterCountPerBlock;
+    const size_t TotalBlockCount = Parameters->BatchCount * GroupCount * PhaseCount *
+        RowBlockCount * FilterBlockCount;
+
+    const size_t TargetThreadCount = WorkBlock->TargetThreadCount;
+
+    const size_t BlockCountPerThread = TotalBlockCount / TargetThreadCount;
+    const size_t BlockCountExtra = TotalBlockCount % TargetThreadCount;
+
+    size_t BlockStart;
+    size_t BlockEnd;
+
+    if (uint32_t(Index) < BlockCountExtra) {
+        BlockStart = (BlockCountPerThread + 1) * Index;
+        BlockEnd = BlockStart + BlockCountPerThread + 1;
+    } else {
+        BlockStart = BlockCountPerThread * Index + BlockCountExtra;
+        BlockEnd = BlockStart + BlockCountPerThread;
+    }
+
+    //
+    // Iterate over the blocks allocated to this thread.
+    //
+
+    const size_t InputChannels = Parameters->InputChannels;
+    const size_t InputGroupSize = InputChannels * Parameters->InputSize;
+    const size_t OutputGroupSize = FilterCount * Parameters->OutputSize;
+    const size_t FilterGroupSize = FilterCount * Parameters->K;
+
+    float* ExpandedInput = WorkBlock->WorkingBuffer + Index * WorkBlock->WorkingBufferSizePerThread;
+    float* GemmOutput = ExpandedInput + Parameters->u.ConvTranspose.ExpandedInputSize;
+
+    size_t ExpandedBlock = SIZE_MAX;
+
+    for (size_t block = BlockStart; block < BlockEnd; block++) {
+
+        const size_t FilterBlock = block % FilterBlockCount;
+        const size_t RowBlock = (block / FilterBlockCount) % RowBlockCount;
+        const size_t PhaseIndex = (block / (FilterBlockCount * RowBlockCount)) % PhaseCount;
+        const size_t bg = block / (FilterBlockCount * RowBlockCount * PhaseCount);
+        const size_t group = bg % GroupCount;
+
+        MLAS_CONV_TRANSPOSE_PHASE Phase;
+
+        MlasConvTransposeGetPhase(Parameters, PhaseIndex, &Phase);
+
+        const size_t RowStart = RowBlock * RowsPerBlock;
+
+        if (RowStart >= Phase.GridCount[0] || Phase.GridCount[1] == 0) {
+            continue;
+        }
+
+        size_t RowCount = Phase.GridCount[0] - RowStart;
+
+        if (RowCount > RowsPerBlock) {
+            RowCount = RowsPerBlock;
+        }
+
+        const size_t K = InputChannels * Phase.TapCount[0] * Phase.TapCount[1];
+        const size_t N = RowCount * Phase.GridCount[1];
+
+        //
+        // Expand the input for the row block unless the previous filter block
+        // of this thread already expanded it.
+        //
+
+        if (K > 0 && ExpandedBlock != block / FilterBlockCount) {
+            MlasConvTransposeExpandInput(Parameters, &Phase, WorkBlock->Input + bg * InputGroupSize,
+                RowStart, RowCount, ExpandedInput);
+            ExpandedBlock = block / FilterBlockCount;
+        }
+
+        const size_t FilterStart = FilterBlock * FilterCountPerBlock;
+
+        size_t FilterBlockSize = FilterCount - FilterStart;
+
+        if (FilterBlockSize > FilterCountPerBlock) {
+            FilterBlockSize = FilterCountPerBlock;
+        }
+
+        //
+        // Phases without any kernel taps only receive the bias.
+        //
+
+        if (K > 0) {
+            MlasSgemmOperation(CblasNoTrans, CblasNoTrans, FilterBlockSize, N, K, 1.0f,
+                WorkBlock->PackedFilter + group * FilterGroupSize + Phase.FilterOffset + FilterStart * K,
+                K, ExpandedInput, N, 0.0f, GemmOutput, N);
+        } else {
+            std::fill_n(GemmOutput, FilterBlockSize * N, 0.0f);
+        }
+
+        const float* bias = WorkBlock->Bias;
+
+        if (bias != nullptr) {
+            bias += group * FilterCount + FilterStart;
+        }
+
+        MlasActivation(Parameters->Activation, GemmOutput, bias, FilterBlockSize, N, N);
+
+        MlasConvTransposeStoreOutput(Parameters, &Phase, GemmOutput, FilterBlockSize, RowStart,
+            RowCount, WorkBlock->Output + bg * OutputGroupSize + FilterStart * Parameters->OutputSize);
+    }
+}
+
+void
+MLASCALL
+MlasConvTransposePrepare(
+    MLAS_CONV_PARAMETERS* Parameters,
+    size_t Dimensions,
+    size_t BatchCount,
+    size_t GroupCount,
+    size_t InputChannels,
+    const int64_t* InputShape,
+    const int64_t* KernelShape,
+    const int64_t* DilationShape,
+    const int64_t* Padding,
+    const int64_t* StrideShape,
+    const int64_t* OutputShape,
+    size_t FilterCount,
+    const MLAS_ACTIVATION* Activation,
+    size_t* WorkingBufferSize,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine prepares for a transposed convolution operation by computing
+    required parameters including the required working buffer size for
+    intermediate results.
+
+Arguments:
+
+    Parameters - Supplies the structure that stores the provided and computed
+        parameters for the transposed convolution operation.
+
+    Dimensions - Supplies the number of dimensions (must be 1 or 2).
+
+    BatchCount - Supplies the number of batches to the processed.
+
+    GroupCount - Supplies the number of channel groups.
+
+    InputChannels - Supplies the number of input channels per group.
+
+    InputShape - Supplies the shape of the input tensor.
+
+    KernelShape - Supplies the shape of the kernel transform.
+
+    DilationShape - Supplies the shape of the dilation.
+
+    Padding - Supplies the number of padding elements at the edge of the
+        output tensor.
+
+    StrideShape - Supplies the shape of the stride.
+
+    OutputShape - Supplies the shape of the output tensor.
+
+    FilterCount - Supplies the number of output channels per group.
+
+    Activation - Supplies the parameters for the activation to apply to the
+        transposed convolution output.
+
+    WorkingBufferSize - Receives the number of elements to allocate for the
+        working buffer for intermediate results. This includes the
+        MlasConvTransformedFilterSize elements of the packed filter, which are
+        not needed if the caller supplies a packed filter.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    //
+    // Save the transposed convolution parameters. One dimensional operations
+    // are promoted to two dimensional operations with a unit height.
+    //
+
+    Parameters->Activation = Activation;
+    Parameters->Dimensions = 2;
+    Parameters->BatchCount = BatchCount;
+    Parameters->GroupCount = GroupCount;
+    Parameters->InputChannels = InputChannels;
+    Parameters->FilterCount = FilterCount;
+
+    const size_t DimensionOffset = 2 - Dimensions;
+
+    size_t InputSize = 1;
+    size_t OutputSize = 1;
+    size_t K = InputChannels;
+
+    for (size_t dim = 0; dim < 2; dim++) {
+
+        if (dim < DimensionOffset) {
+
+            Parameters->InputShape[dim] = 1;
+            Parameters->OutputShape[dim] = 1;
+            Parameters->KernelShape[dim] = 1;
+            Parameters->DilationShape[dim] = 1;
+            Parameters->Padding[dim] = 0;
+            Parameters->Padding[dim + 2] = 0;
+            Parameters->StrideShape[dim] = 1;
+
+        } else {
+
+            const size_t index = dim - DimensionOffset;
+
+            Parameters->InputShape[dim] = size_t(InputShape[index]);
+            Parameters->OutputShape[dim] = size_t(OutputShape[index]);
+            Parameters->KernelShape[dim] = size_t(KernelShape[index]);
+            Parameters->DilationShape[dim] = size_t(DilationShape[index]);
+            Parameters->Padding[dim] = size_t(Padding[index]);
+            Parameters->Padding[dim + 2] = size_t(Padding[index + Dimensions]);
+            Parameters->StrideShape[dim] = size_t(StrideShape[index]);
+        }
+
+        InputSize *= Parameters->InputShape[dim];
+        OutputSize *= Parameters->OutputShape[dim];
+        K *= Parameters->KernelShape[dim];
+    }
+
+    Parameters->InputSize = InputSize;
+    Parameters->OutputSize = OutputSize;
+    Parameters->K = K;
+
+    Parameters->Algorithm = MlasConvAlgorithmTranspose;
+
+    //
+    // Compute the size of the largest phase, which has the ceiling of the
+    // output size divided by the stride positions along each dimension, and
+    // the largest number of kernel taps of any phase.
+    //
+
+    const size_t StrideHeight = Parameters->StrideShape[0];
+    const size_t StrideWidth = Parameters->StrideShape[1];
+    const size_t PhaseCount = StrideHeight * StrideWidth;
+    const size_t GridHeight = (Parameters->OutputShape[0] + StrideHeight - 1) / StrideHeight;
+    const size_t GridWidth = (Parameters->OutputShape[1] + StrideWidth - 1) / StrideWidth;
+
+    size_t MaximumTapCount[2] = { 0, 0 };
+
+    for (size_t dim = 0; dim < 2; dim++) {
+        for (size_t Residue = 0; Residue < Parameters->StrideShape[dim]; Residue++) {
+            size_t TapStart;
+            size_t TapStep;
+            size_t TapCount = MlasConvTransposeGetTaps(Parameters->KernelShape[dim],
+                Parameters->DilationShape[dim], Parameters->StrideShape[dim], Residue,
+                &TapStart, &TapStep);
+            if (MaximumTapCount[dim] < TapCount) {
+                MaximumTapCount[dim] = TapCount;
+            }
+        }
+    }
+
+    //
+    // Compute the number of target threads given the complexity of the
+    // transposed convolution operation. Reduce the number of rows per block
+    // until there are enough blocks for the threads, then partition the
+    // filters.
+    //
+
+    const double Complexity = double(BatchCount) * double(GroupCount) * double(FilterCount) *
+        double(K) * double(InputSize);
+
+    int32_t TargetThreadCount;
+
+    if (Complexity < double(MLAS_SGEMM_THREAD_COMPLEXITY * MLAS_MAXIMUM_THREAD_COUNT)) {
+        TargetThreadCount = int32_t(Complexity / double(MLAS_SGEMM_THREAD_COMPLEXITY)) + 1;
+    } else {
+        TargetThreadCount = MLAS_MAXIMUM_THREAD_COUNT;
+    }
+
+    int32_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (TargetThreadCount >= MaximumThreadCount) {
+        TargetThreadCount = MaximumThreadCount;
+    }
+
+    size_t RowsPerBlock = (GridWidth > 0) ? MLAS_CONV_TRANSPOSE_TILE_ELEMENTS / GridWidth : 1;
+
+    if (RowsPerBlock > GridHeight) {
+        RowsPerBlock = GridHeight;
+    }
+
+    if (RowsPerBlock == 0) {
+        RowsPerBlock = 1;
+    }
+
+    const size_t BatchGroupPhaseCount = BatchCount * GroupCount * PhaseCount;
+
+    while (RowsPerBlock > 1 &&
+           BatchGroupPhaseCount * ((GridHeight + RowsPerBlock - 1) / RowsPerBlock) < size_t(TargetThreadCount)) {
+        RowsPerBlock--;
+    }
+
+    const size_t RowBlockCount = (GridHeight + RowsPerBlock - 1) / RowsPerBlock;
+    const size_t BlockCount = BatchGroupPhaseCount * RowBlockCount;
+
+    size_t FilterCountPerBlock = FilterCount;
+
+    if (BlockCount > 0 && BlockCount < size_t(TargetThreadCount)) {
+
+        size_t FilterBlockCount = (size_t(TargetThreadCount) + BlockCount - 1) / BlockCount;
+
+        FilterCountPerBlock = (FilterCount + FilterBlockCount - 1) / FilterBlockCount;
+        FilterCountPerBlock = (FilterCountPerBlock + MLAS_CONV_TRANSPOSE_FILTER_ALIGN - 1) &
+            ~size_t(MLAS_CONV_TRANSPOSE_FILTER_ALIGN - 1);
+
+        if (FilterCountPerBlock > FilterCount) {
+            FilterCountPerBlock = FilterCount;
+        }
+    }
+
+    if (FilterCountPerBlock == 0) {
+        FilterCountPerBlock = 1;
+    }
+
+    const size_t TotalBlockCount = BlockCount *
+        ((FilterCount + FilterCountPerBlock - 1) / FilterCountPerBlock);
+
+    if (size_t(TargetThreadCount) >= TotalBlockCount) {
+        TargetThreadCount = (TotalBlockCount > 0) ? int32_t(TotalBlockCount) : 1;
+    }
+
+    const size_t BlockElements = RowsPerBlock * GridWidth;
+
+    Parameters->ThreadCount = TargetThreadCount;
+    Parameters->u.ConvTranspose.RowsPerBlock = RowsPerBlock;
+    Parameters->u.ConvTranspose.RowBlockCount = RowBlockCount;
+    Parameters->u.ConvTranspose.FilterCountPerBlock = FilterCountPerBlock;
+    Parameters->u.ConvTranspose.ExpandedInputSize = InputChannels * MaximumTapCount[0] *
+        MaximumTapCount[1] * BlockElements;
+    Parameters->u.ConvTranspose.TransformedFilter = nullptr;
+
+    //
+    // The working buffer holds the packed filter, unless the caller supplies
+    // one, followed by the expanded input and the GEMM output of each thread.
+    //
+
+    *WorkingBufferSize = GroupCount * FilterCount * K + size_t(TargetThreadCount) *
+        (Parameters->u.ConvTranspose.ExpandedInputSize + FilterCountPerBlock * BlockElements);
+}
+
+void
+MLASCALL
+MlasConvTranspose(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    const float* Filter,
+    const float* Bias,
+    float* WorkingBuffer,
+    float* Output,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the transposed convolution operation.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the transposed
+        convolution parameters, as prepared by MlasConvTransposePrepare.
+
+    Input - Supplies the input tensor.
+
+    Filter - Supplies the filter tensor, with the shape GroupCount *
+        InputChannels by FilterCount by the kernel shape.
+
+    Bias - Optionally supplies the bias vector.
+
+    WorkingBuffer - Supplies a working buffer sized to the number of elements
+        returned by MlasConvTransposePrepare, less MlasConvTransformedFilterSize
+        elements if the parameters supply a packed filter.
+
+    Output - Supplies the output tensor.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const float* PackedFilter = Parameters->u.ConvTranspose.TransformedFilter;
+
+    //
+    // Repack the filter into the start of the working buffer if the caller
+    // did not supply a packed filter.
+    //
+
+    if (PackedFilter == nullptr) {
+        MlasConvTransposePackFilter(Parameters, Filter, WorkingBuffer);
+        PackedFilter = WorkingBuffer;
+        WorkingBuffer += Parameters->GroupCount * Parameters->FilterCount * Parameters->K;
+    }
+
+    MLAS_CONV_TRANSPOSE_WORK_BLOCK WorkBlock;
+
+    WorkBlock.Parameters = Parameters;
+    WorkBlock.Input = Input;
+    WorkBlock.PackedFilter = PackedFilter;
+    WorkBlock.Bias = Bias;
+    WorkBlock.WorkingBuffer = WorkingBuffer;
+    WorkBlock.Output = Output;
+    WorkBlock.WorkingBufferSizePerThread = Parameters->u.ConvTranspose.ExpandedInputSize +
+        Parameters->u.ConvTranspose.FilterCountPerBlock * Parameters->u.ConvTranspose.RowsPerBlock *
+        ((Parameters->OutputShape[1] + Parameters->StrideShape[1] - 1) / Parameters->StrideShape[1]);
+    WorkBlock.TargetThreadCount = Parameters->ThreadCount;
+
+    MlasExecuteThreaded(MlasConvTransposeThreaded, &WorkBlock, Parameters->ThreadCount, ThreadPool);
+}
@@ -0,0 +1,267 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    fp16.cpp
+
+Abstract:
+
+    This module implements routines to convert between FP16 and FP32 formats.
+
+    The implementation below targets the base instruction set and converts one
+    element at a time. Processors that support the F16C instruction set use
+    the vectorized kernels in fp16_f16c.cpp instead.
+
+--*/
+
+#include "mlasi.h"
+
+MLAS_FORCEINLINE
+float
+MlasHalfToFloat(
+    unsigned short Value
+    )
+{
+    const uint32_t Sign = uint32_t(Value & 0x8000) << 16;
+    uint32_t ExponentMantissa = uint32_t(Value & 0x7FFF) << 13;
+    uint32_t Bits;
+
+    if (ExponentMantissa >= (0x7C00 << 13)) {
+
+        //
+        // Infinity or NaN: keep the payload and use the maximum exponent.
+        // NaNs are made quiet.
+        //
+
+        Bits = ExponentMantissa | 0x7F800000;
+        if (Bits != 0x7F800000) {
+            Bits |= 0x00400000;
+        }
+
+    } else if (ExponentMantissa >= (0x0400 << 13)) {
+
+        //
+        // Normal: rebias the exponent from 15 to 127.
+        //
+
+        Bits = ExponentMantissa + ((127 - 15) << 23);
+
+    } else {
+
+        //
+        // Zero or denormal: scale the mantissa by 2^-24 using a float
+        // multiply, which normalizes the result.
+        //
+
+        float Denormal = float(ExponentMantissa >> 13) * (1.0f / 16777216.0f);
+        memcpy(&Bits, &Denormal, sizeof(Bits));
+    }
+
+    Bits |= Sign;
+
+    float Result;
+    memcpy(&Result, &Bits, sizeof(Result));
+    return Result;
+}
+
+MLAS_FORCEINLINE
+unsigned short
+MlasFloatToHalf(
+    float Value
+    )
+{
+    uint32_t Bits;
+    memcpy(&Bits, &Value, sizeof(Bits));
+
+    const unsigned short Sign = (unsigned short)((Bits >> 16) & 0x8000);
+    Bits &= 0x7FFFFFFF;
+
+    unsigned short Result;
+
+    if (Bits >= 0x7F800000) {
+
+        //
+        // Infinity or NaN: NaNs are kept quiet.
+        //
+
+        Result = (Bits > 0x7F800000) ? 0x7E00 : 0x7C00;
+
+    } else if (Bits >= 0x47800000) {
+
+        //
+        // Too large for a half: overflow to infinity.
+        //
+
+        Result = 0x7C00;
+
+    } else if (Bits < 0x38800000) {
+
+        //
+        // Denormal or zero: let the floating point adder round the value to
+        // the denormal half precision mantissa. Adding 0.5 places the
+        // mantissa of a value below 2^-14 into the low bits of the result.
+        //
+
+        float Magnitude;
+        memcpy(&Magnitude, &Bits, sizeof(Magnitude));
+        Magnitude += 0.5f;
+
+        uint32_t DenormalBits;
+        memcpy(&DenormalBits, &Magnitude, sizeof(DenormalBits));
+        Result = (unsigned short)(DenormalBits - 0x3F000000);
+
+    } else {
+
+        //
+        // Normal: rebias the exponent and round the mantissa to nearest even.
+        //
+
+        const uint32_t MantissaOdd = (Bits >> 13) & 1;
+        Bits += ((uint32_t)(15 - 127) << 23) + 0xFFF + MantissaOdd;
+        Result = (unsigned short)(Bits >> 13);
+    }
+
+    return Result | Sign;
+}
+
+void
+MLASCALL
+MlasConvertHalfToFloatKernel(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of half-precision floats to the
+    destination buffer of single-precision floats.
+
+Arguments:
+
+    Source - Supplies the source buffer of half-precision floats.
+
+    Destination - Supplies the destination buffer of single-precision floats.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    for (size_t i = 0; i < Count; i++) {
+        Destination[i] = MlasHalfToFloat(Source[i]);
+    }
+}
+
+void
+MLASCALL
+MlasConvertFloatToHalfKernel(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of single-precision floats to the
+    destination buffer of half-precision floats. Values are rounded to nearest
+    even.
+
+Arguments:
+
+    Source - Supplies the source buffer of single-precision floats.
+
+    Destination - Supplies the destination buffer of half-precision floats.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    for (size_t i = 0; i < Count; i++) {
+        Destination[i] = MlasFloatToHalf(Source[i]);
+    }
+}
+
+void
+MLASCALL
+MlasConvertHalfToFloatBuffer(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of half-precision floats to the
+    destination buffer of single-precision floats.
+
+Arguments:
+
+    Source - Supplies the source buffer of half-precision floats.
+
+    Destination - Supplies the destination buffer of single-precision floats.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+#if defined(MLAS_TARGET_AMD64)
+    MlasPlatform.ConvertHalfToFloatRoutine(Source, Destination, Count);
+#else
+    MlasConvertHalfToFloatKernel(Source, Destination, Count);
+#endif
+}
+
+void
+MLASCALL
+MlasConvertFloatToHalfBuffer(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of single-precision floats to the
+    destination buffer of half-precision floats. Values are rounded to nearest
+    even.
+
+Arguments:
+
+    Source - Supplies the source buffer of single-precision floats.
+
+    Destination - Supplies the destination buffer of half-precision floats.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+#if defined(MLAS_TARGET_AMD64)
+    MlasPlatform.ConvertFloatToHalfRoutine(Source, Destination, Count);
+#else
+    MlasConvertFloatToHalfKernel(Source, Destination, Count);
+#endif
+}
@@ -0,0 +1,103 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    fp16_f16c.cpp
+
+Abstract:
+
+    This module implements kernels to convert between FP16 and FP32 formats.
+
+    This implementation uses F16C instructions. The build compiles this file
+    with the F16C instruction set enabled, so it must only be called after
+    the platform checks for F16C support.
+
+--*/
+
+#include "mlasi.h"
+
+void
+MLASCALL
+MlasConvertHalfToFloatKernelF16C(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    )
+{
+    while (Count >= 16) {
+
+        __m256 Vector0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)Source));
+        __m256 Vector1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(Source + 8)));
+
+        _mm256_storeu_ps(Destination, Vector0);
+        _mm256_storeu_ps(Destination + 8, Vector1);
+
+        Source += 16;
+        Destination += 16;
+        Count -= 16;
+    }
+
+    if (Count >= 8) {
+
+        _mm256_storeu_ps(Destination, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)Source)));
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+    if (Count > 0) {
+
+        unsigned short SourceBuffer[8] = {};
+        float DestinationBuffer[8];
+
+        memcpy(SourceBuffer, Source, Count * sizeof(unsigned short));
+        _mm256_storeu_ps(DestinationBuffer, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)SourceBuffer)));
+        memcpy(Destination, DestinationBuffer, Count * sizeof(float));
+    }
+}
+
+void
+MLASCALL
+MlasConvertFloatToHalfKernelF16C(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    )
+{
+    while (Count >= 16) {
+
+        __m128i Vector0 = _mm256_cvtps_ph(_mm256_loadu_ps(Source), _MM_FROUND_TO_NEAREST_INT);
+        __m128i Vector1 = _mm256_cvtps_ph(_mm256_loadu_ps(Source + 8), _MM_FROUND_TO_NEAREST_INT);
+
+        _mm_storeu_si128((__m128i*)Destination, Vector0);
+        _mm_storeu_si128((__m128i*)(Destination + 8), Vector1);
+
+        Source += 16;
+        Destination += 16;
+        Count -= 16;
+    }
+
+    if (Count >= 8) {
+
+        _mm_storeu_si128((__m128i*)Destination, _mm256_cvtps_ph(_mm256_loadu_ps(Source), _MM_FROUND_TO_NEAREST_INT));
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+    if (Count > 0) {
+
+        float SourceBuffer[8] = {};
+        unsigned short DestinationBuffer[8];
+
+        memcpy(SourceBuffer, Source, Count * sizeof(float));
+        _mm_storeu_si128((__m128i*)DestinationBuffer, _mm256_cvtps_ph(_mm256_loadu_ps(SourceBuffer), _MM_FROUND_TO_NEAREST_INT));
+        memcpy(Destination, DestinationBuffer, Count * sizeof(unsigned short));
+    }
+}
@@ -21,6 +21,7 @@ Abstract:
 #include <memory.h>
 #include <algorithm>
 #include <limits>
+#include <cmath>
 
 #if defined(_WIN32)
 #include <windows.h>
@@ -451,6 +452,26 @@ void
 
 typedef MLAS_ELEMENTWISE_KERNEL_ROUTINE* PMLAS_ELEMENTWISE_KERNEL_ROUTINE;
 
+typedef
+void
+(MLASCALL MLAS_CONVERT_HALF_TO_FLOAT_ROUTINE)(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    );
+
+typedef MLAS_CONVERT_HALF_TO_FLOAT_ROUTINE* PMLAS_CONVERT_HALF_TO_FLOAT_ROUTINE;
+
+typedef
+void
+(MLASCALL MLAS_CONVERT_FLOAT_TO_HALF_ROUTINE)(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    );
+
+typedef MLAS_CONVERT_FLOAT_TO_HALF_ROUTINE* PMLAS_CONVERT_FLOAT_TO_HALF_ROUTINE;
+
 extern "C" {
 
 #if defined(MLAS_TARGET_AMD64_IX86)
@@ -550,6 +571,13 @@ extern "C" {
     MLAS_ELEMENTWISE_KERNEL_ROUTINE MlasErfKernelFma3;
 #endif
 
+    MLAS_CONVERT_HALF_TO_FLOAT_ROUTINE MlasConvertHalfToFloatKernel;
+    MLAS_CONVERT_FLOAT_TO_HALF_ROUTINE MlasConvertFloatToHalfKernel;
+#if defined(MLAS_TARGET_AMD64)
+    MLAS_CONVERT_HALF_TO_FLOAT_ROUTINE MlasConvertHalfToFloatKernelF16C;
+    MLAS_CONVERT_FLOAT_TO_HALF_ROUTINE MlasConvertFloatToHalfKernelF16C;
+#endif
+
 }
 
 //
@@ -599,6 +627,93 @@ MlasSgemmOperation(
     size_t ldc
     );
 
+//
+// Single-threaded quantized integer matrix/matrix multiply operation.
+//
+
+#if defined(MLAS_TARGET_AMD64_IX86)
+MLAS_GEMM_X8X8_OPERATION MlasGemmU8U8Operation;
+#endif
+
+//
+// Winograd convolution routines.
+//
+
+bool
+MlasConvWinogradPrepare(
+    MLAS_CONV_PARAMETERS* Parameters,
+    size_t* WorkingBufferSize,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+void
+MlasConvWinograd(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    const float* Filter,
+    const float* Bias,
+    float* WorkingBuffer,
+    float* Output,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+size_t
+MlasConvWinogradTransformedFilterSize(
+    const MLAS_CONV_PARAMETERS* Parameters
+    );
+
+void
+MlasConvWinogradTransformFilter(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Filter,
+    float* TransformedFilter
+    );
+
+//
+// Transposed convolution routines.
+//
+
+void
+MlasConvTransposePackFilter(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Filter,
+    float* PackedFilter
+    );
+
+//
+// Define the base thread context for NCWHc convolution or pooling operations.
+//
+
+struct MLAS_NCHWC_WORK_BLOCK
+{
+    int32_t tids;
+    size_t BatchCount;
+    size_t InputChannels;
+    size_t InputShape[2];
+    size_t InputSize;
+    size_t OutputChannels;
+    size_t OutputShape[2];
+    size_t OutputSize;
+    size_t KernelShape[2];
+    size_t DilationShape[2];
+    size_t Padding[4];
+    size_t StrideShape[2];
+    size_t OutputCountLeftPad[2];
+    size_t OutputCount[2];
+    size_t OutputCountRightPad[2];
+};
+
+void
+MlasNchwcPrepareWorkBlock(
+    MLAS_NCHWC_WORK_BLOCK* WorkBlock,
+    const int64_t* InputShape,
+    const int64_t* KernelShape,
+    const int64_t* DilationShape,
+    const int64_t* Padding,
+    const int64_t* StrideShape,
+    const int64_t* OutputShape
+    );
+
 //
 // Environment information class.
 //
@@ -631,6 +746,8 @@ struct MLAS_PLATFORM {
     PMLAS_ELEMENTWISE_KERNEL_ROUTINE LogisticKernelRoutine;
     PMLAS_ELEMENTWISE_KERNEL_ROUTINE TanhKernelRoutine;
     PMLAS_ELEMENTWISE_KERNEL_ROUTINE ErfKernelRoutine;
+    PMLAS_CONVERT_HALF_TO_FLOAT_ROUTINE ConvertHalfToFloatRoutine;
+    PMLAS_CONVERT_FLOAT_TO_HALF_ROUTINE ConvertFloatToHalfRoutine;
     uint32_t NchwcBlockSize;
     uint32_t PreferredBufferAlignment;
 #endif
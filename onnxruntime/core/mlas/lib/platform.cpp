@@ -17,6 +17,8 @@ Abstract:
 
 #include "mlasi.h"
 
+#include <string.h>
+
 //
 // Stores the platform information.
 //
@@ -68,6 +70,84 @@ MlasReadExtendedControlRegister(
 #endif
 }
 
+//
+// Defines the instruction set extension levels that MLAS_MAXIMUM_ISA can
+// limit the kernel selection to.
+//
+
+enum MLAS_ISA_LEVEL {
+    MlasIsaSse2,
+    MlasIsaAvx,
+    MlasIsaAvx2,
+    MlasIsaAvx512F,
+    MlasIsaAvx512Core,
+    MlasIsaAvx512Vnni,
+};
+
+static
+MLAS_ISA_LEVEL
+MlasGetMaximumIsaLevel(
+    void
+    )
+/*++
+
+Routine Description:
+
+    This routine reads the MLAS_MAXIMUM_ISA environment variable, which limits
+    the instruction set extensions used by the library. This allows the kernels
+    written for older processors to be benchmarked and tested on a newer
+    processor.
+
+Arguments:
+
+    None.
+
+Return Value:
+
+    Returns the maximum instruction set extension level to use.
+
+--*/
+{
+    static const struct {
+        const char* Name;
+        MLAS_ISA_LEVEL Level;
+    } IsaLevels[] = {
+        { "SSE2", MlasIsaSse2 },
+        { "AVX", MlasIsaAvx },
+        { "AVX2", MlasIsaAvx2 },
+        { "FMA3", MlasIsaAvx2 },
+        { "AVX512F", MlasIsaAvx512F },
+        { "AVX512CORE", MlasIsaAvx512Core },
+        { "AVX512VNNI", MlasIsaAvx512Vnni },
+    };
+
+    char Value[32];
+
+#if defined(_WIN32)
+    DWORD Length = GetEnvironmentVariableA("MLAS_MAXIMUM_ISA", Value, sizeof(Value));
+
+    if (Length == 0 || Length >= sizeof(Value)) {
+        return MlasIsaAvx512Vnni;
+    }
+#else
+    const char* EnvironmentValue = getenv("MLAS_MAXIMUM_ISA");
+
+    if (EnvironmentValue == nullptr || strlen(EnvironmentValue) >= sizeof(Value)) {
+        return MlasIsaAvx512Vnni;
+    }
+
+    strcpy(Value, EnvironmentValue);
+#endif
+
+    for (const auto& IsaLevel : IsaLevels) {
+        if (strcmp(Value, IsaLevel.Name) == 0) {
+            return IsaLevel.Level;
+        }
+    }
+
+    return MlasIsaAvx512Vnni;
+}
+
 #endif
 
 MLAS_PLATFORM::MLAS_PLATFORM(
@@ -92,6 +172,8 @@ Return Value:
 
 #if defined(MLAS_TARGET_AMD64_IX86)
 
+    const MLAS_ISA_LEVEL MaximumIsaLevel = MlasGetMaximumIsaLevel();
+
     //
     // Default to the baseline SSE2 support.
     //
@@ -118,6 +200,8 @@ Return Value:
     this->LogisticKernelRoutine = MlasLogisticKernel;
     this->TanhKernelRoutine = MlasTanhKernel;
     this->ErfKernelRoutine = MlasErfKernel;
+    this->ConvertHalfToFloatRoutine = MlasConvertHalfToFloatKernel;
+    this->ConvertFloatToHalfRoutine = MlasConvertFloatToHalfKernel;
     this->NchwcBlockSize = 8;
     this->PreferredBufferAlignment = MLAS_DEFAULT_PREFERRED_BUFFER_ALIGNMENT;
 
@@ -134,7 +218,7 @@ Return Value:
     __cpuid(1, Cpuid1[0], Cpuid1[1], Cpuid1[2], Cpuid1[3]);
 #endif
 
-    if ((Cpuid1[2] & 0x18000000) == 0x18000000) {
+    if ((Cpuid1[2] & 0x18000000) == 0x18000000 && MaximumIsaLevel >= MlasIsaAvx) {
 
         //
         // Check if the operating system supports saving SSE and AVX states.
@@ -160,6 +244,15 @@ Return Value:
             this->PoolFloatKernel[MlasAveragePoolingExcludePad] = MlasPoolAverageExcludePadFloatKernelAvx;
             this->PoolFloatKernel[MlasAveragePoolingIncludePad] = MlasPoolAverageIncludePadFloatKernelAvx;
 
+            //
+            // Check if the processor supports the F16C feature.
+            //
+
+            if ((Cpuid1[2] & 0x20000000) != 0) {
+                this->ConvertHalfToFloatRoutine = MlasConvertHalfToFloatKernelF16C;
+                this->ConvertFloatToHalfRoutine = MlasConvertFloatToHalfKernelF16C;
+            }
+
             //
             // Check if the processor supports AVX2/FMA3 features.
             //
@@ -171,7 +264,8 @@ Return Value:
             __cpuid_count(7, 0, Cpuid7[0], Cpuid7[1], Cpuid7[2], Cpuid7[3]);
 #endif
 
-            if (((Cpuid1[2] & 0x1000) != 0) && ((Cpuid7[1] & 0x20) != 0)) {
+            if (((Cpuid1[2] & 0x1000) != 0) && ((Cpuid7[1] & 0x20) != 0) &&
+                MaximumIsaLevel >= MlasIsaAvx2) {
 
                 this->GemmU8S8CopyPackARoutine = MlasGemmU8S8CopyPackAAvx2;
                 this->GemmU8S8CopyPackBRoutine = MlasGemmU8S8CopyPackBAvx2;
@@ -198,7 +292,8 @@ Return Value:
                 // operating system supports saving AVX512F state.
                 //
 
-                if (((Cpuid7[1] & 0x10000) != 0) && ((xcr0 & 0xE0) == 0xE0)) {
+                if (((Cpuid7[1] & 0x10000) != 0) && ((xcr0 & 0xE0) == 0xE0) &&
+                    MaximumIsaLevel >= MlasIsaAvx512F) {
 
                     this->GemmFloatKernel = MlasGemmFloatKernelAvx512F;
                     this->GemmDoubleKernel = MlasGemmDoubleKernelAvx512F;
@@ -219,7 +314,8 @@ Return Value:
 
 #if !defined(MLAS_AVX512CORE_UNSUPPORTED)
 
-                    if ((Cpuid7[1] & 0xC0020000) == 0xC0020000) {
+                    if ((Cpuid7[1] & 0xC0020000) == 0xC0020000 &&
+                        MaximumIsaLevel >= MlasIsaAvx512Core) {
 
                         this->GemmU8S8Kernel = MlasGemmU8S8KernelAvx512Core;
                         this->GemvU8S8Kernel = MlasGemvU8S8KernelAvx512Core;
@@ -229,7 +325,7 @@ Return Value:
                         // Check if the processor supports AVX512VNNI.
                         //
 
-                        if ((Cpuid7[2] & 0x800) != 0) {
+                        if ((Cpuid7[2] & 0x800) != 0 && MaximumIsaLevel >= MlasIsaAvx512Vnni) {
 
                             this->GemmU8S8Kernel = MlasGemmU8S8KernelAvx512Vnni;
                             this->GemvU8S8Kernel = MlasGemvU8S8KernelAvx512Vnni;
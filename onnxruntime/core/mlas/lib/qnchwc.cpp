@@ -0,0 +1,1044 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    qnchwc.cpp
+
+Abstract:
+
+    This module implements the quantized operations using the NCHWc blocking
+    format.
+
+    The tensors use the same blocked layout as the single precision routines,
+    so a graph can switch between the float and quantized NCHWc operators
+    with the same reorder operations.
+
+    On x86 targets, the convolution of an NCHWc input gathers the input
+    blocks of a set of outputs and multiplies them by the filter using the
+    quantized GEMM kernels, which use the 8-bit dot product instructions of
+    the platform (such as AVX512 VNNI) when available. The block size is a
+    multiple of four, so each group of four input channels maps directly to
+    one 32-bit dot product lane.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Define the worker thread context for a quantized NCHWc convolution
+// operation.
+//
+
+struct MLAS_NCHWC_QCONV_WORK_BLOCK : MLAS_NCHWC_WORK_BLOCK
+{
+    const uint8_t* Input;
+    const uint8_t* Filter;
+    const int32_t* Bias;
+    uint8_t* Output;
+    size_t GroupCount;
+    float OutputScale;
+    uint8_t InputZeroPoint;
+    uint8_t FilterZeroPoint;
+    uint8_t OutputZeroPoint;
+};
+
+//
+// Define the worker thread context for a quantized NCHWc pooling operation.
+//
+
+struct MLAS_NCHWC_QPOOL_WORK_BLOCK : MLAS_NCHWC_WORK_BLOCK
+{
+    const uint8_t* Input;
+    uint8_t* Output;
+    MLAS_POOLING_KIND PoolingKind;
+};
+
+//
+// Define the size of the stack buffer used to gather the input columns of a
+// quantized NCHWc convolution and the maximum number of outputs computed by
+// one call to the quantized GEMM kernels.
+//
+
+#define MLAS_NCHWC_QCONV_COLUMN_BUFFER_SIZE     (32 * 1024)
+#define MLAS_NCHWC_QCONV_GEMM_OUTPUT_COUNT      64
+
+//
+// Base implementation for quantized convolution and pooling algorithms.
+//
+
+struct MLAS_NCHWC_QNN_ALGORITHM
+{
+    //
+    // Capture these values from the work block for use as local constants.
+    //
+
+    const size_t BatchCount;
+    const size_t InputHeight;
+    const size_t InputWidth;
+    const size_t InputSize;
+    const size_t OutputHeight;
+    const size_t OutputWidth;
+    const size_t OutputSize;
+    const size_t KernelHeight;
+    const size_t KernelWidth;
+    const size_t KernelSize;
+    const size_t DilationHeight;
+    const size_t DilationWidth;
+    const size_t PaddingLeftY;
+    const size_t PaddingLeftX;
+    const size_t StrideHeight;
+    const size_t StrideWidth;
+
+    MLAS_NCHWC_QNN_ALGORITHM(const MLAS_NCHWC_WORK_BLOCK* WorkBlock) :
+        BatchCount(WorkBlock->BatchCount),
+        InputHeight(WorkBlock->InputShape[0]),
+        InputWidth(WorkBlock->InputShape[1]),
+        InputSize(WorkBlock->InputSize),
+        OutputHeight(WorkBlock->OutputShape[0]),
+        OutputWidth(WorkBlock->OutputShape[1]),
+        OutputSize(WorkBlock->OutputSize),
+        KernelHeight(WorkBlock->KernelShape[0]),
+        KernelWidth(WorkBlock->KernelShape[1]),
+        KernelSize(KernelHeight * KernelWidth),
+        DilationHeight(WorkBlock->DilationShape[0]),
+        DilationWidth(WorkBlock->DilationShape[1]),
+        PaddingLeftY(WorkBlock->Padding[0]),
+        PaddingLeftX(WorkBlock->Padding[1]),
+        StrideHeight(WorkBlock->StrideShape[0]),
+        StrideWidth(WorkBlock->StrideShape[1])
+    {
+    }
+
+    void
+    ComputeValidKernelRange(
+        size_t First,
+        size_t Dilation,
+        size_t KernelExtent,
+        size_t InputExtent,
+        size_t* KernelStart,
+        size_t* KernelEnd
+        )
+    {
+        //
+        // Compute the range of kernel indices that map to input elements
+        // instead of padding. The first input index is allowed to underflow,
+        // so that padding before the input compares as a large value. The
+        // valid indices are contiguous because the input index increases
+        // with the kernel index.
+        //
+
+        size_t k = 0;
+
+        while (k < KernelExtent && First + k * Dilation >= InputExtent) {
+            k++;
+        }
+
+        *KernelStart = k;
+
+        while (k < KernelExtent && First + k * Dilation < InputExtent) {
+            k++;
+        }
+
+        *KernelEnd = k;
+    }
+};
+
+//
+// Implementation of the quantized convolution algorithms.
+//
+// The block size is a template parameter so that the loops over the channels
+// of a block have a constant trip count and can be unrolled and vectorized by
+// the compiler.
+//
+
+template<size_t BlockSize>
+struct MLAS_NCHWC_QCONV_ALGORITHM : MLAS_NCHWC_QNN_ALGORITHM
+{
+    const MLAS_NCHWC_QCONV_WORK_BLOCK* WorkBlock;
+    const size_t GroupCount;
+    const size_t InputChannels;
+    const size_t OutputChannels;
+    const int32_t InputZeroPoint;
+    const int32_t FilterZeroPoint;
+    const int32_t OutputZeroPoint;
+    const float OutputScale;
+    const float MinimumValue;
+    const float MaximumValue;
+
+    MLAS_NCHWC_QCONV_ALGORITHM(const MLAS_NCHWC_QCONV_WORK_BLOCK* WorkBlock) :
+        MLAS_NCHWC_QNN_ALGORITHM(WorkBlock),
+        WorkBlock(WorkBlock),
+        GroupCount(WorkBlock->GroupCount),
+        InputChannels(WorkBlock->InputChannels),
+        OutputChannels(WorkBlock->OutputChannels),
+        InputZeroPoint(WorkBlock->InputZeroPoint),
+        FilterZeroPoint(WorkBlock->FilterZeroPoint),
+        OutputZeroPoint(WorkBlock->OutputZeroPoint),
+        OutputScale(WorkBlock->OutputScale),
+        MinimumValue(float(0 - OutputZeroPoint)),
+        MaximumValue(float(255 - OutputZeroPoint))
+    {
+    }
+
+    void
+    Requantize(
+        const int32_t* Accumulator,
+        const int32_t* Bias,
+        uint8_t* Output
+        )
+    {
+        //
+        // Scale the accumulators and clamp to the output range before
+        // rounding to nearest even and applying the zero point, matching
+        // MlasRequantizeOutput.
+        //
+
+        for (size_t bc = 0; bc < BlockSize; bc++) {
+
+            int32_t IntegerValue = Accumulator[bc];
+
+            if (Bias != nullptr) {
+                IntegerValue += Bias[bc];
+            }
+
+            float FloatValue = float(IntegerValue) * OutputScale;
+
+            FloatValue = (std::max)(FloatValue, MinimumValue);
+            FloatValue = (std::min)(FloatValue, MaximumValue);
+
+            Output[bc] = uint8_t(int32_t(std::nearbyintf(FloatValue)) + OutputZeroPoint);
+        }
+    }
+
+    void
+    ComputeFilterSum(
+        const uint8_t* Filter,
+        size_t FilterLength,
+        int32_t* FilterSum
+        )
+    {
+        //
+        // Sum the filter values of each output channel of a filter block in
+        // OIHWBiBo format.
+        //
+
+        std::fill_n(FilterSum, BlockSize, 0);
+
+        for (size_t n = 0; n < FilterLength; n += BlockSize) {
+
+            for (size_t bo = 0; bo < BlockSize; bo++) {
+                FilterSum[bo] += int32_t(Filter[bo]);
+            }
+
+            Filter += BlockSize;
+        }
+    }
+
+    void
+    ComputeRowNchwc(
+        const uint8_t* Input,
+        const uint8_t* Filter,
+        const int32_t* Bias,
+        const int32_t* FilterSum,
+        uint8_t* Output,
+        size_t oh
+        )
+    {
+        //
+        // Computes an output row for an input in NCHWc format. The dot
+        // products use the raw 8-bit values and the zero points are applied
+        // afterwards:
+        //
+        //  sum((x - xzp) * (w - wzp)) =
+        //      sum(x * w) - wzp * sum(x) - xzp * sum(w) + count * xzp * wzp
+        //
+        // The sums only include the kernel positions inside the input. The
+        // filter sum of the interior outputs is precomputed per filter block.
+        // Outputs touching the padding subtract the filter values of the
+        // kernel positions that fall outside of the input.
+        //
+
+        const size_t InputChannelBlocks = InputChannels / BlockSize;
+        const size_t BlockFilterSize = BlockSize * BlockSize;
+        const size_t ChannelFilterStride = KernelSize * BlockFilterSize;
+
+        const size_t ih = oh * StrideHeight - PaddingLeftY;
+
+        size_t khStart;
+        size_t khEnd;
+
+        ComputeValidKernelRange(ih, DilationHeight, KernelHeight, InputHeight, &khStart, &khEnd);
+
+        for (size_t ow = 0; ow < OutputWidth; ow++) {
+
+            const size_t iw = ow * StrideWidth - PaddingLeftX;
+
+            size_t kwStart;
+            size_t kwEnd;
+
+            ComputeValidKernelRange(iw, DilationWidth, KernelWidth, InputWidth, &kwStart, &kwEnd);
+
+            int32_t Accumulator[BlockSize] = { 0 };
+            int32_t ValidFilterSum[BlockSize];
+            int32_t InputSum = 0;
+
+            const uint8_t* input = Input;
+            const uint8_t* filter = Filter;
+
+            for (size_t icb = 0; icb < InputChannelBlocks; icb++) {
+
+                for (size_t kh = khStart; kh < khEnd; kh++) {
+
+                    const size_t InputRowIndex = (ih + kh * DilationHeight) * InputWidth;
+
+                    for (size_t kw = kwStart; kw < kwEnd; kw++) {
+
+                        const uint8_t* x = input + (InputRowIndex + iw + kw * DilationWidth) * BlockSize;
+                        const uint8_t* w = filter + (kh * KernelWidth + kw) * BlockFilterSize;
+
+                        for (size_t bi = 0; bi < BlockSize; bi++) {
+
+                            const int32_t InputValue = x[bi];
+
+                            for (size_t bo = 0; bo < BlockSize; bo++) {
+                                Accumulator[bo] += InputValue * int32_t(w[bo]);
+                            }
+
+                            InputSum += InputValue;
+                            w += BlockSize;
+                        }
+                    }
+                }
+
+                input += BlockSize * InputSize;
+                filter += ChannelFilterStride;
+            }
+
+            std::copy_n(FilterSum, BlockSize, ValidFilterSum);
+
+            const bool IsInterior = (khStart == 0 && khEnd == KernelHeight &&
+                kwStart == 0 && kwEnd == KernelWidth);
+
+            if (!IsInterior && InputZeroPoint != 0) {
+
+                filter = Filter;
+
+                for (size_t icb = 0; icb < InputChannelBlocks; icb++) {
+
+                    for (size_t kh = 0; kh < KernelHeight; kh++) {
+
+                        for (size_t kw = 0; kw < KernelWidth; kw++) {
+
+                            if (kh >= khStart && kh < khEnd && kw >= kwStart && kw < kwEnd) {
+                                continue;
+                            }
+
+                            const uint8_t* w = filter + (kh * KernelWidth + kw) * BlockFilterSize;
+
+                            for (size_t bi = 0; bi < BlockSize; bi++) {
+
+                                for (size_t bo = 0; bo < BlockSize; bo++) {
+                                    ValidFilterSum[bo] -= int32_t(w[bo]);
+                                }
+
+                                w += BlockSize;
+                            }
+                        }
+                    }
+
+                    filter += ChannelFilterStride;
+                }
+            }
+
+            const int32_t ValidCount = int32_t((khEnd - khStart) * (kwEnd - kwStart) * InputChannels);
+            const int32_t InputCorrection = ValidCount * InputZeroPoint * FilterZeroPoint - FilterZeroPoint * InputSum;
+
+            for (size_t bo = 0; bo < BlockSize; bo++) {
+                Accumulator[bo] += InputCorrection - InputZeroPoint * ValidFilterSum[bo];
+            }
+
+            Requantize(Accumulator, Bias, Output);
+
+            Output += BlockSize;
+        }
+    }
+
+#if defined(MLAS_TARGET_AMD64_IX86)
+
+    void
+    ComputeRowNchwcGemm(
+        const uint8_t* Input,
+        const uint8_t* Filter,
+        const int32_t* Bias,
+        uint8_t* Output,
+        size_t oh
+        )
+    {
+        //
+        // Computes an output row for an input in NCHWc format using the
+        // quantized GEMM kernels. The input blocks of each output are copied
+        // to a row of the column buffer in the same order as the rows of the
+        // OIHWBiBo filter block. Kernel positions that fall in the padding
+        // are filled with the input zero point so that the zero point
+        // corrections of the GEMM apply uniformly.
+        //
+
+        MLAS_DECLSPEC_ALIGN(uint8_t ColumnBuffer[MLAS_NCHWC_QCONV_COLUMN_BUFFER_SIZE], 64);
+        MLAS_DECLSPEC_ALIGN(int32_t Accumulator[MLAS_NCHWC_QCONV_GEMM_OUTPUT_COUNT * BlockSize], 64);
+
+        const size_t InputChannelBlocks = InputChannels / BlockSize;
+        const size_t ColumnLength = InputChannels * KernelSize;
+
+        const size_t OutputCountPerGemm = (std::min)(size_t(MLAS_NCHWC_QCONV_GEMM_OUTPUT_COUNT),
+            MLAS_NCHWC_QCONV_COLUMN_BUFFER_SIZE / ColumnLength);
+
+        const size_t ih = oh * StrideHeight - PaddingLeftY;
+
+        for (size_t ow = 0; ow < OutputWidth;) {
+
+            const size_t OutputCount = (std::min)(OutputCountPerGemm, OutputWidth - ow);
+
+            uint8_t* column = ColumnBuffer;
+
+            for (size_t n = 0; n < OutputCount; n++) {
+
+                const size_t iw = (ow + n) * StrideWidth - PaddingLeftX;
+
+                const uint8_t* input = Input;
+
+                for (size_t icb = 0; icb < InputChannelBlocks; icb++) {
+
+                    for (size_t kh = 0; kh < KernelHeight; kh++) {
+
+                        const size_t ihk = ih + kh * DilationHeight;
+
+                        for (size_t kw = 0; kw < KernelWidth; kw++) {
+
+                            const size_t iwk = iw + kw * DilationWidth;
+
+                            if (ihk < InputHeight && iwk < InputWidth) {
+                                std::copy_n(input + (ihk * InputWidth + iwk) * BlockSize, BlockSize, column);
+                            } else {
+                                std::fill_n(column, BlockSize, uint8_t(InputZeroPoint));
+                            }
+
+                            column += BlockSize;
+                        }
+                    }
+
+                    input += BlockSize * InputSize;
+                }
+            }
+
+            MlasGemmU8U8Operation(OutputCount, BlockSize, ColumnLength, ColumnBuffer,
+                ColumnLength, int16_t(InputZeroPoint), Filter, BlockSize,
+                int16_t(FilterZeroPoint), Accumulator, BlockSize);
+
+            for (size_t n = 0; n < OutputCount; n++) {
+                Requantize(&Accumulator[n * BlockSize], Bias, Output);
+                Output += BlockSize;
+            }
+
+            ow += OutputCount;
+        }
+    }
+
+#endif
+
+    void
+    ComputeRowNchw(
+        const uint8_t* Input,
+        const uint8_t* Filter,
+        const int32_t* Bias,
+        uint8_t* Output,
+        size_t oh
+        )
+    {
+        //
+        // Computes an output row for an input in NCHW format, which is used
+        // when the number of input channels is less than the block size. The
+        // filter is in OIHWBo format.
+        //
+
+        const size_t ih = oh * StrideHeight - PaddingLeftY;
+
+        size_t khStart;
+        size_t khEnd;
+
+        ComputeValidKernelRange(ih, DilationHeight, KernelHeight, InputHeight, &khStart, &khEnd);
+
+        for (size_t ow = 0; ow < OutputWidth; ow++) {
+
+            const size_t iw = ow * StrideWidth - PaddingLeftX;
+
+            size_t kwStart;
+            size_t kwEnd;
+
+            ComputeValidKernelRange(iw, DilationWidth, KernelWidth, InputWidth, &kwStart, &kwEnd);
+
+            int32_t Accumulator[BlockSize] = { 0 };
+
+            for (size_t ic = 0; ic < InputChannels; ic++) {
+
+                const uint8_t* input = Input + ic * InputSize;
+                const uint8_t* filter = Filter + ic * KernelSize * BlockSize;
+
+                for (size_t kh = khStart; kh < khEnd; kh++) {
+
+                    for (size_t kw = kwStart; kw < kwEnd; kw++) {
+
+                        const int32_t x = int32_t(input[(ih + kh * DilationHeight) * InputWidth +
+                            iw + kw * DilationWidth]) - InputZeroPoint;
+                        const uint8_t* w = filter + (kh * KernelWidth + kw) * BlockSize;
+
+                        for (size_t bo = 0; bo < BlockSize; bo++) {
+                            Accumulator[bo] += x * (int32_t(w[bo]) - FilterZeroPoint);
+                        }
+                    }
+                }
+            }
+
+            Requantize(Accumulator, Bias, Output);
+
+            Output += BlockSize;
+        }
+    }
+
+    void
+    ComputeRowDepthwise(
+        const uint8_t* Input,
+        const uint8_t* Filter,
+        const int32_t* Bias,
+        uint8_t* Output,
+        size_t oh
+        )
+    {
+        //
+        // Computes an output row for a depthwise convolution, where each
+        // channel of the NCHWc input block produces the same channel of the
+        // output block. The filter is in OIHWBo format.
+        //
+
+        const size_t ih = oh * StrideHeight - PaddingLeftY;
+
+        size_t khStart;
+        size_t khEnd;
+
+        ComputeValidKernelRange(ih, DilationHeight, KernelHeight, InputHeight, &khStart, &khEnd);
+
+        for (size_t ow = 0; ow < OutputWidth; ow++) {
+
+            const size_t iw = ow * StrideWidth - PaddingLeftX;
+
+            size_t kwStart;
+            size_t kwEnd;
+
+            ComputeValidKernelRange(iw, DilationWidth, KernelWidth, InputWidth, &kwStart, &kwEnd);
+
+            int32_t Accumulator[BlockSize] = { 0 };
+
+            for (size_t kh = khStart; kh < khEnd; kh++) {
+
+                for (size_t kw = kwStart; kw < kwEnd; kw++) {
+
+                    const uint8_t* x = Input + ((ih + kh * DilationHeight) * InputWidth +
+                        iw + kw * DilationWidth) * BlockSize;
+                    const uint8_t* w = Filter + (kh * KernelWidth + kw) * BlockSize;
+
+                    for (size_t bc = 0; bc < BlockSize; bc++) {
+                        Accumulator[bc] += (int32_t(x[bc]) - InputZeroPoint) *
+                            (int32_t(w[bc]) - FilterZeroPoint);
+                    }
+                }
+            }
+
+            Requantize(Accumulator, Bias, Output);
+
+            Output += BlockSize;
+        }
+    }
+
+    void Execute(int32_t Index)
+    {
+        //
+        // Determine the type of convolution to perform based on the shape
+        // parameters. The caller must reorder the filter tensor to match:
+        // OIHWBiBo for NCHWc inputs, else OIHWBo.
+        //
+
+        const bool IsDepthwise = (InputChannels == 1 && OutputChannels == 1);
+        const bool IsNchwcInput = (InputChannels >= BlockSize);
+
+        //
+        // Use the quantized GEMM kernels for an input in NCHWc format if the
+        // platform provides them and a column of the input fits in the
+        // column buffer.
+        //
+
+#if defined(MLAS_TARGET_AMD64_IX86)
+        const bool UseGemm = (InputChannels * KernelSize <= MLAS_NCHWC_QCONV_COLUMN_BUFFER_SIZE);
+#else
+        const bool UseGemm = false;
+#endif
+
+        //
+        // Compute the number of output channel blocks. Depthwise convolution
+        // packs a channel from each of BlockSize groups into a block.
+        //
+
+        const size_t FilterBlocksPerGroup = (OutputChannels + BlockSize - 1) / BlockSize;
+
+        size_t FilterBlockCount;
+
+        if (IsDepthwise) {
+            FilterBlockCount = (GroupCount + BlockSize - 1) / BlockSize;
+        } else {
+            FilterBlockCount = GroupCount * FilterBlocksPerGroup;
+        }
+
+        const size_t TotalWork = BatchCount * FilterBlockCount * OutputHeight;
+
+        size_t WorkIndex;
+        size_t WorkRemaining;
+
+        MlasPartitionWork(Index, WorkBlock->tids, TotalWork, &WorkIndex, &WorkRemaining);
+
+        //
+        // Extract the current batch, filter block, and output line from the
+        // starting work index.
+        //
+
+        size_t oh = WorkIndex % OutputHeight;
+        size_t BatchFilterBlock = WorkIndex / OutputHeight;
+
+        uint8_t* Output = WorkBlock->Output + WorkIndex * BlockSize * OutputWidth;
+
+        const size_t BatchInputSize = (IsDepthwise ? FilterBlockCount * BlockSize : GroupCount * InputChannels) * InputSize;
+        const size_t FilterBlockSize = BlockSize * InputChannels * KernelSize;
+
+        int32_t FilterSum[BlockSize] = { 0 };
+        size_t FilterSumBlock = size_t(-1);
+
+        //
+        // Loop until all of the work has been completed.
+        //
+
+        while (WorkRemaining > 0) {
+
+            const size_t Batch = BatchFilterBlock / FilterBlockCount;
+            const size_t FilterBlock = BatchFilterBlock % FilterBlockCount;
+
+            const uint8_t* Input = WorkBlock->Input + Batch * BatchInputSize;
+            const uint8_t* Filter = WorkBlock->Filter + FilterBlock * FilterBlockSize;
+            const int32_t* Bias = WorkBlock->Bias;
+
+            if (Bias != nullptr) {
+                Bias += FilterBlock * BlockSize;
+            }
+
+            //
+            // Compute the output rows that remain for this filter block.
+            //
+
+            const size_t WorkThisIteration = (std::min)(WorkRemaining, OutputHeight - oh);
+
+            if (IsDepthwise) {
+
+                Input += FilterBlock * BlockSize * InputSize;
+
+                for (size_t n = 0; n < WorkThisIteration; n++) {
+                    ComputeRowDepthwise(Input, Filter, Bias, Output, oh + n);
+                    Output += BlockSize * OutputWidth;
+                }
+
+            } else {
+
+                Input += (FilterBlock / FilterBlocksPerGroup) * InputChannels * InputSize;
+
+                if (IsNchwcInput && UseGemm) {
+
+#if defined(MLAS_TARGET_AMD64_IX86)
+                    for (size_t n = 0; n < WorkThisIteration; n++) {
+                        ComputeRowNchwcGemm(Input, Filter, Bias, Output, oh + n);
+                        Output += BlockSize * OutputWidth;
+                    }
+#endif
+
+                } else if (IsNchwcInput) {
+
+                    if (FilterSumBlock != FilterBlock) {
+                        ComputeFilterSum(Filter, FilterBlockSize, FilterSum);
+                        FilterSumBlock = FilterBlock;
+                    }
+
+                    for (size_t n = 0; n < WorkThisIteration; n++) {
+                        ComputeRowNchwc(Input, Filter, Bias, FilterSum, Output, oh + n);
+                        Output += BlockSize * OutputWidth;
+                    }
+
+                } else {
+
+                    for (size_t n = 0; n < WorkThisIteration; n++) {
+                        ComputeRowNchw(Input, Filter, Bias, Output, oh + n);
+                        Output += BlockSize * OutputWidth;
+                    }
+                }
+            }
+
+            WorkRemaining -= WorkThisIteration;
+
+            oh = 0;
+            BatchFilterBlock++;
+        }
+    }
+};
+
+//
+// Implementation of the quantized pooling algorithm.
+//
+
+template<size_t BlockSize>
+struct MLAS_NCHWC_QPOOL_ALGORITHM : MLAS_NCHWC_QNN_ALGORITHM
+{
+    const MLAS_NCHWC_QPOOL_WORK_BLOCK* WorkBlock;
+    const size_t ChannelBlockCount;
+
+    MLAS_NCHWC_QPOOL_ALGORITHM(const MLAS_NCHWC_QPOOL_WORK_BLOCK* WorkBlock) :
+        MLAS_NCHWC_QNN_ALGORITHM(WorkBlock),
+        WorkBlock(WorkBlock),
+        ChannelBlockCount((WorkBlock->InputChannels + BlockSize - 1) / BlockSize)
+    {
+    }
+
+    void ComputeRow(const uint8_t* Input, uint8_t* Output, size_t oh)
+    {
+        const MLAS_POOLING_KIND PoolingKind = WorkBlock->PoolingKind;
+
+        const size_t ih = oh * StrideHeight - PaddingLeftY;
+
+        size_t khStart;
+        size_t khEnd;
+
+        ComputeValidKernelRange(ih, DilationHeight, KernelHeight, InputHeight, &khStart, &khEnd);
+
+        for (size_t ow = 0; ow < OutputWidth; ow++) {
+
+            const size_t iw = ow * StrideWidth - PaddingLeftX;
+
+            size_t kwStart;
+            size_t kwEnd;
+
+            ComputeValidKernelRange(iw, DilationWidth, KernelWidth, InputWidth, &kwStart, &kwEnd);
+
+            uint32_t Accumulator[BlockSize] = { 0 };
+
+            for (size_t kh = khStart; kh < khEnd; kh++) {
+
+                for (size_t kw = kwStart; kw < kwEnd; kw++) {
+
+                    const uint8_t* x = Input + ((ih + kh * DilationHeight) * InputWidth +
+                        iw + kw * DilationWidth) * BlockSize;
+
+                    if (PoolingKind == MlasMaximumPooling) {
+                        for (size_t bc = 0; bc < BlockSize; bc++) {
+                            Accumulator[bc] = (std::max)(Accumulator[bc], uint32_t(x[bc]));
+                        }
+                    } else {
+                        for (size_t bc = 0; bc < BlockSize; bc++) {
+                            Accumulator[bc] += x[bc];
+                        }
+                    }
+                }
+            }
+
+            if (PoolingKind == MlasMaximumPooling) {
+
+                for (size_t bc = 0; bc < BlockSize; bc++) {
+                    Output[bc] = uint8_t(Accumulator[bc]);
+                }
+
+            } else {
+
+                //
+                // Average the values rounding to nearest. Padding elements
+                // contribute zero when included in the divisor.
+                //
+
+                uint32_t Count;
+
+                if (PoolingKind == MlasAveragePoolingIncludePad) {
+                    Count = uint32_t(KernelSize);
+                } else {
+                    Count = uint32_t((khEnd - khStart) * (kwEnd - kwStart));
+                }
+
+                if (Count == 0) {
+                    Count = 1;
+                }
+
+                for (size_t bc = 0; bc < BlockSize; bc++) {
+                    Output[bc] = uint8_t((Accumulator[bc] + Count / 2) / Count);
+                }
+            }
+
+            Output += BlockSize;
+        }
+    }
+
+    void Execute(int32_t Index)
+    {
+        const size_t TotalWork = BatchCount * ChannelBlockCount * OutputHeight;
+
+        size_t WorkIndex;
+        size_t WorkRemaining;
+
+        MlasPartitionWork(Index, WorkBlock->tids, TotalWork, &WorkIndex, &WorkRemaining);
+
+        size_t oh = WorkIndex % OutputHeight;
+        const size_t BatchChannel = WorkIndex / OutputHeight;
+
+        const uint8_t* Input = WorkBlock->Input + BatchChannel * BlockSize * InputSize;
+        uint8_t* Output = WorkBlock->Output + WorkIndex * BlockSize * OutputWidth;
+
+        //
+        // Loop until all of the work has been completed.
+        //
+
+        while (WorkRemaining > 0) {
+
+            ComputeRow(Input, Output, oh);
+
+            Output += BlockSize * OutputWidth;
+
+            WorkRemaining -= 1;
+
+            if (++oh == OutputHeight) {
+
+                Input += BlockSize * InputSize;
+
+                oh = 0;
+            }
+        }
+    }
+};
+
+template<typename AlgorithmType>
+void
+MlasNchwcQuantizedThreaded(
+    void* Context,
+    int32_t Index
+    )
+{
+    AlgorithmType((decltype(AlgorithmType::WorkBlock))Context).Execute(Index);
+}
+
+void
+MLASCALL
+MlasNchwcConv(
+    const int64_t* InputShape,
+    const int64_t* KernelShape,
+    const int64_t* DilationShape,
+    const int64_t* Padding,
+    const int64_t* StrideShape,
+    const int64_t* OutputShape,
+    size_t GroupCount,
+    const uint8_t* Input,
+    uint8_t InputZeroPoint,
+    const uint8_t* Filter,
+    uint8_t FilterZeroPoint,
+    const int32_t* Bias,
+    uint8_t* Output,
+    float OutputScale,
+    uint8_t OutputZeroPoint,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the quantized NCHWc convolution operation.
+
+    The convolution uses an input in NCHWc format if the number of input
+    channels per group is at least the block size, with the filter reordered
+    by the quantized MlasReorderFilterOIHWBiBo. Depthwise convolutions (one
+    input and output channel per group) also use an input in NCHWc format
+    with the filter reordered by MlasReorderFilterOIHWBo. Otherwise, the
+    input is in NCHW format and the filter is reordered by
+    MlasReorderFilterOIHWBo.
+
+Arguments:
+
+    InputShape - Supplies the shape of the input tensor.
+
+    KernelShape - Supplies the shape of the kernel transform.
+
+    DilationShape - Supplies the shape of the dilation.
+
+    Padding - Supplies the number of padding elements at the edge of the input
+        tensor.
+
+    StrideShape - Supplies the shape of the stride.
+
+    OutputShape - Supplies the shape of the output tensor.
+
+    GroupCount - Supplies the number of channel groups.
+
+    Input - Supplies the input tensor.
+
+    InputZeroPoint - Supplies the zero point of the input tensor.
+
+    Filter - Supplies the filter tensor.
+
+    FilterZeroPoint - Supplies the zero point of the filter tensor.
+
+    Bias - Optionally supplies the bias vector, which uses the product of the
+        input and filter scales.
+
+    Output - Supplies the output tensor.
+
+    OutputScale - Supplies the scale to convert the accumulators to the
+        output quantization: the input scale times the filter scale divided
+        by the output scale.
+
+    OutputZeroPoint - Supplies the zero point of the output tensor.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_NCHWC_QCONV_WORK_BLOCK WorkBlock;
+
+    //
+    // Capture the convolution specific parameters to the work block.
+    //
+
+    WorkBlock.Input = Input;
+    WorkBlock.Filter = Filter;
+    WorkBlock.Bias = Bias;
+    WorkBlock.Output = Output;
+    WorkBlock.GroupCount = GroupCount;
+    WorkBlock.OutputScale = OutputScale;
+    WorkBlock.InputZeroPoint = InputZeroPoint;
+    WorkBlock.FilterZeroPoint = FilterZeroPoint;
+    WorkBlock.OutputZeroPoint = OutputZeroPoint;
+
+    //
+    // Capture the generic shape parameters to the work block.
+    //
+
+    MlasNchwcPrepareWorkBlock(&WorkBlock, InputShape, KernelShape,
+        DilationShape, Padding, StrideShape, OutputShape);
+
+    WorkBlock.InputChannels /= GroupCount;
+    WorkBlock.OutputChannels /= GroupCount;
+
+    PMLAS_THREADED_ROUTINE ThreadedRoutine;
+
+    if (MlasNchwcGetBlockSize() == 16) {
+        ThreadedRoutine = MlasNchwcQuantizedThreaded<MLAS_NCHWC_QCONV_ALGORITHM<16>>;
+    } else {
+        ThreadedRoutine = MlasNchwcQuantizedThreaded<MLAS_NCHWC_QCONV_ALGORITHM<8>>;
+    }
+
+    //
+    // Schedule the operation across a set of worker threads.
+    //
+
+    WorkBlock.tids = MlasGetMaximumThreadCount(ThreadPool);
+
+    MlasExecuteThreaded(ThreadedRoutine, &WorkBlock, WorkBlock.tids, ThreadPool);
+}
+
+void
+MLASCALL
+MlasNchwcPool(
+    MLAS_POOLING_KIND PoolingKind,
+    const int64_t* InputShape,
+    const int64_t* KernelShape,
+    const int64_t* DilationShape,
+    const int64_t* Padding,
+    const int64_t* StrideShape,
+    const int64_t* OutputShape,
+    const uint8_t* Input,
+    uint8_t* Output,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the quantized NCHWc pooling operation. The input
+    and output tensors share the same quantization parameters.
+
+Arguments:
+
+    PoolingKind - Supplies the kind of pooling operation to perform.
+
+    InputShape - Supplies the shape of the input tensor.
+
+    KernelShape - Supplies the shape of the kernel transform.
+
+    DilationShape - Supplies the shape of the dilation.
+
+    Padding - Supplies the number of padding elements at the edge of the input
+        tensor.
+
+    StrideShape - Supplies the shape of the stride.
+
+    OutputShape - Supplies the shape of the output tensor.
+
+    Input - Supplies the input tensor.
+
+    Output - Supplies the output tensor.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_NCHWC_QPOOL_WORK_BLOCK WorkBlock;
+
+    //
+    // Capture the pooling specific parameters to the work block.
+    //
+
+    WorkBlock.Input = Input;
+    WorkBlock.Output = Output;
+    WorkBlock.PoolingKind = PoolingKind;
+
+    //
+    // Capture the generic shape parameters to the work block.
+    //
+
+    MlasNchwcPrepareWorkBlock(&WorkBlock, InputShape, KernelShape,
+        DilationShape, Padding, StrideShape, OutputShape);
+
+    PMLAS_THREADED_ROUTINE ThreadedRoutine;
+
+    if (MlasNchwcGetBlockSize() == 16) {
+        ThreadedRoutine = MlasNchwcQuantizedThreaded<MLAS_NCHWC_QPOOL_ALGORITHM<16>>;
+    } else {
+        ThreadedRoutine = MlasNchwcQuantizedThreaded<MLAS_NCHWC_QPOOL_ALGORITHM<8>>;
+    }
+
+    //
+    // Schedule the operation across a set of worker threads.
+    //
+
+    WorkBlock.tids = MlasGetMaximumThreadCount(ThreadPool);
+
+    MlasExecuteThreaded(ThreadedRoutine, &WorkBlock, WorkBlock.tids, ThreadPool);
+}
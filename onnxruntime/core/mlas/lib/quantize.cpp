@@ -422,3 +422,107 @@ Return Value:
 }
 
 #endif
+
+void
+MLASCALL
+MlasRequantizeOutput(
+    const int32_t* Input,
+    uint8_t* Output,
+    const int32_t* Bias,
+    size_t M,
+    size_t N,
+    const float* Scale,
+    bool PerColumnScale,
+    uint8_t ZeroPoint
+    )
+/*++
+
+Routine Description:
+
+    This routine requantizes the intermediate buffer to the output buffer
+    optionally adding the supplied bias. The quantization scale is supplied
+    per output channel, which is either a row or a column of the output matrix
+    depending on the layout of the operation that produced the buffer.
+
+Arguments:
+
+    Input - Supplies the input matrix.
+
+    Output - Supplies the output matrix.
+
+    Bias - Supplies the optional bias vector to be added to the input buffer
+        before requantization.
+
+    M - Supplies the number of elements of the bias vector and the number of
+        rows in the output matrix.
+
+    N - Supplies the number of columns of the output matrix.
+
+    Scale - Supplies the quantization scale vector. The vector has M elements
+        if PerColumnScale is false, else N elements.
+
+    PerColumnScale - Supplies true if the scale vector is indexed by column,
+        else the scale vector is indexed by row.
+
+    ZeroPoint - Supplies the quantization zero point value.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const float MinimumValue = float(0 - ZeroPoint);
+    const float MaximumValue = float(255 - ZeroPoint);
+
+#if defined(MLAS_SSE2_INTRINSICS)
+    MLAS_FLOAT32X4 MinimumValueVector = MlasBroadcastFloat32x4(MinimumValue);
+    MLAS_FLOAT32X4 MaximumValueVector = MlasBroadcastFloat32x4(MaximumValue);
+    MLAS_INT32X4 ZeroPointVector = MlasBroadcastInt32x4(ZeroPoint);
+#endif
+
+    //
+    // Step through each row of the output matrix.
+    //
+
+    for (size_t m = 0; m < M; m++) {
+
+        const int32_t BiasValue = (Bias != nullptr) ? Bias[m] : 0;
+
+        size_t n = 0;
+
+#if defined(MLAS_SSE2_INTRINSICS)
+
+        MLAS_INT32X4 BiasVector = MlasBroadcastInt32x4(BiasValue);
+        MLAS_FLOAT32X4 ScaleVector = MlasBroadcastFloat32x4(Scale[PerColumnScale ? 0 : m]);
+
+        for (; n + 4 <= N; n += 4) {
+
+            if (PerColumnScale) {
+                ScaleVector = MlasLoadFloat32x4(Scale + n);
+            }
+
+            MLAS_INT32X4 IntegerVector = _mm_loadu_si128((const __m128i *)&Input[n]);
+            IntegerVector = MlasRequantizeOutputVector(IntegerVector, BiasVector,
+                ScaleVector, MinimumValueVector, MaximumValueVector, ZeroPointVector);
+
+            IntegerVector = _mm_packus_epi16(IntegerVector, IntegerVector);
+            IntegerVector = _mm_packus_epi16(IntegerVector, IntegerVector);
+
+            *((int32_t*)&Output[n]) = _mm_cvtsi128_si32(IntegerVector);
+        }
+
+#endif
+
+        for (; n < N; n++) {
+
+            float FloatValue = float(Input[n] + BiasValue) * Scale[PerColumnScale ? n : m];
+            FloatValue = std::max(FloatValue, MinimumValue);
+            FloatValue = std::min(FloatValue, MaximumValue);
+            Output[n] = uint8_t(int32_t(std::nearbyintf(FloatValue)) + ZeroPoint);
+        }
+
+        Input += N;
+        Output += N;
+    }
+}
@@ -724,3 +724,323 @@ Return Value:
         S += BlockSize * InputStride;
     }
 }
+
+void
+MLASCALL
+MlasReorderInput(
+    const int64_t* InputShape,
+    const uint8_t* S,
+    uint8_t* D
+    )
+/*++
+
+Routine Description:
+
+    This routine reorders a quantized input buffer from NCHW to NCHWc format.
+
+Arguments:
+
+    InputShape - Supplies the shape of the input tensor.
+
+    S - Supplies the address of the source tensor.
+
+    D - Supplies the address of the destination tensor.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t BlockSize = MlasNchwcGetBlockSize();
+
+    const size_t InputChannels = size_t(InputShape[0] * InputShape[1]);
+    const size_t InputSize = size_t(InputShape[2]) * size_t(InputShape[3]);
+
+    for (size_t i = InputChannels; i > 0;) {
+
+        const size_t InputChannelsThisIteration = (std::min)(i, BlockSize);
+        i -= InputChannelsThisIteration;
+
+        //
+        // Interleave the channels of this block and zero pad the channels
+        // beyond the end of the input tensor.
+        //
+
+        for (size_t n = 0; n < InputSize; n++) {
+
+            const uint8_t* s = S + n;
+            size_t bc = 0;
+
+            for (; bc < InputChannelsThisIteration; bc++) {
+                *D++ = *s;
+                s += InputSize;
+            }
+
+            for (; bc < BlockSize; bc++) {
+                *D++ = 0;
+            }
+        }
+
+        S += BlockSize * InputSize;
+    }
+}
+
+void
+MLASCALL
+MlasReorderOutputNchw(
+    const int64_t* OutputShape,
+    const uint8_t* S,
+    uint8_t* D
+    )
+/*++
+
+Routine Description:
+
+    This routine reorders a quantized output buffer from NCHWc to NCHW format.
+
+Arguments:
+
+    OutputShape - Supplies the shape of the output tensor.
+
+    S - Supplies the address of the source tensor.
+
+    D - Supplies the address of the destination tensor.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t BlockSize = MlasNchwcGetBlockSize();
+
+    const size_t BatchCount = size_t(OutputShape[0]);
+    const size_t OutputChannels = size_t(OutputShape[1]);
+    const size_t OutputSize = size_t(OutputShape[2]) * size_t(OutputShape[3]);
+
+    for (size_t batch = 0; batch < BatchCount; batch++) {
+
+        for (size_t o = OutputChannels; o > 0;) {
+
+            const size_t OutputChannelsThisIteration = (std::min)(o, BlockSize);
+            o -= OutputChannelsThisIteration;
+
+            //
+            // Deinterleave the channels of this block, skipping any padding
+            // channels of the final block.
+            //
+
+            for (size_t bc = 0; bc < OutputChannelsThisIteration; bc++) {
+
+                const uint8_t* s = S + bc;
+
+                for (size_t n = 0; n < OutputSize; n++) {
+                    *D++ = *s;
+                    s += BlockSize;
+                }
+            }
+
+            S += BlockSize * OutputSize;
+        }
+    }
+}
+
+void
+MLASCALL
+MlasReorderOutputNhwc(
+    const int64_t* OutputShape,
+    const uint8_t* S,
+    uint8_t* D
+    )
+/*++
+
+Routine Description:
+
+    This routine reorders a quantized output buffer from NCHWc to NHWC format.
+
+Arguments:
+
+    OutputShape - Supplies the shape of the output tensor.
+
+    S - Supplies the address of the source tensor.
+
+    D - Supplies the address of the destination tensor.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t BlockSize = MlasNchwcGetBlockSize();
+
+    const size_t BatchCount = size_t(OutputShape[0]);
+    const size_t OutputChannels = size_t(OutputShape[3]);
+    const size_t OutputSize = size_t(OutputShape[1]) * size_t(OutputShape[2]);
+
+    const size_t AlignedOutputChannels = (OutputChannels + BlockSize - 1) & ~(BlockSize - 1);
+
+    for (size_t batch = 0; batch < BatchCount; batch++) {
+
+        const uint8_t* s = S;
+
+        for (size_t n = 0; n < OutputSize; n++) {
+
+            const uint8_t* ss = s;
+
+            for (size_t o = OutputChannels; o > 0;) {
+
+                const size_t OutputChannelsThisIteration = (std::min)(o, BlockSize);
+                o -= OutputChannelsThisIteration;
+
+                std::copy_n(ss, OutputChannelsThisIteration, D);
+
+                ss += BlockSize * OutputSize;
+                D += OutputChannelsThisIteration;
+            }
+
+            s += BlockSize;
+        }
+
+        S += AlignedOutputChannels * OutputSize;
+    }
+}
+
+void
+MLASCALL
+MlasReorderFilterOIHWBiBo(
+    const int64_t* FilterShape,
+    const uint8_t* S,
+    uint8_t* D
+    )
+/*++
+
+Routine Description:
+
+    This routine reorders a quantized filter buffer from OIHW to OIHWBiBo
+    format.
+
+Arguments:
+
+    FilterShape - Supplies the shape of the filter tensor.
+
+    S - Supplies the address of the source tensor.
+
+    D - Supplies the address of the destination tensor.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t BlockSize = MlasNchwcGetBlockSize();
+
+    const size_t OutputChannels = size_t(FilterShape[0]);
+    const size_t InputChannels = size_t(FilterShape[1]);
+    const size_t KernelHeight = size_t(FilterShape[2]);
+    const size_t KernelWidth = size_t(FilterShape[3]);
+
+    const size_t KernelSize = KernelHeight * KernelWidth;
+    const size_t InputStride = InputChannels * KernelSize;
+
+    //
+    // The layout is the same as the single precision OIHWBiBo format, so the
+    // BlockSize by BlockSize matrix of each kernel position can be used as
+    // the B operand of a QGEMM. Output and input channels beyond the end of
+    // the filter tensor are zero padded.
+    //
+
+    for (size_t o = OutputChannels; o > 0;) {
+
+        const size_t OutputChannelsThisIteration = (std::min)(o, BlockSize);
+        o -= OutputChannelsThisIteration;
+
+        for (size_t i = 0; i < InputChannels; i += BlockSize) {
+
+            const size_t InputChannelsThisIteration = (std::min)(InputChannels - i, BlockSize);
+
+            for (size_t k = 0; k < KernelSize; k++) {
+
+                for (size_t bi = 0; bi < BlockSize; bi++) {
+
+                    for (size_t bo = 0; bo < BlockSize; bo++) {
+
+                        if (bo < OutputChannelsThisIteration && bi < InputChannelsThisIteration) {
+                            *D++ = S[bo * InputStride + (i + bi) * KernelSize + k];
+                        } else {
+                            *D++ = 0;
+                        }
+                    }
+                }
+            }
+        }
+
+        S += BlockSize * InputStride;
+    }
+}
+
+void
+MLASCALL
+MlasReorderFilterOIHWBo(
+    const int64_t* FilterShape,
+    const uint8_t* S,
+    uint8_t* D
+    )
+/*++
+
+Routine Description:
+
+    This routine reorders a quantized filter buffer from OIHW to OIHWBo
+    format.
+
+Arguments:
+
+    FilterShape - Supplies the shape of the filter tensor.
+
+    S - Supplies the address of the source tensor.
+
+    D - Supplies the address of the destination tensor.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t BlockSize = MlasNchwcGetBlockSize();
+
+    const size_t OutputChannels = size_t(FilterShape[0]);
+    const size_t InputChannels = size_t(FilterShape[1]);
+    const size_t KernelHeight = size_t(FilterShape[2]);
+    const size_t KernelWidth = size_t(FilterShape[3]);
+
+    const size_t InputStride = InputChannels * KernelHeight * KernelWidth;
+
+    //
+    // The layout is the same as the single precision OIHWBo format. Output
+    // channels beyond the end of the filter tensor are zero padded.
+    //
+
+    for (size_t o = OutputChannels; o > 0;) {
+
+        const size_t OutputChannelsThisIteration = (std::min)(o, BlockSize);
+        o -= OutputChannelsThisIteration;
+
+        for (size_t k = 0; k < InputStride; k++) {
+
+            size_t bo = 0;
+
+            for (; bo < OutputChannelsThisIteration; bo++) {
+                *D++ = S[bo * InputStride + k];
+            }
+
+            for (; bo < BlockSize; bo++) {
+                *D++ = 0;
+            }
+        }
+
+        S += BlockSize * InputStride;
+    }
+}
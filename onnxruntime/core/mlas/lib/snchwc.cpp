@@ -17,29 +17,6 @@ Abstract:
 
 #include "mlasi.h"
 
-//
-// Define the base thread context for NCWHc convolution or pooling operations.
-//
-
-struct MLAS_NCHWC_WORK_BLOCK
-{
-    int32_t tids;
-    size_t BatchCount;
-    size_t InputChannels;
-    size_t InputShape[2];
-    size_t InputSize;
-    size_t OutputChannels;
-    size_t OutputShape[2];
-    size_t OutputSize;
-    size_t KernelShape[2];
-    size_t DilationShape[2];
-    size_t Padding[4];
-    size_t StrideShape[2];
-    size_t OutputCountLeftPad[2];
-    size_t OutputCount[2];
-    size_t OutputCountRightPad[2];
-};
-
 //
 // Define the worker thread context for a NCHWc convolution operation.
 //
@@ -0,0 +1,1098 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    winograd.cpp
+
+Abstract:
+
+    This module implements the Winograd minimal filtering algorithms F(2x2,3x3)
+    and F(4x4,3x3) for two dimensional convolutions with a 3x3 kernel and unit
+    stride and dilation.
+
+    The filter is transformed to a set of (TileSize + 2)^2 matrices of shape
+    FilterCount by InputChannels. Blocks of input tiles are transformed to the
+    same number of matrices of shape InputChannels by TileCount, multiplied by
+    the transformed filter with a GEMM per tile element, and transformed back
+    to output tiles. The transforms process four tiles at a time.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Define the minimum number of input channels and filters per group to use
+// the Winograd algorithm. Smaller convolutions do not amortize the transforms.
+//
+
+#define MLAS_CONV_WINOGRAD_MINIMUM_CHANNELS 16
+
+//
+// Define the target number of tiles to transform per block. Blocks are made
+// of whole rows of tiles.
+//
+
+#define MLAS_CONV_WINOGRAD_TILE_BLOCK 64
+
+//
+// Define the relative cost of a transformed element to a multiply/add of the
+// GEMM, as the transforms are bound by memory accesses.
+//
+
+#define MLAS_CONV_WINOGRAD_TRANSFORM_COST 8
+
+MLAS_FORCEINLINE
+void
+MlasWinogradTranspose4x4(
+    MLAS_FLOAT32X4& Vector0,
+    MLAS_FLOAT32X4& Vector1,
+    MLAS_FLOAT32X4& Vector2,
+    MLAS_FLOAT32X4& Vector3
+    )
+{
+#if defined(MLAS_NEON_INTRINSICS)
+    float32x4x2_t z0 = vzipq_f32(Vector0, Vector2);
+    float32x4x2_t z1 = vzipq_f32(Vector1, Vector3);
+    float32x4x2_t o0 = vzipq_f32(z0.val[0], z1.val[0]);
+    float32x4x2_t o1 = vzipq_f32(z0.val[1], z1.val[1]);
+    Vector0 = o0.val[0];
+    Vector1 = o0.val[1];
+    Vector2 = o1.val[0];
+    Vector3 = o1.val[1];
+#elif defined(MLAS_SSE2_INTRINSICS)
+    __m128 z0 = _mm_unpacklo_ps(Vector0, Vector1);
+    __m128 z1 = _mm_unpackhi_ps(Vector0, Vector1);
+    __m128 z2 = _mm_unpacklo_ps(Vector2, Vector3);
+    __m128 z3 = _mm_unpackhi_ps(Vector2, Vector3);
+    Vector0 = _mm_movelh_ps(z0, z2);
+    Vector1 = _mm_movehl_ps(z2, z0);
+    Vector2 = _mm_movelh_ps(z1, z3);
+    Vector3 = _mm_movehl_ps(z3, z1);
+#else
+#error Unsupported architecture.
+#endif
+}
+
+MLAS_FORCEINLINE
+void
+MlasWinogradInterleave(
+    MLAS_FLOAT32X4& Vector0,
+    MLAS_FLOAT32X4& Vector1
+    )
+{
+#if defined(MLAS_NEON_INTRINSICS)
+    float32x4x2_t z = vzipq_f32(Vector0, Vector1);
+    Vector0 = z.val[0];
+    Vector1 = z.val[1];
+#elif defined(MLAS_SSE2_INTRINSICS)
+    __m128 z0 = _mm_unpacklo_ps(Vector0, Vector1);
+    __m128 z1 = _mm_unpackhi_ps(Vector0, Vector1);
+    Vector0 = z0;
+    Vector1 = z1;
+#else
+#error Unsupported architecture.
+#endif
+}
+
+//
+// Abstraction for the F(2x2,3x3) transforms.
+//
+
+struct MLAS_WINOGRAD_F2X3
+{
+    static constexpr size_t OutputTile = 2;
+    static constexpr size_t InputTile = 4;
+
+    static void FilterTransform(const float* g, size_t gStride, float* u, size_t uStride)
+    {
+        const float g0 = g[0];
+        const float g1 = g[gStride];
+        const float g2 = g[2 * gStride];
+
+        u[0] = g0;
+        u[uStride] = 0.5f * (g0 + g1 + g2);
+        u[2 * uStride] = 0.5f * (g0 - g1 + g2);
+        u[3 * uStride] = g2;
+    }
+
+    static MLAS_FORCEINLINE void InputTransform(const MLAS_FLOAT32X4* d, size_t dStride, MLAS_FLOAT32X4* v, size_t vStride)
+    {
+        MLAS_FLOAT32X4 d0 = d[0];
+        MLAS_FLOAT32X4 d1 = d[dStride];
+        MLAS_FLOAT32X4 d2 = d[2 * dStride];
+        MLAS_FLOAT32X4 d3 = d[3 * dStride];
+
+        v[0] = MlasSubtractFloat32x4(d0, d2);
+        v[vStride] = MlasAddFloat32x4(d1, d2);
+        v[2 * vStride] = MlasSubtractFloat32x4(d2, d1);
+        v[3 * vStride] = MlasSubtractFloat32x4(d1, d3);
+    }
+
+    static MLAS_FORCEINLINE void OutputTransform(const MLAS_FLOAT32X4* m, size_t mStride, MLAS_FLOAT32X4* y, size_t yStride)
+    {
+        MLAS_FLOAT32X4 m0 = m[0];
+        MLAS_FLOAT32X4 m1 = m[mStride];
+        MLAS_FLOAT32X4 m2 = m[2 * mStride];
+        MLAS_FLOAT32X4 m3 = m[3 * mStride];
+
+        y[0] = MlasAddFloat32x4(MlasAddFloat32x4(m0, m1), m2);
+        y[yStride] = MlasSubtractFloat32x4(MlasSubtractFloat32x4(m1, m2), m3);
+    }
+
+    static MLAS_FORCEINLINE void StoreOutputRow(float* output, const MLAS_FLOAT32X4* y)
+    {
+        MLAS_FLOAT32X4 y0 = y[0];
+        MLAS_FLOAT32X4 y1 = y[1];
+
+        MlasWinogradInterleave(y0, y1);
+
+        MlasStoreFloat32x4(output, y0);
+        MlasStoreFloat32x4(output + 4, y1);
+    }
+};
+
+//
+// Abstraction for the F(4x4,3x3) transforms.
+//
+
+struct MLAS_WINOGRAD_F4X3
+{
+    static constexpr size_t OutputTile = 4;
+    static constexpr size_t InputTile = 6;
+
+    static void FilterTransform(const float* g, size_t gStride, float* u, size_t uStride)
+    {
+        const float g0 = g[0];
+        const float g1 = g[gStride];
+        const float g2 = g[2 * gStride];
+
+        u[0] = g0 / 4.0f;
+        u[uStride] = -(g0 + g1 + g2) / 6.0f;
+        u[2 * uStride] = -(g0 - g1 + g2) / 6.0f;
+        u[3 * uStride] = g0 / 24.0f + g1 / 12.0f + g2 / 6.0f;
+        u[4 * uStride] = g0 / 24.0f - g1 / 12.0f + g2 / 6.0f;
+        u[5 * uStride] = g2;
+    }
+
+    static MLAS_FORCEINLINE void InputTransform(const MLAS_FLOAT32X4* d, size_t dStride, MLAS_FLOAT32X4* v, size_t vStride)
+    {
+        const MLAS_FLOAT32X4 Two = MlasBroadcastFloat32x4(2.0f);
+        const MLAS_FLOAT32X4 Four = MlasBroadcastFloat32x4(4.0f);
+        const MLAS_FLOAT32X4 MinusFour = MlasBroadcastFloat32x4(-4.0f);
+        const MLAS_FLOAT32X4 MinusFive = MlasBroadcastFloat32x4(-5.0f);
+
+        MLAS_FLOAT32X4 d0 = d[0];
+        MLAS_FLOAT32X4 d1 = d[dStride];
+        MLAS_FLOAT32X4 d2 = d[2 * dStride];
+        MLAS_FLOAT32X4 d3 = d[3 * dStride];
+        MLAS_FLOAT32X4 d4 = d[4 * dStride];
+        MLAS_FLOAT32X4 d5 = d[5 * dStride];
+
+        MLAS_FLOAT32X4 t0 = MlasMultiplyAddFloat32x4(d2, MinusFour, d4);
+        MLAS_FLOAT32X4 t1 = MlasMultiplyAddFloat32x4(d1, MinusFour, d3);
+        MLAS_FLOAT32X4 t2 = MlasSubtractFloat32x4(d4, d2);
+        MLAS_FLOAT32X4 t3 = MlasMultiplyFloat32x4(MlasSubtractFloat32x4(d3, d1), Two);
+
+        v[0] = MlasMultiplyAddFloat32x4(d0, Four, MlasMultiplyAddFloat32x4(d2, MinusFive, d4));
+        v[vStride] = MlasAddFloat32x4(t0, t1);
+        v[2 * vStride] = MlasSubtractFloat32x4(t0, t1);
+        v[3 * vStride] = MlasAddFloat32x4(t2, t3);
+        v[4 * vStride] = MlasSubtractFloat32x4(t2, t3);
+        v[5 * vStride] = MlasMultiplyAddFloat32x4(d1, Four, MlasMultiplyAddFloat32x4(d3, MinusFive, d5));
+    }
+
+    static MLAS_FORCEINLINE void OutputTransform(const MLAS_FLOAT32X4* m, size_t mStride, MLAS_FLOAT32X4* y, size_t yStride)
+    {
+        const MLAS_FLOAT32X4 Two = MlasBroadcastFloat32x4(2.0f);
+        const MLAS_FLOAT32X4 Four = MlasBroadcastFloat32x4(4.0f);
+        const MLAS_FLOAT32X4 Eight = MlasBroadcastFloat32x4(8.0f);
+
+        MLAS_FLOAT32X4 m0 = m[0];
+        MLAS_FLOAT32X4 m1 = m[mStride];
+        MLAS_FLOAT32X4 m2 = m[2 * mStride];
+        MLAS_FLOAT32X4 m3 = m[3 * mStride];
+        MLAS_FLOAT32X4 m4 = m[4 * mStride];
+        MLAS_FLOAT32X4 m5 = m[5 * mStride];
+
+        MLAS_FLOAT32X4 s0 = MlasAddFloat32x4(m1, m2);
+        MLAS_FLOAT32X4 s1 = MlasAddFloat32x4(m3, m4);
+        MLAS_FLOAT32X4 d0 = MlasSubtractFloat32x4(m1, m2);
+        MLAS_FLOAT32X4 d1 = MlasSubtractFloat32x4(m3, m4);
+
+        y[0] = MlasAddFloat32x4(MlasAddFloat32x4(m0, s0), s1);
+        y[yStride] = MlasMultiplyAddFloat32x4(d1, Two, d0);
+        y[2 * yStride] = MlasMultiplyAddFloat32x4(s1, Four, s0);
+        y[3 * yStride] = MlasAddFloat32x4(MlasMultiplyAddFloat32x4(d1, Eight, d0), m5);
+    }
+
+    static MLAS_FORCEINLINE void StoreOutputRow(float* output, const MLAS_FLOAT32X4* y)
+    {
+        MLAS_FLOAT32X4 y0 = y[0];
+        MLAS_FLOAT32X4 y1 = y[1];
+        MLAS_FLOAT32X4 y2 = y[2];
+        MLAS_FLOAT32X4 y3 = y[3];
+
+        MlasWinogradTranspose4x4(y0, y1, y2, y3);
+
+        MlasStoreFloat32x4(output, y0);
+        MlasStoreFloat32x4(output + 4, y1);
+        MlasStoreFloat32x4(output + 8, y2);
+        MlasStoreFloat32x4(output + 12, y3);
+    }
+};
+
+//
+// Define the parameters to execute segments of a Winograd convolution on
+// worker threads.
+//
+
+struct MLAS_CONV_WINOGRAD_WORK_BLOCK {
+    const MLAS_CONV_PARAMETERS* Parameters;
+    const float* Input;
+    const float* TransformedFilter;
+    const float* Bias;
+    float* WorkingBuffer;
+    float* Output;
+    size_t WorkingBufferSizePerThread;
+    int32_t TargetThreadCount;
+};
+
+template<typename WinogradTransform>
+void
+MlasConvWinogradTransformFilter(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Filter,
+    float* TransformedFilter
+    )
+/*++
+
+Routine Description:
+
+    This routine transforms the 3x3 filter of every input channel and filter
+    to the Winograd domain, as U = G * g * G^T.
+
+    The transformed filter is stored as a matrix of shape FilterCount by
+    InputChannels for each element of the input tile, for each group.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    Filter - Supplies the filter tensor.
+
+    TransformedFilter - Supplies the buffer to receive the transformed filter.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    constexpr size_t InputTile = WinogradTransform::InputTile;
+    constexpr size_t TileElements = InputTile * InputTile;
+
+    const size_t GroupCount = Parameters->GroupCount;
+    const size_t FilterCount = Parameters->FilterCount;
+    const size_t InputChannels = Parameters->InputChannels;
+    const size_t MatrixSize = FilterCount * InputChannels;
+
+    for (size_t g = 0; g < GroupCount; g++) {
+
+        for (size_t f = 0; f < FilterCount; f++) {
+
+            for (size_t c = 0; c < InputChannels; c++) {
+
+                float Columns[InputTile * 3];
+                float Tile[TileElements];
+
+                //
+                // Transform the columns of the kernel, then the rows.
+                //
+
+                for (size_t kx = 0; kx < 3; kx++) {
+                    WinogradTransform::FilterTransform(Filter + kx, 3, Columns + kx, 3);
+                }
+
+                for (size_t i = 0; i < InputTile; i++) {
+                    WinogradTransform::FilterTransform(Columns + i * 3, 1, Tile + i * InputTile, 1);
+                }
+
+                float* u = TransformedFilter + f * InputChannels + c;
+
+                for (size_t e = 0; e < TileElements; e++) {
+                    u[e * MatrixSize] = Tile[e];
+                }
+
+                Filter += 9;
+            }
+        }
+
+        TransformedFilter += TileElements * MatrixSize;
+    }
+}
+
+template<typename WinogradTransform>
+void
+MlasConvWinogradOperation(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    const float* TransformedFilter,
+    const float* Bias,
+    float* WorkingBuffer,
+    float* Output,
+    size_t TileRowStart,
+    size_t TileRowCount
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the Winograd convolution of a block of tile rows
+    of one batch and group.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    Input - Supplies the input channels of the group.
+
+    TransformedFilter - Supplies the transformed filter of the group.
+
+    Bias - Optionally supplies the bias of the group.
+
+    WorkingBuffer - Supplies the working buffer for the transformed input and
+        output tiles.
+
+    Output - Supplies the output channels of the group.
+
+    TileRowStart - Supplies the first tile row to compute.
+
+    TileRowCount - Supplies the number of tile rows to compute.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    constexpr size_t OutputTile = WinogradTransform::OutputTile;
+    constexpr size_t InputTile = WinogradTransform::InputTile;
+    constexpr size_t TileElements = InputTile * InputTile;
+
+    const size_t InputChannels = Parameters->InputChannels;
+    const size_t FilterCount = Parameters->FilterCount;
+    const size_t InputHeight = Parameters->InputShape[0];
+    const size_t InputWidth = Parameters->InputShape[1];
+    const size_t InputSize = Parameters->InputSize;
+    const size_t OutputHeight = Parameters->OutputShape[0];
+    const size_t OutputWidth = Parameters->OutputShape[1];
+    const size_t OutputSize = Parameters->OutputSize;
+    const size_t PaddingLeftY = Parameters->Padding[0];
+    const size_t PaddingLeftX = Parameters->Padding[1];
+    const size_t TilesX = (OutputWidth + OutputTile - 1) / OutputTile;
+
+    //
+    // The tile count is padded to a multiple of four tiles. The padding tiles
+    // read zeros and are not stored to the output.
+    //
+
+    const size_t TileCount = TileRowCount * TilesX;
+    const size_t PaddedTileCount = (TileCount + 3) & ~size_t(3);
+
+    float* TransformedInput = WorkingBuffer;
+    float* TransformedOutput = WorkingBuffer + TileElements * InputChannels * PaddedTileCount;
+
+    MLAS_DECLSPEC_ALIGN(float Patch[TileElements][4], sizeof(MLAS_FLOAT32X4));
+    MLAS_FLOAT32X4 Rows[TileElements];
+    MLAS_FLOAT32X4 Tile[TileElements];
+
+    //
+    // Transform the input tiles, four tiles at a time.
+    //
+
+    for (size_t t = 0; t < PaddedTileCount; t += 4) {
+
+        size_t InputOffset[4];
+        bool InputInterior[4];
+        bool TileValid[4];
+
+        for (size_t lane = 0; lane < 4; lane++) {
+
+            size_t tile = t + lane;
+            size_t ty = TileRowStart + tile / TilesX;
+            size_t tx = tile % TilesX;
+
+            size_t ih = ty * OutputTile - PaddingLeftY;
+            size_t iw = tx * OutputTile - PaddingLeftX;
+
+            TileValid[lane] = (tile < TileCount);
+            InputInterior[lane] = TileValid[lane] &&
+                ih < InputHeight && ih + InputTile <= InputHeight &&
+                iw < InputWidth && iw + InputTile <= InputWidth;
+            InputOffset[lane] = ih * InputWidth + iw;
+        }
+
+        //
+        // The patches of four adjacent tiles of the same row are loaded as
+        // vectors and transposed.
+        //
+
+        const bool InputRowInterior = (t % TilesX) + 3 < TilesX &&
+            InputInterior[0] && InputInterior[3];
+
+        for (size_t c = 0; c < InputChannels; c++) {
+
+            const float* input = Input + c * InputSize;
+
+            if (InputRowInterior) {
+
+                const float* patch = input + InputOffset[0];
+
+                for (size_t i = 0; i < InputTile; i++) {
+
+                    for (size_t j = 0; j < InputTile; j += 4) {
+
+                        //
+                        // Overlap the last columns with the previous ones
+                        // when the tile is not a multiple of four wide.
+                        //
+
+                        size_t jj = (j + 4 > InputTile) ? InputTile - 4 : j;
+
+                        MLAS_FLOAT32X4 v0 = MlasLoadFloat32x4(patch + jj);
+                        MLAS_FLOAT32X4 v1 = MlasLoadFloat32x4(patch + jj + OutputTile);
+                        MLAS_FLOAT32X4 v2 = MlasLoadFloat32x4(patch + jj + 2 * OutputTile);
+                        MLAS_FLOAT32X4 v3 = MlasLoadFloat32x4(patch + jj + 3 * OutputTile);
+
+                        MlasWinogradTranspose4x4(v0, v1, v2, v3);
+
+                        Tile[i * InputTile + jj] = v0;
+                        Tile[i * InputTile + jj + 1] = v1;
+                        Tile[i * InputTile + jj + 2] = v2;
+                        Tile[i * InputTile + jj + 3] = v3;
+                    }
+
+                    patch += InputWidth;
+                }
+
+            } else {
+
+                //
+                // Gather the input patches, checking the bounds only for the
+                // tiles that overlap the padding.
+                //
+
+                for (size_t lane = 0; lane < 4; lane++) {
+
+                    if (InputInterior[lane]) {
+
+                        const float* patch = input + InputOffset[lane];
+
+                        for (size_t i = 0; i < InputTile; i++) {
+                            for (size_t j = 0; j < InputTile; j++) {
+                                Patch[i * InputTile + j][lane] = patch[i * InputWidth + j];
+                            }
+                        }
+
+                    } else {
+
+                        size_t tile = t + lane;
+                        size_t ty = TileRowStart + tile / TilesX;
+                        size_t tx = tile % TilesX;
+
+                        for (size_t i = 0; i < InputTile; i++) {
+
+                            size_t ih = ty * OutputTile + i - PaddingLeftY;
+
+                            for (size_t j = 0; j < InputTile; j++) {
+
+                                size_t iw = tx * OutputTile + j - PaddingLeftX;
+
+                                Patch[i * InputTile + j][lane] =
+                                    (TileValid[lane] && ih < InputHeight && iw < InputWidth) ?
+                                    input[ih * InputWidth + iw] : 0.0f;
+                            }
+                        }
+                    }
+                }
+
+                for (size_t e = 0; e < TileElements; e++) {
+                    Tile[e] = MlasLoadFloat32x4(Patch[e]);
+                }
+            }
+
+            //
+            // Compute V = B^T * d * B by transforming the columns, then the
+            // rows, and store each element to its matrix.
+            //
+
+            for (size_t j = 0; j < InputTile; j++) {
+                WinogradTransform::InputTransform(Tile + j, InputTile, Rows + j, InputTile);
+            }
+
+            for (size_t i = 0; i < InputTile; i++) {
+                WinogradTransform::InputTransform(Rows + i * InputTile, 1, Tile + i * InputTile, 1);
+            }
+
+            float* v = TransformedInput + c * PaddedTileCount + t;
+
+            for (size_t e = 0; e < TileElements; e++) {
+                MlasStoreFloat32x4(v + e * InputChannels * PaddedTileCount, Tile[e]);
+            }
+        }
+    }
+
+    //
+    // Multiply the transformed filter by the transformed input for every
+    // element of the tile.
+    //
+
+    for (size_t e = 0; e < TileElements; e++) {
+
+        MlasSgemmOperation(CblasNoTrans, CblasNoTrans, FilterCount, PaddedTileCount,
+            InputChannels, 1.0f, TransformedFilter + e * FilterCount * InputChannels,
+            InputChannels, TransformedInput + e * InputChannels * PaddedTileCount,
+            PaddedTileCount, 0.0f, TransformedOutput + e * FilterCount * PaddedTileCount,
+            PaddedTileCount);
+    }
+
+    //
+    // Transform the output tiles, four tiles at a time, as Y = A^T * m * A.
+    //
+
+    for (size_t f = 0; f < FilterCount; f++) {
+
+        float* output = Output + f * OutputSize;
+
+        for (size_t t = 0; t < TileCount; t += 4) {
+
+            const float* m = TransformedOutput + f * PaddedTileCount + t;
+
+            for (size_t e = 0; e < TileElements; e++) {
+                Tile[e] = MlasLoadFloat32x4(m + e * FilterCount * PaddedTileCount);
+            }
+
+            for (size_t j = 0; j < InputTile; j++) {
+                WinogradTransform::OutputTransform(Tile + j, InputTile, Rows + j, InputTile);
+            }
+
+            for (size_t i = 0; i < OutputTile; i++) {
+                WinogradTransform::OutputTransform(Rows + i * InputTile, 1, Tile + i * OutputTile, 1);
+            }
+
+            //
+            // Store four adjacent output tiles of the same row as vectors, else
+            // scatter the output tiles, clipping the tiles that extend past
+            // the output.
+            //
+
+            size_t oh = (TileRowStart + t / TilesX) * OutputTile;
+            size_t ow = (t % TilesX) * OutputTile;
+
+            if (oh + OutputTile <= OutputHeight && ow + 4 * OutputTile <= OutputWidth) {
+
+                for (size_t i = 0; i < OutputTile; i++) {
+                    WinogradTransform::StoreOutputRow(output + (oh + i) * OutputWidth + ow,
+                        Tile + i * OutputTile);
+                }
+
+                continue;
+            }
+
+            for (size_t e = 0; e < OutputTile * OutputTile; e++) {
+                MlasStoreFloat32x4(Patch[e], Tile[e]);
+            }
+
+            size_t LaneCount = TileCount - t;
+
+            if (LaneCount > 4) {
+                LaneCount = 4;
+            }
+
+            for (size_t lane = 0; lane < LaneCount; lane++) {
+
+                size_t tile = t + lane;
+
+                oh = (TileRowStart + tile / TilesX) * OutputTile;
+                ow = (tile % TilesX) * OutputTile;
+
+                size_t CountY = OutputHeight - oh;
+                size_t CountX = OutputWidth - ow;
+
+                if (CountY > OutputTile) {
+                    CountY = OutputTile;
+                }
+
+                if (CountX > OutputTile) {
+                    CountX = OutputTile;
+                }
+
+                for (size_t i = 0; i < CountY; i++) {
+                    for (size_t j = 0; j < CountX; j++) {
+                        output[(oh + i) * OutputWidth + ow + j] = Patch[i * OutputTile + j][lane];
+                    }
+                }
+            }
+        }
+    }
+
+    //
+    // Apply the activation with optional bias to the output rows of the
+    // block.
+    //
+
+    size_t OutputRowStart = TileRowStart * OutputTile;
+    size_t OutputRowEnd = (TileRowStart + TileRowCount) * OutputTile;
+
+    if (OutputRowEnd > OutputHeight) {
+        OutputRowEnd = OutputHeight;
+    }
+
+    MlasActivation(Parameters->Activation, Output + OutputRowStart * OutputWidth, Bias,
+        FilterCount, (OutputRowEnd - OutputRowStart) * OutputWidth, OutputSize);
+}
+
+template<typename WinogradTransform>
+void
+MlasConvWinogradThreaded(
+    void* Context,
+    int32_t Index
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of a
+    Winograd convolution operation.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    Index - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_CONV_WINOGRAD_WORK_BLOCK* WorkBlock = (MLAS_CONV_WINOGRAD_WORK_BLOCK*)Context;
+
+    const MLAS_CONV_PARAMETERS* Parameters = WorkBlock->Parameters;
+
+    constexpr size_t OutputTile = WinogradTransform::OutputTile;
+    constexpr size_t InputTile = WinogradTransform::InputTile;
+
+    //
+    // Compute the range of tile row blocks to use for this thread.
+    //
+
+    const size_t GroupCount = Parameters->GroupCount;
+    const size_t TilesY = (Parameters->OutputShape[0] + OutputTile - 1) / OutputTile;
+    const size_t TileRowsPerBlock = Parameters->u.Winograd.TileRowsPerBlock;
+    const size_t BlockCount = (TilesY + TileRowsPerBlock - 1) / TileRowsPerBlock;
+    const size_t TotalBlockCount = Parameters->BatchCount * GroupCount * BlockCount;
+
+    const size_t TargetThreadCount = WorkBlock->TargetThreadCount;
+
+    const size_t BlockCountPerThread = TotalBlockCount / TargetThreadCount;
+    const size_t BlockCountExtra = TotalBlockCount % TargetThreadCount;
+
+    size_t BlockStart;
+    size_t BlockEnd;
+
+    if (uint32_t(Index) < BlockCountExtra) {
+        BlockStart = (BlockCountPerThread + 1) * Index;
+        BlockEnd = BlockStart + BlockCountPerThread + 1;
+    } else {
+        BlockStart = BlockCountPerThread * Index + BlockCountExtra;
+        BlockEnd = BlockStart + BlockCountPerThread;
+    }
+
+    //
+    // Iterate over the tile row blocks allocated to this thread.
+    //
+
+    const size_t FilterCount = Parameters->FilterCount;
+    const size_t InputGroupSize = Parameters->InputChannels * Parameters->InputSize;
+    const size_t OutputGroupSize = FilterCount * Parameters->OutputSize;
+    const size_t FilterGroupSize = InputTile * InputTile * FilterCount * Parameters->InputChannels;
+
+    float* WorkingBuffer = WorkBlock->WorkingBuffer + Index * WorkBlock->WorkingBufferSizePerThread;
+
+    for (size_t block = BlockStart; block < BlockEnd; block++) {
+
+        const size_t bg = block / BlockCount;
+        const size_t group = bg % GroupCount;
+        const size_t TileRowStart = (block % BlockCount) * TileRowsPerBlock;
+
+        size_t TileRowCount = TilesY - TileRowStart;
+
+        if (TileRowCount > TileRowsPerBlock) {
+            TileRowCount = TileRowsPerBlock;
+        }
+
+        const float* bias = WorkBlock->Bias;
+
+        if (bias != nullptr) {
+            bias += group * FilterCount;
+        }
+
+        MlasConvWinogradOperation<WinogradTransform>(Parameters,
+            WorkBlock->Input + bg * InputGroupSize,
+            WorkBlock->TransformedFilter + group * FilterGroupSize, bias, WorkingBuffer,
+            WorkBlock->Output + bg * OutputGroupSize, TileRowStart, TileRowCount);
+    }
+}
+
+template<typename WinogradTransform>
+void
+MlasConvWinogradExecute(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    const float* Filter,
+    const float* Bias,
+    float* WorkingBuffer,
+    float* Output,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the Winograd convolution operation for the
+    specified transform.
+
+Arguments:
+
+    See MlasConvWinograd.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    constexpr size_t InputTile = WinogradTransform::InputTile;
+
+    const float* TransformedFilter = Parameters->u.Winograd.TransformedFilter;
+
+    //
+    // Transform the filter into the start of the working buffer if the caller
+    // did not supply a transformed filter. Otherwise the working buffer does
+    // not include space for the transformed filter.
+    //
+
+    if (TransformedFilter == nullptr) {
+        MlasConvWinogradTransformFilter<WinogradTransform>(Parameters, Filter, WorkingBuffer);
+        TransformedFilter = WorkingBuffer;
+        WorkingBuffer += MlasConvWinogradTransformedFilterSize(Parameters);
+    }
+
+    MLAS_CONV_WINOGRAD_WORK_BLOCK WorkBlock;
+
+    WorkBlock.Parameters = Parameters;
+    WorkBlock.Input = Input;
+    WorkBlock.TransformedFilter = TransformedFilter;
+    WorkBlock.Bias = Bias;
+    WorkBlock.WorkingBuffer = WorkingBuffer;
+    WorkBlock.Output = Output;
+    WorkBlock.WorkingBufferSizePerThread = InputTile * InputTile *
+        Parameters->u.Winograd.PaddedTileCount * (Parameters->InputChannels + Parameters->FilterCount);
+    WorkBlock.TargetThreadCount = Parameters->ThreadCount;
+
+    MlasExecuteThreaded(MlasConvWinogradThreaded<WinogradTransform>, &WorkBlock,
+        Parameters->ThreadCount, ThreadPool);
+}
+
+inline
+size_t
+MlasConvWinogradTileRowsPerBlock(
+    size_t TilesY,
+    size_t TilesX
+    )
+{
+    size_t TileRowsPerBlock = MLAS_CONV_WINOGRAD_TILE_BLOCK / TilesX;
+
+    if (TileRowsPerBlock == 0) {
+        TileRowsPerBlock = 1;
+    }
+
+    if (TileRowsPerBlock > TilesY) {
+        TileRowsPerBlock = TilesY;
+    }
+
+    return TileRowsPerBlock;
+}
+
+bool
+MlasConvWinogradPrepare(
+    MLAS_CONV_PARAMETERS* Parameters,
+    size_t* WorkingBufferSize,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine determines whether a convolution is performed with a
+    Winograd algorithm and prepares its parameters.
+
+    The arithmetic of the convolution with an expanded input and a GEMM is
+    compared to the arithmetic of the GEMMs and the transforms of each tile
+    size, including the partial tiles at the edges of the output. Small
+    outputs do not fill the GEMM panels and keep using the expanded input.
+
+Arguments:
+
+    Parameters - Supplies the structure that stores the provided and computed
+        parameters for the convolution operation.
+
+    WorkingBufferSize - Receives the number of elements to allocate for the
+        working buffer. This includes MlasConvWinogradTransformedFilterSize
+        elements for the transformed filter, which are not needed if the
+        caller supplies a transformed filter.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    Returns true if the Winograd algorithm is selected, else false.
+
+--*/
+{
+    if (Parameters->Dimensions != 2 ||
+        Parameters->KernelShape[0] != 3 || Parameters->KernelShape[1] != 3 ||
+        Parameters->StrideShape[0] != 1 || Parameters->StrideShape[1] != 1 ||
+        Parameters->DilationShape[0] != 1 || Parameters->DilationShape[1] != 1) {
+        return false;
+    }
+
+    const size_t InputChannels = Parameters->InputChannels;
+    const size_t FilterCount = Parameters->FilterCount;
+
+    if (InputChannels < MLAS_CONV_WINOGRAD_MINIMUM_CHANNELS ||
+        FilterCount < MLAS_CONV_WINOGRAD_MINIMUM_CHANNELS) {
+        return false;
+    }
+
+    const size_t OutputHeight = Parameters->OutputShape[0];
+    const size_t OutputWidth = Parameters->OutputShape[1];
+
+    //
+    // Compute the cost of the expanded convolution and of each tile size.
+    //
+
+    double BestCost = (double(FilterCount) + 1.0) * double(Parameters->OutputSize) *
+        double(Parameters->K);
+    size_t BestOutputTile = 0;
+
+    for (size_t OutputTile = 2; OutputTile <= 4; OutputTile += 2) {
+
+        size_t InputTile = OutputTile + 2;
+        size_t TilesY = (OutputHeight + OutputTile - 1) / OutputTile;
+        size_t TilesX = (OutputWidth + OutputTile - 1) / OutputTile;
+        size_t TileRowsPerBlock = MlasConvWinogradTileRowsPerBlock(TilesY, TilesX);
+        size_t BlockCount = (TilesY + TileRowsPerBlock - 1) / TileRowsPerBlock;
+
+        //
+        // The GEMM of a block costs at least a full panel of columns, plus
+        // the packing of the transformed filter.
+        //
+
+        size_t BlockColumns = (TileRowsPerBlock * TilesX + MLAS_SGEMM_STRIDEN_THREAD_ALIGN - 1) &
+            ~size_t(MLAS_SGEMM_STRIDEN_THREAD_ALIGN - 1);
+
+        double TransformedSize = double(InputTile * InputTile) * double(TilesY * TilesX);
+        double Cost = double(InputTile * InputTile) * double(BlockCount) *
+            double(BlockColumns + MLAS_SGEMM_STRIDEN_THREAD_ALIGN) *
+            double(InputChannels) * double(FilterCount) +
+            TransformedSize * double(InputChannels + FilterCount) *
+            double(MLAS_CONV_WINOGRAD_TRANSFORM_COST);
+
+        if (Cost < BestCost) {
+            BestCost = Cost;
+            BestOutputTile = OutputTile;
+        }
+    }
+
+    if (BestOutputTile == 0) {
+        return false;
+    }
+
+    //
+    // Compute the number of tile rows per block and the number of target
+    // threads given the complexity of the convolution operation. Reduce the
+    // block size until there are enough blocks for the threads.
+    //
+
+    const size_t OutputTile = BestOutputTile;
+    const size_t TilesY = (OutputHeight + OutputTile - 1) / OutputTile;
+    const size_t TilesX = (OutputWidth + OutputTile - 1) / OutputTile;
+    const size_t BatchGroupCount = Parameters->BatchCount * Parameters->GroupCount;
+
+    int32_t TargetThreadCount;
+
+    if (BestCost < double(MLAS_SGEMM_THREAD_COMPLEXITY * MLAS_MAXIMUM_THREAD_COUNT)) {
+        TargetThreadCount = int32_t(BestCost / double(MLAS_SGEMM_THREAD_COMPLEXITY)) + 1;
+    } else {
+        TargetThreadCount = MLAS_MAXIMUM_THREAD_COUNT;
+    }
+
+    int32_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (TargetThreadCount >= MaximumThreadCount) {
+        TargetThreadCount = MaximumThreadCount;
+    }
+
+    size_t TileRowsPerBlock = MlasConvWinogradTileRowsPerBlock(TilesY, TilesX);
+
+    while (TileRowsPerBlock > 1 &&
+           BatchGroupCount * ((TilesY + TileRowsPerBlock - 1) / TileRowsPerBlock) < size_t(TargetThreadCount)) {
+        TileRowsPerBlock--;
+    }
+
+    size_t TotalBlockCount = BatchGroupCount * ((TilesY + TileRowsPerBlock - 1) / TileRowsPerBlock);
+
+    if (size_t(TargetThreadCount) >= TotalBlockCount) {
+        TargetThreadCount = int32_t(TotalBlockCount);
+    }
+
+    Parameters->Algorithm = MlasConvAlgorithmWinograd;
+    Parameters->ThreadCount = TargetThreadCount;
+    Parameters->u.Winograd.OutputTile = OutputTile;
+    Parameters->u.Winograd.TileRowsPerBlock = TileRowsPerBlock;
+    Parameters->u.Winograd.PaddedTileCount = (TileRowsPerBlock * TilesX + 3) & ~size_t(3);
+    Parameters->u.Winograd.TransformedFilter = nullptr;
+
+    size_t InputTile = OutputTile + 2;
+
+    *WorkingBufferSize = MlasConvWinogradTransformedFilterSize(Parameters) +
+        size_t(TargetThreadCount) * InputTile * InputTile *
+        Parameters->u.Winograd.PaddedTileCount * (InputChannels + FilterCount);
+
+    return true;
+}
+
+void
+MlasConvWinograd(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    const float* Filter,
+    const float* Bias,
+    float* WorkingBuffer,
+    float* Output,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the Winograd convolution operation.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    Input - Supplies the input tensor.
+
+    Filter - Supplies the filter tensor. This is not used if the parameters
+        supply a transformed filter.
+
+    Bias - Optionally supplies the bias vector.
+
+    WorkingBuffer - Supplies a working buffer sized to the number of elements
+        returned by MlasConvPrepare, less MlasConvTransformedFilterSize
+        elements if the parameters supply a transformed filter.
+
+    Output - Supplies the output tensor.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    if (Parameters->u.Winograd.OutputTile == 2) {
+        MlasConvWinogradExecute<MLAS_WINOGRAD_F2X3>(Parameters, Input, Filter, Bias,
+            WorkingBuffer, Output, ThreadPool);
+    } else {
+        MlasConvWinogradExecute<MLAS_WINOGRAD_F4X3>(Parameters, Input, Filter, Bias,
+            WorkingBuffer, Output, ThreadPool);
+    }
+}
+
+size_t
+MlasConvWinogradTransformedFilterSize(
+    const MLAS_CONV_PARAMETERS* Parameters
+    )
+/*++
+
+Routine Description:
+
+    This routine returns the number of elements of the transformed filter of
+    a Winograd convolution.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+Return Value:
+
+    Returns the number of elements of the transformed filter.
+
+--*/
+{
+    size_t InputTile = Parameters->u.Winograd.OutputTile + 2;
+
+    return Parameters->GroupCount * InputTile * InputTile * Parameters->FilterCount *
+        Parameters->InputChannels;
+}
+
+void
+MlasConvWinogradTransformFilter(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Filter,
+    float* TransformedFilter
+    )
+/*++
+
+Routine Description:
+
+    This routine transforms the filter of a Winograd convolution for the tile
+    size selected by MlasConvWinogradPrepare.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    Filter - Supplies the filter tensor.
+
+    TransformedFilter - Supplies the buffer to receive the transformed filter.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    if (Parameters->u.Winograd.OutputTile == 2) {
+        MlasConvWinogradTransformFilter<MLAS_WINOGRAD_F2X3>(Parameters, Filter, TransformedFilter);
+    } else {
+        MlasConvWinogradTransformFilter<MLAS_WINOGRAD_F4X3>(Parameters, Filter, TransformedFilter);
+    }
+}
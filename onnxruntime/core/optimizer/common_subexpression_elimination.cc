@@ -0,0 +1,255 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/common_subexpression_elimination.h"
+
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "core/graph/graph_utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+inline void HashCombine(size_t& seed, size_t value) {
+  seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+// Serialized form of an initializer without its name, used when the data is not stored in raw_data.
+std::string SerializeInitializerData(const TensorProto& tensor) {
+  TensorProto data(tensor);
+  data.clear_name();
+  data.clear_doc_string();
+  return data.SerializeAsString();
+}
+
+size_t HashInitializer(const TensorProto& tensor) {
+  size_t hash = std::hash<int>{}(tensor.data_type());
+  for (auto dim : tensor.dims()) {
+    HashCombine(hash, std::hash<int64_t>{}(dim));
+  }
+  HashCombine(hash, tensor.has_raw_data() ? std::hash<std::string>{}(tensor.raw_data())
+                                          : std::hash<std::string>{}(SerializeInitializerData(tensor)));
+  return hash;
+}
+
+bool SameInitializer(const TensorProto& tensor1, const TensorProto& tensor2) {
+  if (tensor1.data_type() != tensor2.data_type() || tensor1.dims_size() != tensor2.dims_size()) {
+    return false;
+  }
+  for (int i = 0; i < tensor1.dims_size(); ++i) {
+    if (tensor1.dims(i) != tensor2.dims(i)) {
+      return false;
+    }
+  }
+  if (tensor1.has_raw_data() && tensor2.has_raw_data()) {
+    return tensor1.raw_data() == tensor2.raw_data();
+  }
+  return SerializeInitializerData(tensor1) == SerializeInitializerData(tensor2);
+}
+
+// Makes all consumers of a constant initializer read the first initializer with identical content. The
+// initializers left without consumers are removed when the graph is resolved.
+bool MergeDuplicateInitializers(Graph& graph) {
+  // Initializers that are graph outputs or are consumed by subgraphs are referenced by name, so are kept as is.
+  std::unordered_set<std::string> excluded;
+  for (const auto* output : graph.GetOutputs()) {
+    excluded.insert(output->Name());
+  }
+
+  std::unordered_set<std::string> consumed;
+  for (const auto& node : graph.Nodes()) {
+    for (const auto* input : node.InputDefs()) {
+      consumed.insert(input->Name());
+    }
+    for (const auto* input : node.ImplicitInputDefs()) {
+      excluded.insert(input->Name());
+    }
+  }
+
+  std::unordered_map<size_t, std::vector<const TensorProto*>> buckets;
+  std::unordered_map<std::string, NodeArg*> replacements;
+
+  for (const auto& entry : graph.GetAllInitializedTensors()) {
+    const std::string& name = entry.first;
+    const TensorProto& tensor = *entry.second;
+    if (consumed.count(name) == 0 || excluded.count(name) != 0 ||
+        !graph_utils::IsConstantInitializer(graph, name, false) ||
+        tensor.data_location() == TensorProto_DataLocation_EXTERNAL) {
+      continue;
+    }
+
+    auto& bucket = buckets[HashInitializer(tensor)];
+    auto same = std::find_if(bucket.cbegin(), bucket.cend(), [&tensor](const TensorProto* candidate) {
+      return SameInitializer(*candidate, tensor);
+    });
+
+    if (same == bucket.cend()) {
+      bucket.push_back(&tensor);
+    } else {
+      replacements[name] = graph.GetNodeArg((*same)->name());
+    }
+  }
+
+  if (replacements.empty()) {
+    return false;
+  }
+
+  for (auto& node : graph.Nodes()) {
+    auto& input_defs = node.MutableInputDefs();
+    for (size_t i = 0; i < input_defs.size(); ++i) {
+      auto replacement = replacements.find(input_defs[i]->Name());
+      if (replacement != replacements.end()) {
+        graph_utils::ReplaceNodeInput(node, static_cast<int>(i), *replacement->second);
+      }
+    }
+  }
+
+  graph.SetGraphResolveNeeded().SetGraphProtoSyncNeeded();
+
+  return true;
+}
+
+bool IsNonDeterministic(const Node& node) {
+  static const std::unordered_set<std::string> random_ops{
+      "RandomNormal", "RandomUniform", "RandomNormalLike", "RandomUniformLike", "Multinomial"};
+  return node.Domain() == kOnnxDomain && random_ops.count(node.OpType()) != 0;
+}
+
+// Builds a key that is equal for nodes that compute the same values: the same operator applied to the same
+// inputs with the same attributes.
+std::string GetNodeKey(const Node& node) {
+  std::string key = node.OpType();
+  key += '\0';
+  key += node.Domain();
+  key += '\0';
+  key += node.GetExecutionProviderType();
+
+  for (const auto* input : node.InputDefs()) {
+    key += '\0';
+    key += input->Name();
+  }
+
+  key += '\0';
+  for (const auto* output : node.OutputDefs()) {
+    key += output->Exists() ? '1' : '0';
+  }
+
+  // order the attributes by name so the key doesn't depend on the iteration order of the attribute map
+  std::map<std::string, const AttributeProto*> attributes;
+  for (const auto& attribute : node.GetAttributes()) {
+    attributes.emplace(attribute.first, &attribute.second);
+  }
+  for (const auto& attribute : attributes) {
+    key += '\0';
+    key += attribute.second->SerializeAsString();
+  }
+
+  return key;
+}
+
+// Returns which outputs of the node are consumed by other nodes or are graph outputs.
+std::vector<bool> GetUsedOutputs(const Graph& graph, const Node& node) {
+  std::vector<bool> used(node.OutputDefs().size(), false);
+  for (auto it = node.OutputEdgesBegin(), end = node.OutputEdgesEnd(); it != end; ++it) {
+    used[it->GetSrcArgIndex()] = true;
+  }
+  for (auto index : graph.GetNodeOutputsInGraphOutputs(node)) {
+    used[index] = true;
+  }
+  return used;
+}
+
+}  // namespace
+
+Status CommonSubexpressionElimination::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                                 const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto node_index : node_topology_list) {
+    auto* node_ptr = graph.GetNode(node_index);
+    if (node_ptr == nullptr)
+      continue;  // node was removed
+
+    ORT_RETURN_IF_ERROR(Recurse(*node_ptr, modified, graph_level, logger));
+  }
+
+  if (MergeDuplicateInitializers(graph)) {
+    modified = true;
+  }
+
+  // Visiting producers first means the consumers of a merged node see the surviving node's outputs as their
+  // inputs, so whole duplicated chains (e.g. Shape->Gather->Unsqueeze->Concat) collapse in a single pass.
+  std::unordered_map<std::string, NodeIndex> node_keys;
+  for (auto node_index : node_topology_list) {
+    auto* node_ptr = graph.GetNode(node_index);
+    if (node_ptr == nullptr)
+      continue;
+
+    auto& node = *node_ptr;
+    if (!graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders()) ||
+        node.OutputDefs().empty() || node.ContainsSubgraph() || IsNonDeterministic(node)) {
+      continue;
+    }
+
+    auto result = node_keys.emplace(GetNodeKey(node), node.Index());
+    if (result.second) {
+      continue;
+    }
+
+    // a graph output must keep its name, so a duplicate that produces one is kept
+    if (!graph.GetNodeOutputsInGraphOutputs(node).empty()) {
+      continue;
+    }
+
+    Node& existing_node = *graph.GetNode(result.first->second);
+    for (int i = 0, end = static_cast<int>(node.OutputDefs().size()); i < end; ++i) {
+      graph_utils::ReplaceDownstreamNodeInput(graph, node, i, existing_node, i);
+    }
+    graph.RemoveNode(node.Index());
+    modified = true;
+  }
+
+  // Remove nodes whose outputs are not used, consumers first so that chains of dead nodes are removed together.
+  // Unused trailing optional outputs (e.g. the mask of Dropout) are dropped so they are not allocated.
+  for (auto it = node_topology_list.rbegin(), end = node_topology_list.rend(); it != end; ++it) {
+    auto* node_ptr = graph.GetNode(*it);
+    if (node_ptr == nullptr)
+      continue;
+
+    auto& node = *node_ptr;
+    if (!graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders()) || node.OutputDefs().empty()) {
+      continue;
+    }
+
+    std::vector<bool> used = GetUsedOutputs(graph, node);
+    if (std::none_of(used.cbegin(), used.cend(), [](bool is_used) { return is_used; })) {
+      graph.RemoveNode(node.Index());
+      modified = true;
+      continue;
+    }
+
+    if (node.Op() == nullptr) {
+      continue;
+    }
+
+    const auto& formal_outputs = node.Op()->outputs();
+    auto& output_defs = node.MutableOutputDefs();
+    while (!used[output_defs.size() - 1] && output_defs.size() <= formal_outputs.size() &&
+           formal_outputs[output_defs.size() - 1].GetOption() == OpSchema::FormalParameterOption::Optional) {
+      output_defs.pop_back();
+      graph.SetGraphResolveNeeded().SetGraphProtoSyncNeeded();
+      modified = true;
+    }
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,28 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class CommonSubexpressionElimination
+Merges equivalent computations and removes computations whose results are never used.
+
+Constant initializers with identical type, shape and content are merged first. Nodes are then keyed by
+(op type, domain, attributes, inputs); a node with the same key as an earlier node is removed and its consumers
+read the outputs of the earlier node instead. Nodes that contain subgraphs or produce random values are never
+merged. Finally, nodes none of whose outputs are consumed are removed, as are unused trailing optional outputs.
+*/
+class CommonSubexpressionElimination : public GraphTransformer {
+ public:
+  CommonSubexpressionElimination(const std::unordered_set<std::string>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("CommonSubexpressionElimination", compatible_execution_providers) {
+  }
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
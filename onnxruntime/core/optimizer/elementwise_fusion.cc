@@ -0,0 +1,303 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/elementwise_fusion.h"
+
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+struct FusableOp {
+  const char* op_type;
+  std::vector<ONNX_NAMESPACE::OperatorSetVersion> versions;
+};
+
+// The operators supported by the FusedElementwise kernel.
+const std::vector<FusableOp>& FusableOps() {
+  static const std::vector<FusableOp> fusable_ops{
+      {"Add", {7}},
+      {"Sub", {7}},
+      {"Mul", {7}},
+      {"Div", {7}},
+      {"Abs", {6}},
+      {"Neg", {6}},
+      {"Sqrt", {6}},
+      {"Reciprocal", {6}},
+      {"Exp", {6}},
+      {"Log", {6}},
+      {"Relu", {6}},
+      {"Sigmoid", {6}},
+      {"Tanh", {6}},
+      {"Erf", {9}},
+  };
+  return fusable_ops;
+}
+
+bool IsFusable(const Node& node, const std::unordered_set<std::string>& compatible_providers) {
+  if (!graph_utils::IsSupportedProvider(node, compatible_providers) ||
+      !optimizer_utils::IsSupportedDataType(node, {"tensor(float)"})) {
+    return false;
+  }
+
+  for (const auto& op : FusableOps()) {
+    if (graph_utils::IsSupportedOptypeVersionAndDomain(node, op.op_type, op.versions)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool SameDim(const TensorShapeProto_Dimension& dim1, const TensorShapeProto_Dimension& dim2) {
+  if (utils::HasDimValue(dim1) && utils::HasDimValue(dim2)) {
+    return dim1.dim_value() == dim2.dim_value();
+  }
+  if (utils::HasDimParam(dim1) && utils::HasDimParam(dim2)) {
+    return !dim1.dim_param().empty() && dim1.dim_param() == dim2.dim_param();
+  }
+  return false;
+}
+
+bool SameShape(const TensorShapeProto& shape1, const TensorShapeProto& shape2) {
+  if (shape1.dim_size() != shape2.dim_size()) {
+    return false;
+  }
+  for (int i = 0; i < shape1.dim_size(); ++i) {
+    if (!SameDim(shape1.dim(i), shape2.dim(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Returns true if the value is a scalar or its shape, ignoring leading 1s, matches the trailing dimensions of
+// output_shape. Such inputs can be read periodically by the FusedElementwise kernel.
+bool IsBroadcastableInput(const TensorShapeProto& shape, const TensorShapeProto& output_shape) {
+  int first = 0;
+  while (first < shape.dim_size() && utils::HasDimValue(shape.dim(first)) && shape.dim(first).dim_value() == 1) {
+    ++first;
+  }
+
+  const int trailing_rank = shape.dim_size() - first;
+  if (trailing_rank > output_shape.dim_size()) {
+    return false;
+  }
+
+  const int output_offset = output_shape.dim_size() - trailing_rank;
+  for (int i = 0; i < trailing_rank; ++i) {
+    if (!SameDim(shape.dim(first + i), output_shape.dim(output_offset + i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// A connected subgraph of elementwise nodes with a single output produced by the root node.
+class ElementwiseGroup {
+ public:
+  ElementwiseGroup(Graph& graph, Node& root, const TensorShapeProto& output_shape)
+      : graph_(graph), root_(root), output_shape_(output_shape) {
+    nodes_.insert(root.Index());
+  }
+
+  // Absorbs the producers of the root's inputs, recursively, if they can be fused.
+  void Grow(const std::unordered_set<std::string>& compatible_providers,
+            const std::unordered_set<NodeIndex>& fused_nodes) {
+    std::vector<Node*> to_visit{&root_};
+    while (!to_visit.empty()) {
+      Node* node = to_visit.back();
+      to_visit.pop_back();
+
+      for (auto it = node->InputEdgesBegin(), end = node->InputEdgesEnd(); it != end; ++it) {
+        const Node& producer = it->GetNode();
+        const auto* producer_shape = producer.OutputDefs()[0]->Shape();
+        if (nodes_.count(producer.Index()) != 0 || fused_nodes.count(producer.Index()) != 0 ||
+            !IsFusable(producer, compatible_providers) ||
+            producer.GetExecutionProviderType() != root_.GetExecutionProviderType() ||
+            producer.GetOutputEdgesCount() != 1 ||
+            !graph_.GetNodeOutputsInGraphOutputs(producer).empty() ||
+            producer_shape == nullptr || !SameShape(*producer_shape, output_shape_)) {
+          continue;
+        }
+
+        nodes_.insert(producer.Index());
+        to_visit.push_back(graph_.GetNode(producer.Index()));
+      }
+    }
+  }
+
+  size_t Size() const { return nodes_.size(); }
+
+  const std::unordered_set<NodeIndex>& Nodes() const { return nodes_; }
+
+  // Check the external inputs can be broadcast by the kernel, and that at least one of them has the output shape
+  // so the kernel infers the same output shape.
+  bool HasSupportedInputs() const {
+    bool has_full_input = false;
+    for (auto index : nodes_) {
+      const Node& node = *graph_.GetNode(index);
+      for (const auto* input : node.InputDefs()) {
+        if (IsInternal(*input)) {
+          continue;
+        }
+
+        const auto* shape = input->Shape();
+        if (shape == nullptr || !IsBroadcastableInput(*shape, output_shape_)) {
+          return false;
+        }
+        has_full_input = has_full_input || SameShape(*shape, output_shape_);
+      }
+    }
+    return has_full_input;
+  }
+
+  // Replace the group with a FusedElementwise node.
+  void Fuse() {
+    CollectInputs(root_);
+
+    std::vector<std::string> ops;
+    std::vector<int64_t> operands;
+    EmitInstructions(root_, ops, operands);
+
+    Node& fused_node = graph_.AddNode(graph_.GenerateNodeName("FusedElementwise"),
+                                      "FusedElementwise",
+                                      "fused elementwise expression",
+                                      inputs_,
+                                      {},
+                                      nullptr,
+                                      kMSDomain);
+    fused_node.AddAttribute("ops", ops);
+    fused_node.AddAttribute("operands", operands);
+    fused_node.SetExecutionProviderType(root_.GetExecutionProviderType());
+
+    // connect the producers of the external inputs to the fused node
+    for (auto index : nodes_) {
+      const Node& node = *graph_.GetNode(index);
+      for (auto it = node.InputEdgesBegin(), end = node.InputEdgesEnd(); it != end; ++it) {
+        if (nodes_.count(it->GetNode().Index()) != 0) {
+          continue;
+        }
+        const NodeArg* input = node.InputDefs()[it->GetDstArgIndex()];
+        const int input_index = input_indices_.at(input);
+        graph_.AddEdge(it->GetNode().Index(), fused_node.Index(), it->GetSrcArgIndex(), input_index);
+      }
+    }
+
+    // move the outputs of the root to the fused node
+    std::vector<std::tuple<NodeIndex, int, int>> output_edges;
+    for (auto it = root_.OutputEdgesBegin(), end = root_.OutputEdgesEnd(); it != end; ++it) {
+      output_edges.emplace_back(it->GetNode().Index(), it->GetSrcArgIndex(), it->GetDstArgIndex());
+    }
+    fused_node.MutableOutputDefs() = root_.MutableOutputDefs();
+    graph_utils::RemoveNodeOutputEdges(graph_, root_);
+    for (const auto& edge : output_edges) {
+      graph_.AddEdge(fused_node.Index(), std::get<0>(edge), std::get<1>(edge), std::get<2>(edge));
+    }
+
+    for (auto index : nodes_) {
+      graph_utils::RemoveNodeOutputEdges(graph_, *graph_.GetNode(index));
+      graph_.RemoveNode(index);
+    }
+  }
+
+ private:
+  const Node* InternalProducer(const Node& node, int input_index) const {
+    const Node* producer = graph_utils::GetInputNode(node, input_index);
+    return (producer != nullptr && nodes_.count(producer->Index()) != 0) ? producer : nullptr;
+  }
+
+  bool IsInternal(const NodeArg& arg) const {
+    for (auto index : nodes_) {
+      const Node& node = *graph_.GetNode(index);
+      if (node.OutputDefs()[0] == &arg && &node != &root_) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void CollectInputs(const Node& node) {
+    const auto& input_defs = node.InputDefs();
+    for (int i = 0, end = static_cast<int>(input_defs.size()); i < end; ++i) {
+      const Node* producer = InternalProducer(node, i);
+      if (producer != nullptr) {
+        CollectInputs(*producer);
+      } else if (input_indices_.count(input_defs[i]) == 0) {
+        input_indices_[input_defs[i]] = static_cast<int>(inputs_.size());
+        inputs_.push_back(const_cast<NodeArg*>(input_defs[i]));
+      }
+    }
+  }
+
+  // Emits the instructions computing node in post-order and returns the operand index of its result.
+  int64_t EmitInstructions(const Node& node, std::vector<std::string>& ops, std::vector<int64_t>& operands) {
+    const auto& input_defs = node.InputDefs();
+    int64_t node_operands[2] = {-1, -1};
+    for (int i = 0, end = static_cast<int>(input_defs.size()); i < end && i < 2; ++i) {
+      const Node* producer = InternalProducer(node, i);
+      node_operands[i] = producer != nullptr ? EmitInstructions(*producer, ops, operands)
+                                             : input_indices_.at(input_defs[i]);
+    }
+
+    ops.push_back(node.OpType());
+    operands.push_back(node_operands[0]);
+    operands.push_back(node_operands[1]);
+    return static_cast<int64_t>(inputs_.size() + ops.size() - 1);
+  }
+
+  Graph& graph_;
+  Node& root_;
+  const TensorShapeProto& output_shape_;
+  std::unordered_set<NodeIndex> nodes_;
+  std::vector<NodeArg*> inputs_;
+  std::unordered_map<const NodeArg*, int> input_indices_;
+};
+
+}  // namespace
+
+Status ElementwiseFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+  std::unordered_set<NodeIndex> fused_nodes;
+
+  // visit consumers before producers, so each group is rooted at its most downstream node
+  for (auto it = node_topology_list.rbegin(); it != node_topology_list.rend(); ++it) {
+    auto* node_ptr = graph.GetNode(*it);
+    if (nullptr == node_ptr)
+      continue;  // node was removed
+
+    auto& node = *node_ptr;
+
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    if (fused_nodes.count(node.Index()) != 0 || !IsFusable(node, GetCompatibleExecutionProviders())) {
+      continue;
+    }
+
+    const auto* output_shape = node.OutputDefs()[0]->Shape();
+    if (output_shape == nullptr) {
+      continue;
+    }
+
+    ElementwiseGroup group(graph, node, *output_shape);
+    group.Grow(GetCompatibleExecutionProviders(), fused_nodes);
+    if (group.Size() < 2 || !group.HasSupportedInputs()) {
+      continue;
+    }
+
+    fused_nodes.insert(group.Nodes().begin(), group.Nodes().end());
+    group.Fuse();
+    modified = true;
+  }
+
+  return Status::OK();
+}
+}  // namespace onnxruntime
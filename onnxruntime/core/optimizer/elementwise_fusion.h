@@ -0,0 +1,27 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class ElementwiseFusion
+Collapses connected subgraphs of float elementwise operators (Add, Sub, Mul, Div, Sqrt, Exp, Tanh, Erf, ...) into a
+single com.microsoft.FusedElementwise node, so the whole expression is evaluated in one pass over memory.
+
+A subgraph is fused if every intermediate value has a single consumer within the subgraph and the same shape as
+the subgraph output, and every external input is a scalar or matches the trailing dimensions of the output.
+*/
+class ElementwiseFusion : public GraphTransformer {
+ public:
+  ElementwiseFusion(const std::unordered_set<std::string>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("ElementwiseFusion", compatible_execution_providers) {
+  }
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
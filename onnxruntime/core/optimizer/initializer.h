@@ -38,6 +38,10 @@ class Initializer final {
         double_data_.assign(static_cast<size_t>(size_), 0.0);
         break;
       }
+      case ONNX_NAMESPACE::TensorProto_DataType_UINT8: {
+        uint8_data_.assign(static_cast<size_t>(size_), 0);
+        break;
+      }
       case ONNX_NAMESPACE::TensorProto_DataType_INT32: {
         int32_data_.assign(static_cast<size_t>(size_), 0);
         break;
@@ -93,6 +97,14 @@ class Initializer final {
             }
             break;
           }
+          case ONNX_NAMESPACE::TensorProto_DataType_UINT8: {
+            int64_t size = tensor_proto.int32_data_size();
+            ORT_ENFORCE(size_ == size, "size is different");
+            for (int i = 0; i < size_; i++) {
+              uint8_data_.push_back(static_cast<uint8_t>(tensor_proto.int32_data(i)));
+            }
+            break;
+          }
           case ONNX_NAMESPACE::TensorProto_DataType_INT32: {
             int64_t size = tensor_proto.int32_data_size();
             ORT_ENFORCE(size_ == size, "size is different");
@@ -162,6 +174,13 @@ class Initializer final {
           }
           break;
         }
+        case ONNX_NAMESPACE::TensorProto_DataType_UINT8: {
+          tensor_proto.clear_int32_data();
+          for (int i = 0; i < size_; i++) {
+            tensor_proto.add_int32_data(uint8_data_[i]);
+          }
+          break;
+        }
         case ONNX_NAMESPACE::TensorProto_DataType_INT32: {
           tensor_proto.clear_int32_data();
           for (int i = 0; i < size_; i++) {
@@ -213,6 +232,10 @@ class Initializer final {
         return reinterpret_cast<T*>(double_data_.data());
         break;
       }
+      case ONNX_NAMESPACE::TensorProto_DataType_UINT8: {
+        return reinterpret_cast<T*>(uint8_data_.data());
+        break;
+      }
       case ONNX_NAMESPACE::TensorProto_DataType_INT32: {
         return reinterpret_cast<T*>(int32_data_.data());
         break;
@@ -246,6 +269,10 @@ class Initializer final {
         return reinterpret_cast<const T*>(double_data_.data());
         break;
       }
+      case ONNX_NAMESPACE::TensorProto_DataType_UINT8: {
+        return reinterpret_cast<const T*>(uint8_data_.data());
+        break;
+      }
       case ONNX_NAMESPACE::TensorProto_DataType_INT32: {
         return reinterpret_cast<const T*>(int32_data_.data());
         break;
@@ -607,6 +634,7 @@ class Initializer final {
   std::vector<float> float_data_;
   std::vector<uint16_t> float16_data_;
   std::vector<double> double_data_;
+  std::vector<uint8_t> uint8_data_;
   std::vector<int32_t> int32_data_;
   std::vector<int64_t> int64_data_;
 };
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include <deque>
+#include "core/framework/data_types_internal.h"
 #include "core/graph/graph_utils.h"
 #include "core/optimizer/initializer.h"
 #include "core/optimizer/nchwc_transformer.h"
@@ -11,6 +12,27 @@ using namespace ONNX_NAMESPACE;
 using namespace ::onnxruntime::common;
 namespace onnxruntime {
 
+static int32_t GetElementType(const NodeArg& node_arg) {
+  const auto* type_proto = node_arg.TypeAsProto();
+  if (type_proto == nullptr || !type_proto->has_tensor_type()) {
+    return ONNX_NAMESPACE::TensorProto_DataType_UNDEFINED;
+  }
+  return type_proto->tensor_type().elem_type();
+}
+
+static bool IsScalarTensor(const NodeArg& node_arg) {
+  const auto* shape = node_arg.Shape();
+  if (shape == nullptr) {
+    return false;
+  }
+  for (const auto& dim : shape->dim()) {
+    if (!utils::HasDimValue(dim) || dim.dim_value() != 1) {
+      return false;
+    }
+  }
+  return true;
+}
+
 class NchwcTransformerImpl {
  public:
   NchwcTransformerImpl(Graph& graph) noexcept : graph_(graph) {}
@@ -113,9 +135,23 @@ class NchwcTransformerImpl {
                               NchwcArgument::Shape& output_shape,
                               const ONNX_NAMESPACE::TensorProto* filter_shape);
 
+  bool IsSameNchwcShape(const NodeArg* input_0, const NchwcArgument& nchwc_input_0,
+                        const NodeArg* input_n, const NchwcArgument& nchwc_input_n);
+
+  template <typename T>
+  NodeArg* ReorderFilter(NodeArg* filter_arg,
+                         const ONNX_NAMESPACE::TensorProto& filter_tensor_proto,
+                         bool reorder_filter_OIHWBo,
+                         int64_t nchwc_output_channels);
+  template <typename T>
+  NodeArg* AlignBias(NodeArg* bias_arg,
+                     const ONNX_NAMESPACE::TensorProto& bias_tensor_proto,
+                     int64_t nchwc_output_channels);
+
   void TransformConv(Node& node);
   void TransformPool(Node& node);
   void TransformBinary(Node& node, bool add_node);
+  void TransformQLinearAdd(Node& node);
   void TransformConcat(Node& node);
   void TransformActivation(Node& node);
   void TransformBatchNormalization(Node& node);
@@ -289,19 +325,114 @@ void NchwcTransformerImpl::ConvPoolShapeInference(const Node& node,
   }
 }
 
+template <typename T>
+NodeArg* NchwcTransformerImpl::ReorderFilter(NodeArg* filter_arg,
+                                            const ONNX_NAMESPACE::TensorProto& filter_tensor_proto,
+                                            bool reorder_filter_OIHWBo,
+                                            int64_t nchwc_output_channels) {
+  // Check if the filter has already been converted to the target format.
+  std::unordered_map<NodeArg*, NodeArg*>* filters_map;
+  if (reorder_filter_OIHWBo) {
+    filters_map = &filters_OIHWBo_;
+  } else {
+    filters_map = &filters_OIHWBiBo_;
+  }
+
+  auto filters_it = filters_map->find(filter_arg);
+  if (filters_it != filters_map->end()) {
+    // Reuse the existing NodeArg.
+    return filters_it->second;
+  }
+
+  Initializer filter{filter_tensor_proto, graph_.ModelPath()};
+
+  const int64_t output_channels = filter.dims()[0];
+  std::vector<T> reordered_filter(filter.size() / output_channels * nchwc_output_channels);
+
+  // Reorder the weights tensor statically.
+  if (reorder_filter_OIHWBo) {
+    MlasReorderFilterOIHWBo(filter.dims().data(), filter.data<T>(), reordered_filter.data());
+  } else {
+    MlasReorderFilterOIHWBiBo(filter.dims().data(), filter.data<T>(), reordered_filter.data());
+  }
+
+  ONNX_NAMESPACE::TensorProto nchwc_filter_tensor_proto;
+
+  nchwc_filter_tensor_proto.set_data_type(utils::ToTensorProtoElementType<T>());
+  nchwc_filter_tensor_proto.set_name(graph_.GenerateNodeArgName("reorder"));
+  nchwc_filter_tensor_proto.set_raw_data(reordered_filter.data(), reordered_filter.size() * sizeof(T));
+
+  nchwc_filter_tensor_proto.add_dims(nchwc_output_channels);
+  for (size_t i = 1; i < 4; i++) {
+    nchwc_filter_tensor_proto.add_dims(filter.dims()[i]);
+  }
+
+  auto* nchwc_filter_arg = &graph_utils::AddInitializer(graph_, nchwc_filter_tensor_proto);
+  filters_map->emplace(filter_arg, nchwc_filter_arg);
+  return nchwc_filter_arg;
+}
+
+template <typename T>
+NodeArg* NchwcTransformerImpl::AlignBias(NodeArg* bias_arg,
+                                        const ONNX_NAMESPACE::TensorProto& bias_tensor_proto,
+                                        int64_t nchwc_output_channels) {
+  auto biases_it = aligned_biases_.find(bias_arg);
+  if (biases_it != aligned_biases_.end()) {
+    // Reuse the existing NodeArg.
+    return biases_it->second;
+  }
+
+  Initializer bias{bias_tensor_proto, graph_.ModelPath()};
+
+  std::vector<T> aligned_bias(nchwc_output_channels);
+  std::copy_n(bias.data<T>(), bias.size(), aligned_bias.data());
+
+  ONNX_NAMESPACE::TensorProto nchwc_bias_tensor_proto;
+
+  nchwc_bias_tensor_proto.set_data_type(utils::ToTensorProtoElementType<T>());
+  nchwc_bias_tensor_proto.set_name(graph_.GenerateNodeArgName("reorder"));
+  nchwc_bias_tensor_proto.set_raw_data(aligned_bias.data(), nchwc_output_channels * sizeof(T));
+
+  nchwc_bias_tensor_proto.add_dims(nchwc_output_channels);
+
+  auto* nchwc_bias_arg = &graph_utils::AddInitializer(graph_, nchwc_bias_tensor_proto);
+  aligned_biases_.emplace(bias_arg, nchwc_bias_arg);
+  return nchwc_bias_arg;
+}
+
 void NchwcTransformerImpl::TransformConv(Node& node) {
   auto& input_defs = node.MutableInputDefs();
   auto& output_defs = node.MutableOutputDefs();
 
+  // QLinearConv carries the quantization parameters between the input, the
+  // filter, and the bias tensors. The filter is uint8 and the bias is int32.
+  const bool is_qlinear_conv = (node.OpType() == "QLinearConv");
+  const size_t filter_index = is_qlinear_conv ? 3 : 1;
+  const size_t bias_index = is_qlinear_conv ? 8 : 2;
+  const auto filter_data_type = is_qlinear_conv ? ONNX_NAMESPACE::TensorProto_DataType_UINT8
+                                                : ONNX_NAMESPACE::TensorProto_DataType_FLOAT;
+  const auto bias_data_type = is_qlinear_conv ? ONNX_NAMESPACE::TensorProto_DataType_INT32
+                                              : ONNX_NAMESPACE::TensorProto_DataType_FLOAT;
+
   // Require that the weights tensor be static.
   const ONNX_NAMESPACE::TensorProto* conv_W_tensor_proto = nullptr;
-  if (!graph_utils::NodeArgIsConstant(graph_, *input_defs[1]) ||
-      !graph_.GetInitializedTensor(input_defs[1]->Name(), conv_W_tensor_proto) ||
-      (conv_W_tensor_proto->data_type() != ONNX_NAMESPACE::TensorProto_DataType_FLOAT) ||
+  if (!graph_utils::NodeArgIsConstant(graph_, *input_defs[filter_index]) ||
+      !graph_.GetInitializedTensor(input_defs[filter_index]->Name(), conv_W_tensor_proto) ||
+      (conv_W_tensor_proto->data_type() != filter_data_type) ||
       (conv_W_tensor_proto->dims_size() != 4)) {
     return;
   }
 
+  // The NCHWc quantized kernel only supports per-tensor quantization, so
+  // require that the scales and zero points are scalars.
+  if (is_qlinear_conv) {
+    for (size_t i : {1, 2, 4, 5, 6, 7}) {
+      if (!IsScalarTensor(*input_defs[i])) {
+        return;
+      }
+    }
+  }
+
   const int64_t output_channels = conv_W_tensor_proto->dims(0);
   const int64_t input_channels = conv_W_tensor_proto->dims(1);
 
@@ -343,86 +474,39 @@ void NchwcTransformerImpl::TransformConv(Node& node) {
 
   // Also require that the optional bias tensor be static.
   const ONNX_NAMESPACE::TensorProto* conv_B_tensor_proto = nullptr;
-  if (input_defs.size() >= 3) {
-    if (!graph_utils::NodeArgIsConstant(graph_, *input_defs[2]) ||
-        !graph_.GetInitializedTensor(input_defs[2]->Name(), conv_B_tensor_proto) ||
-        (conv_B_tensor_proto->data_type() != ONNX_NAMESPACE::TensorProto_DataType_FLOAT) ||
+  if (input_defs.size() > bias_index && input_defs[bias_index]->Exists()) {
+    if (!graph_utils::NodeArgIsConstant(graph_, *input_defs[bias_index]) ||
+        !graph_.GetInitializedTensor(input_defs[bias_index]->Name(), conv_B_tensor_proto) ||
+        (conv_B_tensor_proto->data_type() != bias_data_type) ||
         (conv_B_tensor_proto->dims_size() != 1) ||
         (conv_B_tensor_proto->dims(0) != output_channels)) {
       return;
     }
   }
 
-  // Check if the filter has already been converted to the target format.
-  std::unordered_map<NodeArg*, NodeArg*>* filters_map;
-  if (reorder_filter_OIHWBo) {
-    filters_map = &filters_OIHWBo_;
-  } else {
-    filters_map = &filters_OIHWBiBo_;
-  }
-
   NodeArg* nchwc_conv_W_arg;
-  auto filters_it = filters_map->find(input_defs[1]);
-  if (filters_it != filters_map->end()) {
-    // Reuse the existing NodeArg.
-    nchwc_conv_W_arg = filters_it->second;
+  if (is_qlinear_conv) {
+    nchwc_conv_W_arg = ReorderFilter<uint8_t>(input_defs[filter_index], *conv_W_tensor_proto,
+                                              reorder_filter_OIHWBo, nchwc_output_channels);
   } else {
-    Initializer conv_W{*conv_W_tensor_proto, graph_.ModelPath()};
-
-    std::vector<float> reordered_filter(conv_W.size() / output_channels * nchwc_output_channels);
-
-    // Reorder the weights tensor statically.
-    if (reorder_filter_OIHWBo) {
-      MlasReorderFilterOIHWBo(conv_W.dims().data(), conv_W.data<float>(), reordered_filter.data());
-    } else {
-      MlasReorderFilterOIHWBiBo(conv_W.dims().data(), conv_W.data<float>(), reordered_filter.data());
-    }
-
-    ONNX_NAMESPACE::TensorProto nchwc_conv_W_tensor_proto;
-
-    nchwc_conv_W_tensor_proto.set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
-    nchwc_conv_W_tensor_proto.set_name(graph_.GenerateNodeArgName("reorder"));
-    nchwc_conv_W_tensor_proto.set_raw_data(reordered_filter.data(), reordered_filter.size() * sizeof(float));
-
-    nchwc_conv_W_tensor_proto.add_dims(nchwc_output_channels);
-    for (size_t i = 1; i < 4; i++) {
-      nchwc_conv_W_tensor_proto.add_dims(conv_W.dims()[i]);
-    }
-
-    nchwc_conv_W_arg = &graph_utils::AddInitializer(graph_, nchwc_conv_W_tensor_proto);
-    filters_map->emplace(input_defs[1], nchwc_conv_W_arg);
+    nchwc_conv_W_arg = ReorderFilter<float>(input_defs[filter_index], *conv_W_tensor_proto,
+                                            reorder_filter_OIHWBo, nchwc_output_channels);
   }
 
   // Align the optional bias tensor up to the number of NCHWc output channels.
   NodeArg* nchwc_conv_B_arg = nullptr;
   if ((conv_B_tensor_proto != nullptr) && (output_channels != nchwc_output_channels)) {
-    auto biases_it = aligned_biases_.find(input_defs[2]);
-    if (biases_it != aligned_biases_.end()) {
-      // Reuse the existing NodeArg.
-      nchwc_conv_B_arg = biases_it->second;
+    if (is_qlinear_conv) {
+      nchwc_conv_B_arg = AlignBias<int32_t>(input_defs[bias_index], *conv_B_tensor_proto, nchwc_output_channels);
     } else {
-      Initializer conv_B{*conv_B_tensor_proto, graph_.ModelPath()};
-
-      std::vector<float> aligned_bias(nchwc_output_channels);
-      std::copy_n(conv_B.data<float>(), output_channels, aligned_bias.data());
-
-      ONNX_NAMESPACE::TensorProto nchwc_conv_B_tensor_proto;
-
-      nchwc_conv_B_tensor_proto.set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
-      nchwc_conv_B_tensor_proto.set_name(graph_.GenerateNodeArgName("reorder"));
-      nchwc_conv_B_tensor_proto.set_raw_data(aligned_bias.data(), nchwc_output_channels * sizeof(float));
-
-      nchwc_conv_B_tensor_proto.add_dims(nchwc_output_channels);
-
-      nchwc_conv_B_arg = &graph_utils::AddInitializer(graph_, nchwc_conv_B_tensor_proto);
-      aligned_biases_.emplace(input_defs[2], nchwc_conv_B_arg);
+      nchwc_conv_B_arg = AlignBias<float>(input_defs[bias_index], *conv_B_tensor_proto, nchwc_output_channels);
     }
   }
 
   // Create the replacement node.
   std::string nchwc_node_name = graph_.GenerateNodeName(output_defs[0]->Name() + "_nchwc");
   Node& nchwc_node = graph_.AddNode(nchwc_node_name,
-                                    "Conv",
+                                    is_qlinear_conv ? "QLinearConv" : "Conv",
                                     nchwc_node_name,
                                     input_defs,
                                     output_defs,
@@ -430,10 +514,10 @@ void NchwcTransformerImpl::TransformConv(Node& node) {
                                     kMSNchwcDomain);
   nchwc_node.SetExecutionProviderType(kCpuExecutionProvider);
 
-  nchwc_node.MutableInputDefs()[1] = nchwc_conv_W_arg;
+  nchwc_node.MutableInputDefs()[filter_index] = nchwc_conv_W_arg;
 
   if (nchwc_conv_B_arg != nullptr) {
-    nchwc_node.MutableInputDefs()[2] = nchwc_conv_B_arg;
+    nchwc_node.MutableInputDefs()[bias_index] = nchwc_conv_B_arg;
   }
 
   NchwcArgument::Shape output_shape(output_defs[0]);
@@ -463,6 +547,16 @@ void NchwcTransformerImpl::TransformPool(Node& node) {
     return;
   }
 
+  // The quantized NCHWc pooling kernel only implements MaxPool.
+  const int32_t element_type = GetElementType(*input_defs[0]);
+  if (element_type == ONNX_NAMESPACE::TensorProto_DataType_UINT8) {
+    if (node.OpType() != "MaxPool") {
+      return;
+    }
+  } else if (element_type != ONNX_NAMESPACE::TensorProto_DataType_FLOAT) {
+    return;
+  }
+
   const size_t nchwc_block_size = MlasNchwcGetBlockSize();
 
   auto* input_shape = input_defs[0]->Shape();
@@ -505,6 +599,30 @@ void NchwcTransformerImpl::TransformPool(Node& node) {
   removed_nodes_.push_front(node.Index());
 }
 
+bool NchwcTransformerImpl::IsSameNchwcShape(const NodeArg* input_0, const NchwcArgument& nchwc_input_0,
+                                            const NodeArg* input_n, const NchwcArgument& nchwc_input_n) {
+  auto* input_0_shape = input_0->Shape();
+  for (int i = 0; i < kNchwcDims; i++) {
+    // Test if this dimension is derived from the same NodeArg.
+    if (!nchwc_input_0.shape_.IsDimEqual(nchwc_input_n.shape_, i)) {
+      // Check if ONNX shape inferencing has computed a precise dimension value.
+      auto* input_n_shape = input_n->Shape();
+      if ((input_0_shape == nullptr) || (input_n_shape == nullptr)) {
+        return false;
+      }
+      auto& input_0_dim = input_0_shape->dim(i);
+      auto& input_n_dim = input_n_shape->dim(i);
+      if (!utils::HasDimValue(input_0_dim) ||
+          !utils::HasDimValue(input_n_dim) ||
+          (input_0_dim.dim_value() <= 0) ||
+          (input_0_dim.dim_value() != input_n_dim.dim_value())) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 // The existing Add/Sum operator implementations can be used with tensors
 // in NCHWc format if the tensor shapes are exactly the same (elementwise
 // add).
@@ -525,26 +643,9 @@ void NchwcTransformerImpl::TransformBinary(Node& node, bool add_node) {
 
   // Test if all of the NCHWc inputs have a compatible shape.
   auto* nchwc_input_0 = nchwc_inputs[0];
-  auto* nchwc_input_0_shape = input_defs[0]->Shape();
   for (size_t n = 1; n < input_defs_count; n++) {
-    auto* nchwc_input_n = nchwc_inputs[n];
-    for (int i = 0; i < kNchwcDims; i++) {
-      // Test if this dimension is derived from the same NodeArg.
-      if (!nchwc_input_0->shape_.IsDimEqual(nchwc_input_n->shape_, i)) {
-        // Check if ONNX shape inferencing has computed a precise dimension value.
-        auto* nchwc_input_n_shape = input_defs[n]->Shape();
-        if ((nchwc_input_0_shape == nullptr) || (nchwc_input_n_shape == nullptr)) {
-          return;
-        }
-        auto& nchwc_input_0_dim = nchwc_input_0_shape->dim(i);
-        auto& nchwc_input_n_dim = nchwc_input_n_shape->dim(i);
-        if (!utils::HasDimValue(nchwc_input_0_dim) ||
-            !utils::HasDimValue(nchwc_input_n_dim) ||
-            (nchwc_input_0_dim.dim_value() <= 0) ||
-            (nchwc_input_0_dim.dim_value() != nchwc_input_n_dim.dim_value())) {
-          return;
-        }
-      }
+    if (!IsSameNchwcShape(input_defs[0], *nchwc_input_0, input_defs[n], *nchwc_inputs[n])) {
+      return;
     }
   }
 
@@ -593,6 +694,35 @@ void NchwcTransformerImpl::TransformBinary(Node& node, bool add_node) {
   CreateNchwcArgument(node, node, nchwc_input_0->channels_, nchwc_input_0->shape_);
 }
 
+// The QLinearAdd operator implementation can also be used with tensors in
+// NCHWc format if the tensor shapes are exactly the same. The scale and zero
+// point inputs are left untouched.
+void NchwcTransformerImpl::TransformQLinearAdd(Node& node) {
+  auto& input_defs = node.MutableInputDefs();
+
+  auto it_a = nchwc_args_.find(input_defs[0]);
+  if (it_a == nchwc_args_.end()) {
+    return;
+  }
+  auto it_b = nchwc_args_.find(input_defs[3]);
+  if (it_b == nchwc_args_.end()) {
+    return;
+  }
+  auto* nchwc_input_a = it_a->second.get();
+  auto* nchwc_input_b = it_b->second.get();
+
+  if (!IsSameNchwcShape(input_defs[0], *nchwc_input_a, input_defs[3], *nchwc_input_b)) {
+    return;
+  }
+
+  input_defs[0] = nchwc_input_a->nchwc_arg_;
+  nchwc_input_a->remaining_original_uses_--;
+  input_defs[3] = nchwc_input_b->nchwc_arg_;
+  nchwc_input_b->remaining_original_uses_--;
+
+  CreateNchwcArgument(node, node, nchwc_input_a->channels_, nchwc_input_a->shape_);
+}
+
 void NchwcTransformerImpl::TransformConcat(Node& node) {
   auto& input_defs = node.MutableInputDefs();
   auto& output_defs = node.MutableOutputDefs();
@@ -837,6 +967,11 @@ void NchwcTransformerImpl::TransformResize(Node& node) {
   }
   auto* nchwc_input = it->second.get();
 
+  // The NCHWc upsample kernel only supports float tensors.
+  if (GetElementType(*input_defs[0]) != ONNX_NAMESPACE::TensorProto_DataType_FLOAT) {
+    return;
+  }
+
   // Only support the nearest interpolation mode (the default value).
   const auto* mode_attr = graph_utils::GetNodeAttribute(node, "mode");
   if (mode_attr != nullptr && utils::HasString(*mode_attr)) {
@@ -923,7 +1058,8 @@ void NchwcTransformerImpl::TransformResize(Node& node) {
 
 void NchwcTransformerImpl::Transform(Node& node) {
   if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Conv", {1, 11}) ||
-      graph_utils::IsSupportedOptypeVersionAndDomain(node, "FusedConv", {1}, kMSDomain)) {
+      graph_utils::IsSupportedOptypeVersionAndDomain(node, "FusedConv", {1}, kMSDomain) ||
+      graph_utils::IsSupportedOptypeVersionAndDomain(node, "QLinearConv", {10})) {
     TransformConv(node);
   } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "MaxPool", {1, 8, 10, 11, 12}) ||
              graph_utils::IsSupportedOptypeVersionAndDomain(node, "AveragePool", {1, 7, 10, 11}) ||
@@ -941,6 +1077,8 @@ void NchwcTransformerImpl::Transform(Node& node) {
       TransformBinary(node, true);
     } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Mul", {7})) {
       TransformBinary(node, false);
+    } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "QLinearAdd", {1}, kMSDomain)) {
+      TransformQLinearAdd(node);
     } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Concat", {4, 11})) {
       TransformConcat(node);
     } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Relu", {6})) {
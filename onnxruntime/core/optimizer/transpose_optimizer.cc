@@ -0,0 +1,485 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/transpose_optimizer.h"
+
+#include <tuple>
+
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+struct LayoutAgnosticOp {
+  const char* op_type;
+  std::vector<ONNX_NAMESPACE::OperatorSetVersion> versions;
+};
+
+// Operators with a single data input that is processed elementwise. Any other inputs are scalars (e.g. Clip-11).
+const std::vector<LayoutAgnosticOp>& UnaryElementwiseOps() {
+  static const std::vector<LayoutAgnosticOp> ops{
+      {"Abs", {6}}, {"Neg", {6}}, {"Sqrt", {6}}, {"Reciprocal", {6}}, {"Exp", {6}}, {"Log", {6}},
+      {"Floor", {6}}, {"Ceil", {6}}, {"Relu", {6}}, {"LeakyRelu", {6}}, {"Elu", {6}}, {"Selu", {6}},
+      {"Sigmoid", {6}}, {"HardSigmoid", {6}}, {"Tanh", {6}}, {"Softsign", {1}}, {"Softplus", {1}},
+      {"Erf", {9}}, {"Sign", {9}}, {"Not", {1}}, {"Cast", {6, 9}}, {"Clip", {6, 11}},
+  };
+  return ops;
+}
+
+// Operators that combine inputs elementwise with multidirectional broadcasting.
+const std::vector<LayoutAgnosticOp>& BroadcastElementwiseOps() {
+  static const std::vector<LayoutAgnosticOp> ops{
+      {"Add", {7}}, {"Sub", {7}}, {"Mul", {7}}, {"Div", {7}}, {"Pow", {7}},
+      {"Max", {8}}, {"Min", {8}}, {"Sum", {8}}, {"Mean", {8}},
+      {"And", {7}}, {"Or", {7}}, {"Xor", {7}}, {"Equal", {7, 11}}, {"Less", {7, 9}}, {"Greater", {7, 9}},
+  };
+  return ops;
+}
+
+// Reductions with an "axes" attribute.
+const std::vector<LayoutAgnosticOp>& ReduceOps() {
+  static const std::vector<LayoutAgnosticOp> ops{
+      {"ReduceSum", {1, 11}}, {"ReduceMean", {1, 11}}, {"ReduceMax", {1, 11}}, {"ReduceMin", {1, 11}},
+      {"ReduceProd", {1, 11}}, {"ReduceL1", {1, 11}}, {"ReduceL2", {1, 11}}, {"ReduceLogSum", {1, 11}},
+      {"ReduceLogSumExp", {1, 11}}, {"ReduceSumSquare", {1, 11}},
+  };
+  return ops;
+}
+
+bool IsAnyOf(const Node& node, const std::vector<LayoutAgnosticOp>& ops) {
+  for (const auto& op : ops) {
+    if (graph_utils::IsSupportedOptypeVersionAndDomain(node, op.op_type, op.versions)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool IsTranspose(const Node& node) {
+  return graph_utils::IsSupportedOptypeVersionAndDomain(node, "Transpose", {1});
+}
+
+// Returns the permutation of a Transpose node. The default permutation reverses the dimensions, so it can only be
+// produced if the input rank is known; otherwise an empty vector is returned.
+std::vector<int64_t> GetPermutation(const Node& transpose) {
+  std::vector<int64_t> perm;
+  if (graph_utils::GetRepeatedNodeAttributeValues(transpose, "perm", perm)) {
+    return perm;
+  }
+
+  const auto* shape = transpose.InputDefs()[0]->Shape();
+  if (shape != nullptr) {
+    for (int64_t i = shape->dim_size() - 1; i >= 0; --i) {
+      perm.push_back(i);
+    }
+  }
+  return perm;
+}
+
+bool IsIdentityPermutation(const std::vector<int64_t>& perm) {
+  for (size_t i = 0; i < perm.size(); ++i) {
+    if (perm[i] != static_cast<int64_t>(i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int64_t HandleNegativeAxis(int64_t axis, int64_t rank) {
+  return axis < 0 ? axis + rank : axis;
+}
+
+// Returns the Transpose that produces input 'input_index' of 'node' if it can be moved or removed: it must be
+// the only consumer of the Transpose, the Transpose output must not be a graph output and both nodes must be
+// assigned to the same provider.
+Node* GetMovableTranspose(Graph& graph, const Node& node, int input_index, std::vector<int64_t>& perm) {
+  const Node::EdgeEnd* edge = graph_utils::GetInputEdge(node, input_index);
+  if (edge == nullptr) {
+    return nullptr;
+  }
+
+  Node* transpose = graph.GetNode(edge->GetNode().Index());
+  if (!IsTranspose(*transpose) ||
+      transpose->GetExecutionProviderType() != node.GetExecutionProviderType() ||
+      transpose->GetOutputEdgesCount() != 1 ||
+      !graph.GetNodeOutputsInGraphOutputs(*transpose).empty()) {
+    return nullptr;
+  }
+
+  perm = GetPermutation(*transpose);
+  return perm.empty() ? nullptr : transpose;
+}
+
+// Makes input 'input_index' of 'node' read the input of 'transpose' directly. The Transpose is removed once it
+// has no consumers left.
+void BypassTranspose(Graph& graph, Node& node, int input_index, Node& transpose) {
+  graph.RemoveEdge(transpose.Index(), node.Index(), 0, input_index);
+  graph_utils::ReplaceNodeInput(node, input_index, *transpose.MutableInputDefs()[0]);
+
+  const Node::EdgeEnd* input_edge = graph_utils::GetInputEdge(transpose, 0);
+  if (input_edge != nullptr) {
+    graph.AddEdge(input_edge->GetNode().Index(), node.Index(), input_edge->GetSrcArgIndex(), input_index);
+  }
+
+  if (transpose.GetOutputEdgesCount() == 0) {
+    graph.RemoveNode(transpose.Index());
+  }
+}
+
+// Places a Transpose with the given permutation after output 0 of 'node'. The node produces a new untransposed
+// value, and the new Transpose produces the original output for all existing consumers.
+void InsertTransposeAfter(Graph& graph, Node& node, const std::vector<int64_t>& perm) {
+  if (IsIdentityPermutation(perm)) {
+    return;
+  }
+
+  NodeArg* output = node.MutableOutputDefs()[0];
+
+  std::vector<std::tuple<NodeIndex, int>> consumers;
+  for (auto it = node.OutputEdgesBegin(), end = node.OutputEdgesEnd(); it != end; ++it) {
+    if (it->GetSrcArgIndex() == 0) {
+      consumers.emplace_back(it->GetNode().Index(), it->GetDstArgIndex());
+    }
+  }
+  for (const auto& consumer : consumers) {
+    graph.RemoveEdge(node.Index(), std::get<0>(consumer), 0, std::get<1>(consumer));
+  }
+
+  // The shape of the untransposed value is recomputed when the graph is resolved.
+  TypeProto untransposed_type;
+  if (output->TypeAsProto() != nullptr) {
+    untransposed_type = *output->TypeAsProto();
+    untransposed_type.mutable_tensor_type()->clear_shape();
+  }
+  auto& untransposed = graph.GetOrCreateNodeArg(graph.GenerateNodeArgName(output->Name() + "_untransposed"),
+                                                output->TypeAsProto() != nullptr ? &untransposed_type : nullptr);
+  node.MutableOutputDefs()[0] = &untransposed;
+
+  Node& transpose = graph.AddNode(graph.GenerateNodeName(node.Name() + "_transpose"),
+                                  "Transpose",
+                                  "Transpose moved below " + node.Name(),
+                                  {&untransposed},
+                                  {output});
+  transpose.AddAttribute("perm", perm);
+  transpose.SetExecutionProviderType(node.GetExecutionProviderType());
+
+  graph.AddEdge(node.Index(), transpose.Index(), 0, 0);
+  for (const auto& consumer : consumers) {
+    graph.AddEdge(transpose.Index(), std::get<0>(consumer), 0, std::get<1>(consumer));
+  }
+}
+
+// Returns true if the value is known to contain a single element whose broadcast is unaffected by a transpose
+// of the other inputs of rank 'rank'.
+bool IsBroadcastScalar(const NodeArg& input, size_t rank) {
+  const auto* shape = input.Shape();
+  if (shape == nullptr || static_cast<size_t>(shape->dim_size()) > rank) {
+    return false;
+  }
+  for (const auto& dim : shape->dim()) {
+    if (!utils::HasDimValue(dim) || dim.dim_value() != 1) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Transpose(Transpose(X, perm1), perm2) == Transpose(X, perm1[perm2[i]]), which is removed entirely if the
+// composed permutation is the identity.
+bool MergeTransposes(Graph& graph, Node& node, const logging::Logger& logger) {
+  std::vector<int64_t> input_perm;
+  Node* input_transpose = GetMovableTranspose(graph, node, 0, input_perm);
+  if (input_transpose == nullptr) {
+    return false;
+  }
+
+  std::vector<int64_t> perm = GetPermutation(node);
+  if (perm.size() != input_perm.size()) {
+    return false;
+  }
+
+  std::vector<int64_t> composed_perm(perm.size());
+  for (size_t i = 0; i < perm.size(); ++i) {
+    composed_perm[i] = input_perm[perm[i]];
+  }
+
+  BypassTranspose(graph, node, 0, *input_transpose);
+  node.AddAttribute("perm", composed_perm);
+
+  if (IsIdentityPermutation(composed_perm) && graph_utils::CanRemoveNode(graph, node, logger)) {
+    graph_utils::RemoveNode(graph, node);
+  }
+  return true;
+}
+
+// Gemm(Transpose(A), B) == Gemm(A, B, transA=!transA), and similarly for B.
+bool FoldIntoGemm(Graph& graph, Node& node) {
+  bool modified = false;
+  for (int i = 0; i < 2; ++i) {
+    std::vector<int64_t> perm;
+    Node* transpose = GetMovableTranspose(graph, node, i, perm);
+    if (transpose == nullptr || perm != std::vector<int64_t>{1, 0}) {
+      continue;
+    }
+
+    const std::string attr_name = i == 0 ? "transA" : "transB";
+    const auto* attr = graph_utils::GetNodeAttribute(node, attr_name);
+    int64_t trans = attr != nullptr ? attr->i() : 0;
+
+    BypassTranspose(graph, node, i, *transpose);
+    node.AddAttribute(attr_name, static_cast<int64_t>(trans == 0 ? 1 : 0));
+    modified = true;
+  }
+  return modified;
+}
+
+bool PushThroughUnaryElementwise(Graph& graph, Node& node) {
+  std::vector<int64_t> perm;
+  Node* transpose = GetMovableTranspose(graph, node, 0, perm);
+  if (transpose == nullptr) {
+    return false;
+  }
+
+  BypassTranspose(graph, node, 0, *transpose);
+  InsertTransposeAfter(graph, node, perm);
+  return true;
+}
+
+bool PushThroughBroadcastElementwise(Graph& graph, Node& node) {
+  const auto& input_defs = node.InputDefs();
+  std::vector<Node*> transposes(input_defs.size(), nullptr);
+  std::vector<int64_t> perm;
+
+  for (size_t i = 0; i < input_defs.size(); ++i) {
+    std::vector<int64_t> input_perm;
+    transposes[i] = GetMovableTranspose(graph, node, static_cast<int>(i), input_perm);
+    if (transposes[i] != nullptr) {
+      if (perm.empty()) {
+        perm = input_perm;
+      } else if (perm != input_perm) {
+        return false;
+      }
+    }
+  }
+
+  if (perm.empty()) {
+    return false;
+  }
+
+  // Every other input must broadcast the same way before and after the transpose.
+  for (size_t i = 0; i < input_defs.size(); ++i) {
+    if (transposes[i] == nullptr && !IsBroadcastScalar(*input_defs[i], perm.size())) {
+      return false;
+    }
+  }
+
+  for (size_t i = 0; i < input_defs.size(); ++i) {
+    if (transposes[i] != nullptr) {
+      BypassTranspose(graph, node, static_cast<int>(i), *transposes[i]);
+    }
+  }
+  InsertTransposeAfter(graph, node, perm);
+  return true;
+}
+
+// Reducing axis 'a' of the transposed tensor reduces axis perm[a] of the original tensor. With keepdims=0 the
+// permutation applied to the reduced tensor must skip the reduced axes.
+bool PushThroughReduce(Graph& graph, Node& node) {
+  std::vector<int64_t> perm;
+  Node* transpose = GetMovableTranspose(graph, node, 0, perm);
+  if (transpose == nullptr) {
+    return false;
+  }
+
+  const int64_t rank = static_cast<int64_t>(perm.size());
+  std::vector<int64_t> axes;
+  if (!graph_utils::GetRepeatedNodeAttributeValues(node, "axes", axes)) {
+    for (int64_t i = 0; i < rank; ++i) {
+      axes.push_back(i);
+    }
+  }
+
+  std::vector<bool> is_reduced(rank, false);
+  std::vector<int64_t> new_axes;
+  for (auto axis : axes) {
+    axis = HandleNegativeAxis(axis, rank);
+    if (axis < 0 || axis >= rank) {
+      return false;
+    }
+    is_reduced[axis] = true;
+    new_axes.push_back(perm[axis]);
+  }
+
+  const auto* keepdims_attr = graph_utils::GetNodeAttribute(node, "keepdims");
+  const bool keepdims = keepdims_attr == nullptr || keepdims_attr->i() != 0;
+
+  std::vector<int64_t> output_perm;
+  if (keepdims) {
+    output_perm = perm;
+  } else {
+    // position of each remaining axis of the original tensor after the reduction
+    std::vector<bool> is_reduced_original(rank, false);
+    for (auto axis : new_axes) {
+      is_reduced_original[axis] = true;
+    }
+    std::vector<int64_t> reduced_position(rank, 0);
+    for (int64_t d = 0, position = 0; d < rank; ++d) {
+      reduced_position[d] = position;
+      position += is_reduced_original[d] ? 0 : 1;
+    }
+    for (int64_t j = 0; j < rank; ++j) {
+      if (!is_reduced[j]) {
+        output_perm.push_back(reduced_position[perm[j]]);
+      }
+    }
+  }
+
+  BypassTranspose(graph, node, 0, *transpose);
+  node.AddAttribute("axes", new_axes);
+  InsertTransposeAfter(graph, node, output_perm);
+  return true;
+}
+
+bool PushThroughConcat(Graph& graph, Node& node) {
+  const auto& input_defs = node.InputDefs();
+  std::vector<Node*> transposes(input_defs.size(), nullptr);
+  std::vector<int64_t> perm;
+
+  for (size_t i = 0; i < input_defs.size(); ++i) {
+    std::vector<int64_t> input_perm;
+    transposes[i] = GetMovableTranspose(graph, node, static_cast<int>(i), input_perm);
+    if (transposes[i] == nullptr || (i > 0 && perm != input_perm)) {
+      return false;
+    }
+    perm = input_perm;
+  }
+
+  const auto* axis_attr = graph_utils::GetNodeAttribute(node, "axis");
+  if (perm.empty() || axis_attr == nullptr) {
+    return false;
+  }
+  const int64_t axis = HandleNegativeAxis(axis_attr->i(), static_cast<int64_t>(perm.size()));
+  if (axis < 0 || axis >= static_cast<int64_t>(perm.size())) {
+    return false;
+  }
+
+  for (size_t i = 0; i < input_defs.size(); ++i) {
+    BypassTranspose(graph, node, static_cast<int>(i), *transposes[i]);
+  }
+  node.AddAttribute("axis", perm[axis]);
+  InsertTransposeAfter(graph, node, perm);
+  return true;
+}
+
+// Unsqueeze(Transpose(X, perm), axes) == Transpose(Unsqueeze(X, axes), perm'), where perm' keeps the inserted
+// axes in place and maps the remaining positions to where the original axes land in Unsqueeze(X, axes).
+bool PushThroughUnsqueeze(Graph& graph, Node& node) {
+  std::vector<int64_t> perm;
+  Node* transpose = GetMovableTranspose(graph, node, 0, perm);
+  std::vector<int64_t> axes;
+  if (transpose == nullptr || !graph_utils::GetRepeatedNodeAttributeValues(node, "axes", axes)) {
+    return false;
+  }
+
+  const int64_t output_rank = static_cast<int64_t>(perm.size() + axes.size());
+  std::vector<bool> is_inserted(output_rank, false);
+  for (auto axis : axes) {
+    axis = HandleNegativeAxis(axis, output_rank);
+    if (axis < 0 || axis >= output_rank || is_inserted[axis]) {
+      return false;
+    }
+    is_inserted[axis] = true;
+  }
+
+  std::vector<int64_t> original_positions;
+  for (int64_t i = 0; i < output_rank; ++i) {
+    if (!is_inserted[i]) {
+      original_positions.push_back(i);
+    }
+  }
+
+  std::vector<int64_t> output_perm(output_rank);
+  for (int64_t i = 0, j = 0; i < output_rank; ++i) {
+    output_perm[i] = is_inserted[i] ? i : original_positions[perm[j++]];
+  }
+
+  BypassTranspose(graph, node, 0, *transpose);
+  InsertTransposeAfter(graph, node, output_perm);
+  return true;
+}
+
+// Pad-2 with its pads given as an attribute. The pads are permuted to the original layout.
+bool PushThroughPad(Graph& graph, Node& node) {
+  std::vector<int64_t> perm;
+  Node* transpose = GetMovableTranspose(graph, node, 0, perm);
+  std::vector<int64_t> pads;
+  if (transpose == nullptr || !graph_utils::GetRepeatedNodeAttributeValues(node, "pads", pads) ||
+      pads.size() != 2 * perm.size()) {
+    return false;
+  }
+
+  const size_t rank = perm.size();
+  std::vector<int64_t> new_pads(pads.size());
+  for (size_t j = 0; j < rank; ++j) {
+    new_pads[perm[j]] = pads[j];
+    new_pads[rank + perm[j]] = pads[rank + j];
+  }
+
+  BypassTranspose(graph, node, 0, *transpose);
+  node.AddAttribute("pads", new_pads);
+  InsertTransposeAfter(graph, node, perm);
+  return true;
+}
+
+}  // namespace
+
+Status TransposeOptimizer::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  // Nodes are visited producer first, so a Transpose that is pushed below one node is considered again when its
+  // new consumer is visited.
+  for (auto node_index : node_topology_list) {
+    auto* node_ptr = graph.GetNode(node_index);
+    if (node_ptr == nullptr)
+      continue;  // node was removed
+
+    auto& node = *node_ptr;
+
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    if (!graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders()) ||
+        node.OutputDefs().size() != 1) {
+      continue;
+    }
+
+    bool node_modified = false;
+    if (IsTranspose(node)) {
+      node_modified = MergeTransposes(graph, node, logger);
+    } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Gemm", {7, 9, 11})) {
+      node_modified = FoldIntoGemm(graph, node);
+    } else if (IsAnyOf(node, UnaryElementwiseOps())) {
+      node_modified = PushThroughUnaryElementwise(graph, node);
+    } else if (IsAnyOf(node, BroadcastElementwiseOps())) {
+      node_modified = PushThroughBroadcastElementwise(graph, node);
+    } else if (IsAnyOf(node, ReduceOps())) {
+      node_modified = PushThroughReduce(graph, node);
+    } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Concat", {4, 11})) {
+      node_modified = PushThroughConcat(graph, node);
+    } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Unsqueeze", {1, 11})) {
+      node_modified = PushThroughUnsqueeze(graph, node);
+    } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Pad", {2})) {
+      node_modified = PushThroughPad(graph, node);
+    }
+
+    modified = modified || node_modified;
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
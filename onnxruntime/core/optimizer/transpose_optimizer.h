@@ -0,0 +1,28 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class TransposeOptimizer
+Reduces the number of Transpose nodes that materialize a copy of their input.
+
+A Transpose is pushed below its consumer when the consumer is layout agnostic (unary and binary elementwise ops,
+reductions, Concat, Unsqueeze and Pad) with the consumer's axis attributes remapped accordingly. Transposes that
+meet after being pushed are merged, and cancelled entirely when their permutations are inverses of each other.
+A 2D Transpose that feeds a Gemm is folded into the Gemm's transA/transB attribute.
+*/
+class TransposeOptimizer : public GraphTransformer {
+ public:
+  TransposeOptimizer(const std::unordered_set<std::string>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("TransposeOptimizer", compatible_execution_providers) {
+  }
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
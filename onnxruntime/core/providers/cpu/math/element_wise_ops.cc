@@ -908,6 +908,10 @@ ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
 // This is a special case version of TBroadcaster just for Expand that only has a shape as the second parameter
 template <typename T>
 struct TBroadcasterExpand {
+  // Expand only reads Input0, the cost model of ParallelBroadcastLoop counts it twice which is close enough for a copy
+  using Input0Type = T;
+  using Input1Type = T;
+
   TBroadcasterExpand(const Tensor& input, const std::vector<int64_t>& shape)
       : input_tensor_(input),
         broadcaster_(input.Shape().GetDims(), shape) {
@@ -916,6 +920,12 @@ struct TBroadcasterExpand {
   TensorShape GetOutputShape() const { return TensorShape(broadcaster_.output_shape_); }
   size_t GetSpanSize() const { return span_size_; }
 
+  // Uses smaller spans, 'span_size' must divide the original span size
+  void SetSpanSize(size_t span_size) { span_size_ = span_size; }
+
+  // Continues from output element 'offset', which must be at a span boundary
+  void Seek(size_t offset) { broadcaster_.iterator1_.Seek(offset); }
+
   bool IsInput0Scalar() const { return broadcaster_.iterator1_.deltas_.front() == 0; }
 
   T NextScalar() { return *Next(); }
@@ -941,19 +951,41 @@ Status Expand_8<T>::Compute(OpKernelContext* context) const {
   const auto* p_shape = tensor_shape.template Data<int64_t>();
   std::vector<int64_t> shape{p_shape, p_shape + tensor_shape.Shape().Size()};
 
-  TBroadcasterExpand<T> bc(*context->Input<Tensor>(0), shape);
-  TBroadcastOutput<T> output(bc.GetSpanSize(), *context->Output(0, bc.GetOutputShape()));
+  const auto& input = *context->Input<Tensor>(0);
+  TBroadcasterExpand<T> bc(input, shape);
+  auto& output_tensor = *context->Output(0, bc.GetOutputShape());
+
+  // the allocation planner made the output a strided view over the input buffer, as all consumers of the
+  // output accept strided inputs. broadcast dimensions get a stride of 0 so no data is duplicated.
+  if (output_tensor.Shape().Size() > 0 && output_tensor.DataRaw() == input.DataRaw()) {
+    const auto& input_dims = input.Shape().GetDims();
+    const auto& output_dims = output_tensor.Shape().GetDims();
+    const std::vector<int64_t> input_strides = input.Strides();
+    std::vector<int64_t> output_strides(output_dims.size(), 0);
+    const size_t rank_offset = output_dims.size() - input_dims.size();
+    for (size_t i = 0; i < input_dims.size(); ++i) {
+      if (input_dims[i] != 1) {
+        output_strides[i + rank_offset] = input_strides[i];
+      }
+    }
+    output_tensor.SetShapeAndStrides(output_tensor.Shape(), output_strides);
+    return Status::OK();
+  }
 
   // This doesn't use BroadcastLoop since there is no second tensor, just duplicating the first
-  if (bc.IsInput0Scalar()) {
-    // Input0 being a scalar is the only special case here, since we're duplicating a single value
-    while (output)
-      output.NextEigenOutput().array() = bc.NextScalar();
-  } else {
-    // Input1 being a scalar doesn't matter (as there's no actual input1). We're still duplicating Input0 in the same sized chunks
-    while (output)
-      output.NextEigenOutput() = bc.NextEigen();
-  }
+  ParallelBroadcastLoop<T>(
+      context->GetOperatorThreadPool(), bc, output_tensor,
+      [](TBroadcasterExpand<T>& chunk_bc, TBroadcastOutput<T>& output) {
+        if (chunk_bc.IsInput0Scalar()) {
+          // Input0 being a scalar is the only special case here, since we're duplicating a single value
+          while (output)
+            output.NextEigenOutput().array() = chunk_bc.NextScalar();
+        } else {
+          // Input1 being a scalar doesn't matter (as there's no actual input1). We're still duplicating Input0 in the same sized chunks
+          while (output)
+            output.NextEigenOutput() = chunk_bc.NextEigen();
+        }
+      });
   return Status::OK();
 }
 
@@ -962,7 +994,9 @@ Status Expand_8<T>::Compute(OpKernelContext* context) const {
       Expand,                                                                      \
       8,                                                                           \
       TYPE,                                                                        \
-      KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<TYPE>()), \
+      KernelDefBuilder()                                                           \
+          .TypeConstraint("T", DataTypeImpl::GetTensorType<TYPE>())                \
+          .MayStridedOutput(0, 0),                                                 \
       Expand_8<TYPE>);
 
 REG_EXPAND_KERNEL(float)
@@ -1030,28 +1064,30 @@ void BroadCastFMod(const Tensor& X, const Tensor& Y, OpKernelContext* context) {
   TBroadcaster<T, T> mod_broadcaster{X, Y};
   Tensor* const output = context->Output(0, mod_broadcaster.GetOutputShape());
   ORT_ENFORCE(output, "failed to get first output!");
-  TBroadcastOutput<T> mod_broadcast_output{
-      mod_broadcaster.GetSpanSize(), *output};
-
-  BroadcastLoopSpan(
-      mod_broadcaster, mod_broadcast_output,
-      [](gsl::span<T> output, const T& X, gsl::span<const T> Y) {
-        std::transform(Y.cbegin(), Y.cend(), output.begin(),
-                       [X](T y) {
-                         return static_cast<T>(std::fmod(X, y));
-                       });
-      },
-      [](gsl::span<T> output, gsl::span<const T> X, const T& Y) {
-        std::transform(X.cbegin(), X.cend(), output.begin(),
-                       [Y](T x) {
-                         return static_cast<T>(std::fmod(x, Y));
-                       });
-      },
-      [](gsl::span<T> output, gsl::span<const T> X, gsl::span<const T> Y) {
-        std::transform(
-            X.cbegin(), X.cend(), Y.cbegin(), output.begin(),
-            [](T x, T y) {
-              return static_cast<T>(std::fmod(x, y));
+
+  ParallelBroadcastLoop<T>(
+      context->GetOperatorThreadPool(), mod_broadcaster, *output,
+      [](TBroadcaster<T, T>& bc, TBroadcastOutput<T>& broadcast_output) {
+        BroadcastLoopSpan(
+            bc, broadcast_output,
+            [](gsl::span<T> output, const T& X, gsl::span<const T> Y) {
+              std::transform(Y.cbegin(), Y.cend(), output.begin(),
+                             [X](T y) {
+                               return static_cast<T>(std::fmod(X, y));
+                             });
+            },
+            [](gsl::span<T> output, gsl::span<const T> X, const T& Y) {
+              std::transform(X.cbegin(), X.cend(), output.begin(),
+                             [Y](T x) {
+                               return static_cast<T>(std::fmod(x, Y));
+                             });
+            },
+            [](gsl::span<T> output, gsl::span<const T> X, gsl::span<const T> Y) {
+              std::transform(
+                  X.cbegin(), X.cend(), Y.cbegin(), output.begin(),
+                  [](T x, T y) {
+                    return static_cast<T>(std::fmod(x, y));
+                  });
             });
       });
 }
@@ -1070,31 +1106,33 @@ void BroadCastMod(const Tensor& X, const Tensor& Y, OpKernelContext* context) {
   TBroadcaster<T, T> mod_broadcaster{X, Y};
   Tensor* const output = context->Output(0, mod_broadcaster.GetOutputShape());
   ORT_ENFORCE(output, "failed to get first output!");
-  TBroadcastOutput<T> mod_broadcast_output{
-      mod_broadcaster.GetSpanSize(), *output};
 
   // static_cast below are necessary when small types such as
   // int16_t and int8_t are converted to integers to perform remainder
   // operation. This cast is safe with respect to data loss.
-  BroadcastLoopSpan(
-      mod_broadcaster, mod_broadcast_output,
-      [](gsl::span<T> output, const T& X, gsl::span<const T> Y) {
-        std::transform(Y.cbegin(), Y.cend(), output.begin(),
-                       [X](T y) {
-                         return Modulus(X, y);
-                       });
-      },
-      [](gsl::span<T> output, gsl::span<const T> X, const T& Y) {
-        std::transform(X.cbegin(), X.cend(), output.begin(),
-                       [Y](T x) {
-                         return Modulus(x, Y);
-                       });
-      },
-      [](gsl::span<T> output, gsl::span<const T> X, gsl::span<const T> Y) {
-        std::transform(
-            X.cbegin(), X.cend(), Y.cbegin(), output.begin(),
-            [](T x, T y) {
-              return Modulus(x, y);
+  ParallelBroadcastLoop<T>(
+      context->GetOperatorThreadPool(), mod_broadcaster, *output,
+      [](TBroadcaster<T, T>& bc, TBroadcastOutput<T>& broadcast_output) {
+        BroadcastLoopSpan(
+            bc, broadcast_output,
+            [](gsl::span<T> output, const T& X, gsl::span<const T> Y) {
+              std::transform(Y.cbegin(), Y.cend(), output.begin(),
+                             [X](T y) {
+                               return Modulus(X, y);
+                             });
+            },
+            [](gsl::span<T> output, gsl::span<const T> X, const T& Y) {
+              std::transform(X.cbegin(), X.cend(), output.begin(),
+                             [Y](T x) {
+                               return Modulus(x, Y);
+                             });
+            },
+            [](gsl::span<T> output, gsl::span<const T> X, gsl::span<const T> Y) {
+              std::transform(
+                  X.cbegin(), X.cend(), Y.cbegin(), output.begin(),
+                  [](T x, T y) {
+                    return Modulus(x, y);
+                  });
             });
       });
 }
@@ -1103,30 +1141,32 @@ void BroadCastMFloat16FMod(const Tensor& X, const Tensor& Y, OpKernelContext* co
   TBroadcaster<MLFloat16, MLFloat16> mod_broadcaster{X, Y};
   Tensor* const output = context->Output(0, mod_broadcaster.GetOutputShape());
   ORT_ENFORCE(output, "failed to get first output!");
-  TBroadcastOutput<MLFloat16> mod_broadcast_output{
-      mod_broadcaster.GetSpanSize(), *output};
-
-  BroadcastLoopSpan(
-      mod_broadcaster, mod_broadcast_output,
-      [](gsl::span<MLFloat16> output, const MLFloat16& X, gsl::span<const MLFloat16> Y) {
-        std::transform(Y.cbegin(), Y.cend(), output.begin(),
-                       [X_fl = math::halfToFloat(X.val)](const MLFloat16& y) {
-                         return MLFloat16(math::floatToHalf(std::fmod(X_fl, math::halfToFloat(y.val))));
-                       });
-      },
-      [](gsl::span<MLFloat16> output, gsl::span<const MLFloat16> X, const MLFloat16& Y) {
-        std::transform(X.cbegin(), X.cend(), output.begin(),
-                       [Y_fl = math::halfToFloat(Y.val)](const MLFloat16& x) {
-                         return MLFloat16(math::floatToHalf(std::fmod(math::halfToFloat(x.val), Y_fl)));
-                       });
-      },
-      [](gsl::span<MLFloat16> output, gsl::span<const MLFloat16> X, gsl::span<const MLFloat16> Y) {
-        std::transform(
-            X.cbegin(), X.cend(), Y.cbegin(), output.begin(),
-            [](const MLFloat16& x, const MLFloat16& y) {
-              auto x_fl = math::halfToFloat(x.val);
-              auto y_fl = math::halfToFloat(y.val);
-              return MLFloat16(math::floatToHalf(std::fmod(x_fl, y_fl)));
+
+  ParallelBroadcastLoop<MLFloat16>(
+      context->GetOperatorThreadPool(), mod_broadcaster, *output,
+      [](TBroadcaster<MLFloat16, MLFloat16>& bc, TBroadcastOutput<MLFloat16>& broadcast_output) {
+        BroadcastLoopSpan(
+            bc, broadcast_output,
+            [](gsl::span<MLFloat16> output, const MLFloat16& X, gsl::span<const MLFloat16> Y) {
+              std::transform(Y.cbegin(), Y.cend(), output.begin(),
+                             [X_fl = math::halfToFloat(X.val)](const MLFloat16& y) {
+                               return MLFloat16(math::floatToHalf(std::fmod(X_fl, math::halfToFloat(y.val))));
+                             });
+            },
+            [](gsl::span<MLFloat16> output, gsl::span<const MLFloat16> X, const MLFloat16& Y) {
+              std::transform(X.cbegin(), X.cend(), output.begin(),
+                             [Y_fl = math::halfToFloat(Y.val)](const MLFloat16& x) {
+                               return MLFloat16(math::floatToHalf(std::fmod(math::halfToFloat(x.val), Y_fl)));
+                             });
+            },
+            [](gsl::span<MLFloat16> output, gsl::span<const MLFloat16> X, gsl::span<const MLFloat16> Y) {
+              std::transform(
+                  X.cbegin(), X.cend(), Y.cbegin(), output.begin(),
+                  [](const MLFloat16& x, const MLFloat16& y) {
+                    auto x_fl = math::halfToFloat(x.val);
+                    auto y_fl = math::halfToFloat(y.val);
+                    return MLFloat16(math::floatToHalf(std::fmod(x_fl, y_fl)));
+                  });
             });
       });
 }
@@ -5,6 +5,7 @@
 
 #include "core/common/common.h"
 #include "core/framework/op_kernel.h"
+#include "core/platform/threadpool.h"
 #include "core/util/math_cpuonly.h"
 
 namespace onnxruntime {
@@ -343,6 +344,19 @@ struct BroadcastIterator {
     return index;
   }
 
+  // Positions the iterator at output element 'offset', as if AdvanceBy had been called up to it. 'offset' must be
+  // at a span boundary.
+  void Seek(size_t offset) {
+    index_ = deltas_[0] * offset;
+    counters_[0] = static_cast<int64_t>(offset % static_cast<size_t>(counts_[0]));
+    size_t carry = offset / static_cast<size_t>(counts_[0]);
+    for (size_t counterIndex = 1; counterIndex < counters_.size(); counterIndex++) {
+      index_ += deltas_[counterIndex] * carry;
+      counters_[counterIndex] = static_cast<int64_t>(carry % static_cast<size_t>(counts_[counterIndex]));
+      carry /= static_cast<size_t>(counts_[counterIndex]);
+    }
+  }
+
   void Reserve(int64_t max_dims) {
     deltas_.reserve(static_cast<size_t>(max_dims));
     counts_.reserve(static_cast<size_t>(max_dims));
@@ -502,6 +516,9 @@ struct Broadcaster {
 
 template <typename T0, typename T1>
 struct TBroadcaster {
+  using Input0Type = T0;
+  using Input1Type = T1;
+
   TBroadcaster(const Tensor& input0, const Tensor& input1)
       : input_tensor0_(input0),
         input_tensor1_(input1) {
@@ -510,6 +527,15 @@ struct TBroadcaster {
   TensorShape GetOutputShape() const { return TensorShape(broadcaster_.output_shape_); }
   size_t GetSpanSize() const { return span_size_; }
 
+  // Uses smaller spans, 'span_size' must divide the original span size
+  void SetSpanSize(size_t span_size) { span_size_ = span_size; }
+
+  // Continues from output element 'offset', which must be at a span boundary
+  void Seek(size_t offset) {
+    broadcaster_.iterator1_.Seek(offset);
+    broadcaster_.iterator2_.Seek(offset);
+  }
+
   bool IsInput0Scalar() const { return broadcaster_.iterator1_.deltas_.front() == 0; }
   bool IsInput1Scalar() const { return broadcaster_.iterator2_.deltas_.front() == 0; }
 
@@ -543,6 +569,13 @@ struct TBroadcastOutput {
     output_end_ = output_ + tensor.Shape().Size();
   }
 
+  // Output elements [start_offset, end_offset) of the tensor
+  TBroadcastOutput(size_t span_size, Tensor& tensor, size_t start_offset, size_t end_offset)
+      : span_size_(span_size) {
+    output_ = tensor.template MutableData<T>() + start_offset;
+    output_end_ = tensor.template MutableData<T>() + end_offset;
+  }
+
   operator bool() const {
     return output_ != output_end_;
   }
@@ -623,11 +656,68 @@ void BroadcastLoopSpan(TBroadcaster& bc, Output& output, Input0Scalar input0scal
   }
 }
 
+// Output elements handled by one task of ParallelBroadcastLoop. Small enough for the inputs and the output of a
+// chunk to stay in the L2 cache, large enough for the per chunk setup to be negligible.
+constexpr ptrdiff_t kBroadcastChunkSize = 16384;
+
+// Runs 'loop(TBroadcaster& bc, TBroadcastOutput<TOutput>& output)', e.g. a BroadcastLoop, over the output of 'bc'
+// using the intra-op thread pool. The output is split into chunks of whole spans. Each chunk gets its own copy of
+// the broadcaster, positioned at the start of the chunk, and an output covering only the chunk, so the chunks are
+// independent. Spans longer than a chunk are split into equal pieces first, so elementwise ops on same shaped or
+// scalar inputs are parallelized as well. Outputs of a single chunk, or without a thread pool, run on the calling
+// thread.
+template <typename TOutput, typename TBroadcaster, typename Loop>
+void ParallelBroadcastLoop(concurrency::ThreadPool* tp, TBroadcaster& bc, Tensor& output_tensor, Loop loop) {
+  const ptrdiff_t output_size = static_cast<ptrdiff_t>(output_tensor.Shape().Size());
+  if (tp == nullptr || output_size <= kBroadcastChunkSize) {
+    TBroadcastOutput<TOutput> output(bc.GetSpanSize(), output_tensor);
+    loop(bc, output);
+    return;
+  }
+
+  ptrdiff_t span_size = static_cast<ptrdiff_t>(bc.GetSpanSize());
+  if (span_size > kBroadcastChunkSize) {
+    // Use the smallest number of pieces that evenly divides the span and is not much smaller than a chunk
+    const ptrdiff_t min_pieces = (span_size + kBroadcastChunkSize - 1) / kBroadcastChunkSize;
+    for (ptrdiff_t pieces = min_pieces; pieces <= 8 * min_pieces; pieces++) {
+      if (span_size % pieces == 0) {
+        span_size /= pieces;
+        break;
+      }
+    }
+  }
+
+  const ptrdiff_t chunk_size = std::max<ptrdiff_t>(kBroadcastChunkSize / span_size, 1) * span_size;
+  const ptrdiff_t chunk_count = (output_size + chunk_size - 1) / chunk_size;
+  const double chunk_elements = static_cast<double>(chunk_size);
+  const TensorOpCost chunk_cost{
+      chunk_elements * (sizeof(typename TBroadcaster::Input0Type) + sizeof(typename TBroadcaster::Input1Type)),
+      chunk_elements * sizeof(TOutput),
+      chunk_elements};
+
+  concurrency::ThreadPool::TryParallelFor(
+      tp, chunk_count, chunk_cost,
+      [&bc, &output_tensor, &loop, span_size, chunk_size, output_size](ptrdiff_t first, ptrdiff_t last) {
+        const ptrdiff_t start = first * chunk_size;
+        const ptrdiff_t end = std::min(last * chunk_size, output_size);
+        TBroadcaster chunk_bc(bc);
+        chunk_bc.SetSpanSize(static_cast<size_t>(span_size));
+        chunk_bc.Seek(static_cast<size_t>(start));
+        TBroadcastOutput<TOutput> output(static_cast<size_t>(span_size), output_tensor,
+                                         static_cast<size_t>(start), static_cast<size_t>(end));
+        loop(chunk_bc, output);
+      });
+}
+
 template <typename TInput, typename TOutput, typename Input0Scalar, typename Input1Scalar, typename General>
 Status BroadcastTwo(OpKernelContext& context, Input0Scalar input0scalar, Input1Scalar input1scalar, General general) {
   TBroadcaster<TInput, TInput> bc(*context.Input<Tensor>(0), *context.Input<Tensor>(1));
-  TBroadcastOutput<TOutput> output(bc.GetSpanSize(), *context.Output(0, bc.GetOutputShape()));
-  BroadcastLoop(bc, output, input0scalar, input1scalar, general);
+  Tensor& output_tensor = *context.Output(0, bc.GetOutputShape());
+  ParallelBroadcastLoop<TOutput>(
+      context.GetOperatorThreadPool(), bc, output_tensor,
+      [&](TBroadcaster<TInput, TInput>& chunk_bc, TBroadcastOutput<TOutput>& output) {
+        BroadcastLoop(chunk_bc, output, input0scalar, input1scalar, general);
+      });
 
   return Status::OK();
 }
@@ -664,9 +754,11 @@ Status BroadcastVariadic(const Node& node, OpKernelContext& context, Input0Scala
       p_output = tempOutput.get();
     }
 
-    TBroadcastOutput<TOutput> output(bc.GetSpanSize(), *p_output);
-
-    BroadcastLoop(bc, output, input0scalar, input1scalar, general);
+    ParallelBroadcastLoop<TOutput>(
+        context.GetOperatorThreadPool(), bc, *p_output,
+        [&](TBroadcaster<TInput, TInput>& chunk_bc, TBroadcastOutput<TOutput>& output) {
+          BroadcastLoop(chunk_bc, output, input0scalar, input1scalar, general);
+        });
 
     tempInput = std::move(tempOutput);
   }
@@ -4,6 +4,7 @@
 #include "core/providers/cpu/math/matmul.h"
 #include "core/util/math.h"
 #include "core/util/math_cpuonly.h"
+#include "core/providers/cpu/tensor/strided_copy.h"
 #include "matmul_helper.h"
 
 namespace onnxruntime {
@@ -12,7 +13,10 @@ ONNX_CPU_OPERATOR_VERSIONED_TYPED_KERNEL(
     MatMul,
     1, 8,
     float,
-    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>())
+        .MayStridedInput(0)
+        .MayStridedInput(1),
     MatMul<float>);
 
 ONNX_CPU_OPERATOR_VERSIONED_TYPED_KERNEL(
@@ -27,7 +31,10 @@ ONNX_CPU_OPERATOR_TYPED_KERNEL(
     MatMul,
     9,
     float,
-    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>())
+        .MayStridedInput(0)
+        .MayStridedInput(1),
     MatMul<float>);
 
 ONNX_CPU_OPERATOR_TYPED_KERNEL(
@@ -92,4 +99,154 @@ Status MatMul<T>::Compute(OpKernelContext* ctx) const {
   return Status::OK();
 }
 
+// Describes how the matrices in the last two dimensions of a strided tensor map to GEMM arguments.
+struct StridedMatrixLayout {
+  CBLAS_TRANSPOSE trans;
+  int64_t ld;
+};
+
+// Returns false if the strides of the last two dimensions can't be expressed with a transpose flag and a
+// leading dimension, e.g. if a dimension is broadcast.
+static bool GetStridedMatrixLayout(const TensorShape& shape, const std::vector<int64_t>& strides,
+                                   StridedMatrixLayout& layout) {
+  const size_t rank = shape.NumDimensions();
+  const int64_t rows = shape[rank - 2];
+  const int64_t cols = shape[rank - 1];
+  const int64_t row_stride = strides[rank - 2];
+  const int64_t col_stride = strides[rank - 1];
+
+  if ((col_stride == 1 || cols == 1) && row_stride >= std::max<int64_t>(cols, 1)) {
+    layout = {CblasNoTrans, std::max<int64_t>(row_stride, 1)};
+    return true;
+  }
+
+  if ((row_stride == 1 || rows == 1) && col_stride >= std::max<int64_t>(rows, 1)) {
+    layout = {CblasTrans, std::max<int64_t>(col_stride, 1)};
+    return true;
+  }
+
+  return false;
+}
+
+// Runs the GEMMs directly on strided views of the inputs if both are at least 2D and the matrix strides are
+// supported by GEMM. The batch dimensions broadcast as in MatMulComputeHelper. Returns false if the inputs need to
+// be made contiguous first.
+static bool TryStridedMatMul(const Tensor& A, const Tensor& B, Tensor& Y, concurrency::ThreadPool* thread_pool) {
+  const auto& a_shape = A.Shape();
+  const auto& b_shape = B.Shape();
+  const auto& y_shape = Y.Shape();
+  const size_t a_rank = a_shape.NumDimensions();
+  const size_t b_rank = b_shape.NumDimensions();
+
+  // 1-D operands are promoted to matrices by MatMulComputeHelper, so they take the contiguous path.
+  if (a_rank < 2 || b_rank < 2) {
+    return false;
+  }
+
+  const auto a_strides = A.Strides();
+  const auto b_strides = B.Strides();
+  StridedMatrixLayout a_layout;
+  StridedMatrixLayout b_layout;
+  if (!GetStridedMatrixLayout(a_shape, a_strides, a_layout) || !GetStridedMatrixLayout(b_shape, b_strides, b_layout)) {
+    return false;
+  }
+
+  // the batch dimensions of the operands are aligned to the right of the batch dimensions of the output, and
+  // an operand is broadcast over the output dimensions it lacks or has as 1.
+  const size_t batch_rank = y_shape.NumDimensions() - 2;
+  std::vector<int64_t> a_batch_strides(batch_rank, 0);
+  std::vector<int64_t> b_batch_strides(batch_rank, 0);
+  for (size_t i = 0; i < a_rank - 2; ++i) {
+    if (a_shape[i] != 1) {
+      a_batch_strides[batch_rank - (a_rank - 2) + i] = a_strides[i];
+    }
+  }
+  for (size_t i = 0; i < b_rank - 2; ++i) {
+    if (b_shape[i] != 1) {
+      b_batch_strides[batch_rank - (b_rank - 2) + i] = b_strides[i];
+    }
+  }
+
+  const int64_t M = a_shape[a_rank - 2];
+  const int64_t K = a_shape[a_rank - 1];
+  const int64_t N = b_shape[b_rank - 1];
+  const int64_t batch_count = y_shape.SizeToDimension(batch_rank);
+
+  const float* a_data = A.Data<float>();
+  const float* b_data = B.Data<float>();
+  float* y_data = Y.MutableData<float>();
+
+  std::vector<int64_t> batch_index(batch_rank, 0);
+  for (int64_t batch = 0; batch < batch_count; ++batch) {
+    int64_t a_offset = 0;
+    int64_t b_offset = 0;
+    for (size_t i = 0; i < batch_rank; ++i) {
+      a_offset += batch_index[i] * a_batch_strides[i];
+      b_offset += batch_index[i] * b_batch_strides[i];
+    }
+
+    math::GemmEx<float, concurrency::ThreadPool>(
+        a_layout.trans, b_layout.trans,
+        static_cast<int>(M), static_cast<int>(N), static_cast<int>(K),
+        1.0f,
+        a_data + a_offset, static_cast<int>(a_layout.ld),
+        b_data + b_offset, static_cast<int>(b_layout.ld),
+        0.0f,
+        y_data + batch * M * N, static_cast<int>(N),
+        thread_pool);
+
+    for (size_t k = batch_rank; k-- > 0;) {
+      if (++batch_index[k] < y_shape[k]) break;
+      batch_index[k] = 0;
+    }
+  }
+
+  return true;
+}
+
+template <>
+Status MatMul<float>::Compute(OpKernelContext* ctx) const {
+  concurrency::ThreadPool* thread_pool = ctx->GetOperatorThreadPool();
+
+  const auto* left_X = ctx->Input<Tensor>(0);
+  const auto* right_X = ctx->Input<Tensor>(1);
+
+  MatMulComputeHelper helper;
+  ORT_RETURN_IF_ERROR(helper.Compute(left_X->Shape(), right_X->Shape()));
+
+  Tensor* Y = ctx->Output(0, helper.OutputShape());
+
+  if (Y->Shape().Size() == 0) {
+    return Status::OK();
+  }
+
+  // strided views produced by e.g. Transpose are consumed in place if GEMM can address them, and are only
+  // copied to contiguous buffers otherwise.
+  std::unique_ptr<Tensor> left_holder;
+  std::unique_ptr<Tensor> right_holder;
+  if (!left_X->IsContiguous() || !right_X->IsContiguous()) {
+    if (TryStridedMatMul(*left_X, *right_X, *Y, thread_pool)) {
+      return Status::OK();
+    }
+
+    AllocatorPtr allocator;
+    ORT_RETURN_IF_ERROR(ctx->GetTempSpaceAllocator(&allocator));
+    ORT_RETURN_IF_ERROR(MakeContiguous(*left_X, allocator, left_holder, left_X));
+    ORT_RETURN_IF_ERROR(MakeContiguous(*right_X, allocator, right_holder, right_X));
+  }
+
+  size_t max_len = helper.OutputOffsets().size();
+  for (size_t i = 0; i < max_len; i++) {
+    math::MatMul<float>(
+        static_cast<int>(helper.M()),
+        static_cast<int>(helper.N()),
+        static_cast<int>(helper.K()),
+        left_X->Data<float>() + helper.LeftOffsets()[i],
+        right_X->Data<float>() + helper.RightOffsets()[i],
+        Y->MutableData<float>() + helper.OutputOffsets()[i], thread_pool);
+  }
+
+  return Status::OK();
+}
+
 }  // namespace onnxruntime
@@ -18,4 +18,9 @@ class MatMul final : public OpKernel {
   Status Compute(OpKernelContext* context) const override;
 };
 
+// MatMul<float> accepts strided inputs (e.g. the output of a Transpose) and consumes them through the GEMM
+// transpose flags and leading dimensions where possible.
+template <>
+Status MatMul<float>::Compute(OpKernelContext* context) const;
+
 }  // namespace onnxruntime
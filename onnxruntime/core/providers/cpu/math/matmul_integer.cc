@@ -49,6 +49,7 @@ Status MatMulInteger<uint8_t, uint8_t>::Compute(OpKernelContext* ctx) const {
   // validate zero points
   uint8_t a_offset = 0;
   uint8_t b_offset = 0;
+  const uint8_t* b_zero_points = nullptr;
   if (has_a_zero_point_) {
     auto a_zero_point = ctx->Input<Tensor>(2);
     ORT_ENFORCE(IsScalarOr1ElementVector(a_zero_point),
@@ -57,9 +58,20 @@ Status MatMulInteger<uint8_t, uint8_t>::Compute(OpKernelContext* ctx) const {
   }
   if (has_b_zero_point_) {
     auto b_zero_point = ctx->Input<Tensor>(3);
-    ORT_ENFORCE(IsScalarOr1ElementVector(b_zero_point),
-                "MatmulInteger : input2 zero point must be a scalar or 1D tensor of size 1");
-    b_offset = static_cast<int32_t>(*b_zero_point->template Data<uint8_t>());
+    if (IsScalarOr1ElementVector(b_zero_point)) {
+      b_offset = static_cast<int32_t>(*b_zero_point->template Data<uint8_t>());
+    } else {
+      // Per-column zero points for weights quantized per output channel.
+      ORT_ENFORCE(b_zero_point->Shape().NumDimensions() == 1 && b_zero_point->Shape()[0] == helper.N(),
+                  "MatmulInteger : input2 zero point must be a scalar, a 1D tensor of size 1, or a 1D tensor "
+                  "with one element per column of input2");
+      const auto* b_zero_point_data = b_zero_point->template Data<uint8_t>();
+      if (IsUniformZeroPoint(b_zero_point_data, static_cast<size_t>(helper.N()))) {
+        b_offset = b_zero_point_data[0];
+      } else {
+        b_zero_points = b_zero_point_data;
+      }
+    }
   }
 
   for (size_t i = 0; i < helper.OutputOffsets().size(); i++) {
@@ -75,6 +87,18 @@ Status MatMulInteger<uint8_t, uint8_t>::Compute(OpKernelContext* ctx) const {
                   y->template MutableData<int32_t>() + helper.OutputOffsets()[i],
                   static_cast<int>(helper.N()),
                   thread_pool);
+
+    if (b_zero_points != nullptr) {
+      QGemmApplyColumnZeroPoints(static_cast<int>(helper.M()),
+                                 static_cast<int>(helper.N()),
+                                 static_cast<int>(helper.K()),
+                                 a->template Data<uint8_t>() + helper.LeftOffsets()[i],
+                                 static_cast<int>(helper.K()),
+                                 a_offset,
+                                 b_zero_points,
+                                 y->template MutableData<int32_t>() + helper.OutputOffsets()[i],
+                                 static_cast<int>(helper.N()));
+    }
   }
   return Status::OK();
 }
@@ -97,8 +121,8 @@ Status MatMulInteger<uint8_t, int8_t>::Compute(OpKernelContext* ctx) const {
 
     auto IsZeroPointTensorAllZero = [](OpKernelContext* ctx, int input_idx) -> bool {
       auto t = ctx->Input<Tensor>(input_idx);
-      ORT_ENFORCE(t->Shape().NumDimensions() <= 1 && t->Shape().Size() == 1,
-                  "Currently only scalar zero_point is supported. TODO: add per channel zero point support.");
+      ORT_ENFORCE(t->Shape().NumDimensions() <= 1,
+                  "Currently only scalar or per-channel zero_point is supported.");
       ORT_ENFORCE(t->IsDataType<int8_t>() || t->IsDataType<uint8_t>());
       auto data = reinterpret_cast<const int8_t*>(t->DataRaw());
       auto vec = std::vector<int8_t>(data, data + t->Shape().Size());
@@ -24,6 +24,90 @@ ONNX_OPERATOR_KERNEL_EX(
         .TypeConstraint("T3", DataTypeImpl::GetTensorType<uint8_t>()),
     QLinearMatMul<uint8_t, uint8_t, uint8_t>);
 
+template <>
+Status QLinearMatMul<uint8_t, uint8_t, uint8_t>::ComputePerColumn(OpKernelContext* ctx,
+                                                                 const MatMulComputeHelper& helper,
+                                                                 const Tensor* a,
+                                                                 const Tensor* b,
+                                                                 Tensor* y,
+                                                                 float a_scale,
+                                                                 const Tensor* b_scale,
+                                                                 const Tensor* b_offset,
+                                                                 float y_scale) const {
+  const size_t M = static_cast<size_t>(helper.M());
+  const size_t N = static_cast<size_t>(helper.N());
+  const size_t K = static_cast<size_t>(helper.K());
+
+  // Build the per-column requantization multipliers.
+  const auto* b_scale_data = b_scale->template Data<float>();
+  const bool per_column_scale = !IsScalarOr1ElementVector(b_scale);
+  std::vector<float> real_multipliers(N);
+  for (size_t n = 0; n < N; n++) {
+    real_multipliers[n] = (a_scale * b_scale_data[per_column_scale ? n : 0]) / y_scale;
+  }
+
+  // Use the weight zero point as the GEMM offset if all columns share the same
+  // value, otherwise adjust the GEMM result after the fact.
+  const auto* b_offset_data = b_offset->template Data<uint8_t>();
+  const size_t b_offset_count = static_cast<size_t>(b_offset->Shape().Size());
+  uint8_t b_gemm_offset = 0;
+  const uint8_t* b_zero_points = nullptr;
+  if (IsUniformZeroPoint(b_offset_data, b_offset_count)) {
+    b_gemm_offset = b_offset_data[0];
+  } else {
+    b_zero_points = b_offset_data;
+  }
+
+  const uint8_t a_offset = *(ctx->Input<Tensor>(2)->template Data<uint8_t>());
+  const uint8_t y_offset = *(ctx->Input<Tensor>(7)->template Data<uint8_t>());
+
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(ctx->GetTempSpaceAllocator(&alloc));
+  auto gemm_output_data = alloc->Alloc(SafeInt<size_t>(sizeof(int32_t)) * M * N);
+  BufferUniquePtr gemm_output_buffer(gemm_output_data, BufferDeleter(alloc));
+  auto* gemm_output = static_cast<int32_t*>(gemm_output_buffer.get());
+
+  for (size_t i = 0; i < helper.OutputOffsets().size(); i++) {
+    const auto* a_data = a->template Data<uint8_t>() + helper.LeftOffsets()[i];
+
+    QGemmu8u8_s32(static_cast<int>(M),
+                  static_cast<int>(N),
+                  static_cast<int>(K),
+                  a_data,
+                  static_cast<int>(K),
+                  a_offset,
+                  b->template Data<uint8_t>() + helper.RightOffsets()[i],
+                  static_cast<int>(N),
+                  b_gemm_offset,
+                  gemm_output,
+                  static_cast<int>(N),
+                  ctx->GetOperatorThreadPool());
+
+    if (b_zero_points != nullptr) {
+      QGemmApplyColumnZeroPoints(static_cast<int>(M),
+                                 static_cast<int>(N),
+                                 static_cast<int>(K),
+                                 a_data,
+                                 static_cast<int>(K),
+                                 a_offset,
+                                 b_zero_points,
+                                 gemm_output,
+                                 static_cast<int>(N));
+    }
+
+    MlasRequantizeOutput(gemm_output,
+                         y->template MutableData<uint8_t>() + helper.OutputOffsets()[i],
+                         nullptr,
+                         M,
+                         N,
+                         real_multipliers.data(),
+                         true,
+                         y_offset);
+  }
+
+  return Status::OK();
+}
+
 template <>
 Status QLinearMatMul<uint8_t, uint8_t, uint8_t>::Compute(OpKernelContext* ctx) const {
   auto a = ctx->Input<Tensor>(0);
@@ -40,8 +124,6 @@ Status QLinearMatMul<uint8_t, uint8_t, uint8_t>::Compute(OpKernelContext* ctx) c
   auto y_offset = ctx->Input<Tensor>(7);
   ORT_ENFORCE(IsScalarOr1ElementVector(a_offset),
               "QLinearMatmul : input zero point must be a scalar or 1D tensor of size 1");
-  ORT_ENFORCE(IsScalarOr1ElementVector(b_offset),
-              "QLinearMatmul : weight zero point must be a scalar or 1D tensor of size 1");
   ORT_ENFORCE(IsScalarOr1ElementVector(y_offset),
               "QLinearMatmul : result zero point must be a scalar or 1D tensor of size 1");
 
@@ -51,15 +133,31 @@ Status QLinearMatMul<uint8_t, uint8_t, uint8_t>::Compute(OpKernelContext* ctx) c
   auto y_scale = ctx->Input<Tensor>(6);
   ORT_ENFORCE(IsScalarOr1ElementVector(a_scale),
               "QLinearMatmul : input scale must be a scalar or 1D tensor of size 1");
-  ORT_ENFORCE(IsScalarOr1ElementVector(b_scale),
-              "QLinearMatmul : weight scale must be a scalar or 1D tensor of size 1");
   ORT_ENFORCE(IsScalarOr1ElementVector(y_scale),
               "QLinearMatmul : result scale must be a scalar or 1D tensor of size 1");
 
+  // The weight scale and zero point may be supplied per column of the weight
+  // matrix (per output channel).
+  auto is_valid_per_column = [&helper](const Tensor* t) {
+    return IsScalarOr1ElementVector(t) ||
+           (t->Shape().NumDimensions() == 1 && t->Shape()[0] == helper.N());
+  };
+  ORT_ENFORCE(is_valid_per_column(b_offset),
+              "QLinearMatmul : weight zero point must be a scalar, a 1D tensor of size 1, or a 1D tensor with one "
+              "element per column of the weight matrix");
+  ORT_ENFORCE(is_valid_per_column(b_scale),
+              "QLinearMatmul : weight scale must be a scalar, a 1D tensor of size 1, or a 1D tensor with one "
+              "element per column of the weight matrix");
+
   auto a_scale_data = *(a_scale->template Data<float>());
-  auto b_scale_data = *(b_scale->template Data<float>());
   auto y_scale_data = *(y_scale->template Data<float>());
 
+  if (!IsScalarOr1ElementVector(b_offset) || !IsScalarOr1ElementVector(b_scale)) {
+    return ComputePerColumn(ctx, helper, a, b, y, a_scale_data, b_scale, b_offset, y_scale_data);
+  }
+
+  auto b_scale_data = *(b_scale->template Data<float>());
+
   const float real_multiplier = (a_scale_data * b_scale_data) / y_scale_data;
 
 #ifdef MLAS_SUPPORTS_GEMM_U8X8
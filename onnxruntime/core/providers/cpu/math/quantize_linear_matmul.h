@@ -4,6 +4,7 @@
 #pragma once
 
 #include "core/framework/op_kernel.h"
+#include "core/providers/cpu/math/matmul_helper.h"
 
 namespace onnxruntime {
 
@@ -15,5 +16,15 @@ class QLinearMatMul final : public OpKernel {
 
   Status Compute(OpKernelContext* context) const override;
 
+ private:
+  Status ComputePerColumn(OpKernelContext* ctx,
+                          const MatMulComputeHelper& helper,
+                          const Tensor* a,
+                          const Tensor* b,
+                          Tensor* y,
+                          float a_scale,
+                          const Tensor* b_scale,
+                          const Tensor* b_offset,
+                          float y_scale) const;
 };
 }  // namespace onnxruntime
@@ -20,8 +20,8 @@
 #include "core/common/exceptions.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/tensor.h"
+#include "core/platform/threadpool.h"
 #include "core/util/math_cpuonly.h"
-#include <queue>
 #include <algorithm>
 #include <cmath>
 
@@ -31,7 +31,7 @@ namespace onnxruntime {
 template <typename T>
 struct GreaterValueCmp {
   using DataType = T;
-  bool operator()(const pair<T, int64_t>& lhs, const pair<T, int64_t>& rhs) {
+  bool operator()(const pair<T, int64_t>& lhs, const pair<T, int64_t>& rhs) const {
     return (lhs.first > rhs.first ||
             // when values are equal, we want lhs to get higher "priority"
             // if its corresponding index comes first (i.e.) is lower
@@ -42,7 +42,7 @@ struct GreaterValueCmp {
 template <typename T>
 struct LesserValueCmp {
   using DataType = T;
-  bool operator()(const pair<T, int64_t>& lhs, const pair<T, int64_t>& rhs) {
+  bool operator()(const pair<T, int64_t>& lhs, const pair<T, int64_t>& rhs) const {
     return (lhs.first < rhs.first ||
             // when values are equal, we want lhs to get higher "priority"
             // if its corresponding index comes first (i.e.) is lower
@@ -50,127 +50,196 @@ struct LesserValueCmp {
   }
 };
 
+// Number of values the threshold scan checks at once. The check of a block is a branch free loop the compiler turns
+// into SIMD compares, the heap is only updated for the blocks holding a value better than the current k-th best.
+constexpr int64_t kTopKScanBlock = 16;
+
+// Rows at least this many times longer than k use the threshold heap, also when the output is unsorted
+constexpr int64_t kTopKHeapRatio = 64;
+
+// When there are fewer rows than threads, rows longer than two chunks of this size are split in chunks that are
+// selected in parallel. The candidates of the chunks are merged afterwards.
+constexpr int64_t kTopKMinChunkSize = 32768;
+
 // Static helpers that implement the core logic for each of the 'TopK' operator flavor
 
-// Selects the top k elements (largest or smallest based on template parameter)
-template <class Comparator>
-static vector<pair<typename Comparator::DataType, int64_t>> select_top_k(
-    const ConstEigenMatrixMapRowMajor<typename Comparator::DataType>& raw_data, int64_t row_num, int64_t num_blocks,
-    int64_t block_slice, int64_t inter_block_offset, const unsigned k,
-    bool sort_top_k) {
-  // create a data holder and insert elements
-  vector<pair<typename Comparator::DataType, int64_t>> data_holder;
-  data_holder.reserve(num_blocks);
-  for (int64_t l = 0; l < num_blocks; ++l) {
-    data_holder.push_back({raw_data(row_num, l * block_slice + inter_block_offset), l});
+template <bool largest, typename T>
+static inline bool IsBetter(T value, T threshold) {
+  return largest ? value > threshold : value < threshold;
+}
+
+// Selects the top k (largest or smallest based on template parameter) of the 'n' values data[0], data[stride], ...
+// into the first k entries of 'candidates', ordered best first if 'sort_top_k'. Indices start at 'first_index'.
+// 'candidates' is scratch space that is reused for all the rows a thread processes.
+template <bool largest, class Comparator>
+static void select_top_k(const typename Comparator::DataType* data, int64_t n, int64_t stride, int64_t first_index,
+                         const unsigned k, bool sort_top_k,
+                         vector<pair<typename Comparator::DataType, int64_t>>& candidates) {
+  using T = typename Comparator::DataType;
+  const Comparator cmp;
+  candidates.clear();
+
+  auto n_casted = static_cast<double>(n);
+  auto k_casted = static_cast<double>(k);
+  const bool use_heap = n >= kTopKHeapRatio * static_cast<int64_t>(k) ||
+                        (sort_top_k && (n_casted + k_casted * log(k_casted)) >= (n_casted * log(k_casted)));
+
+  if (!use_heap) {
+    // Select first  - O(n), then sort O(k * ln(k)) if needed
+    for (int64_t l = 0; l < n; ++l) {
+      candidates.emplace_back(data[l * stride], first_index + l);
+    }
+    nth_element(candidates.begin(), candidates.begin() + (k - 1), candidates.end(), cmp);
+    if (sort_top_k) {
+      std::sort(candidates.begin(), candidates.begin() + k, cmp);
+    }
+    return;
   }
 
-  // find the top k (largest or smallest) elements in the data holder - O(n)
-  nth_element(data_holder.begin(), data_holder.begin() + (k - 1), data_holder.end(), Comparator());
+  // Pass the values over a heap of the best k values seen so far. The top of the heap is the worst of them, so a
+  // value only needs to be compared with that threshold to be skipped.
+  // Overall complexity = O(n * ln(k)) in the worst case, O(n) when few values pass the threshold
+  for (int64_t l = 0; l < static_cast<int64_t>(k); ++l) {
+    candidates.emplace_back(data[l * stride], first_index + l);
+  }
+  std::make_heap(candidates.begin(), candidates.end(), cmp);
+  T threshold = candidates.front().first;
+
+  auto insert = [&](int64_t l) {
+    std::pop_heap(candidates.begin(), candidates.end(), cmp);
+    candidates.back() = {data[l * stride], first_index + l};
+    std::push_heap(candidates.begin(), candidates.end(), cmp);
+    threshold = candidates.front().first;
+  };
+
+  int64_t l = k;
+  if (stride == 1) {
+    for (; l + kTopKScanBlock <= n; l += kTopKScanBlock) {
+      int hits = 0;
+      for (int64_t m = 0; m < kTopKScanBlock; ++m) {
+        hits += IsBetter<largest>(data[l + m], threshold);
+      }
+      if (hits != 0) {
+        for (int64_t m = l; m < l + kTopKScanBlock; ++m) {
+          if (IsBetter<largest>(data[m], threshold)) {
+            insert(m);
+          }
+        }
+      }
+    }
+  }
+  for (; l < n; ++l) {
+    // a value equal to the threshold comes later, so it has a lower priority
+    if (IsBetter<largest>(data[l * stride], threshold)) {
+      insert(l);
+    }
+  }
 
-  // sort the top k elements if needed - O (k log k)
   if (sort_top_k) {
-    std::sort(data_holder.begin(), data_holder.begin() + k, Comparator());
+    std::sort_heap(candidates.begin(), candidates.end(), cmp);
   }
-
-  // the data_holder now contains the top k elements in the first k indices
-  return data_holder;
 }
 
 // Given an input tensor 'input' and metadata values - 'k' and 'axis_parsed',
-// this method will extract the sorted top k largest/smallest elements and place them in the output tensor 'values'
-// along with the metadata output 'indices'
-template <bool largest, bool sorted, class Comparator>
+// this method will extract the top k largest/smallest elements (sorted if 'sorted') and place them in the output
+// tensor 'values' along with the metadata output 'indices'. Rows are processed in parallel on the thread pool.
+template <bool largest, class Comparator>
 static void extract_top_k_elements(const Tensor* input, const TensorShape& input_shape, Tensor* values,
                                    Tensor* indices, const TensorShape& output_shape, const unsigned k,
-                                   const unsigned axis_parsed) {
+                                   const bool sorted, const unsigned axis_parsed, concurrency::ThreadPool* tp) {
+  using T = typename Comparator::DataType;
+  using Candidates = vector<pair<T, int64_t>>;
+
   // Cache some values that will be used in the implementation below
   const int64_t rows = input_shape.SizeToDimension(static_cast<size_t>(axis_parsed));
   const int64_t cols = input->Shape().Size() / rows;
-  auto input_map =
-      ConstEigenMatrixMapRowMajor<typename Comparator::DataType>(
-          static_cast<const typename Comparator::DataType*>(input->template Data<typename Comparator::DataType>()), rows, cols);
+  const T* input_data = input->template Data<T>();
 
-  // Use Eigen maps to allow indexing into the 2d tensors like Values_map(i,j)
   const int64_t reduced_cols = output_shape.SizeFromDimension(static_cast<size_t>(axis_parsed));
-  auto values_map = EigenMatrixMapRowMajor<typename Comparator::DataType>(
-      values->template MutableData<typename Comparator::DataType>(), rows, reduced_cols);
-  auto indices_map = EigenMatrixMapRowMajor<int64_t>(indices->template MutableData<int64_t>(), rows, reduced_cols);
+  T* values_data = values->template MutableData<T>();
+  int64_t* indices_data = indices->template MutableData<int64_t>();
 
   // This is basically the number of elements within each of the "k" rows
   const int64_t block_slice = reduced_cols / k;
   const int64_t num_blocks = input_shape[axis_parsed];
 
-  for (int64_t i = 0; i < rows; ++i) {
-    for (int64_t j = 0; j < block_slice; ++j) {
-      // Since sorted == true, we will use a Heap to hold the top K values in sorted fashion
-      if (sorted) {  // The optimizer will clean-up the redundant condition based on the template parameter 'sorted'
-        auto n_casted = static_cast<double>(num_blocks);
-        auto k_casted = static_cast<double>(k);
-        if ((n_casted + k_casted * log(k_casted)) < (n_casted * log(k_casted))) {
-          // Select first  - O(n), then sort O(k * ln(k))
-          // Overall complexity =  O (n + k * ln(k))
-          const auto& data_holder = select_top_k<Comparator>(input_map, i, num_blocks, block_slice, j, k, true);
-          for (int64_t l = 0; l < k; ++l) {
-            const auto& elem = data_holder[l];
-            auto col_index = l * block_slice + j;
-            values_map(i, col_index) = elem.first;
-            indices_map(i, col_index) = elem.second;
-          }
-        } else {
-          // Perform sorted selection by passing 'n' elements over a heap of size 'k'
-          // overall complexity =  O (n * ln(k))
-
-          // Build a min-heap/max-heap, the heap element is pair of (value, idx)
-          // The top of the heap is the smallest/largest value depending on whether it is a min-heap/max-heap
-          // This is a min-heap if largest == true, this is a max-heap if largest == false
-          priority_queue<pair<typename Comparator::DataType, int64_t>, vector<pair<typename Comparator::DataType, int64_t>>, Comparator> heap;
-
-          // Maintain the size of heap to be less or equal to k, so the
-          // heap will hold the k largest/smallest values
-          for (int64_t l = 0; l < num_blocks; ++l) {
-            const auto value = input_map(i, l * block_slice + j);
-            // largest == true: insert into the min-heap if the size is < k or if the new
-            // element is greater than the min element in the min-heap
-
-            // largest == false: insert into the min-heap if the size is < k or if the new
-            // element is lesser than the max element in the max-heap
-            if ((heap.size() < k) || (largest && value > heap.top().first) ||
-                (!largest && value < heap.top().first)) {  // the optimizer will clean-up the redundant condition based
-                                                           // on the template parameter 'largest'
-              heap.push({value, l});
-            }
-            if (heap.size() > k) {
-              heap.pop();
-            }
-          }
-          // Extract these k elements and place them in the results placeholder
-          for (int64_t l = 0; l < k; ++l) {
-            const auto& elem = heap.top();
-            auto col_index = (k - l - 1) * block_slice + j;
-            values_map(i, col_index) = elem.first;
-            indices_map(i, col_index) = elem.second;
-            heap.pop();
-          }
-        }
-      } else {  // sorted == false
-        // The optimizer will clean-up the redundant condition based on the template parameter 'sorted'
-
-        // If the top K values are not required to be sorted, we use a more optimal selection algorithm
-        // Average - O(n). Worst - O(n * ln(n)) or O(n^2) depending on the implementation, where 'n' is the number of input
-
-        const auto& data_holder = select_top_k<Comparator>(input_map, i, num_blocks, block_slice, j, k, false);
-
-        // Insert the top 'k' (largest or smallest) elements into the final output buffers
-        for (int64_t l = 0; l < k; ++l) {
-          const auto& elem = data_holder[l];
-          auto col_index = l * block_slice + j;
-          values_map(i, col_index) = elem.first;
-          indices_map(i, col_index) = elem.second;
+  // Every (row, offset within the block) pair selects the top k of 'num_blocks' values 'block_slice' apart
+  const int64_t slice_count = rows * block_slice;
+  auto write_output = [&](int64_t slice, const Candidates& candidates) {
+    const int64_t i = slice / block_slice;
+    const int64_t j = slice % block_slice;
+    T* slice_values = values_data + i * reduced_cols + j;
+    int64_t* slice_indices = indices_data + i * reduced_cols + j;
+    for (int64_t l = 0; l < static_cast<int64_t>(k); ++l) {
+      slice_values[l * block_slice] = candidates[l].first;
+      slice_indices[l * block_slice] = candidates[l].second;
+    }
+  };
+  auto slice_data = [&](int64_t slice) {
+    return input_data + (slice / block_slice) * cols + slice % block_slice;
+  };
+
+  const int64_t thread_count = tp == nullptr ? 1 : tp->NumThreads();
+  if (slice_count < thread_count && num_blocks >= 2 * kTopKMinChunkSize &&
+      num_blocks >= kTopKHeapRatio * static_cast<int64_t>(k)) {
+    // Few long rows: select the top k of each chunk of a row in parallel, then select the top k of the candidates
+    // of all the chunks of the row. The comparators break ties by index, so the result is the same as selecting
+    // over the whole row.
+    const int64_t chunks_per_slice = std::max<int64_t>(
+        std::min<int64_t>(num_blocks / kTopKMinChunkSize, (4 * thread_count + slice_count - 1) / slice_count), 1);
+    const int64_t chunk_size = (num_blocks + chunks_per_slice - 1) / chunks_per_slice;
+    const int64_t chunk_count = slice_count * chunks_per_slice;
+
+    Candidates chunk_candidates(static_cast<size_t>(chunk_count * k));
+    vector<int64_t> chunk_candidate_counts(static_cast<size_t>(chunk_count));
+
+    const TensorOpCost chunk_cost{static_cast<double>(chunk_size * sizeof(T)),
+                                  static_cast<double>(k * sizeof(pair<T, int64_t>)),
+                                  static_cast<double>(chunk_size)};
+    concurrency::ThreadPool::TryParallelFor(tp, chunk_count, chunk_cost, [&](ptrdiff_t first, ptrdiff_t last) {
+      Candidates candidates;
+      for (ptrdiff_t chunk = first; chunk < last; ++chunk) {
+        const int64_t slice = chunk / chunks_per_slice;
+        const int64_t begin = (chunk % chunks_per_slice) * chunk_size;
+        const int64_t size = std::min(chunk_size, num_blocks - begin);
+        const int64_t count = std::min<int64_t>(size, k);
+        if (count <= 0) {
+          chunk_candidate_counts[chunk] = 0;
+          continue;
         }
+        select_top_k<largest, Comparator>(slice_data(slice) + begin * block_slice, size, block_slice, begin,
+                                          static_cast<unsigned>(count), false, candidates);
+        std::copy(candidates.begin(), candidates.begin() + count, chunk_candidates.begin() + chunk * k);
+        chunk_candidate_counts[chunk] = count;
+      }
+    });
+
+    Candidates candidates;
+    for (int64_t slice = 0; slice < slice_count; ++slice) {
+      candidates.clear();
+      for (int64_t chunk = slice * chunks_per_slice; chunk < (slice + 1) * chunks_per_slice; ++chunk) {
+        auto chunk_begin = chunk_candidates.begin() + chunk * k;
+        candidates.insert(candidates.end(), chunk_begin, chunk_begin + chunk_candidate_counts[chunk]);
       }
+      nth_element(candidates.begin(), candidates.begin() + (k - 1), candidates.end(), Comparator());
+      if (sorted) {
+        std::sort(candidates.begin(), candidates.begin() + k, Comparator());
+      }
+      write_output(slice, candidates);
     }
+    return;
   }
+
+  const TensorOpCost slice_cost{static_cast<double>(num_blocks * sizeof(T)),
+                                static_cast<double>(k * (sizeof(T) + sizeof(int64_t))),
+                                static_cast<double>(num_blocks)};
+  concurrency::ThreadPool::TryParallelFor(tp, slice_count, slice_cost, [&](ptrdiff_t first, ptrdiff_t last) {
+    Candidates candidates;
+    for (ptrdiff_t slice = first; slice < last; ++slice) {
+      select_top_k<largest, Comparator>(slice_data(slice), num_blocks, block_slice, 0, k, sorted, candidates);
+      write_output(slice, candidates);
+    }
+  });
 }
 
 // Wrapper over core TopK implementation
@@ -204,22 +273,15 @@ static Status TopKImpl(OpKernelContext* p_op_kernel_context, const Tensor* input
     return Status::OK();
   }
 
-  if (sorted && largest) {
-    // extract sorted largest TopK elements
-    extract_top_k_elements<true, true, GreaterValueCmp<T>>(input, input_shape, values, indices, output_shape, k,
-                                                           gsl::narrow_cast<unsigned>(axis_parsed));
-  } else if (sorted && !largest) {
-    // extract sorted smallest TopK elements
-    extract_top_k_elements<false, true, LesserValueCmp<T>>(input, input_shape, values, indices, output_shape, k,
-                                                           gsl::narrow_cast<unsigned>(axis_parsed));
-  } else if (largest) {
-    // extract unsorted (order undefined) largest TopK elements
-    extract_top_k_elements<true, false, GreaterValueCmp<T>>(input, input_shape, values, indices, output_shape, k,
-                                                            gsl::narrow_cast<unsigned>(axis_parsed));
+  concurrency::ThreadPool* tp = p_op_kernel_context->GetOperatorThreadPool();
+  if (largest) {
+    // extract largest TopK elements
+    extract_top_k_elements<true, GreaterValueCmp<T>>(input, input_shape, values, indices, output_shape, k, sorted,
+                                                     gsl::narrow_cast<unsigned>(axis_parsed), tp);
   } else {
-    // extract unsorted (order undefined) smallest TopK elements
-    extract_top_k_elements<false, false, LesserValueCmp<T>>(input, input_shape, values, indices, output_shape, k,
-                                                            gsl::narrow_cast<unsigned>(axis_parsed));
+    // extract smallest TopK elements
+    extract_top_k_elements<false, LesserValueCmp<T>>(input, input_shape, values, indices, output_shape, k, sorted,
+                                                     gsl::narrow_cast<unsigned>(axis_parsed), tp);
   }
 
   return Status::OK();
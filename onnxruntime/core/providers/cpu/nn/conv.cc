@@ -160,6 +160,29 @@ Status Conv<T>::Compute(OpKernelContext* context) const {
   return Status::OK();
 }
 
+std::shared_ptr<const std::vector<float>> Conv<float>::GetTransformedFilter(const MLAS_CONV_PARAMETERS& parameters,
+                                                                            const float* filter) const {
+  const size_t transformed_filter_size = MlasConvTransformedFilterSize(&parameters);
+
+  std::lock_guard<OrtMutex> lock(transformed_filter_mutex_);
+  if (transformed_filter_ != nullptr && transformed_filter_source_ == filter &&
+      transformed_filter_algorithm_ == parameters.Algorithm &&
+      transformed_filter_tile_ == parameters.u.Winograd.OutputTile) {
+    return transformed_filter_;
+  }
+
+  // The filter is constant, so the transformed filter only changes with the
+  // algorithm and its tile size, which depend on the input shape.
+  auto transformed_filter = std::make_shared<std::vector<float>>(transformed_filter_size);
+  MlasConvTransformFilter(&parameters, filter, transformed_filter->data());
+
+  transformed_filter_ = transformed_filter;
+  transformed_filter_source_ = filter;
+  transformed_filter_algorithm_ = parameters.Algorithm;
+  transformed_filter_tile_ = parameters.u.Winograd.OutputTile;
+  return transformed_filter_;
+}
+
 Status Conv<float>::Compute(OpKernelContext* context) const {
   size_t num_inputs = OpKernel::Node().InputDefs().size();
   const auto* X = context->Input<Tensor>(0);
@@ -226,6 +249,14 @@ Status Conv<float>::Compute(OpKernelContext* context) const {
                     &WorkingBufferSize,
                     thread_pool);
 
+    // A cached transformed filter does not need space in the working buffer.
+    std::shared_ptr<const std::vector<float>> transformed_filter;
+    if (filter_is_constant_ && MlasConvTransformedFilterSize(&Parameters) > 0) {
+      transformed_filter = GetTransformedFilter(Parameters, W->template Data<float>());
+      Parameters.u.Winograd.TransformedFilter = transformed_filter->data();
+      WorkingBufferSize -= transformed_filter->size();
+    }
+
     auto* working_data = WorkingBufferSize > 0 ? alloc->Alloc(SafeInt<size_t>(sizeof(float)) * WorkingBufferSize)
                                                : nullptr;
     BufferUniquePtr working_buffer(working_data, BufferDeleter(alloc));
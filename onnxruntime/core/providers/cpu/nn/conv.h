@@ -4,6 +4,7 @@
 #pragma once
 
 #include "core/framework/op_kernel.h"
+#include "core/platform/ort_mutex.h"
 #include "core/providers/cpu/nn/conv_attributes.h"
 #include "core/mlas/inc/mlas.h"
 
@@ -26,6 +27,9 @@ class Conv<float> : public OpKernel {
  public:
   Conv<float>(const OpKernelInfo& info) : OpKernel(info), conv_attrs_(info) {
     activation_.ActivationKind = MlasIdentityActivation;
+
+    const Tensor* W;
+    filter_is_constant_ = info.TryGetConstantInput(1, &W);
   }
 
   Status Compute(OpKernelContext* context) const override;
@@ -34,6 +38,19 @@ class Conv<float> : public OpKernel {
   MLAS_ACTIVATION activation_;
 
   ConvAttributes conv_attrs_;
+
+ private:
+  // Transforms a constant filter for the MLAS algorithm selected by the parameters, once per algorithm and tile size.
+  std::shared_ptr<const std::vector<float>> GetTransformedFilter(const MLAS_CONV_PARAMETERS& parameters,
+                                                                 const float* filter) const;
+
+  bool filter_is_constant_{false};
+  mutable std::shared_ptr<const std::vector<float>> transformed_filter_;
+  // The filter, algorithm and tile size that transformed_filter_ was computed for
+  mutable const float* transformed_filter_source_{nullptr};
+  mutable MLAS_CONV_ALGORITHM transformed_filter_algorithm_{MlasConvAlgorithmGemmDirect};
+  mutable size_t transformed_filter_tile_{0};
+  mutable OrtMutex transformed_filter_mutex_;
 };
 
 }  // namespace onnxruntime
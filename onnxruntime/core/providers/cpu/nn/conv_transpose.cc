@@ -40,6 +40,23 @@ Status ConvTranspose<T>::Compute(OpKernelContext* context) const {
   return ConvTranspose<T>::DoConvTranspose(context, false);
 }
 
+template <typename T>
+std::shared_ptr<const std::vector<float>> ConvTranspose<T>::GetTransformedFilter(const MLAS_CONV_PARAMETERS& parameters,
+                                                                                 const float* filter) const {
+  const size_t transformed_filter_size = MlasConvTransformedFilterSize(&parameters);
+
+  std::lock_guard<OrtMutex> lock(transformed_filter_mutex_);
+  if (transformed_filter_ != nullptr && transformed_filter_->size() == transformed_filter_size) {
+    return transformed_filter_;
+  }
+
+  auto transformed_filter = std::make_shared<std::vector<float>>(transformed_filter_size);
+  MlasConvTransformFilter(&parameters, filter, transformed_filter->data());
+
+  transformed_filter_ = transformed_filter;
+  return transformed_filter_;
+}
+
 template <typename T>
 Status ConvTranspose<T>::DoConvTranspose(OpKernelContext* context, bool dynamic_padding) const {
   concurrency::ThreadPool* thread_pool = context->GetOperatorThreadPool();
@@ -49,6 +66,64 @@ Status ConvTranspose<T>::DoConvTranspose(OpKernelContext* context, bool dynamic_
   bool has_bias = dynamic_padding ? num_inputs == 4 : num_inputs == 3;
   ORT_RETURN_IF_ERROR(conv_transpose_attrs_.PrepareForCompute(context, has_bias, p, dynamic_padding));
 
+  // Bail out early if one of the dimensions is zero.
+  if (p.Y->Shape().Size() == 0) {
+    return Status::OK();
+  }
+
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+
+  const T* Xdata = p.X->template Data<T>();
+  const T* filter_data = p.F->template Data<T>();
+  T* Ydata = p.Y->template MutableData<T>();
+
+  const size_t kernel_rank = p.kernel_shape.size();
+
+  if (kernel_rank >= 1 && kernel_rank <= 2) {
+    // The transposed convolution is decomposed into a stride 1 convolution per
+    // output phase, which computes and stores blocks of the output directly.
+    MLAS_CONV_PARAMETERS Parameters;
+    size_t WorkingBufferSize;
+    MlasConvTransposePrepare(&Parameters,
+                             kernel_rank,
+                             static_cast<size_t>(p.N),
+                             static_cast<size_t>(conv_transpose_attrs_.group),
+                             static_cast<size_t>(p.num_input_channels / conv_transpose_attrs_.group),
+                             p.input_shape.GetDims().data(),
+                             p.kernel_shape.data(),
+                             p.dilations.data(),
+                             p.pads.data(),
+                             p.strides.data(),
+                             p.Y->Shape().GetDims().data() + 2,
+                             static_cast<size_t>(p.num_output_channels / conv_transpose_attrs_.group),
+                             &activation_,
+                             &WorkingBufferSize,
+                             thread_pool);
+
+    // A cached packed filter does not need space in the working buffer.
+    std::shared_ptr<const std::vector<float>> transformed_filter;
+    if (filter_is_constant_) {
+      transformed_filter = GetTransformedFilter(Parameters, filter_data);
+      Parameters.u.ConvTranspose.TransformedFilter = transformed_filter->data();
+      WorkingBufferSize -= transformed_filter->size();
+    }
+
+    auto* working_data = WorkingBufferSize > 0 ? alloc->Alloc(SafeInt<size_t>(sizeof(float)) * WorkingBufferSize)
+                                               : nullptr;
+    BufferUniquePtr working_buffer(working_data, BufferDeleter(alloc));
+
+    MlasConvTranspose(&Parameters,
+                      Xdata,
+                      filter_data,
+                      p.B != nullptr ? p.B->template Data<T>() : nullptr,
+                      static_cast<float*>(working_buffer.get()),
+                      Ydata,
+                      thread_pool);
+
+    return Status::OK();
+  }
+
   const int64_t input_image_size = p.input_shape.Size();
   const int64_t X_offset = p.num_input_channels / conv_transpose_attrs_.group * input_image_size;
   const int64_t Y_offset = p.Y->Shape().Size() / p.Y->Shape()[0] / conv_transpose_attrs_.group;
@@ -57,112 +132,57 @@ Status ConvTranspose<T>::DoConvTranspose(OpKernelContext* context, bool dynamic_
   const int64_t kernel_dim = p.num_output_channels / conv_transpose_attrs_.group * kernel_size;
   const int64_t output_size = (p.Y->Shape().Slice(2)).Size();
 
-  AllocatorPtr alloc;
-  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
-
   const int64_t col_buffer_size = kernel_dim * p.input_shape.Size();
   auto col_data = alloc->Alloc(SafeInt<size_t>(sizeof(T)) * col_buffer_size);
   BufferUniquePtr col_buffer(col_data, BufferDeleter(alloc));
   T* col_buffer_data = static_cast<T*>(col_buffer.get());
 
-  const T* Xdata = p.X->template Data<T>();
-  const T* filter_data = p.F->template Data<T>();
-  T* Ydata = p.Y->template MutableData<T>();
-
   std::vector<int64_t> col_buffer_shape{kernel_dim};
   col_buffer_shape.insert(col_buffer_shape.end(), p.input_shape.GetDims().begin(), p.input_shape.GetDims().end());
 
-  if (p.X->Shape().NumDimensions() == 4) {
-    for (auto image_id = 0; image_id < p.N; ++image_id) {
-      for (int group_id = 0; group_id < conv_transpose_attrs_.group; ++group_id) {
-        // Weight term
-        math::Gemm<T>(
-            CblasTrans,
-            CblasNoTrans,
-            kernel_dim,
-            input_image_size,
-            p.num_input_channels / conv_transpose_attrs_.group,
-            1,
-            filter_data + group_id * W_offset,
-            Xdata + group_id * X_offset,
-            0,
-            col_buffer_data,
-            thread_pool);
-
-        // Col2im
-        math::Col2im<T, CPUMathUtil, StorageOrder::NCHW>(
-            col_buffer_data,
-            p.num_output_channels / conv_transpose_attrs_.group,
-            p.Y->Shape()[2],
-            p.Y->Shape()[3],
-            p.kernel_shape[0],
-            p.kernel_shape[1],
-            p.dilations[0],
-            p.dilations[1],
-            p.pads[0],
-            p.pads[1],
-            p.pads[2],
-            p.pads[3],
-            p.strides[0],
-            p.strides[1],
-            Ydata + group_id * Y_offset,
-            &CPUMathUtil::Instance());
-      }
-
-      if (p.B != nullptr) {
-        auto Ymatrix = EigenMatrixMap<T>(Ydata, output_size, p.num_output_channels);
-        auto Bvec = ConstEigenVectorMap<T>(p.B->template Data<T>(), p.num_output_channels);
-        Ymatrix.rowwise() += Bvec.transpose();
-      }
-
-      Xdata += X_offset * conv_transpose_attrs_.group;
-      Ydata += Y_offset * conv_transpose_attrs_.group;
+  TensorShape output_shape = p.Y->Shape().Slice(1);
+  output_shape[0] = output_shape[0] / conv_transpose_attrs_.group;
+
+  for (auto image_id = 0; image_id < p.N; ++image_id) {
+    for (int group_id = 0; group_id < conv_transpose_attrs_.group; ++group_id) {
+      // Weight term
+      math::Gemm<T>(
+          CblasTrans,
+          CblasNoTrans,
+          kernel_dim,
+          input_image_size,
+          p.num_input_channels / conv_transpose_attrs_.group,
+          1,
+          filter_data + group_id * W_offset,
+          Xdata + group_id * X_offset,
+          0,
+          col_buffer_data,
+          thread_pool);
+
+      // Col2im
+      math::Col2imNd<T, CPUMathUtil, StorageOrder::NCHW>(
+          col_buffer_data,
+          output_shape.GetDims().data(),
+          col_buffer_shape.data(),
+          output_shape.Size(),
+          col_buffer_size,
+          p.kernel_shape.data(),
+          p.strides.data(),
+          p.dilations.data(),
+          p.pads.data(),
+          static_cast<int>(p.kernel_shape.size()),
+          Ydata + group_id * Y_offset,
+          &CPUMathUtil::Instance());
     }
-  } else {
-    TensorShape output_shape = p.Y->Shape().Slice(1);
-    output_shape[0] = output_shape[0] / conv_transpose_attrs_.group;
-
-    for (auto image_id = 0; image_id < p.N; ++image_id) {
-      for (int group_id = 0; group_id < conv_transpose_attrs_.group; ++group_id) {
-        // Weight term
-        math::Gemm<T>(
-            CblasTrans,
-            CblasNoTrans,
-            kernel_dim,
-            input_image_size,
-            p.num_input_channels / conv_transpose_attrs_.group,
-            1,
-            filter_data + group_id * W_offset,
-            Xdata + group_id * X_offset,
-            0,
-            col_buffer_data,
-            thread_pool);
-
-        // Col2im
-        math::Col2imNd<T, CPUMathUtil, StorageOrder::NCHW>(
-            col_buffer_data,
-            output_shape.GetDims().data(),
-            col_buffer_shape.data(),
-            output_shape.Size(),
-            col_buffer_size,
-            p.kernel_shape.data(),
-            p.strides.data(),
-            p.dilations.data(),
-            p.pads.data(),
-            static_cast<int>(p.kernel_shape.size()),
-            Ydata + group_id * Y_offset,
-            &CPUMathUtil::Instance());
-      }
-
-      if (p.B != nullptr) {
-        auto Ymatrix = EigenMatrixMap<T>(Ydata, output_size, p.num_output_channels);
-        auto Bvec = ConstEigenVectorMap<T>(p.B->template Data<T>(), p.num_output_channels);
-        Ymatrix.rowwise() += Bvec.transpose();
-      }
-
-      Xdata += X_offset * conv_transpose_attrs_.group;
-      Ydata += Y_offset * conv_transpose_attrs_.group;
+
+    if (p.B != nullptr) {
+      auto Ymatrix = EigenMatrixMap<T>(Ydata, output_size, p.num_output_channels);
+      auto Bvec = ConstEigenVectorMap<T>(p.B->template Data<T>(), p.num_output_channels);
+      Ymatrix.rowwise() += Bvec.transpose();
     }
+
+    Xdata += X_offset * conv_transpose_attrs_.group;
+    Ydata += Y_offset * conv_transpose_attrs_.group;
   }
 
   return Status::OK();
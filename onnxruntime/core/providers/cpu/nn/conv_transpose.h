@@ -18,22 +18,39 @@
 #pragma once
 
 #include "core/framework/op_kernel.h"
+#include "core/platform/ort_mutex.h"
 #include "core/providers/cpu/nn/conv_transpose_attributes.h"
+#include "core/mlas/inc/mlas.h"
 
 namespace onnxruntime {
 
 template <typename T>
 class ConvTranspose : public OpKernel {
  public:
-  ConvTranspose(const OpKernelInfo& info) : OpKernel(info), conv_transpose_attrs_(info) {}
+  ConvTranspose(const OpKernelInfo& info) : OpKernel(info), conv_transpose_attrs_(info) {
+    activation_.ActivationKind = MlasIdentityActivation;
+
+    const Tensor* W;
+    filter_is_constant_ = info.TryGetConstantInput(1, &W);
+  }
 
   Status Compute(OpKernelContext* context) const override;
 
  protected:
   Status DoConvTranspose(OpKernelContext* context, bool dynamic_padding) const;
 
+  MLAS_ACTIVATION activation_;
+
  private:
+  // Repacks a constant filter for the MLAS transposed convolution once.
+  std::shared_ptr<const std::vector<float>> GetTransformedFilter(const MLAS_CONV_PARAMETERS& parameters,
+                                                                 const float* filter) const;
+
   ConvTransposeAttributes conv_transpose_attrs_;
+
+  bool filter_is_constant_{false};
+  mutable std::shared_ptr<const std::vector<float>> transformed_filter_;
+  mutable OrtMutex transformed_filter_mutex_;
 };
 
 }  // namespace onnxruntime
@@ -35,13 +35,10 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
   auto Y_zero_point = context->Input<Tensor>(7);
   ORT_ENFORCE(IsScalarOr1ElementVector(X_zero_point),
               "QLinearConv : input zero point must be a scalar or 1D tensor of size 1");
-  ORT_ENFORCE(IsScalarOr1ElementVector(W_zero_point),
-              "QLinearConv : filter zero point must be a scalar or 1D tensor of size 1");
   ORT_ENFORCE(IsScalarOr1ElementVector(Y_zero_point),
               "QLinearConv : result zero point must be a scalar or 1D tensor of size 1");
 
   auto X_zero_point_value = *(X_zero_point->template Data<uint8_t>());
-  auto W_zero_point_value = *(W_zero_point->template Data<uint8_t>());
   auto Y_zero_point_value = *(Y_zero_point->template Data<uint8_t>());
 
   // validate scale
@@ -50,13 +47,10 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
   auto Y_scale = context->Input<Tensor>(6);
   ORT_ENFORCE(IsScalarOr1ElementVector(X_scale),
               "QLinearConv : input scale must be a scalar or 1D tensor of size 1");
-  ORT_ENFORCE(IsScalarOr1ElementVector(W_scale),
-              "QLinearConv : filter scale must be a scalar or 1D tensor of size 1");
   ORT_ENFORCE(IsScalarOr1ElementVector(Y_scale),
               "QLinearConv : result scale must be a scalar or 1D tensor of size 1");
 
   auto X_scale_value = *(X_scale->template Data<float>());
-  auto W_scale_value = *(W_scale->template Data<float>());
   auto Y_scale_value = *(Y_scale->template Data<float>());
 
   size_t num_inputs = OpKernel::Node().InputDefs().size();
@@ -70,6 +64,40 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
   const int64_t M = W->Shape()[0];
   ORT_RETURN_IF_ERROR(conv_attrs_.ValidateInputShape(X, W));
 
+  // The filter scale and zero point may be supplied per output channel.
+  auto is_valid_per_channel = [M](const Tensor* t) {
+    return IsScalarOr1ElementVector(t) ||
+           (t->Shape().NumDimensions() == 1 && t->Shape()[0] == M);
+  };
+  ORT_ENFORCE(is_valid_per_channel(W_zero_point),
+              "QLinearConv : filter zero point must be a scalar, a 1D tensor of size 1, or a 1D tensor with one "
+              "element per output channel");
+  ORT_ENFORCE(is_valid_per_channel(W_scale),
+              "QLinearConv : filter scale must be a scalar, a 1D tensor of size 1, or a 1D tensor with one "
+              "element per output channel");
+
+  const auto* W_zero_point_data = W_zero_point->template Data<uint8_t>();
+  const auto* W_scale_data = W_scale->template Data<float>();
+  const bool is_per_channel_scale = !IsScalarOr1ElementVector(W_scale);
+  const bool is_per_channel_zero_point = !IsScalarOr1ElementVector(W_zero_point);
+
+  // Use the filter zero point as the GEMM offset if all output channels share
+  // the same value, otherwise adjust the GEMM result after the fact.
+  uint8_t W_zero_point_value = W_zero_point_data[0];
+  const uint8_t* W_zero_points = nullptr;
+  if (is_per_channel_zero_point && !IsUniformZeroPoint(W_zero_point_data, static_cast<size_t>(M))) {
+    W_zero_point_value = 0;
+    W_zero_points = W_zero_point_data;
+  }
+
+  // Platforms without the MLAS integer GEMM requantize per tensor outputs with
+  // GEMMLOWP. Per-channel quantization always requantizes with MLAS.
+#ifdef MLAS_SUPPORTS_GEMM_U8X8
+  const bool use_gemmlowp = false;
+#else
+  const bool use_gemmlowp = !is_per_channel_scale && (W_zero_points == nullptr);
+#endif
+
   std::vector<int64_t> kernel_shape;
   ORT_RETURN_IF_ERROR(conv_attrs_.ComputeKernelShape(W->Shape(), kernel_shape));
 
@@ -132,19 +160,37 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
 
   auto* col_buffer_data = static_cast<uint8_t*>(col_buffer.get());
 
-  const float real_multiplier = (X_scale_value * W_scale_value) / Y_scale_value;
+  // Build the requantization multipliers for each output channel.
+  std::vector<float> real_multipliers(static_cast<size_t>(M));
+  for (int64_t m = 0; m < M; m++) {
+    real_multipliers[m] = (X_scale_value * W_scale_data[is_per_channel_scale ? m : 0]) / Y_scale_value;
+  }
 
-#ifdef MLAS_SUPPORTS_GEMM_U8X8
   // Use an intermediate int32_t buffer for the GEMM computation before
   // requantizing to the output type.
-  auto gemm_output_data = alloc->Alloc(SafeInt<size_t>(sizeof(int32_t)) * Y_offset);
-  BufferUniquePtr gemm_output_buffer(gemm_output_data, BufferDeleter(alloc));
-  auto* gemm_output = static_cast<int32_t*>(gemm_output_buffer.get());
-#else
+  BufferUniquePtr gemm_output_buffer;
+  int32_t* gemm_output = nullptr;
+  if (!use_gemmlowp) {
+    auto gemm_output_data = alloc->Alloc(SafeInt<size_t>(sizeof(int32_t)) * Y_offset);
+    gemm_output_buffer = BufferUniquePtr(gemm_output_data, BufferDeleter(alloc));
+    gemm_output = static_cast<int32_t*>(gemm_output_buffer.get());
+  }
+
+  // Per channel filter zero points are applied after the GEMM using the sums
+  // of the columns of the GEMM's right hand side.
+  BufferUniquePtr column_sums_buffer;
+  int32_t* column_sums = nullptr;
+  if (!use_gemmlowp && W_zero_points != nullptr) {
+    auto column_sums_data = alloc->Alloc(SafeInt<size_t>(sizeof(int32_t)) * output_image_size);
+    column_sums_buffer = BufferUniquePtr(column_sums_data, BufferDeleter(alloc));
+    column_sums = static_cast<int32_t*>(column_sums_buffer.get());
+  }
+
+#ifndef MLAS_SUPPORTS_GEMM_U8X8
   // Compute the fixed point multiplier and shift for requantizing with GEMMLOWP.
   int32_t integer_multiplier;
   int right_shift;
-  QuantizeMultiplier(real_multiplier, &integer_multiplier, &right_shift);
+  QuantizeMultiplier(real_multipliers[0], &integer_multiplier, &right_shift);
 #endif
 
   const auto* Xdata = X->template Data<uint8_t>();
@@ -191,41 +237,59 @@ Status QLinearConv::Compute(OpKernelContext* context) const {
         }
       }
 
-#ifdef MLAS_SUPPORTS_GEMM_U8X8
-      QGemmu8u8_s32(static_cast<int>(M / conv_attrs_.group),
-                    static_cast<int>(output_image_size),
-                    static_cast<int>(kernel_dim),
-                    Wdata + group_id * W_offset,
-                    static_cast<int>(kernel_dim),
-                    W_zero_point_value,
-                    col_buffer_data == nullptr ? Xdata : col_buffer_data,
-                    static_cast<int>(output_image_size),
-                    X_zero_point_value,
-                    gemm_output,
-                    static_cast<int>(output_image_size),
-                    context->GetOperatorThreadPool());
-
-      MlasRequantizeOutput(gemm_output,
-                           Ydata,
-                           Bdata != nullptr ? Bdata + group_id * B_offset : nullptr,
-                           static_cast<size_t>(M / conv_attrs_.group),
-                           static_cast<size_t>(output_image_size),
-                           real_multiplier,
-                           Y_zero_point_value);
-#else
-      GemmlowpMultiplyu8u8_u8(Wdata + group_id * W_offset,
-                              col_buffer_data == nullptr ? Xdata : col_buffer_data,
-                              Ydata,
-                              W_zero_point_value,
-                              X_zero_point_value,
-                              Y_zero_point_value,
-                              static_cast<int>(M / conv_attrs_.group),
-                              static_cast<int>(output_image_size),
-                              static_cast<int>(kernel_dim),
-                              integer_multiplier,
-                              right_shift,
-                              Bdata != nullptr ? Bdata + group_id * B_offset : nullptr);
+      const uint8_t* gemm_rhs_data = col_buffer_data == nullptr ? Xdata : col_buffer_data;
+
+      if (use_gemmlowp) {
+#ifndef MLAS_SUPPORTS_GEMM_U8X8
+        GemmlowpMultiplyu8u8_u8(Wdata + group_id * W_offset,
+                                gemm_rhs_data,
+                                Ydata,
+                                W_zero_point_value,
+                                X_zero_point_value,
+                                Y_zero_point_value,
+                                static_cast<int>(M / conv_attrs_.group),
+                                static_cast<int>(output_image_size),
+                                static_cast<int>(kernel_dim),
+                                integer_multiplier,
+                                right_shift,
+                                Bdata != nullptr ? Bdata + group_id * B_offset : nullptr);
 #endif
+      } else {
+        QGemmu8u8_s32(static_cast<int>(M / conv_attrs_.group),
+                      static_cast<int>(output_image_size),
+                      static_cast<int>(kernel_dim),
+                      Wdata + group_id * W_offset,
+                      static_cast<int>(kernel_dim),
+                      W_zero_point_value,
+                      gemm_rhs_data,
+                      static_cast<int>(output_image_size),
+                      X_zero_point_value,
+                      gemm_output,
+                      static_cast<int>(output_image_size),
+                      context->GetOperatorThreadPool());
+
+        if (W_zero_points != nullptr) {
+          QGemmApplyRowZeroPoints(static_cast<int>(M / conv_attrs_.group),
+                                  static_cast<int>(output_image_size),
+                                  static_cast<int>(kernel_dim),
+                                  W_zero_points + group_id * B_offset,
+                                  gemm_rhs_data,
+                                  static_cast<int>(output_image_size),
+                                  X_zero_point_value,
+                                  column_sums,
+                                  gemm_output,
+                                  static_cast<int>(output_image_size));
+        }
+
+        MlasRequantizeOutput(gemm_output,
+                             Ydata,
+                             Bdata != nullptr ? Bdata + group_id * B_offset : nullptr,
+                             static_cast<size_t>(M / conv_attrs_.group),
+                             static_cast<size_t>(output_image_size),
+                             real_multipliers.data() + group_id * B_offset,
+                             false,
+                             Y_zero_point_value);
+      }
 
       Xdata += X_offset;
       Ydata += Y_offset;
@@ -13,7 +13,10 @@ limitations under the License.
 
 #include "non_max_suppression.h"
 #include "non_max_suppression_helper.h"
-#include <queue>
+#include "core/platform/threadpool.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
 
 namespace onnxruntime {
 
@@ -110,6 +113,104 @@ Status NonMaxSuppressionBase::GetThresholdsFromInputs(const PrepareContext& pc,
   return Status::OK();
 }
 
+namespace {
+
+// The corners and the area of the boxes of a batch, as separate arrays so the IOU of a box with all the selected
+// boxes of a class can be computed with SIMD instructions
+struct BoxCorners {
+  std::vector<float> x_min;
+  std::vector<float> y_min;
+  std::vector<float> x_max;
+  std::vector<float> y_max;
+  std::vector<float> area;
+
+  void Resize(size_t count) {
+    x_min.resize(count);
+    y_min.resize(count);
+    x_max.resize(count);
+    y_max.resize(count);
+    area.resize(count);
+  }
+
+  // Computes the corners and the area the same way as SuppressByIOU, so the results are identical
+  void Set(size_t i, const float* box, int64_t center_point_box) {
+    if (0 == center_point_box) {
+      // boxes data format [y1, x1, y2, x2],
+      MaxMin(box[1], box[3], x_min[i], x_max[i]);
+      MaxMin(box[0], box[2], y_min[i], y_max[i]);
+    } else {
+      // 1 == center_point_box_ => boxes data format [x_center, y_center, width, height]
+      float width_half = box[2] / 2;
+      float height_half = box[3] / 2;
+      x_min[i] = box[0] - width_half;
+      x_max[i] = box[0] + width_half;
+      y_min[i] = box[1] - height_half;
+      y_max[i] = box[1] + height_half;
+    }
+    area[i] = (x_max[i] - x_min[i]) * (y_max[i] - y_min[i]);
+  }
+
+  void Copy(size_t i, const BoxCorners& from, size_t from_index) {
+    x_min[i] = from.x_min[from_index];
+    y_min[i] = from.y_min[from_index];
+    x_max[i] = from.x_max[from_index];
+    y_max[i] = from.y_max[from_index];
+    area[i] = from.area[from_index];
+  }
+};
+
+// Selected boxes checked at once for a candidate. The check of a block has no branches so it is vectorized, a
+// candidate that is suppressed by a box of the block skips the remaining blocks.
+constexpr size_t kIOUBlockSize = 8;
+
+// Returns true if the box 'index' of 'boxes' exceeds the IOU threshold with one of the 'count' boxes of 'selected'.
+// Matches SuppressByIOU with the selected box as the first box.
+bool SuppressBySelected(const BoxCorners& selected, size_t count, const BoxCorners& boxes, int64_t index,
+                        float iou_threshold) {
+  const float x2_min = boxes.x_min[index];
+  const float y2_min = boxes.y_min[index];
+  const float x2_max = boxes.x_max[index];
+  const float y2_max = boxes.y_max[index];
+  const float area2 = boxes.area[index];
+
+  for (size_t block = 0; block < count; block += kIOUBlockSize) {
+    const size_t block_end = std::min(block + kIOUBlockSize, count);
+    int suppressed = 0;
+    for (size_t i = block; i < block_end; ++i) {
+      const float intersection_x_min = std::max(selected.x_min[i], x2_min);
+      const float intersection_y_min = std::max(selected.y_min[i], y2_min);
+      const float intersection_x_max = std::min(selected.x_max[i], x2_max);
+      const float intersection_y_max = std::min(selected.y_max[i], y2_max);
+
+      const float intersection_area = std::max(intersection_x_max - intersection_x_min, .0f) *
+                                      std::max(intersection_y_max - intersection_y_min, .0f);
+      const float area1 = selected.area[i];
+      const float union_area = area1 + area2 - intersection_area;
+
+      suppressed |= static_cast<int>(intersection_area > .0f) & static_cast<int>(area1 > .0f) &
+                    static_cast<int>(area2 > .0f) & static_cast<int>(union_area > .0f) &
+                    static_cast<int>(intersection_area / union_area > iou_threshold);
+    }
+    if (suppressed != 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+struct ScoreIndexPair {
+  float score_{};
+  int64_t index_{};
+
+  // Higher scores first. Boxes with the same score are taken in index order.
+  bool operator<(const ScoreIndexPair& rhs) const {
+    return score_ > rhs.score_ || (score_ == rhs.score_ && index_ < rhs.index_);
+  }
+};
+
+}  // namespace
+
 Status NonMaxSuppression::Compute(OpKernelContext* ctx) const {
   PrepareContext pc;
   auto ret = PrepareCompute(ctx, pc);
@@ -130,68 +231,82 @@ Status NonMaxSuppression::Compute(OpKernelContext* ctx) const {
   const auto* const boxes_data = pc.boxes_data_;
   const auto* const scores_data = pc.scores_data_;
 
-  struct ScoreIndexPair {
-    float score_{};
-    int64_t index_{};
-
-    ScoreIndexPair() = default;
-    explicit ScoreIndexPair(float score, int64_t idx) : score_(score), index_(idx) {}
-
-    bool operator<(const ScoreIndexPair& rhs) const {
-      return score_ < rhs.score_;
-    }
-  };
-
   const auto center_point_box = GetCenterPointBox();
-
-  std::vector<SelectedIndex> selected_indices;
-  for (int64_t batch_index = 0; batch_index < pc.num_batches_; ++batch_index) {
-    for (int64_t class_index = 0; class_index < pc.num_classes_; ++class_index) {
-      int64_t box_score_offset = (batch_index * pc.num_classes_ + class_index) * pc.num_boxes_;
-      int64_t box_offset = batch_index * pc.num_boxes_ * 4;
-      // Filter by score_threshold_
-      std::priority_queue<ScoreIndexPair, std::deque<ScoreIndexPair>> sorted_scores_with_index;
-      const auto* class_scores = scores_data + box_score_offset;
-      if (pc.score_threshold_ != nullptr) {
-        for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
-          if (*class_scores > score_threshold) {
-            sorted_scores_with_index.push(ScoreIndexPair(*class_scores, box_index));
-          }
-        }
-      } else {
-        for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
-          sorted_scores_with_index.push(ScoreIndexPair(*class_scores, box_index));
+  const int64_t num_batches = pc.num_batches_;
+  const int64_t num_classes = pc.num_classes_;
+  const int64_t num_boxes = pc.num_boxes_;
+  const bool has_score_threshold = pc.score_threshold_ != nullptr;
+  concurrency::ThreadPool* tp = ctx->GetOperatorThreadPool();
+
+  // The corners and areas of the boxes are shared by all the classes of a batch, so they are computed once
+  std::vector<BoxCorners> batch_boxes(static_cast<size_t>(num_batches));
+  for (auto& boxes : batch_boxes) {
+    boxes.Resize(static_cast<size_t>(num_boxes));
+  }
+  concurrency::ThreadPool::TryParallelFor(
+      tp, num_batches * num_boxes, TensorOpCost{4 * sizeof(float), 5 * sizeof(float), 8},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t i = first; i < last; ++i) {
+          batch_boxes[i / num_boxes].Set(static_cast<size_t>(i % num_boxes), boxes_data + 4 * i, center_point_box);
         }
-      }
-
-      ScoreIndexPair next_top_score;
-      std::vector<int64_t> selected_indices_inside_class;
-      // Get the next box with top score, filter by iou_threshold
-      while (!sorted_scores_with_index.empty()) {
-        next_top_score = sorted_scores_with_index.top();
-        sorted_scores_with_index.pop();
-
-        bool selected = true;
-        // Check with existing selected boxes for this class, suppress if exceed the IOU (Intersection Over Union) threshold
-        for (int64_t selected_index : selected_indices_inside_class) {
-          if (SuppressByIOU(boxes_data + box_offset, selected_index, next_top_score.index_,
-                            center_point_box, iou_threshold)) {
-            selected = false;
-            break;
+      });
+
+  // Every (batch, class) pair selects its boxes independently, in parallel, into its own list. The lists are
+  // concatenated in (batch, class) order afterwards, so the output is the same as processing them in sequence.
+  std::vector<std::vector<int64_t>> selected_per_class(static_cast<size_t>(num_batches * num_classes));
+  const TensorOpCost class_cost{static_cast<double>(num_boxes * sizeof(float)), 0,
+                                static_cast<double>(num_boxes) * 16};
+  concurrency::ThreadPool::TryParallelFor(
+      tp, num_batches * num_classes, class_cost, [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        std::vector<ScoreIndexPair> candidates(static_cast<size_t>(num_boxes));
+        BoxCorners selected_boxes;
+        for (std::ptrdiff_t batch_class = first; batch_class < last; ++batch_class) {
+          const BoxCorners& boxes = batch_boxes[batch_class / num_classes];
+          const float* class_scores = scores_data + batch_class * num_boxes;
+
+          // Filter by score_threshold_. The candidate is always written and only kept if it passes, so the loop
+          // has no branches. NaN scores are never kept, as they have no order for the sort.
+          size_t candidate_count = 0;
+          for (int64_t box_index = 0; box_index < num_boxes; ++box_index) {
+            const float score = class_scores[box_index];
+            candidates[candidate_count].score_ = score;
+            candidates[candidate_count].index_ = box_index;
+            candidate_count += has_score_threshold ? score > score_threshold : !std::isnan(score);
           }
-        }
-
-        if (selected) {
-          if (max_output_boxes_per_class > 0 &&
-              static_cast<int64_t>(selected_indices_inside_class.size()) >= max_output_boxes_per_class) {
-            break;
+          std::sort(candidates.begin(), candidates.begin() + candidate_count);
+
+          auto& selected_indices_inside_class = selected_per_class[batch_class];
+          size_t selected_count = 0;
+          // Take the boxes with the top scores, filter by iou_threshold
+          for (size_t c = 0; c < candidate_count; ++c) {
+            const int64_t box_index = candidates[c].index_;
+            // Check with existing selected boxes for this class, suppress if exceed the IOU (Intersection Over Union)
+            // threshold
+            if (SuppressBySelected(selected_boxes, selected_count, boxes, box_index, iou_threshold)) {
+              continue;
+            }
+
+            if (max_output_boxes_per_class > 0 &&
+                static_cast<int64_t>(selected_count) >= max_output_boxes_per_class) {
+              break;
+            }
+            if (selected_count == selected_boxes.area.size()) {
+              selected_boxes.Resize(std::max<size_t>(2 * selected_count, kIOUBlockSize));
+            }
+            selected_boxes.Copy(selected_count++, boxes, static_cast<size_t>(box_index));
+            selected_indices_inside_class.push_back(box_index);
           }
-          selected_indices_inside_class.push_back(next_top_score.index_);
-          selected_indices.emplace_back(batch_index, class_index, next_top_score.index_);
         }
-      }  //while
-    }    //for class_index
-  }      //for batch_index
+      });
+
+  std::vector<SelectedIndex> selected_indices;
+  for (int64_t batch_index = 0; batch_index < num_batches; ++batch_index) {
+    for (int64_t class_index = 0; class_index < num_classes; ++class_index) {
+      for (int64_t box_index : selected_per_class[batch_index * num_classes + class_index]) {
+        selected_indices.emplace_back(batch_index, class_index, box_index);
+      }
+    }
+  }
 
   const auto last_dim = 3;
   const auto num_selected = selected_indices.size();
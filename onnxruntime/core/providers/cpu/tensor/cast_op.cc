@@ -7,51 +7,49 @@
 #include "core/framework/op_kernel.h"
 #include "core/util/math.h"
 #include "core/util/math_cpuonly.h"
-#include "Eigen/src/Core/arch/Default/Half.h"
 #include "core/common/common.h"
-
-#if defined(_M_AMD64)
 #include "core/mlas/inc/mlas.h"
-#endif
+#include "core/providers/cpu/tensor/parallel_copy.h"
 
 using namespace ONNX_NAMESPACE;
 namespace onnxruntime {
 
 template <typename SrcType,
           typename DstType>
-inline void CastData(const Tensor* in, Tensor* out, const TensorShape& shape) {
+inline void CastData(const Tensor* in, Tensor* out, const TensorShape& shape, concurrency::ThreadPool* tp) {
   auto shape_size = shape.Size();
-  auto in_vector = ConstEigenVectorMap<SrcType>(in->template Data<SrcType>(), shape_size);
-  auto output_vector = EigenVectorMap<DstType>(out->template MutableData<DstType>(), shape_size);
-  output_vector = in_vector.template cast<DstType>();
+  ParallelConvert(tp, in->template Data<SrcType>(), out->template MutableData<DstType>(), shape_size,
+                  [](const SrcType* src, DstType* dst, size_t count) {
+                    auto in_vector = ConstEigenVectorMap<SrcType>(src, count);
+                    auto output_vector = EigenVectorMap<DstType>(dst, count);
+                    output_vector = in_vector.template cast<DstType>();
+                  });
 }
 
 template <>
-inline void CastData<float, MLFloat16>(const Tensor* in, Tensor* out, const TensorShape& shape) {
-  auto out_data = out->template MutableData<MLFloat16>();
+inline void CastData<float, MLFloat16>(const Tensor* in, Tensor* out, const TensorShape& shape,
+                                       concurrency::ThreadPool* tp) {
   auto shape_size = shape.Size();
-  auto in_vector = ConstEigenVectorMap<float>(in->template Data<float>(), shape_size);
-  auto output_vector = EigenVectorMap<Eigen::half>(static_cast<Eigen::half*>(static_cast<void*>(out_data)), shape_size);
-  output_vector = in_vector.template cast<Eigen::half>();
+  ParallelConvert(tp, in->template Data<float>(), out->template MutableData<MLFloat16>(), shape_size,
+                  [](const float* src, MLFloat16* dst, size_t count) {
+                    MlasConvertFloatToHalfBuffer(src, &dst[0].val, count);
+                  });
 }
 
 template <>
-inline void CastData<MLFloat16, float>(const Tensor* in, Tensor* out, const TensorShape& shape) {
-  auto out_data = out->template MutableData<float>();
-  auto in_data = in->template Data<MLFloat16>();
+inline void CastData<MLFloat16, float>(const Tensor* in, Tensor* out, const TensorShape& shape,
+                                       concurrency::ThreadPool* tp) {
   auto shape_size = shape.Size();
-#if defined(_M_AMD64)
-  MlasConvertHalfToFloatBuffer(&in_data[0].val, out_data, shape_size);
-#else
-  auto in_vector = ConstEigenVectorMap<Eigen::half>(static_cast<const Eigen::half*>(static_cast<const void*>(in_data)), shape_size);
-  auto output_vector = EigenVectorMap<float>(out_data, shape_size);
-  output_vector = in_vector.template cast<float>();
-#endif
+  ParallelConvert(tp, in->template Data<MLFloat16>(), out->template MutableData<float>(), shape_size,
+                  [](const MLFloat16* src, float* dst, size_t count) {
+                    MlasConvertHalfToFloatBuffer(&src[0].val, dst, count);
+                  });
 }
 
 template <typename SrcType,
           typename DstType>
-inline void CastFloat16Data(const Tensor* in, Tensor* out, const TensorShape& shape, const AllocatorPtr& allocator) {
+inline void CastFloat16Data(const Tensor* in, Tensor* out, const TensorShape& shape, const AllocatorPtr& allocator,
+                            concurrency::ThreadPool* tp) {
   ORT_ENFORCE(allocator != nullptr);
   const int64_t len = shape.Size();
   ORT_ENFORCE(len > 0);
@@ -59,11 +57,11 @@ inline void CastFloat16Data(const Tensor* in, Tensor* out, const TensorShape& sh
   ORT_ENFORCE(buffer);
   Tensor tmp_tensor(DataTypeImpl::GetType<float>(), shape, buffer, allocator->Info());
   if (std::is_same<SrcType, MLFloat16>::value) {
-    CastData<MLFloat16, float>(in, &tmp_tensor, shape);  // first cast to float
-    CastData<float, DstType>(&tmp_tensor, out, shape);   // then cast to the destination type.
+    CastData<MLFloat16, float>(in, &tmp_tensor, shape, tp);  // first cast to float
+    CastData<float, DstType>(&tmp_tensor, out, shape, tp);   // then cast to the destination type.
   } else if (std::is_same<DstType, MLFloat16>::value) {
-    CastData<SrcType, float>(in, &tmp_tensor, shape);
-    CastData<float, MLFloat16>(&tmp_tensor, out, shape);
+    CastData<SrcType, float>(in, &tmp_tensor, shape, tp);
+    CastData<float, MLFloat16>(&tmp_tensor, out, shape, tp);
   }
   allocator->Free(buffer);
 }
@@ -176,8 +174,8 @@ class Cast final : public OpKernel {
  private:
   template <typename SrcType,
             typename DstType>
-  void CastData(const Tensor* in, Tensor* out, const TensorShape& shape) const {
-    ::onnxruntime::CastData<SrcType, DstType>(in, out, shape);
+  void CastData(const Tensor* in, Tensor* out, const TensorShape& shape, OpKernelContext* context) const {
+    ::onnxruntime::CastData<SrcType, DstType>(in, out, shape, context->GetOperatorThreadPool());
   }
 
   template <typename SrcType,
@@ -185,7 +183,7 @@ class Cast final : public OpKernel {
   Status CastFloat16Data(const Tensor* in, Tensor* out, const TensorShape& shape, OpKernelContext* context) const {
     AllocatorPtr allocator;
     ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&allocator));
-    ::onnxruntime::CastFloat16Data<SrcType, DstType>(in, out, shape, allocator);
+    ::onnxruntime::CastFloat16Data<SrcType, DstType>(in, out, shape, allocator, context->GetOperatorThreadPool());
     return Status::OK();
   }
 
@@ -236,41 +234,41 @@ const std::vector<MLDataType> castOpTypeConstraints{
                                                                                                                                    \
     switch (to_) {                                                                                                                 \
       case TensorProto_DataType_BOOL:                                                                                              \
-        CastData<in_type, bool>(X, Y, shape);                                                                                      \
+        CastData<in_type, bool>(X, Y, shape, context);                                                                             \
         break;                                                                                                                     \
       case TensorProto_DataType_INT16:                                                                                             \
-        CastData<in_type, int16_t>(X, Y, shape);                                                                                   \
+        CastData<in_type, int16_t>(X, Y, shape, context);                                                                          \
         break;                                                                                                                     \
       case TensorProto_DataType_INT32:                                                                                             \
-        CastData<in_type, int32_t>(X, Y, shape);                                                                                   \
+        CastData<in_type, int32_t>(X, Y, shape, context);                                                                          \
         break;                                                                                                                     \
       case TensorProto_DataType_INT64:                                                                                             \
-        CastData<in_type, int64_t>(X, Y, shape);                                                                                   \
+        CastData<in_type, int64_t>(X, Y, shape, context);                                                                          \
         break;                                                                                                                     \
       case TensorProto_DataType_UINT8:                                                                                             \
-        CastData<in_type, uint8_t>(X, Y, shape);                                                                                   \
+        CastData<in_type, uint8_t>(X, Y, shape, context);                                                                          \
         break;                                                                                                                     \
       case TensorProto_DataType_UINT16:                                                                                            \
-        CastData<in_type, uint16_t>(X, Y, shape);                                                                                  \
+        CastData<in_type, uint16_t>(X, Y, shape, context);                                                                         \
         break;                                                                                                                     \
       case TensorProto_DataType_UINT32:                                                                                            \
-        CastData<in_type, uint32_t>(X, Y, shape);                                                                                  \
+        CastData<in_type, uint32_t>(X, Y, shape, context);                                                                         \
         break;                                                                                                                     \
       case TensorProto_DataType_UINT64:                                                                                            \
-        CastData<in_type, uint64_t>(X, Y, shape);                                                                                  \
+        CastData<in_type, uint64_t>(X, Y, shape, context);                                                                         \
         break;                                                                                                                     \
       case TensorProto_DataType_FLOAT:                                                                                             \
-        CastData<in_type, float>(X, Y, shape);                                                                                     \
+        CastData<in_type, float>(X, Y, shape, context);                                                                            \
         break;                                                                                                                     \
       case TensorProto_DataType_DOUBLE:                                                                                            \
-        CastData<in_type, double>(X, Y, shape);                                                                                    \
+        CastData<in_type, double>(X, Y, shape, context);                                                                           \
         break;                                                                                                                     \
       case TensorProto_DataType_INT8:                                                                                              \
-        CastData<in_type, int8_t>(X, Y, shape);                                                                                    \
+        CastData<in_type, int8_t>(X, Y, shape, context);                                                                           \
         break;                                                                                                                     \
       case TensorProto_DataType_FLOAT16:                                                                                           \
         if (std::is_same<in_type, float>::value) {                                                                                 \
-          CastData<float, MLFloat16>(X, Y, shape);                                                                                 \
+          CastData<float, MLFloat16>(X, Y, shape, context);                                                                        \
         } else {                                                                                                                   \
           auto st = CastFloat16Data<in_type, MLFloat16>(X, Y, shape, context);                                                     \
           if (!st.IsOK()) return st;                                                                                               \
@@ -339,7 +337,7 @@ Status Cast<MLFloat16>::Compute(OpKernelContext* context) const {
       st = CastFloat16Data<MLFloat16, uint64_t>(X, Y, shape, context);
       break;
     case TensorProto_DataType_FLOAT:
-      CastData<MLFloat16, float>(X, Y, shape);
+      CastData<MLFloat16, float>(X, Y, shape, context);
       break;
     case TensorProto_DataType_FLOAT16: {
       auto X_type = X->DataType();
@@ -347,7 +345,7 @@ Status Cast<MLFloat16>::Compute(OpKernelContext* context) const {
       void* target = Y->MutableDataRaw(X_type);
       // if source and target pointers are not equal, we need to copy the data.
       if (target != source) {
-        memcpy(target, source, shape.Size() * X_type->Size());
+        ParallelMemcpy(context->GetOperatorThreadPool(), target, source, shape.Size() * X_type->Size());
       }
       st = Status::OK();
       break;
@@ -3,6 +3,7 @@
 
 #include "core/providers/cpu/tensor/concat.h"
 #include "core/providers/common.h"
+#include "core/providers/cpu/tensor/parallel_copy.h"
 #include "core/framework/TensorSeq.h"
 
 namespace onnxruntime {
@@ -152,10 +153,11 @@ Status ConcatBase::PrepareForCompute(OpKernelContext* ctx,
 }
 
 // This method computes the output tensor for Concat/ConcatFromSequence ops
-Status ConcatBase::ComputeImpl(Prepare& p) const {
+Status ConcatBase::ComputeImpl(Prepare& p, concurrency::ThreadPool* tp) const {
   int input_count = static_cast<int>(p.inputs.size());
   int64_t initial_output_offset = 0;  // initial offset for each input
   auto element_bytes = p.output_tensor->DataType()->Size();
+  uint8_t* output = static_cast<uint8_t*>(p.output_tensor->MutableDataRaw());
   for (int input_index = 0; input_index < input_count; input_index++) {
     const auto& prep = p.inputs[input_index];
 
@@ -167,32 +169,33 @@ Status ConcatBase::ComputeImpl(Prepare& p) const {
     const uint8_t* input = static_cast<const uint8_t*>(prep.tensor->DataRaw());
 
     auto input_size = prep.num_elements;
-
-    // Copy the data across. For every 'input_axis_pitch' values copied, we move over by the 'output_axis_pitch'
-    // TODO: Optimization possibility: There are cases where we simply need to "merge" raw buffers and this 
-    // could be done without the pointer house-keeping as below. Some scenarios whether this is possible are:
-    // 1) Concatenating on input axis = 0
-    // 2) Stacking on output axis = 0
-    // 3) Stacking scalars
-    uint8_t* output = static_cast<uint8_t*>(p.output_tensor->MutableDataRaw());
-    int64_t cur_out_offset = 0;
-    int64_t cur_in_offset = 0;
-    for (size_t idx_copy = 0, end = input_size / input_axis_pitch; idx_copy < end; ++idx_copy) {
-      if (p.is_string_type) {
-        size_t out = initial_output_offset + cur_out_offset;
-        for (int idx_item = 0; idx_item < input_axis_pitch; ++idx_item) {
-          reinterpret_cast<std::string*>(output)[out + idx_item] =
-              reinterpret_cast<const std::string*>(input)[cur_in_offset + idx_item];
-        }
-      } else {
-        memcpy(
-            output + (initial_output_offset + cur_out_offset) * element_bytes,
-            input + cur_in_offset * element_bytes,
-            input_axis_pitch * element_bytes);
-      }
-
-      cur_out_offset += p.output_axis_pitch;
-      cur_in_offset += input_axis_pitch;
+    const auto copy_count = static_cast<std::ptrdiff_t>(input_size / input_axis_pitch);
+
+    // Copy the data across. For every 'input_axis_pitch' values copied, we move over by the 'output_axis_pitch'.
+    // When the input is a single block (e.g. concatenating on axis 0, or stacking on output axis 0) the block is
+    // split instead, so large inputs are still copied in parallel.
+    if (copy_count == 1 && !p.is_string_type) {
+      ParallelMemcpy(tp, output + initial_output_offset * element_bytes, input, input_axis_pitch * element_bytes);
+    } else {
+      const int64_t output_axis_pitch = p.output_axis_pitch;
+      const bool is_string_type = p.is_string_type;
+      ParallelCopyBlocks(
+          tp, copy_count, static_cast<double>(input_axis_pitch * element_bytes),
+          [=](std::ptrdiff_t first, std::ptrdiff_t last) {
+            for (std::ptrdiff_t idx_copy = first; idx_copy < last; ++idx_copy) {
+              const int64_t out_offset = initial_output_offset + idx_copy * output_axis_pitch;
+              const int64_t in_offset = idx_copy * input_axis_pitch;
+              if (is_string_type) {
+                for (int64_t idx_item = 0; idx_item < input_axis_pitch; ++idx_item) {
+                  reinterpret_cast<std::string*>(output)[out_offset + idx_item] =
+                      reinterpret_cast<const std::string*>(input)[in_offset + idx_item];
+                }
+              } else {
+                memcpy(output + out_offset * element_bytes, input + in_offset * element_bytes,
+                       input_axis_pitch * element_bytes);
+              }
+            }
+          });
     }
 
     initial_output_offset += input_axis_pitch;
@@ -224,7 +227,7 @@ Status Concat::Compute(OpKernelContext* ctx) const {
     return Status::OK();
 
   // Compute values to be placed in the output tensor
-  return ComputeImpl(p);
+  return ComputeImpl(p, ctx->GetOperatorThreadPool());
 }
 
 }  // namespace onnxruntime
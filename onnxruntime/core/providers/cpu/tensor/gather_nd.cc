@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "gather_nd.h"
+#include "core/providers/cpu/tensor/parallel_copy.h"
 
 namespace onnxruntime {
 
@@ -110,30 +111,32 @@ Status GatherND::Compute(OpKernelContext* context) const {
                           ? PrepareForCompute<int32_t>(context, p)
                           : PrepareForCompute<int64_t>(context, p));
 
-  return nullptr == p.input_str_base ? GatherNumber(p) : GatherString(p);
+  return nullptr == p.input_str_base ? GatherNumber(p, context->GetOperatorThreadPool())
+                                   : GatherString(p, context->GetOperatorThreadPool());
 }
 
-Status GatherND::GatherNumber(const Prepare& p) const {
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-  for (int64_t i = 0; i < static_cast<int64_t>(p.element_offsets.size()); ++i) {
-    memcpy(p.output_base + i * p.bytes_to_copy, p.input_base + p.element_offsets[i] * p.element_bytes,
-           p.bytes_to_copy);
-  }
+Status GatherND::GatherNumber(const Prepare& p, concurrency::ThreadPool* tp) const {
+  ParallelCopyBlocks(tp, static_cast<std::ptrdiff_t>(p.element_offsets.size()), static_cast<double>(p.bytes_to_copy),
+                     [&p](std::ptrdiff_t first, std::ptrdiff_t last) {
+                       for (std::ptrdiff_t i = first; i < last; ++i) {
+                         memcpy(p.output_base + i * p.bytes_to_copy,
+                                p.input_base + p.element_offsets[i] * p.element_bytes, p.bytes_to_copy);
+                       }
+                     });
 
   return Status::OK();
 }
 
-Status GatherND::GatherString(const Prepare& p) const {
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-  for (int64_t i = 0; i < static_cast<int64_t>(p.element_offsets.size()); ++i) {
-    for (int64_t j = 0; j < static_cast<int64_t>(p.element_to_copy); ++j) {
-      p.output_str_base[i * p.element_to_copy + j] = p.input_str_base[p.element_offsets[i] + j];
-    }
-  }
+Status GatherND::GatherString(const Prepare& p, concurrency::ThreadPool* tp) const {
+  ParallelCopyBlocks(tp, static_cast<std::ptrdiff_t>(p.element_offsets.size()),
+                     static_cast<double>(p.element_to_copy * sizeof(std::string)),
+                     [&p](std::ptrdiff_t first, std::ptrdiff_t last) {
+                       for (std::ptrdiff_t i = first; i < last; ++i) {
+                         for (int64_t j = 0; j < static_cast<int64_t>(p.element_to_copy); ++j) {
+                           p.output_str_base[i * p.element_to_copy + j] = p.input_str_base[p.element_offsets[i] + j];
+                         }
+                       }
+                     });
 
   return Status::OK();
 }
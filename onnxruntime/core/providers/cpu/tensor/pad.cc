@@ -8,6 +8,7 @@
 #pragma warning(disable : 4996)
 #endif
 #include "core/providers/cpu/tensor/pad.h"
+#include "core/providers/cpu/tensor/parallel_copy.h"
 #include "core/providers/cpu/tensor/utils.h"
 
 namespace onnxruntime {
@@ -191,65 +192,17 @@ static void ReshapePads(const std::vector<int64_t>& src_pad, size_t src_dim_coun
   reshaped_pad[inner_axis + new_dim_count] = src_pad[inner_axis + src_dim_count] * inner_no_pad_size;
 }
 
+// Pads the input slice described by input_starts and input_extents into output, which points to the start of the
+// padded block. Each axis is padded by reshaped_pad, and output_pitches are the pitches of the padded output.
 template <typename T>
-Status PadCpuImpl(OpKernelContext* ctx,
-                  const std::vector<int64_t>& pads,
-                  const std::vector<int64_t>& slices,
-                  const Mode& mode,
-                  T value) {
-  const auto& input_tensor = *ctx->Input<Tensor>(0);
-  const auto& orig_input_shape = input_tensor.Shape();
-  std::vector<int64_t> output_dims(orig_input_shape.GetDims());
-  size_t data_rank = output_dims.size();
-
-  // make copy of raw_pads as it may be mutated below
-  ORT_ENFORCE(data_rank > 0, "Input tensor has no dimensions");
-  ORT_ENFORCE(data_rank * 2 == pads.size(), "'pads' has wrong number of values");
-
-  // Reshape input dims
-  std::vector<int64_t> reshaped_input_dims;
-  FlattenInnerShape(output_dims, pads, slices, reshaped_input_dims);
-
-  // Reshape padding
-  size_t new_dims_count = reshaped_input_dims.size();
+static void PadSlice(T* output, const Tensor& input_tensor, const TensorShape& input_shape,
+                     const std::vector<int64_t>& input_starts, const std::vector<int64_t>& input_extents,
+                     const std::vector<int64_t>& reshaped_pad, const TensorPitches& output_pitches,
+                     const Mode& mode, T value) {
+  size_t new_dims_count = input_extents.size();
   size_t inner_axis = new_dims_count - 1;
-  size_t inner_no_pad_size = output_dims[inner_axis] > 0 ? reshaped_input_dims[inner_axis] / output_dims[inner_axis] : 0;
-  std::vector<int64_t> reshaped_pad(2 * new_dims_count), reshaped_slice(2 * new_dims_count);
-  ReshapePads(pads, data_rank, new_dims_count, inner_no_pad_size, reshaped_pad);
-  ReshapePads(slices, data_rank, new_dims_count, inner_no_pad_size, reshaped_slice);
-
-  std::vector<int64_t> reshaped_output_dims = reshaped_input_dims;
-  std::vector<int64_t> input_starts;
-  std::vector<int64_t> input_extents;
-
-  // Calculate output dimensions, and handle any negative padding
-  input_starts.reserve(new_dims_count);
-  input_extents.reserve(new_dims_count);
-  for (size_t i = 0; i < new_dims_count; i++) {
-    input_starts.push_back(-1 * reshaped_slice[i]);
-    input_extents.push_back(reshaped_input_dims[i] + reshaped_slice[i] + reshaped_slice[i + new_dims_count]);
-    reshaped_output_dims[i] += reshaped_pad[i] + reshaped_pad[i + new_dims_count] + reshaped_slice[i] + reshaped_slice[i + new_dims_count];
-  }
-
-  for (size_t i = 0; i < data_rank; i++) {
-    output_dims[i] += pads[i] + pads[i + data_rank] + slices[i] + slices[i + data_rank];
-  }
-
-  // special case an input with one or more dim values of 0. edge case that is easier to handle
-  // separately than to complicate all the code for normal usage.
-  if (orig_input_shape.Size() == 0) {
-    return PadInputWithDimValueOfZero(ctx, mode, orig_input_shape, output_dims, value);
-  }
-
-  TensorShape input_shape(reshaped_input_dims);
   SliceIterator<T> input(input_tensor, input_shape, input_starts, input_extents, {});
 
-  // output_shape need to keep original.
-  TensorShape output_shape(output_dims);
-  auto& output_tensor = *ctx->Output(0, output_shape);
-  auto* output = output_tensor.template MutableData<T>();
-
-  TensorPitches output_pitches(reshaped_output_dims);
   size_t alignSkip = 0;  // Amount to skip to align to where the next input tensor data needs to be written
 
   // Initial skip, sum up the begin padding on each axis
@@ -352,6 +305,111 @@ Status PadCpuImpl(OpKernelContext* ctx,
       }
       break;
   }
+}
+
+template <typename T>
+Status PadCpuImpl(OpKernelContext* ctx,
+                  const std::vector<int64_t>& pads,
+                  const std::vector<int64_t>& slices,
+                  const Mode& mode,
+                  T value) {
+  const auto& input_tensor = *ctx->Input<Tensor>(0);
+  const auto& orig_input_shape = input_tensor.Shape();
+  std::vector<int64_t> output_dims(orig_input_shape.GetDims());
+  size_t data_rank = output_dims.size();
+
+  // make copy of raw_pads as it may be mutated below
+  ORT_ENFORCE(data_rank > 0, "Input tensor has no dimensions");
+  ORT_ENFORCE(data_rank * 2 == pads.size(), "'pads' has wrong number of values");
+
+  // Reshape input dims
+  std::vector<int64_t> reshaped_input_dims;
+  FlattenInnerShape(output_dims, pads, slices, reshaped_input_dims);
+
+  // Reshape padding
+  size_t new_dims_count = reshaped_input_dims.size();
+  size_t inner_axis = new_dims_count - 1;
+  size_t inner_no_pad_size = output_dims[inner_axis] > 0 ? reshaped_input_dims[inner_axis] / output_dims[inner_axis] : 0;
+  std::vector<int64_t> reshaped_pad(2 * new_dims_count), reshaped_slice(2 * new_dims_count);
+  ReshapePads(pads, data_rank, new_dims_count, inner_no_pad_size, reshaped_pad);
+  ReshapePads(slices, data_rank, new_dims_count, inner_no_pad_size, reshaped_slice);
+
+  std::vector<int64_t> reshaped_output_dims = reshaped_input_dims;
+  std::vector<int64_t> input_starts;
+  std::vector<int64_t> input_extents;
+
+  // Calculate output dimensions, and handle any negative padding
+  input_starts.reserve(new_dims_count);
+  input_extents.reserve(new_dims_count);
+  for (size_t i = 0; i < new_dims_count; i++) {
+    input_starts.push_back(-1 * reshaped_slice[i]);
+    input_extents.push_back(reshaped_input_dims[i] + reshaped_slice[i] + reshaped_slice[i + new_dims_count]);
+    reshaped_output_dims[i] += reshaped_pad[i] + reshaped_pad[i + new_dims_count] + reshaped_slice[i] + reshaped_slice[i + new_dims_count];
+  }
+
+  for (size_t i = 0; i < data_rank; i++) {
+    output_dims[i] += pads[i] + pads[i + data_rank] + slices[i] + slices[i + data_rank];
+  }
+
+  // special case an input with one or more dim values of 0. edge case that is easier to handle
+  // separately than to complicate all the code for normal usage.
+  if (orig_input_shape.Size() == 0) {
+    return PadInputWithDimValueOfZero(ctx, mode, orig_input_shape, output_dims, value);
+  }
+
+  TensorShape input_shape(reshaped_input_dims);
+
+  // output_shape need to keep original.
+  TensorShape output_shape(output_dims);
+  auto& output_tensor = *ctx->Output(0, output_shape);
+  auto* output = output_tensor.template MutableData<T>();
+
+  TensorPitches output_pitches(reshaped_output_dims);
+
+  concurrency::ThreadPool* tp = ctx->GetOperatorThreadPool();
+  if (tp == nullptr || new_dims_count == 1 || input_extents[0] <= 1) {
+    PadSlice(output, input_tensor, input_shape, input_starts, input_extents, reshaped_pad, output_pitches, mode, value);
+    return Status::OK();
+  }
+
+  // Pad the slices of the outermost axis in parallel, each into its own block of the output. The padding of the
+  // outermost axis is added afterwards, as the edge and reflect modes copy from the padded blocks.
+  const ptrdiff_t outer_pitch = output_pitches[0];
+  const int64_t outer_pre_pad = reshaped_pad[0];
+  const int64_t outer_post_pad = reshaped_pad[new_dims_count];
+  std::vector<int64_t> inner_pad(reshaped_pad);
+  inner_pad[0] = 0;
+  inner_pad[new_dims_count] = 0;
+
+  T* data_start = output + outer_pre_pad * outer_pitch;
+  T* data_end = data_start + input_extents[0] * outer_pitch;
+
+  ParallelCopyBlocks(tp, input_extents[0], static_cast<double>(outer_pitch * sizeof(T)),
+                     [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+                       std::vector<int64_t> starts(input_starts);
+                       std::vector<int64_t> extents(input_extents);
+                       starts[0] += first;
+                       extents[0] = last - first;
+                       PadSlice(data_start + first * outer_pitch, input_tensor, input_shape, starts, extents,
+                                inner_pad, output_pitches, mode, value);
+                     });
+
+  switch (mode) {
+    case Mode::Constant:
+      PadAxisConstant(output, value, outer_pre_pad * outer_pitch);
+      PadAxisConstant(data_end, value, outer_post_pad * outer_pitch);
+      break;
+
+    case Mode::Edge:
+      PadAxis(output, data_start, 1, -outer_pitch, outer_pitch, outer_pre_pad);
+      PadAxis(data_end, data_end - outer_pitch, 1, -outer_pitch, outer_pitch, outer_post_pad);
+      break;
+
+    case Mode::Reflect:
+      PadAxis(output, data_start + outer_pre_pad * outer_pitch, 1, -outer_pitch * 2, outer_pitch, outer_pre_pad);
+      PadAxis(data_end, data_end - 2 * outer_pitch, 1, -outer_pitch * 2, outer_pitch, outer_post_pad);
+      break;
+  }
 
   return Status::OK();
 }
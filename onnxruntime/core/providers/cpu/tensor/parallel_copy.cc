@@ -0,0 +1,43 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/providers/cpu/tensor/parallel_copy.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace onnxruntime {
+
+namespace {
+// Contiguous copies are split in blocks of this many bytes so shards start on a cache line.
+constexpr size_t kMemcpyBlockBytes = 4096;
+}  // namespace
+
+void ParallelCopyBlocks(concurrency::ThreadPool* tp, std::ptrdiff_t block_count, double bytes_per_block,
+                        const std::function<void(std::ptrdiff_t first, std::ptrdiff_t last)>& fn) {
+  if (block_count <= 0) {
+    return;
+  }
+
+  if (tp == nullptr || block_count == 1) {
+    fn(0, block_count);
+    return;
+  }
+
+  concurrency::ThreadPool::TryParallelFor(tp, block_count, TensorOpCost{bytes_per_block, bytes_per_block, 0}, fn);
+}
+
+void ParallelMemcpy(concurrency::ThreadPool* tp, void* dst, const void* src, size_t bytes) {
+  auto* dst_bytes = static_cast<uint8_t*>(dst);
+  const auto* src_bytes = static_cast<const uint8_t*>(src);
+  const auto block_count = static_cast<std::ptrdiff_t>((bytes + kMemcpyBlockBytes - 1) / kMemcpyBlockBytes);
+
+  ParallelCopyBlocks(tp, block_count, static_cast<double>(kMemcpyBlockBytes),
+                     [dst_bytes, src_bytes, bytes](std::ptrdiff_t first, std::ptrdiff_t last) {
+                       const size_t begin = static_cast<size_t>(first) * kMemcpyBlockBytes;
+                       const size_t end = std::min(bytes, static_cast<size_t>(last) * kMemcpyBlockBytes);
+                       memcpy(dst_bytes + begin, src_bytes + begin, end - begin);
+                     });
+}
+
+}  // namespace onnxruntime
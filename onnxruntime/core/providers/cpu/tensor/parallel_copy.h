@@ -0,0 +1,39 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <functional>
+
+#include "core/common/common.h"
+#include "core/platform/threadpool.h"
+
+namespace onnxruntime {
+
+/**
+Runs fn(first, last) over the blocks [0, block_count) of a copy, splitting them across the intra-op thread pool.
+Each block loads and stores bytes_per_block bytes; the thread pool cost model uses that to keep small copies on the
+calling thread. fn must only write the destination of the blocks it is given.
+Data movement kernels (Gather, Tile, Pad, Concat, Expand, Cast, ...) share this so they split work the same way.
+*/
+void ParallelCopyBlocks(concurrency::ThreadPool* tp, std::ptrdiff_t block_count, double bytes_per_block,
+                        const std::function<void(std::ptrdiff_t first, std::ptrdiff_t last)>& fn);
+
+/**
+Copies bytes from src to dst, splitting the copy across the intra-op thread pool.
+*/
+void ParallelMemcpy(concurrency::ThreadPool* tp, void* dst, const void* src, size_t bytes);
+
+/**
+Converts count elements from src to dst with convert(src, dst, n), splitting them across the intra-op thread pool.
+*/
+template <typename TSrc, typename TDst, typename Convert>
+void ParallelConvert(concurrency::ThreadPool* tp, const TSrc* src, TDst* dst, std::ptrdiff_t count,
+                     const Convert& convert) {
+  ParallelCopyBlocks(tp, count, static_cast<double>(sizeof(TSrc) + sizeof(TDst)),
+                     [src, dst, &convert](std::ptrdiff_t first, std::ptrdiff_t last) {
+                       convert(src + first, dst + first, static_cast<size_t>(last - first));
+                     });
+}
+
+}  // namespace onnxruntime
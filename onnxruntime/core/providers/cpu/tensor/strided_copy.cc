@@ -0,0 +1,104 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/providers/cpu/tensor/strided_copy.h"
+
+#include <cstring>
+
+namespace onnxruntime {
+
+template <typename T>
+static void StridedCopyImpl(const T* src, T* dst, const std::vector<int64_t>& dims,
+                            const std::vector<int64_t>& strides) {
+  const size_t rank = dims.size();
+  if (rank == 0) {
+    *dst = *src;
+    return;
+  }
+
+  const int64_t inner_size = dims[rank - 1];
+  const int64_t inner_stride = strides[rank - 1];
+  int64_t outer_size = 1;
+  for (size_t i = 0; i + 1 < rank; ++i) {
+    outer_size *= dims[i];
+  }
+
+  // index into the outer dimensions. the innermost dimension is copied in a single run.
+  std::vector<int64_t> index(rank, 0);
+  for (int64_t outer = 0; outer < outer_size; ++outer) {
+    int64_t offset = 0;
+    for (size_t i = 0; i + 1 < rank; ++i) {
+      offset += index[i] * strides[i];
+    }
+
+    const T* src_row = src + offset;
+    if (inner_stride == 1) {
+      memcpy(dst, src_row, static_cast<size_t>(inner_size) * sizeof(T));
+    } else {
+      for (int64_t i = 0; i < inner_size; ++i) {
+        dst[i] = src_row[i * inner_stride];
+      }
+    }
+    dst += inner_size;
+
+    for (size_t k = rank - 1; k-- > 0;) {
+      if (++index[k] < dims[k]) break;
+      index[k] = 0;
+    }
+  }
+}
+
+Status StridedCopyToContiguous(const Tensor& src, Tensor& dst) {
+  ORT_RETURN_IF_NOT(dst.IsContiguous(), "StridedCopyToContiguous requires a contiguous destination.");
+  ORT_RETURN_IF_NOT(src.DataType() == dst.DataType() && src.Shape() == dst.Shape(),
+                    "StridedCopyToContiguous requires source and destination with the same type and shape.");
+
+  if (src.Shape().Size() == 0) {
+    return Status::OK();
+  }
+
+  const auto& dims = src.Shape().GetDims();
+  const auto strides = src.Strides();
+  const void* src_data = src.DataRaw();
+  void* dst_data = dst.MutableDataRaw();
+
+  if (src.IsDataTypeString()) {
+    StridedCopyImpl(static_cast<const std::string*>(src_data), static_cast<std::string*>(dst_data), dims, strides);
+    return Status::OK();
+  }
+
+  switch (src.DataType()->Size()) {
+    case sizeof(uint8_t):
+      StridedCopyImpl(static_cast<const uint8_t*>(src_data), static_cast<uint8_t*>(dst_data), dims, strides);
+      break;
+    case sizeof(uint16_t):
+      StridedCopyImpl(static_cast<const uint16_t*>(src_data), static_cast<uint16_t*>(dst_data), dims, strides);
+      break;
+    case sizeof(uint32_t):
+      StridedCopyImpl(static_cast<const uint32_t*>(src_data), static_cast<uint32_t*>(dst_data), dims, strides);
+      break;
+    case sizeof(uint64_t):
+      StridedCopyImpl(static_cast<const uint64_t*>(src_data), static_cast<uint64_t*>(dst_data), dims, strides);
+      break;
+    default:
+      return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED, "StridedCopyToContiguous: unsupported element size ",
+                             src.DataType()->Size());
+  }
+
+  return Status::OK();
+}
+
+Status MakeContiguous(const Tensor& input, AllocatorPtr allocator, std::unique_ptr<Tensor>& holder,
+                      const Tensor*& contiguous) {
+  if (input.IsContiguous()) {
+    contiguous = &input;
+    return Status::OK();
+  }
+
+  holder = onnxruntime::make_unique<Tensor>(input.DataType(), input.Shape(), std::move(allocator));
+  ORT_RETURN_IF_ERROR(StridedCopyToContiguous(input, *holder));
+  contiguous = holder.get();
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
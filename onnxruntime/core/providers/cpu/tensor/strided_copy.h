@@ -0,0 +1,26 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/common/common.h"
+#include "core/framework/tensor.h"
+
+namespace onnxruntime {
+
+/**
+Copies the elements of a (possibly non-contiguous) strided tensor view into dst.
+dst must be a contiguous tensor with the same shape and element type as src.
+Kernels that declare KernelDefBuilder::MayStridedInput use this to materialize
+inputs whose layout they can't consume directly.
+*/
+Status StridedCopyToContiguous(const Tensor& src, Tensor& dst);
+
+/**
+Returns a contiguous version of input. If input is already contiguous it is returned as is, otherwise
+a contiguous copy is allocated from allocator and stored in holder.
+*/
+Status MakeContiguous(const Tensor& input, AllocatorPtr allocator, std::unique_ptr<Tensor>& holder,
+                      const Tensor*& contiguous);
+
+}  // namespace onnxruntime
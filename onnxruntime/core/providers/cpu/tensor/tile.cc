@@ -11,6 +11,7 @@
 
 #include "gsl/gsl"
 #include "core/providers/cpu/tensor/tile.h"
+#include "core/providers/cpu/tensor/parallel_copy.h"
 #include "core/providers/cpu/tensor/utils.h"
 
 #ifdef _MSC_VER
@@ -38,13 +39,74 @@ ONNX_CPU_OPERATOR_KERNEL(
         .TypeConstraint("T1", DataTypeImpl::GetTensorType<int64_t>()),
     Tile);
 
-Status TileCoreForFixedSizeTypes(const Tensor& input_tensor, Tensor& output_tensor, const int64_t* repeats, TensorAxisCounters& input_counters, const TensorPitches& output_pitches, size_t element_size) {
+// Output rows (the innermost output axis) smaller than this are tiled sequentially: the sequential path copies
+// whole tiled blocks of the outer axes at once, which beats many small row copies.
+constexpr int64_t kMinParallelTileRowBytes = 256;
+
+// Tiles the output rows [first, last). An output row is the matching input row repeated repeats[rank - 1] times,
+// and the matching input row is found by wrapping the outer output coordinates by the input dims.
+static void TileRows(const uint8_t* input, uint8_t* output, const std::vector<int64_t>& input_shape,
+                     const int64_t* repeats, size_t element_size, std::ptrdiff_t first, std::ptrdiff_t last) {
+  const size_t outer_rank = input_shape.size() - 1;
+  const size_t input_row_bytes = input_shape[outer_rank] * element_size;
+  const int64_t row_repeats = repeats[outer_rank];
+
+  // Coordinates of the row in the outer output and input axes, and the pitch of each input axis in rows
+  std::vector<int64_t> output_coords(outer_rank);
+  std::vector<int64_t> input_coords(outer_rank);
+  std::vector<int64_t> input_row_pitches(outer_rank);
+  int64_t input_row = 0;
+  int64_t remaining = first;
+  int64_t pitch = 1;
+  for (size_t axis = outer_rank; axis-- > 0;) {
+    const int64_t output_dim = input_shape[axis] * repeats[axis];
+    output_coords[axis] = remaining % output_dim;
+    remaining /= output_dim;
+    input_coords[axis] = output_coords[axis] % input_shape[axis];
+    input_row_pitches[axis] = pitch;
+    input_row += input_coords[axis] * pitch;
+    pitch *= input_shape[axis];
+  }
+
+  output += first * input_row_bytes * row_repeats;
+  for (std::ptrdiff_t row = first; row < last; ++row) {
+    const uint8_t* copy = input + input_row * input_row_bytes;
+    for (int64_t repeat = 0; repeat < row_repeats; ++repeat) {
+      memcpy(output, copy, input_row_bytes);
+      output += input_row_bytes;
+    }
+
+    for (size_t axis = outer_rank; axis-- > 0;) {
+      input_row += input_row_pitches[axis];
+      if (++input_coords[axis] == input_shape[axis]) {
+        input_coords[axis] = 0;
+        input_row -= input_shape[axis] * input_row_pitches[axis];
+      }
+      if (++output_coords[axis] != input_shape[axis] * repeats[axis]) {
+        break;
+      }
+      output_coords[axis] = 0;
+    }
+  }
+}
+
+Status TileCoreForFixedSizeTypes(const Tensor& input_tensor, Tensor& output_tensor, const int64_t* repeats, TensorAxisCounters& input_counters, const TensorPitches& output_pitches, size_t element_size, concurrency::ThreadPool* tp) {
   const auto& input_shape = input_tensor.Shape().GetDims();
   const size_t dimension_count = input_shape.size();
 
   const auto* input = reinterpret_cast<const uint8_t*>(input_tensor.DataRaw());
   auto* output = reinterpret_cast<uint8_t*>(output_tensor.MutableDataRaw());
 
+  const int64_t output_row_bytes = output_tensor.Shape()[dimension_count - 1] * static_cast<int64_t>(element_size);
+  if (tp != nullptr && output_row_bytes >= kMinParallelTileRowBytes) {
+    const int64_t output_rows = output_tensor.Shape().SizeToDimension(dimension_count - 1);
+    ParallelCopyBlocks(tp, output_rows, static_cast<double>(output_row_bytes),
+                       [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+                         TileRows(input, output, input_shape, repeats, element_size, first, last);
+                       });
+    return Status::OK();
+  }
+
   // some helper variables that will be used along the way
   size_t block_size = 0;
   int64_t num_repeats = 0;
@@ -116,6 +178,7 @@ Status Tile::Compute(OpKernelContext* ctx) const {
 
   TensorAxisCounters input_counters(input_tensor);
   TensorPitches output_pitches(output_tensor);
+  concurrency::ThreadPool* tp = ctx->GetOperatorThreadPool();
 
   static_assert(sizeof(float) == sizeof(int32_t), "Float and Int32 are of different sizes");
   static_assert(sizeof(double) == sizeof(int64_t), "Double and Int64 are of different sizes");
@@ -123,21 +186,21 @@ Status Tile::Compute(OpKernelContext* ctx) const {
   if (input_tensor.IsDataType<float>() ||
       input_tensor.IsDataType<int32_t>() ||
       input_tensor.IsDataType<uint32_t>())
-    return TileCoreForFixedSizeTypes(input_tensor, output_tensor, repeats, input_counters, output_pitches, sizeof(float));
+    return TileCoreForFixedSizeTypes(input_tensor, output_tensor, repeats, input_counters, output_pitches, sizeof(float), tp);
 
   if (input_tensor.IsDataType<double>() || input_tensor.IsDataType<int64_t>() ||
       input_tensor.IsDataType<uint64_t>())
-    return TileCoreForFixedSizeTypes(input_tensor, output_tensor, repeats, input_counters, output_pitches, sizeof(double));
+    return TileCoreForFixedSizeTypes(input_tensor, output_tensor, repeats, input_counters, output_pitches, sizeof(double), tp);
 
   else if (input_tensor.IsDataType<int8_t>() ||
            input_tensor.IsDataType<uint8_t>())
-    return TileCoreForFixedSizeTypes(input_tensor, output_tensor, repeats, input_counters, output_pitches, sizeof(int8_t));
+    return TileCoreForFixedSizeTypes(input_tensor, output_tensor, repeats, input_counters, output_pitches, sizeof(int8_t), tp);
 
   if (input_tensor.IsDataType<int16_t>() || input_tensor.IsDataType<uint16_t>())
-    return TileCoreForFixedSizeTypes(input_tensor, output_tensor, repeats, input_counters, output_pitches, sizeof(int16_t));
+    return TileCoreForFixedSizeTypes(input_tensor, output_tensor, repeats, input_counters, output_pitches, sizeof(int16_t), tp);
 
   else if (input_tensor.IsDataType<bool>())
-    return TileCoreForFixedSizeTypes(input_tensor, output_tensor, repeats, input_counters, output_pitches, sizeof(bool));
+    return TileCoreForFixedSizeTypes(input_tensor, output_tensor, repeats, input_counters, output_pitches, sizeof(bool), tp);
 
   // TODO: Support 'string' and 'float16' types for completeness
   else
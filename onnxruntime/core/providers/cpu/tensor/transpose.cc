@@ -571,6 +571,18 @@ Status Transpose::Compute(OpKernelContext* ctx) const {
   if (output_shape.Size() == 0)
     return Status::OK();
 
+  // the allocation planner made the output a strided view over the input buffer, as all consumers of the
+  // output accept strided inputs. describe the permuted layout instead of moving any data.
+  if (Y.DataRaw() == X.DataRaw()) {
+    const std::vector<int64_t> input_strides = X.Strides();
+    std::vector<int64_t> output_strides(rank);
+    for (size_t i = 0; i < rank; ++i) {
+      output_strides[i] = input_strides[(*p_perm)[i]];
+    }
+    Y.SetShapeAndStrides(output_shape, output_strides);
+    return Status::OK();
+  }
+
   size_t from = 0, to = 0;
   bool moving_single_axis = IsMovingSingleAxis(*p_perm, from, to);
 
@@ -587,7 +599,9 @@ Status Transpose::Compute(OpKernelContext* ctx) const {
 ONNX_CPU_OPERATOR_KERNEL(
     Transpose,
     1,
-    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::AllTensorTypes()),
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::AllTensorTypes())
+        .MayStridedOutput(0, 0),
     Transpose);
 
 }  // namespace onnxruntime
@@ -2,7 +2,8 @@
 // Licensed under the MIT License.
 
 #include "core/providers/cpu/tensor/upsample.h"
-#include "core/common/safeint.h"
+#include "core/platform/threadpool.h"
+#include <numeric>
 #include <sstream>
 
 using namespace onnxruntime::common;
@@ -62,13 +63,12 @@ Status UpsampleNearest(const T* input,
                        const TensorShape& input_shape,
                        const TensorShape& output_shape,
                        const vector<float>& scales,
-                       const vector<float>& roi,
+                       const ResizeTables& tables,
                        bool is_resize,
                        bool extrapolation_enabled,
                        float extrapolation_value,
                        bool use_nearest2x_optimization,
-                       GetOriginalCoordinateFunc get_original_coordinate,
-                       GetNearestPixelFunc get_nearest_pixel) {
+                       concurrency::ThreadPool* tp) {
   if (!input || !output)
     return Status(ONNXRUNTIME, FAIL,
                   is_resize ? "Resize: input/output value is nullptr"
@@ -85,125 +85,65 @@ Status UpsampleNearest(const T* input,
 
   int64_t n_dim = static_cast<int64_t>(input_shape.NumDimensions());
 
-  std::vector<int64_t> input_dim_counters(n_dim);
-  std::vector<int64_t> input_dim_factor(n_dim);
-  std::vector<bool> use_extrapolation_value(n_dim);
-  input_dim_factor[n_dim - 1] = 1;  // initialize dimension factor
-  for (int64_t dim_idx = n_dim - 2; dim_idx >= 0; dim_idx--) {
-    input_dim_factor[dim_idx] = input_dim_factor[dim_idx + 1] * input_shape[dim_idx + 1];
-  }
-
-  int64_t output_idx = 0;
-  int64_t input_idx = 0;
-
-#define OneDimensionProcessor(dim_inx)                                                                                                                                                                                                               \
-  use_extrapolation_value[dim_inx] = false;                                                                                                                                                                                                          \
-  float original_##dim_inx##_idx = get_original_coordinate(static_cast<float>(output_dim##dim_inx##_inx), scales[dim_inx], static_cast<float>(output_shape[dim_inx]), static_cast<float>(input_shape[dim_inx]), roi[dim_inx], roi[n_dim + dim_inx]); \
-  if (extrapolation_enabled && (original_##dim_inx##_idx < 0 || original_##dim_inx##_idx > input_shape[dim_inx] - 1)) use_extrapolation_value[dim_inx] = true;                                                                                       \
-  int64_t input_dim##dim_inx##_inx = get_nearest_pixel(original_##dim_inx##_idx, scales[dim_inx] < 1);                                                                                                                                               \
-  if (input_dim##dim_inx##_inx > input_shape[dim_inx] - 1) input_dim##dim_inx##_inx = input_shape[dim_inx] - 1;                                                                                                                                      \
-  if (input_dim##dim_inx##_inx < 0) input_dim##dim_inx##_inx = 0;                                                                                                                                                                                    \
-  if (input_dim##dim_inx##_inx != input_dim_counters[dim_inx]) {                                                                                                                                                                                     \
-    input_idx += (input_dim##dim_inx##_inx - input_dim_counters[dim_inx]) * input_dim_factor[dim_inx];                                                                                                                                               \
-    input_dim_counters[dim_inx] = input_dim##dim_inx##_inx;                                                                                                                                                                                          \
-  }
-
-  if (n_dim == 1) {
-    for (int64_t output_dim0_inx = 0; output_dim0_inx < output_shape[0]; output_dim0_inx++) {
-      OneDimensionProcessor(0);
-      output[output_idx++] = use_extrapolation_value[0] ? static_cast<T>(extrapolation_value) : input[input_idx];
-    }
+  if (n_dim == 4 && use_nearest2x_optimization &&
+      scales[0] == 1 && scales[1] == 1 && scales[2] == 2 && scales[3] == 2) {
+    UpsampleNearest2x<T>(input_shape[0], input_shape[1], input_shape[2], input_shape[3], input, output);
     return Status::OK();
   }
 
-  if (n_dim == 2) {
-    for (int64_t output_dim0_inx = 0; output_dim0_inx < output_shape[0]; output_dim0_inx++) {
-      OneDimensionProcessor(0);
-      for (int64_t output_dim1_inx = 0; output_dim1_inx < output_shape[1]; output_dim1_inx++) {
-        OneDimensionProcessor(1);
-        output[output_idx++] = (use_extrapolation_value[0] || use_extrapolation_value[1])
-                                   ? static_cast<T>(extrapolation_value)
-                                   : input[input_idx];
-      }
-    }
+  const int64_t output_size = output_shape.Size();
+  if (output_size == 0) {
     return Status::OK();
   }
 
-  if (n_dim == 3) {
-    for (int64_t output_dim0_inx = 0; output_dim0_inx < output_shape[0]; output_dim0_inx++) {
-      OneDimensionProcessor(0);
-      for (int64_t output_dim1_inx = 0; output_dim1_inx < output_shape[1]; output_dim1_inx++) {
-        OneDimensionProcessor(1);
-        for (int64_t output_dim2_inx = 0; output_dim2_inx < output_shape[2]; output_dim2_inx++) {
-          OneDimensionProcessor(2);
-          bool use_extrapolation = std::any_of(use_extrapolation_value.begin(), use_extrapolation_value.end(),
-                                               [](bool use_extrapolation) {
-                                                 return use_extrapolation == true;
-                                               });
-
-          output[output_idx++] = use_extrapolation ? static_cast<T>(extrapolation_value) : input[input_idx];
-        }
-      }
-    }
-    return Status::OK();
+  std::vector<int64_t> input_dim_factor(n_dim);
+  input_dim_factor[n_dim - 1] = 1;  // initialize dimension factor
+  for (int64_t dim_idx = n_dim - 2; dim_idx >= 0; dim_idx--) {
+    input_dim_factor[dim_idx] = input_dim_factor[dim_idx + 1] * input_shape[dim_idx + 1];
   }
 
-  if (n_dim == 4) {
-    if (use_nearest2x_optimization && scales[0] == 1 && scales[1] == 1 && scales[2] == 2 && scales[3] == 2) {
-      UpsampleNearest2x<T>(input_shape[0], input_shape[1], input_shape[2], input_shape[3], input, output);
-      return Status::OK();
-    }
-    for (int64_t output_dim0_inx = 0; output_dim0_inx < output_shape[0]; output_dim0_inx++) {
-      OneDimensionProcessor(0);
-      for (int64_t output_dim1_inx = 0; output_dim1_inx < output_shape[1]; output_dim1_inx++) {
-        OneDimensionProcessor(1);
-        for (int64_t output_dim2_inx = 0; output_dim2_inx < output_shape[2]; output_dim2_inx++) {
-          OneDimensionProcessor(2);
-          for (int64_t output_dim3_inx = 0; output_dim3_inx < output_shape[3]; output_dim3_inx++) {
-            OneDimensionProcessor(3);
-            bool use_extrapolation = std::any_of(use_extrapolation_value.begin(), use_extrapolation_value.end(),
-                                                 [](bool use_extrapolation) {
-                                                   return use_extrapolation == true;
-                                                 });
-
-            output[output_idx++] = use_extrapolation ? static_cast<T>(extrapolation_value) : input[input_idx];
+  // Every output row (the innermost dimension) gathers from a single input row, found from the tables of the
+  // outer dimensions. The rows are independent, so they are split across the thread pool.
+  const int64_t output_width = output_shape[n_dim - 1];
+  const ResizeAxisTable& width_table = tables.axes[n_dim - 1];
+  const double row_bytes = static_cast<double>(output_width * sizeof(T));
+
+  concurrency::ThreadPool::TryParallelFor(
+      tp, output_size / output_width, TensorOpCost{row_bytes, row_bytes, static_cast<double>(output_width) * 2},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t row = first; row < last; ++row) {
+          T* output_row = output + row * output_width;
+
+          int64_t input_idx = 0;
+          bool use_extrapolation = false;
+          int64_t output_dim_counter = row;
+          for (int64_t dim_idx = n_dim - 2; dim_idx >= 0; dim_idx--) {
+            const ResizeAxisTable& table = tables.axes[dim_idx];
+            const int64_t output_dim_inx = output_dim_counter % output_shape[dim_idx];
+            output_dim_counter /= output_shape[dim_idx];
+            input_idx += table.index[output_dim_inx] * input_dim_factor[dim_idx];
+            use_extrapolation = use_extrapolation || table.extrapolate[output_dim_inx] != 0;
           }
-        }
-      }
-    }
-    return Status::OK();
-  }
 
-#undef OneDimensionProcessor
-
-  std::vector<int64_t> output_dim_counter(n_dim);
-  output_dim_counter[n_dim - 1] = -1;  // initialize dimension counter
-
-  for (; output_idx < output_shape.Size(); output_idx++) {
-    for (int64_t dim_idx = n_dim - 1; dim_idx >= 0; dim_idx--) {
-      if (++output_dim_counter[dim_idx] < output_shape[dim_idx]) {
-        int64_t current_input_dim_counter = 0;
-        auto original_idx = get_original_coordinate(static_cast<float>(output_dim_counter[dim_idx]), scales[dim_idx],
-                                                    static_cast<float>(output_shape[dim_idx]), static_cast<float>(input_shape[dim_idx]),
-                                                    roi[dim_idx], roi[n_dim + dim_idx]);
-        current_input_dim_counter = get_nearest_pixel(original_idx, scales[dim_idx] < 1);
-        current_input_dim_counter = std::max((int64_t)0,
-                                             std::min(current_input_dim_counter, (input_shape[dim_idx] - 1)));
-
-        if (current_input_dim_counter != input_dim_counters[dim_idx]) {
-          input_idx += (current_input_dim_counter - input_dim_counters[dim_idx]) * input_dim_factor[dim_idx];
-          input_dim_counters[dim_idx] = current_input_dim_counter;
-        }
-        break;
-      } else {
-        output_dim_counter[dim_idx] = 0;
-        input_idx += (0 - input_dim_counters[dim_idx]) * input_dim_factor[dim_idx];
-        input_dim_counters[dim_idx] = 0;
-      }
-    }
+          if (use_extrapolation) {
+            std::fill_n(output_row, output_width, static_cast<T>(extrapolation_value));
+            continue;
+          }
 
-    output[output_idx] = input[input_idx];
-  }
+          const T* input_row = input + input_idx;
+          const int64_t* input_x = width_table.index.data();
+          if (extrapolation_enabled) {
+            const uint8_t* extrapolate_x = width_table.extrapolate.data();
+            for (int64_t x = 0; x < output_width; ++x) {
+              output_row[x] = extrapolate_x[x] ? static_cast<T>(extrapolation_value) : input_row[input_x[x]];
+            }
+          } else {
+            for (int64_t x = 0; x < output_width; ++x) {
+              output_row[x] = input_row[input_x[x]];
+            }
+          }
+        }
+      });
 
   return Status::OK();
 }
@@ -278,307 +218,462 @@ Status UpsampleLinear(const T* input,
   return Status::OK();
 }
 
-// The following method supports a 4-D input in 'Linear mode'
+// The following methods support a 4-D input in 'Linear mode'
 // that amounts to 'Bilinear' Upsampling/Resizing in the sense that it assumes
 // the scale values for the outermost 2 dimensions are 1.
 // This is the common use-case where the 4-D input (batched multi-channel images)
 // is usually of shape [N, C, H, W] and the scales are [1.0, 1.0, height_scale, width_scale]
+// The N x C planes are handled as one sequence of output rows split across the thread pool.
 template <typename T>
-void UpsampleBilinear(int64_t batch_size,
-                      int64_t num_channels,
+void UpsampleBilinear(int64_t num_planes,
                       int64_t input_height,
                       int64_t input_width,
                       int64_t output_height,
                       int64_t output_width,
-                      float height_scale,
-                      float width_scale,
-                      const std::vector<float>& roi,
+                      const ResizeAxisTable& y_table,
+                      const ResizeAxisTable& x_table,
                       bool use_extrapolation,
                       float extrapolation_value,
                       const T* Xdata,
                       T* Ydata,
-                      AllocatorPtr& alloc,
-                      GetOriginalCoordinateFunc get_original_coordinate) {
-  std::vector<float> y_original;
-  std::vector<float> x_original;
-
-  SafeInt<size_t> idx_buffer_size = SafeInt<size_t>(2) * sizeof(int64_t) * (output_height + output_width);
-  SafeInt<size_t> scale_buffer_size = SafeInt<size_t>(2) * sizeof(float_t) * (output_height + output_width);
-  auto inx_scale_data_buffer = alloc->Alloc(idx_buffer_size + scale_buffer_size);
-  BufferUniquePtr idx_scale_data_buffer_holder(inx_scale_data_buffer, BufferDeleter(alloc));
-  auto* idx_data = static_cast<int64_t*>(idx_scale_data_buffer_holder.get());
-  int64_t* input_width_mul_y1 = idx_data;
-  int64_t* input_width_mul_y2 = idx_data + output_height;
-  int64_t* in_x1 = idx_data + 2 * output_height;
-  int64_t* in_x2 = idx_data + 2 * output_height + output_width;
-
-  auto* scale_data = reinterpret_cast<float*>(in_x2 + output_width);
-  float* dy1 = scale_data;
-  float* dy2 = scale_data + output_height;
-  float* dx1 = scale_data + 2 * output_height;
-  float* dx2 = scale_data + 2 * output_height + output_width;
-
-  auto roi_y_start = roi.size() / 2 - 2;
-  auto roi_y_end = roi.size() - 2;
-  for (int64_t y = 0; y < output_height; ++y) {
-    float in_y = get_original_coordinate(static_cast<float>(y), height_scale,
-                                         static_cast<float>(output_height), static_cast<float>(input_height),
-                                         roi[roi_y_start], roi[roi_y_end]);
-    y_original.emplace_back(in_y);
-    in_y = std::max(0.0f, std::min(in_y, static_cast<float>(input_height - 1)));
-
-    const int64_t in_y1 = std::min(static_cast<int64_t>(in_y), input_height - 1);
-    const int64_t in_y2 = std::min(in_y1 + 1, input_height - 1);
-    dy1[y] = std::fabs(in_y - in_y1);
-    dy2[y] = std::fabs(in_y - in_y2);
-
-    if (in_y1 == in_y2) {
-      dy1[y] = 0.5f;
-      dy2[y] = 0.5f;
-    }
-
-    input_width_mul_y1[y] = input_width * in_y1;
-    input_width_mul_y2[y] = input_width * in_y2;
-  }
-
-  auto roi_x_start = roi.size() / 2 - 1;
-  auto roi_x_end = roi.size() - 1;
-  for (int64_t x = 0; x < output_width; ++x) {
-    float in_x = get_original_coordinate(static_cast<float>(x), width_scale,
-                                         static_cast<float>(output_width), static_cast<float>(input_width),
-                                         roi[roi_x_start], roi[roi_x_end]);
-    x_original.emplace_back(in_x);
-    in_x = std::max(0.0f, std::min(in_x, static_cast<float>(input_width - 1)));
-
-    in_x1[x] = std::min(static_cast<int64_t>(in_x), input_width - 1);
-    in_x2[x] = std::min(in_x1[x] + 1, input_width - 1);
-
-    dx1[x] = std::abs(in_x - in_x1[x]);
-    dx2[x] = std::abs(in_x - in_x2[x]);
-    if (in_x1[x] == in_x2[x]) {
-      dx1[x] = 0.5f;
-      dx2[x] = 0.5f;
-    }
-  }
+                      concurrency::ThreadPool* tp) {
+  const double row_bytes = static_cast<double>(output_width * sizeof(T));
+  concurrency::ThreadPool::TryParallelFor(
+      tp, num_planes * output_height, TensorOpCost{4 * row_bytes, row_bytes, static_cast<double>(output_width) * 8},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t row = first; row < last; ++row) {
+          const int64_t y = row % output_height;
+          T* Yrow = Ydata + row * output_width;
 
-  for (int64_t n = 0; n < batch_size; ++n) {
-    for (int64_t c = 0; c < num_channels; ++c) {
-      for (int64_t y = 0; y < output_height; ++y) {
-        for (int64_t x = 0; x < output_width; ++x) {
           // when use_extrapolation is set and original index of x or y is out of the dim range
           // then use extrapolation_value as the output value.
-          if (use_extrapolation &&
-              ((y_original[y] < 0 || y_original[y] > static_cast<float>(input_height - 1)) ||
-               (x_original[x] < 0 || x_original[x] > static_cast<float>(input_width - 1)))) {
-            Ydata[output_width * y + x] = static_cast<T>(extrapolation_value);
+          if (y_table.extrapolate[y]) {
+            std::fill_n(Yrow, output_width, static_cast<T>(extrapolation_value));
             continue;
           }
 
-          T X11 = Xdata[input_width_mul_y1[y] + in_x1[x]];
-          T X21 = Xdata[input_width_mul_y1[y] + in_x2[x]];
-          T X12 = Xdata[input_width_mul_y2[y] + in_x1[x]];
-          T X22 = Xdata[input_width_mul_y2[y] + in_x2[x]];
+          const T* Xplane = Xdata + (row / output_height) * input_height * input_width;
+          const T* Xrow1 = Xplane + y_table.index[y] * input_width;
+          const T* Xrow2 = Xplane + y_table.index2[y] * input_width;
+          const float dy2 = y_table.weights[2 * y];
+          const float dy1 = y_table.weights[2 * y + 1];
 
-          Ydata[output_width * y + x] = static_cast<T>(dx2[x] * dy2[y] * X11 +
-                                                       dx1[x] * dy2[y] * X21 +
-                                                       dx2[x] * dy1[y] * X12 +
-                                                       dx1[x] * dy1[y] * X22);
+          for (int64_t x = 0; x < output_width; ++x) {
+            if (x_table.extrapolate[x]) {
+              Yrow[x] = static_cast<T>(extrapolation_value);
+              continue;
+            }
+
+            const int64_t in_x1 = x_table.index[x];
+            const int64_t in_x2 = x_table.index2[x];
+            const float dx2 = x_table.weights[2 * x];
+            const float dx1 = x_table.weights[2 * x + 1];
+
+            T X11 = Xrow1[in_x1];
+            T X21 = Xrow1[in_x2];
+            T X12 = Xrow2[in_x1];
+            T X22 = Xrow2[in_x2];
+
+            Yrow[x] = static_cast<T>(dx2 * dy2 * X11 +
+                                     dx1 * dy2 * X21 +
+                                     dx2 * dy1 * X12 +
+                                     dx1 * dy1 * X22);
+          }
         }
-      }
-      Xdata += input_height * input_width;
-      Ydata += output_width * output_height;
-    }
-  }
+      });
 }
 
-// Calculates cubic coeff based on Robert Keys approach
-// https://ieeexplore.ieee.org/document/1163711
-std::array<float, CubicModeGridLength> GetCubicCoeffs(float s, float cubic_coeff_a = -0.75) {
-  auto abs_s = std::abs(s);
-  std::array<float, CubicModeGridLength> coeffs;
-  coeffs[0] = static_cast<float>(((cubic_coeff_a * (abs_s + 1) - 5 * cubic_coeff_a) * (abs_s + 1) + 8 * cubic_coeff_a) * (abs_s + 1) - 4 * cubic_coeff_a);
-  coeffs[1] = static_cast<float>(((cubic_coeff_a + 2) * abs_s - (cubic_coeff_a + 3)) * abs_s * abs_s + 1);
-  coeffs[2] = static_cast<float>(((cubic_coeff_a + 2) * (1 - abs_s) - (cubic_coeff_a + 3)) * (1 - abs_s) * (1 - abs_s) + 1);
-  coeffs[3] = static_cast<float>(((cubic_coeff_a * (2 - abs_s) - 5 * cubic_coeff_a) * (2 - abs_s) + 8 * cubic_coeff_a) * (2 - abs_s) - 4 * cubic_coeff_a);
-  return coeffs;
-}
+// Bilinear interpolation of float data is separable: the 2 input rows of an output row are interpolated along x,
+// then blended with contiguous, vectorizable loops. Consecutive output rows usually share input rows, so the last
+// 2 interpolated rows are kept. Other types keep the direct formula above so integer results are not changed by
+// the different rounding.
+void UpsampleBilinear(int64_t num_planes,
+                      int64_t input_height,
+                      int64_t input_width,
+                      int64_t output_height,
+                      int64_t output_width,
+                      const ResizeAxisTable& y_table,
+                      const ResizeAxisTable& x_table,
+                      bool use_extrapolation,
+                      float extrapolation_value,
+                      const float* Xdata,
+                      float* Ydata,
+                      concurrency::ThreadPool* tp) {
+  const double row_bytes = static_cast<double>(output_width * sizeof(float));
+  concurrency::ThreadPool::TryParallelFor(
+      tp, num_planes * output_height, TensorOpCost{2 * row_bytes, row_bytes, static_cast<double>(output_width) * 4},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        std::vector<float> row_buffer(static_cast<size_t>(2 * output_width));
+        float* rows[2] = {row_buffer.data(), row_buffer.data() + output_width};
+        // The input rows interpolated in 'rows', as plane * input_height + y
+        int64_t cached_rows[2] = {-1, -1};
+
+        const int64_t* in_x1 = x_table.index.data();
+        const int64_t* in_x2 = x_table.index2.data();
+        const float* dx = x_table.weights.data();
+        auto interpolate_row = [&](int64_t input_row, int slot) {
+          const float* Xrow = Xdata + input_row * input_width;
+          float* interpolated = rows[slot];
+          for (int64_t x = 0; x < output_width; ++x) {
+            interpolated[x] = dx[2 * x] * Xrow[in_x1[x]] + dx[2 * x + 1] * Xrow[in_x2[x]];
+          }
+          cached_rows[slot] = input_row;
+        };
 
-// Get the tensor data at the requested coordinate
-template <typename T>
-T GetDataForCoordinate(const T* Xdata,
-                       int64_t x, int64_t y,
-                       int64_t input_height, int64_t input_width) {
-  x = std::max(static_cast<int64_t>(0), std::min(x, input_width - 1));
-  y = std::max(static_cast<int64_t>(0), std::min(y, input_height - 1));
-  return Xdata[y * input_width + x];
-}
+        for (std::ptrdiff_t row = first; row < last; ++row) {
+          const int64_t y = row % output_height;
+          float* Yrow = Ydata + row * output_width;
 
-// Computes cubic convolution interpolation in 1D
-template <typename T>
-float CubicInterpolation1D(const T* Xdata,
-                           int64_t x,
-                           int64_t y,
-                           int64_t input_height,
-                           int64_t input_width,
-                           std::array<float, CubicModeGridLength>& coeff_array,
-                           float coeff_sum,
-                           std::unordered_map<int64_t, float>& cache) {
-  // When calculating cubic interpolation we move the 4*4 grid across the original data and therefore there is
-  // opportunity to cache the results for previously seen combinations.
-  // Check if the result is already available in the cache
-  auto grid_start_pos = (y)*input_width + (x - 1);
-  if (cache.find(grid_start_pos) != cache.end()) {
-    return cache[grid_start_pos];
-  }
+          if (y_table.extrapolate[y]) {
+            std::fill_n(Yrow, output_width, extrapolation_value);
+            continue;
+          }
 
-  // get the neighbors in 1D and find interpolation for this dimension
-  // for 1D cubic interpolation 4 samples are used. 2 on the left and 2 on the right of x
-  float result = 0;
-  for (int i = 0, j = -1; i < static_cast<int>(CubicModeGridLength); i++, j++) {
-    auto orig_data = GetDataForCoordinate(Xdata, x + j, y, input_height, input_width);
-    result += coeff_array[i] / coeff_sum * orig_data;
-  }
-  cache[grid_start_pos] = result;
+          const int64_t plane_row = (row / output_height) * input_height;
+          const int64_t input_row1 = plane_row + y_table.index[y];
+          const int64_t input_row2 = plane_row + y_table.index2[y];
 
-  return result;
-}
+          int slot1 = cached_rows[0] == input_row1 ? 0 : (cached_rows[1] == input_row1 ? 1 : -1);
+          if (slot1 < 0) {
+            slot1 = cached_rows[0] == input_row2 ? 1 : 0;
+            interpolate_row(input_row1, slot1);
+          }
+          int slot2 = cached_rows[slot1] == input_row2 ? slot1 : 1 - slot1;
+          if (cached_rows[slot2] != input_row2) {
+            interpolate_row(input_row2, slot2);
+          }
 
-template <typename T>
-void ResizeBiCubic(
-    int64_t batch_size,
-    int64_t num_channels,
-    int64_t input_height,
-    int64_t input_width,
-    int64_t output_height,
-    int64_t output_width,
-    float height_scale,
-    float width_scale,
-    float cubic_coeff_a,
-    bool use_extrapolation,
-    float extrapolation_value,
-    bool exclude_outside,
-    const std::vector<float>& roi,
-    const T* Xdata,
-    T* Ydata,
-    GetOriginalCoordinateFunc get_original_coordinate) {
-  std::vector<float> y_original;
-  std::vector<float> x_original;
-  std::unordered_map<float, std::array<float, CubicModeGridLength>> cubic_coeffs;
-  std::unordered_map<float, std::unordered_map<int64_t, float>> coeff_to_1Dinterpolation_map;
-  auto roi_y_start = roi.size() / 2 - 2;
-  auto roi_y_end = roi.size() - 2;
-  auto roi_x_start = roi.size() / 2 - 1;
-  auto roi_x_end = roi.size() - 1;
-
-  // generate coefficients in y direction
-  for (int64_t y = 0; y < output_height; ++y) {
-    float in_y = get_original_coordinate(static_cast<float>(y), height_scale,
-                                         static_cast<float>(output_height), static_cast<float>(input_height),
-                                         roi[roi_y_start], roi[roi_y_end]);
-    y_original.emplace_back(in_y);
-    auto s = y_original[y] - std::floor(y_original[y]);
-    if (cubic_coeffs.find(s) == cubic_coeffs.end()) {
-      cubic_coeffs[s] = GetCubicCoeffs(s, cubic_coeff_a);
-      coeff_to_1Dinterpolation_map[s] = {};
-    }
-  }
+          const float* row1 = rows[slot1];
+          const float* row2 = rows[slot2];
+          const float dy2 = y_table.weights[2 * y];
+          const float dy1 = y_table.weights[2 * y + 1];
+          for (int64_t x = 0; x < output_width; ++x) {
+            Yrow[x] = dy2 * row1[x] + dy1 * row2[x];
+          }
 
-  // generate coefficients in x direction
-  for (int64_t x = 0; x < output_width; ++x) {
-    float in_x = get_original_coordinate(static_cast<float>(x), width_scale,
-                                         static_cast<float>(output_width), static_cast<float>(input_width),
-                                         roi[roi_x_start], roi[roi_x_end]);
-    x_original.emplace_back(in_x);
-    auto s = x_original[x] - std::floor(x_original[x]);
-    if (cubic_coeffs.find(s) == cubic_coeffs.end()) {
-      cubic_coeffs[s] = GetCubicCoeffs(s, cubic_coeff_a);
-      coeff_to_1Dinterpolation_map[s] = {};
-    }
-  }
+          if (use_extrapolation) {
+            for (int64_t x = 0; x < output_width; ++x) {
+              if (x_table.extrapolate[x]) {
+                Yrow[x] = extrapolation_value;
+              }
+            }
+          }
+        }
+      });
+}
 
-  // setup up temp arrays to hold coefficients when exclude_outside is set to true
-  std::array<float, CubicModeGridLength> y_coeff_holder;
-  std::array<float, CubicModeGridLength> x_coeff_holder;
-  float y_coeff_sum = 1;
-  float x_coeff_sum = 1;
+// Bilinear resize of a 4-D input of shape [N, H, W, C] with the scales [1.0, height_scale, width_scale, 1.0].
+// The channels of a pixel are contiguous, so every output pixel blends 4 input pixels with a vectorizable loop
+// over the channels. The N x output height rows are split across the thread pool.
+template <typename T>
+void NhwcUpsampleBilinear(int64_t batch_size,
+                          int64_t num_channels,
+                          int64_t input_height,
+                          int64_t input_width,
+                          int64_t output_height,
+                          int64_t output_width,
+                          const ResizeAxisTable& y_table,
+                          const ResizeAxisTable& x_table,
+                          float extrapolation_value,
+                          const T* Xdata,
+                          T* Ydata,
+                          concurrency::ThreadPool* tp) {
+  const int64_t output_row_size = output_width * num_channels;
+  const double row_bytes = static_cast<double>(output_row_size * sizeof(T));
+  concurrency::ThreadPool::TryParallelFor(
+      tp, batch_size * output_height, TensorOpCost{4 * row_bytes, row_bytes, static_cast<double>(output_row_size) * 8},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t row = first; row < last; ++row) {
+          const int64_t y = row % output_height;
+          T* Yrow = Ydata + row * output_row_size;
+
+          if (y_table.extrapolate[y]) {
+            std::fill_n(Yrow, output_row_size, static_cast<T>(extrapolation_value));
+            continue;
+          }
 
-  for (int64_t n = 0; n < batch_size; n++) {
-    for (int64_t c = 0; c < num_channels; c++) {
-      for (int64_t y = 0; y < output_height; ++y) {
-        auto in_y = y_original[y];
+          const T* Ximage = Xdata + (row / output_height) * input_height * input_width * num_channels;
+          const T* Xrow1 = Ximage + y_table.index[y] * input_width * num_channels;
+          const T* Xrow2 = Ximage + y_table.index2[y] * input_width * num_channels;
+          const float dy2 = y_table.weights[2 * y];
+          const float dy1 = y_table.weights[2 * y + 1];
 
-        // when use_extrapolation is set and original index is out of the dim range
-        // then use extrapolation_value as the output value.
-        if (use_extrapolation && (in_y < 0 || in_y > static_cast<float>(input_height - 1))) {
           for (int64_t x = 0; x < output_width; ++x) {
-            Ydata[y * output_width + x] = extrapolation_value;
-          }
-          continue;
-        }
+            T* Ypixel = Yrow + x * num_channels;
+            if (x_table.extrapolate[x]) {
+              std::fill_n(Ypixel, num_channels, static_cast<T>(extrapolation_value));
+              continue;
+            }
 
-        auto y_int = static_cast<int64_t>(std::floor(in_y));
-        auto& coeff_y = exclude_outside ? y_coeff_holder : cubic_coeffs[in_y - y_int];
-        y_coeff_sum = 1;
-
-        if (exclude_outside) {
-          // When true, the weight of sampling locations outside the grid will be set to 0
-          // and the weight will be renormalized so that their sum is 1.0
-          y_coeff_sum = 0;
-          auto& orig_y_coeffs = cubic_coeffs[in_y - y_int];
-          for (int64_t i = 0, y_val = y_int - 1; y_val <= y_int + 2; y_val++, i++) {
-            y_coeff_holder[i] = (y_val < 0 || y_val >= static_cast<float>(input_height)) ? 0.0f : orig_y_coeffs[i];
-            y_coeff_sum += y_coeff_holder[i];
+            const T* X11 = Xrow1 + x_table.index[x] * num_channels;
+            const T* X21 = Xrow1 + x_table.index2[x] * num_channels;
+            const T* X12 = Xrow2 + x_table.index[x] * num_channels;
+            const T* X22 = Xrow2 + x_table.index2[x] * num_channels;
+            const float dx2 = x_table.weights[2 * x];
+            const float dx1 = x_table.weights[2 * x + 1];
+            const float w11 = dx2 * dy2;
+            const float w21 = dx1 * dy2;
+            const float w12 = dx2 * dy1;
+            const float w22 = dx1 * dy1;
+
+            for (int64_t c = 0; c < num_channels; ++c) {
+              Ypixel[c] = static_cast<T>(w11 * X11[c] + w21 * X21[c] + w12 * X12[c] + w22 * X22[c]);
+            }
           }
         }
+      });
+}
 
-        for (int64_t x = 0; x < output_width; ++x) {
-          auto in_x = x_original[x];
+// Calculates cubic coeff based on Robert Keys approach
+// https://ieeexplore.ieee.org/document/1163711
+std::array<float, CubicModeGridLength> GetCubicCoeffs(float s, float cubic_coeff_a = -0.75) {
+  auto abs_s = std::abs(s);
+  std::array<float, CubicModeGridLength> coeffs;
+  coeffs[0] = static_cast<float>(((cubic_coeff_a * (abs_s + 1) - 5 * cubic_coeff_a) * (abs_s + 1) + 8 * cubic_coeff_a) * (abs_s + 1) - 4 * cubic_coeff_a);
+  coeffs[1] = static_cast<float>(((cubic_coeff_a + 2) * abs_s - (cubic_coeff_a + 3)) * abs_s * abs_s + 1);
+  coeffs[2] = static_cast<float>(((cubic_coeff_a + 2) * (1 - abs_s) - (cubic_coeff_a + 3)) * (1 - abs_s) * (1 - abs_s) + 1);
+  coeffs[3] = static_cast<float>(((cubic_coeff_a * (2 - abs_s) - 5 * cubic_coeff_a) * (2 - abs_s) + 8 * cubic_coeff_a) * (2 - abs_s) - 4 * cubic_coeff_a);
+  return coeffs;
+}
+
+// Bicubic resize of the N x C planes. The interpolation is separable: the input rows are interpolated along x when
+// an output row of the plane first uses them, and the output rows blend 4 of them with vectorizable loops.
+// The N x C x output height rows are split across the thread pool.
+void ResizeBiCubic(int64_t num_planes,
+                   int64_t input_height,
+                   int64_t input_width,
+                   int64_t output_height,
+                   int64_t output_width,
+                   const ResizeAxisTable& y_table,
+                   const ResizeAxisTable& x_table,
+                   bool use_extrapolation,
+                   float extrapolation_value,
+                   const float* Xdata,
+                   float* Ydata,
+                   concurrency::ThreadPool* tp) {
+  const double row_bytes = static_cast<double>(output_width * sizeof(float));
+  concurrency::ThreadPool::TryParallelFor(
+      tp, num_planes * output_height, TensorOpCost{4 * row_bytes, row_bytes, static_cast<double>(output_width) * 16},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        // The input rows of the current plane interpolated along x
+        std::vector<float> interpolated_rows(static_cast<size_t>(input_height * output_width));
+        std::vector<uint8_t> interpolated(static_cast<size_t>(input_height));
+        int64_t interpolated_plane = -1;
+
+        const int64_t* in_x = x_table.index2.data();
+        const float* coeff_x = x_table.weights.data();
+
+        for (std::ptrdiff_t row = first; row < last; ++row) {
+          const int64_t plane = row / output_height;
+          const int64_t y = row % output_height;
+          float* Yrow = Ydata + row * output_width;
 
           // when use_extrapolation is set and original index is out of the dim range
           // then use extrapolation_value as the output value.
-          if (use_extrapolation && (in_x < 0 || in_x > static_cast<float>(input_width - 1))) {
-            Ydata[y * output_width + x] = extrapolation_value;
+          if (y_table.extrapolate[y]) {
+            std::fill_n(Yrow, output_width, extrapolation_value);
             continue;
           }
 
-          auto x_int = static_cast<int64_t>(std::floor(in_x));
-          auto s_x = static_cast<float>(in_x - x_int);
-          auto& coeff_x = exclude_outside ? x_coeff_holder : cubic_coeffs[s_x];
-          x_coeff_sum = 1;
-
-          if (exclude_outside) {
-            // When true, the weight of sampling locations outside the grid will be set to 0
-            // and the weight will be renormalized so that their sum is 1.0
-            x_coeff_sum = 0;
-            auto& orig_x_coeff = cubic_coeffs[s_x];
-            for (int64_t i = 0, x_val = x_int - 1; x_val <= x_int + 2; x_val++, i++) {
-              x_coeff_holder[i] = (x_val < 0 || x_val >= static_cast<float>(input_width)) ? 0.0f : orig_x_coeff[i];
-              x_coeff_sum += x_coeff_holder[i];
+          if (plane != interpolated_plane) {
+            std::fill(interpolated.begin(), interpolated.end(), static_cast<uint8_t>(0));
+            interpolated_plane = plane;
+          }
+
+          const float* Xplane = Xdata + plane * input_height * input_width;
+          for (size_t i = 0; i < CubicModeGridLength; ++i) {
+            const int64_t in_y = y_table.index2[CubicModeGridLength * y + i];
+            float* interpolated_row = interpolated_rows.data() + in_y * output_width;
+
+            // cubic interpolation in x dimension using the x coefficients
+            if (!interpolated[in_y]) {
+              const float* Xrow = Xplane + in_y * input_width;
+              for (int64_t x = 0; x < output_width; ++x) {
+                const int64_t* samples = in_x + CubicModeGridLength * x;
+                const float* coeffs = coeff_x + CubicModeGridLength * x;
+                float result = 0;
+                for (size_t j = 0; j < CubicModeGridLength; ++j) {
+                  result += coeffs[j] * Xrow[samples[j]];
+                }
+                interpolated_row[x] = result;
+              }
+              interpolated[in_y] = 1;
+            }
+
+            // From the result of cubic interpolation in x dim, compute cubic interpolation in y dimension
+            const float coeff_y = y_table.weights[CubicModeGridLength * y + i];
+            if (i == 0) {
+              for (int64_t x = 0; x < output_width; ++x) {
+                Yrow[x] = interpolated_row[x] * coeff_y;
+              }
+            } else {
+              for (int64_t x = 0; x < output_width; ++x) {
+                Yrow[x] += interpolated_row[x] * coeff_y;
+              }
             }
           }
 
-          // Compute cubic interpolation in x dimension using the x coefficients.
-          // From the result of cubic interpolation in x dim, compute cubic interpolation in y dimension
-          auto& interpolation_result_cache = coeff_to_1Dinterpolation_map[s_x];
-          float result = 0;
-          for (int64_t y_val = y_int - 1, i = 0; y_val <= y_int + 2; y_val++, i++) {
-            auto x_interpolation_result = CubicInterpolation1D(Xdata, x_int, y_val,
-                                                               input_height, input_width, coeff_x, x_coeff_sum,
-                                                               interpolation_result_cache);
-            result += x_interpolation_result * coeff_y[i] / y_coeff_sum;
+          if (use_extrapolation) {
+            for (int64_t x = 0; x < output_width; ++x) {
+              if (x_table.extrapolate[x]) {
+                Yrow[x] = extrapolation_value;
+              }
+            }
           }
+        }
+      });
+}
+
+// Fills the table of an axis with the input index of every output coordinate in 'nearest' mode
+void BuildNearestTable(ResizeAxisTable& table,
+                       int64_t input_length,
+                       int64_t output_length,
+                       float scale,
+                       float roi_start,
+                       float roi_end,
+                       bool use_extrapolation,
+                       const GetOriginalCoordinateFunc& get_original_coordinate,
+                       const GetNearestPixelFunc& get_nearest_pixel) {
+  table.index.resize(output_length);
+  table.extrapolate.assign(output_length, 0);
+  for (int64_t i = 0; i < output_length; ++i) {
+    float original_idx = get_original_coordinate(static_cast<float>(i), scale,
+                                                 static_cast<float>(output_length), static_cast<float>(input_length),
+                                                 roi_start, roi_end);
+    if (use_extrapolation && (original_idx < 0 || original_idx > input_length - 1)) {
+      table.extrapolate[i] = 1;
+    }
+    int64_t input_idx = get_nearest_pixel(original_idx, scale < 1);
+    table.index[i] = std::max(static_cast<int64_t>(0), std::min(input_idx, input_length - 1));
+  }
+}
+
+// Fills the table of an axis with the 2 input indices and their weights for every output coordinate in
+// 'linear' mode
+void BuildLinearTable(ResizeAxisTable& table,
+                      int64_t input_length,
+                      int64_t output_length,
+                      float scale,
+                      float roi_start,
+                      float roi_end,
+                      bool use_extrapolation,
+                      const GetOriginalCoordinateFunc& get_original_coordinate) {
+  table.index.resize(output_length);
+  table.index2.resize(output_length);
+  table.weights.resize(2 * output_length);
+  table.extrapolate.assign(output_length, 0);
+  for (int64_t i = 0; i < output_length; ++i) {
+    float in = get_original_coordinate(static_cast<float>(i), scale,
+                                       static_cast<float>(output_length), static_cast<float>(input_length),
+                                       roi_start, roi_end);
+    if (use_extrapolation && (in < 0 || in > static_cast<float>(input_length - 1))) {
+      table.extrapolate[i] = 1;
+    }
+    in = std::max(0.0f, std::min(in, static_cast<float>(input_length - 1)));
+
+    const int64_t in1 = std::min(static_cast<int64_t>(in), input_length - 1);
+    const int64_t in2 = std::min(in1 + 1, input_length - 1);
+    float d1 = std::fabs(in - in1);
+    float d2 = std::fabs(in - in2);
+    if (in1 == in2) {
+      d1 = 0.5f;
+      d2 = 0.5f;
+    }
+
+    // the weight of a sample is the distance to the other one
+    table.index[i] = in1;
+    table.index2[i] = in2;
+    table.weights[2 * i] = d2;
+    table.weights[2 * i + 1] = d1;
+  }
+}
 
-          Ydata[y * output_width + x] = static_cast<T>(result);
+// Fills the table of an axis with the 4 input indices, clamped to the input, and their normalized coefficients
+// for every output coordinate in 'cubic' mode
+void BuildCubicTable(ResizeAxisTable& table,
+                     int64_t input_length,
+                     int64_t output_length,
+                     float scale,
+                     float roi_start,
+                     float roi_end,
+                     bool use_extrapolation,
+                     float cubic_coeff_a,
+                     bool exclude_outside,
+                     const GetOriginalCoordinateFunc& get_original_coordinate) {
+  table.index2.resize(CubicModeGridLength * output_length);
+  table.weights.resize(CubicModeGridLength * output_length);
+  table.extrapolate.assign(output_length, 0);
+  for (int64_t i = 0; i < output_length; ++i) {
+    float in = get_original_coordinate(static_cast<float>(i), scale,
+                                       static_cast<float>(output_length), static_cast<float>(input_length),
+                                       roi_start, roi_end);
+    if (use_extrapolation && (in < 0 || in > static_cast<float>(input_length - 1))) {
+      table.extrapolate[i] = 1;
+    }
+
+    const auto in_int = static_cast<int64_t>(std::floor(in));
+    auto coeffs = GetCubicCoeffs(in - std::floor(in), cubic_coeff_a);
+    float coeff_sum = 1;
+
+    if (exclude_outside) {
+      // When true, the weight of sampling locations outside the grid will be set to 0
+      // and the weight will be renormalized so that their sum is 1.0
+      coeff_sum = 0;
+      for (int64_t j = 0, val = in_int - 1; val <= in_int + 2; val++, j++) {
+        if (val < 0 || val >= input_length) {
+          coeffs[j] = 0.0f;
         }
+        coeff_sum += coeffs[j];
       }
+    }
 
-      Xdata += input_height * input_width;
-      Ydata += output_height * output_width;
+    for (int64_t j = 0, val = in_int - 1; val <= in_int + 2; val++, j++) {
+      table.index2[CubicModeGridLength * i + j] = std::max(static_cast<int64_t>(0), std::min(val, input_length - 1));
+      table.weights[CubicModeGridLength * i + j] = coeffs[j] / coeff_sum;
+    }
+  }
+}
 
-      // clear the cache when moving to the next channel
-      coeff_to_1Dinterpolation_map.clear();
+template <typename T>
+std::shared_ptr<const ResizeTables> Upsample<T>::GetTables(const std::vector<int64_t>& input_dims,
+                                                           const std::vector<int64_t>& output_dims,
+                                                           const std::vector<float>& scales,
+                                                           const std::vector<float>& roi,
+                                                           const std::vector<size_t>& axes) const {
+  std::lock_guard<OrtMutex> lock(tables_mutex_);
+  if (tables_ != nullptr && tables_->input_dims == input_dims && tables_->output_dims == output_dims &&
+      tables_->scales == scales && tables_->roi == roi) {
+    return tables_;
+  }
+
+  auto tables = std::make_shared<ResizeTables>();
+  tables->input_dims = input_dims;
+  tables->output_dims = output_dims;
+  tables->scales = scales;
+  tables->roi = roi;
+
+  const size_t rank = input_dims.size();
+  tables->axes.resize(rank);
+  for (size_t axis : axes) {
+    ResizeAxisTable& table = tables->axes[axis];
+    switch (mode_) {
+      case UpsampleMode::NN:
+        BuildNearestTable(table, input_dims[axis], output_dims[axis], scales[axis], roi[axis], roi[rank + axis],
+                          use_extrapolation_, get_original_coordinate_, get_nearest_pixel_);
+        break;
+      case UpsampleMode::LINEAR:
+        BuildLinearTable(table, input_dims[axis], output_dims[axis], scales[axis], roi[axis], roi[rank + axis],
+                         use_extrapolation_, get_original_coordinate_);
+        break;
+      case UpsampleMode::CUBIC:
+        BuildCubicTable(table, input_dims[axis], output_dims[axis], scales[axis], roi[axis], roi[rank + axis],
+                        use_extrapolation_, cubic_coeff_a_, exclude_outside_, get_original_coordinate_);
+        break;
     }
   }
+
+  tables_ = tables;
+  return tables_;
 }
 
 template <typename T>
@@ -612,51 +707,59 @@ Status Upsample<T>::BaseCompute(OpKernelContext* context,
     return Status::OK();
   }
 
+  concurrency::ThreadPool* tp = context->GetOperatorThreadPool();
+
   switch (mode_) {
-    case UpsampleMode::NN:
+    case UpsampleMode::NN: {
+      std::vector<size_t> axes(dims.size());
+      std::iota(axes.begin(), axes.end(), static_cast<size_t>(0));
+      auto tables = GetTables(dims, output_dims, scales, roi, axes);
       return UpsampleNearest<T>(X->template Data<T>(), Y->template MutableData<T>(), X->Shape(), Y->Shape(),
-                                scales, roi, is_resize_, use_extrapolation_, extrapolation_value_,
-                                use_nearest2x_optimization_, get_original_coordinate_, get_nearest_pixel_);
+                                scales, *tables, is_resize_, use_extrapolation_, extrapolation_value_,
+                                use_nearest2x_optimization_, tp);
+    }
     case UpsampleMode::LINEAR: {
       //The correct behavior of 'linear' mode for an N-D input is not clear right now,
-      //so only support 'bilinear' with 2-D or 4-D input tensor with outermost 2 scales as 1 in the 4-D case
+      //so only support 'bilinear' with 2-D or 4-D input tensor with the scales of N and C as 1 in the 4-D case
       if (dims.size() != 2 && dims.size() != 4) {
         std::ostringstream oss;
         oss << "'Linear' mode only support 2-D inputs ('Bilinear') or 4-D inputs "
-               "with the corresponding outermost 2 scale values being 1 in the ";
+               "with the scale values of the N and C dimensions being 1 in the ";
         oss << (is_resize_ ? "Resize operator" : "Upsample operator");
         return Status(ONNXRUNTIME, FAIL, oss.str());
       }
 
       bool is_2D = dims.size() == 2;
-      const int64_t batch_size = is_2D ? 1 : dims[0];
-      const int64_t num_channels = is_2D ? 1 : dims[1];
-      const int64_t input_height = is_2D ? dims[0] : dims[2];
-      const int64_t input_width = is_2D ? dims[1] : dims[3];
-      const int64_t output_height = is_2D ? output_dims[0] : output_dims[2];
-      const int64_t output_width = is_2D ? output_dims[1] : output_dims[3];
-
-      AllocatorPtr alloc;
-      ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
-      UpsampleBilinear(batch_size, num_channels, input_height, input_width, output_height, output_width,
-                       is_2D ? scales[0] : scales[2], is_2D ? scales[1] : scales[3], roi,
-                       use_extrapolation_, extrapolation_value_, X->template Data<T>(),
-                       Y->template MutableData<T>(), alloc, get_original_coordinate_);
+      // A 4-D input is NCHW unless the scale of the second dimension is not 1, then it is NHWC
+      bool is_nhwc = !is_2D && scales[1] != 1;
+      const size_t height_axis = is_2D ? 0 : (is_nhwc ? 1 : 2);
+      const size_t width_axis = height_axis + 1;
+      auto tables = GetTables(dims, output_dims, scales, roi, {height_axis, width_axis});
+
+      if (is_nhwc) {
+        NhwcUpsampleBilinear(dims[0], dims[3], dims[1], dims[2], output_dims[1], output_dims[2],
+                             tables->axes[height_axis], tables->axes[width_axis], extrapolation_value_,
+                             X->template Data<T>(), Y->template MutableData<T>(), tp);
+        return Status::OK();
+      }
+
+      const int64_t num_planes = is_2D ? 1 : dims[0] * dims[1];
+      UpsampleBilinear(num_planes, dims[height_axis], dims[width_axis],
+                       output_dims[height_axis], output_dims[width_axis],
+                       tables->axes[height_axis], tables->axes[width_axis], use_extrapolation_, extrapolation_value_,
+                       X->template Data<T>(), Y->template MutableData<T>(), tp);
       return Status::OK();
     }
     case UpsampleMode::CUBIC: {
       bool is_2D = dims.size() == 2;
-      const int64_t batch_size = is_2D ? 1 : dims[0];
-      const int64_t num_channels = is_2D ? 1 : dims[1];
-      const int64_t input_height = is_2D ? dims[0] : dims[2];
-      const int64_t input_width = is_2D ? dims[1] : dims[3];
-      const int64_t output_height = is_2D ? output_dims[0] : output_dims[2];
-      const int64_t output_width = is_2D ? output_dims[1] : output_dims[3];
-
-      ResizeBiCubic(batch_size, num_channels, input_height, input_width, output_height, output_width,
-                    is_2D ? scales[0] : scales[2], is_2D ? scales[1] : scales[3], cubic_coeff_a_, use_extrapolation_,
-                    extrapolation_value_, exclude_outside_, roi, X->template Data<float>(), Y->template MutableData<float>(),
-                    get_original_coordinate_);
+      const int64_t num_planes = is_2D ? 1 : dims[0] * dims[1];
+      const size_t height_axis = is_2D ? 0 : 2;
+      const size_t width_axis = height_axis + 1;
+      auto tables = GetTables(dims, output_dims, scales, roi, {height_axis, width_axis});
+
+      ResizeBiCubic(num_planes, dims[height_axis], dims[width_axis], output_dims[height_axis], output_dims[width_axis],
+                    tables->axes[height_axis], tables->axes[width_axis], use_extrapolation_, extrapolation_value_,
+                    X->template Data<float>(), Y->template MutableData<float>(), tp);
       return Status::OK();
     }
     default:
@@ -4,7 +4,9 @@
 #pragma once
 
 #include "core/framework/op_kernel.h"
+#include "core/platform/ort_mutex.h"
 #include <cmath>
+#include <memory>
 
 namespace onnxruntime {
 
@@ -44,6 +46,28 @@ enum ResizeNearestMode {
   NearestModeCount = 5,
 };
 
+// The input coordinates and the weights of the output coordinates of an axis
+struct ResizeAxisTable {
+  // nearest: the input index. linear: the lower input index. cubic: the floor of the original coordinate.
+  std::vector<int64_t> index;
+  // linear: the upper input index
+  std::vector<int64_t> index2;
+  // linear: the weights of index and index2. cubic: the normalized weights of the 4 samples around index.
+  std::vector<float> weights;
+  // Non zero for the output coordinates that take the extrapolation value
+  std::vector<uint8_t> extrapolate;
+};
+
+// The interpolation tables only depend on the shapes, the scales and the roi. They are computed once per run and
+// shared by all the planes, and kept across runs while these do not change.
+struct ResizeTables {
+  std::vector<int64_t> input_dims;
+  std::vector<int64_t> output_dims;
+  std::vector<float> scales;
+  std::vector<float> roi;
+  std::vector<ResizeAxisTable> axes;
+};
+
 class UpsampleBase {
  protected:
   UpsampleBase(OpKernelInfo info) : scales_cached_(false), roi_cached_(false), use_extrapolation_(false) {
@@ -276,9 +300,15 @@ class UpsampleBase {
       }
     }
 
-    if (UpsampleMode::LINEAR == mode || UpsampleMode::CUBIC == mode) {
+    if (UpsampleMode::LINEAR == mode) {
+      ORT_ENFORCE(scales.size() == 2 || (scales.size() == 4 && scales[0] == 1 && (scales[1] == 1 || scales[3] == 1)),
+                  "'Linear' mode only supports 2-D inputs ('Bilinear') or 4-D inputs with the scale values of "
+                  "the N and C dimensions being 1 (NCHW or NHWC layout) in the ",
+                  is_resize_ ? "Resize operator" : "Upsample operator");
+    }
+    if (UpsampleMode::CUBIC == mode) {
       ORT_ENFORCE(scales.size() == 2 || (scales.size() == 4 && scales[0] == 1 && scales[1] == 1),
-                  "'Linear' mode and 'Cubic' mode only support 2-D inputs ('Bilinear', 'Bicubic') or 4-D inputs "
+                  "'Cubic' mode only supports 2-D inputs ('Bicubic') or 4-D inputs "
                   "with the corresponding outermost 2 scale values being 1 in the ",
                   is_resize_ ? "Resize operator" : "Upsample operator");
     }
@@ -331,6 +361,16 @@ class Upsample : public UpsampleBase, public OpKernel {
 
   Status BaseCompute(OpKernelContext* context, const std::vector<float>& roi, const std::vector<float>& scales,
                      const std::vector<int64_t>& output_dims) const;
+
+ private:
+  // Returns the interpolation tables of 'axes', from the cache if the shapes, scales and roi did not change
+  std::shared_ptr<const ResizeTables> GetTables(const std::vector<int64_t>& input_dims,
+                                                const std::vector<int64_t>& output_dims,
+                                                const std::vector<float>& scales, const std::vector<float>& roi,
+                                                const std::vector<size_t>& axes) const;
+
+  mutable std::shared_ptr<const ResizeTables> tables_;
+  mutable OrtMutex tables_mutex_;
 };
 
 }  // namespace onnxruntime
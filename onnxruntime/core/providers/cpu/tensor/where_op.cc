@@ -101,14 +101,16 @@ SelectBroadcastLoop(bool target, TBroadcaster<bool, T>* select_broadcaster,
 
 template <typename T>
 std::unique_ptr<Tensor> Select(bool target, const Tensor& condition_tensor, const Tensor& value_tensor,
-                               TensorAllocator<T>& tensor_allocator) {
+                               TensorAllocator<T>& tensor_allocator, concurrency::ThreadPool* tp) {
   TBroadcaster<bool, T> select_broadcaster{condition_tensor, value_tensor};
   std::unique_ptr<Tensor> select_tensor{
       tensor_allocator.Allocate(select_broadcaster.GetOutputShape())};
-  TBroadcastOutput<T> select_broadcast_output{
-      select_broadcaster.GetSpanSize(), *select_tensor};
 
-  SelectBroadcastLoop(target, &select_broadcaster, &select_broadcast_output);
+  ParallelBroadcastLoop<T>(
+      tp, select_broadcaster, *select_tensor,
+      [target](TBroadcaster<bool, T>& broadcaster, TBroadcastOutput<T>& broadcast_output) {
+        SelectBroadcastLoop(target, &broadcaster, &broadcast_output);
+      });
 
   return select_tensor;
 }
@@ -180,17 +182,20 @@ Status Where<T>::Compute(OpKernelContext* context) const {
   //   Y_selection = !condition ? Y : default value
   // Finally, we broadcast over and merge X_selection and Y_selection:
   //   output = (X_selection != default value) ? X_selection : Y_selection
+  concurrency::ThreadPool* tp = context->GetOperatorThreadPool();
   TensorAllocator<T> tensor_allocator{*context};
-  auto X_selection_tensor = Select<T>(true, *condition, *X, tensor_allocator);
-  auto Y_selection_tensor = Select<T>(false, *condition, *Y, tensor_allocator);
+  auto X_selection_tensor = Select<T>(true, *condition, *X, tensor_allocator, tp);
+  auto Y_selection_tensor = Select<T>(false, *condition, *Y, tensor_allocator, tp);
 
   TBroadcaster<T, T> merge_broadcaster{*X_selection_tensor, *Y_selection_tensor};
   Tensor* const output = context->Output(0, merge_broadcaster.GetOutputShape());
   ORT_ENFORCE(output, "failed to get first output!");
-  TBroadcastOutput<T> merge_broadcast_output{
-      merge_broadcaster.GetSpanSize(), *output};
 
-  MergeBroadcastLoop(&merge_broadcaster, &merge_broadcast_output);
+  ParallelBroadcastLoop<T>(
+      tp, merge_broadcaster, *output,
+      [](TBroadcaster<T, T>& broadcaster, TBroadcastOutput<T>& broadcast_output) {
+        MergeBroadcastLoop(&broadcaster, &broadcast_output);
+      });
 
   return Status::OK();
 }
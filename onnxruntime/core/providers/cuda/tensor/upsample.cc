@@ -49,6 +49,10 @@ Status Upsample<T>::BaseCompute(OpKernelContext* context,
   if (roi.size() != 2 * X->Shape().GetDims().size())
     return Status(ONNXRUNTIME, INVALID_ARGUMENT,
                   "Resize: size of roi array should be 2 * N where N is the rank of input tensor X.");
+  if (UpsampleMode::LINEAR == mode_ && rank == 4 && (scales[0] != 1 || scales[1] != 1))
+    return Status(ONNXRUNTIME, INVALID_ARGUMENT,
+                  is_resize_ ? "Resize: 'Linear' mode only supports 4-D inputs in the NCHW layout."
+                             : "Upsample: 'Linear' mode only supports 4-D inputs in the NCHW layout.");
 
   Tensor* Y = context->Output(0, output_dims);
   typedef typename ToCudaType<T>::MappedType CudaT;
@@ -77,20 +77,43 @@ common::Status IOBinding::BindOutput(const std::string& name, const OrtValue& ml
   auto rc = Contains(output_names_, name);
   if (rc.first) {
     outputs_[rc.second] = ml_value;
+    outputs_allocated_by_session_[rc.second] = !ml_value.IsAllocated();
     return Status::OK();
   }
 
   output_names_.push_back(name);
   outputs_.push_back(ml_value);
+  outputs_allocated_by_session_.push_back(!ml_value.IsAllocated());
   return Status::OK();
 }
 
+void IOBinding::ClearInputs() {
+  feed_names_.clear();
+  feeds_.clear();
+}
+
+void IOBinding::ClearOutputs() {
+  output_names_.clear();
+  outputs_.clear();
+  outputs_allocated_by_session_.clear();
+}
+
+void IOBinding::ResetSessionAllocatedOutputs() {
+  for (size_t i = 0, end = outputs_.size(); i < end; ++i) {
+    if (outputs_allocated_by_session_[i]) {
+      outputs_[i] = OrtValue();
+    }
+  }
+}
+
 const std::vector<std::string>& IOBinding::GetOutputNames() const {
   return output_names_;
 }
 
 std::vector<OrtValue>& IOBinding::GetOutputs() { return outputs_; }
 
+const std::vector<OrtValue>& IOBinding::GetOutputs() const { return outputs_; }
+
 const std::vector<std::string>& IOBinding::GetInputNames() const {
   return feed_names_;
 }
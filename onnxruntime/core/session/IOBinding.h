@@ -60,14 +60,23 @@ class IOBinding {
   common::Status SynchronizeOutputs();
   /**
     * This simply provides the names and optionally allocated output containers.
+    * If ml_value is allocated the output is written directly into it on every run, so its shape must match the
+    * shape of the output. If it isn't allocated the session allocates the output on every run.
     */
   common::Status BindOutput(const std::string& name, const OrtValue& ml_value);
 
+  /**
+    * Removes all bound inputs or outputs so the binding can be reused with a different set of names.
+    */
+  void ClearInputs();
+  void ClearOutputs();
+
   /**
     * This simply collects the outputs obtained after calling Run() inside the @param outputs.
     */
   const std::vector<std::string>& GetOutputNames() const;
   std::vector<OrtValue>& GetOutputs();
+  const std::vector<OrtValue>& GetOutputs() const;
 
   const std::vector<std::string>& GetInputNames() const;
   const std::vector<OrtValue>& GetInputs() const;
@@ -83,11 +92,18 @@ class IOBinding {
   friend InferenceSession;
 
   IOBinding(const SessionState& session_state);
+
+  // Drops the values the session allocated for outputs that were bound without memory in the previous run, so
+  // that a reused binding doesn't force the shape of that run on the next one.
+  void ResetSessionAllocatedOutputs();
+
   const SessionState& session_state_;
   std::vector<std::string> feed_names_;
   std::vector<OrtValue> feeds_;
   std::vector<std::string> output_names_;
   std::vector<OrtValue> outputs_;
+  // true for the outputs that were bound without memory
+  std::vector<bool> outputs_allocated_by_session_;
 
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(IOBinding);
 };
@@ -944,6 +944,21 @@ const SessionOptions& InferenceSession::GetSessionOptions() const {
   return session_options_;
 }
 
+common::Status InferenceSession::GetArenaStats(const std::string& provider_type, AllocatorStats& stats) const {
+  const IExecutionProvider* provider = execution_providers_.Get(provider_type);
+  if (provider == nullptr) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Execution provider ", provider_type,
+                           " is not registered with this session.");
+  }
+
+  stats.Clear();
+  AllocatorPtr allocator = provider->GetAllocator(0, OrtMemTypeDefault);
+  if (allocator != nullptr && allocator->Info().alloc_type == OrtArenaAllocator) {
+    static_cast<IArenaAllocator*>(allocator.get())->GetStats(&stats);
+  }
+  return Status::OK();
+}
+
 common::Status InferenceSession::CheckShapes(const std::string& input_name, const TensorShape& input_shape,
                                              const TensorShape& expected_shape) const {
   auto input_shape_sz = input_shape.NumDimensions();
@@ -1281,6 +1296,7 @@ common::Status InferenceSession::NewIOBinding(std::unique_ptr<IOBinding>* io_bin
 common::Status InferenceSession::Run(const RunOptions& run_options, IOBinding& io_binding) {
   // TODO should Run() call io_binding.SynchronizeInputs() or should it let the callers do it?
   // io_binding.SynchronizeInputs();
+  io_binding.ResetSessionAllocatedOutputs();
   return Run(run_options, io_binding.GetInputNames(), io_binding.GetInputs(), io_binding.GetOutputNames(),
              &io_binding.GetOutputs());
 }
@@ -10,6 +10,7 @@
 #include "core/common/logging/logging.h"
 #include "core/common/profiler.h"
 #include "core/common/status.h"
+#include "core/framework/arena.h"
 #include "core/framework/execution_providers.h"
 #include "core/framework/framework_common.h"
 #include "core/framework/iexecutor.h"
@@ -317,6 +318,15 @@ class InferenceSession {
    */
   const SessionOptions& GetSessionOptions() const;
 
+  /**
+    * Get the statistics of the arena used for the default memory of an execution provider, e.g. to find the
+    * high-water mark of the memory used by the session.
+    * @param provider_type the registered execution provider to query.
+    * @param stats receives the statistics. They are all zero if the provider doesn't allocate from an arena.
+    * @return INVALID_ARGUMENT if the execution provider is not registered.
+    */
+  common::Status GetArenaStats(const std::string& provider_type, AllocatorStats& stats) const;
+
   /**
     * Start profiling on this inference session. This simply turns on profiling events to be
     * recorded. A corresponding EndProfiling has to follow to write profiling data to a file.
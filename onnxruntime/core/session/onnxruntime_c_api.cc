@@ -22,6 +22,7 @@
 #include "core/framework/tensorprotoutils.h"
 #include "core/framework/onnxruntime_typeinfo.h"
 #include "core/session/inference_session.h"
+#include "core/session/IOBinding.h"
 #include "core/session/ort_apis.h"
 #include "core/session/ort_env.h"
 #include "core/framework/data_types.h"
@@ -509,6 +510,149 @@ ORT_API_STATUS_IMPL(OrtApis::Run, _Inout_ OrtSession* sess,
   API_IMPL_END
 }
 
+ORT_API_STATUS_IMPL(OrtApis::CreateIoBinding, _Inout_ OrtSession* sess, _Outptr_ OrtIoBinding** out) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<::onnxruntime::InferenceSession*>(sess);
+  std::unique_ptr<::onnxruntime::IOBinding> binding;
+  auto status = session->NewIOBinding(&binding);
+  if (!status.IsOK()) {
+    return ToOrtStatus(status);
+  }
+  *out = reinterpret_cast<OrtIoBinding*>(binding.release());
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::BindInput, _Inout_ OrtIoBinding* binding, _In_ const char* name,
+                    _In_ const OrtValue* value) {
+  API_IMPL_BEGIN
+  if (name == nullptr || name[0] == '\0') {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "input name cannot be empty");
+  }
+  auto io_binding = reinterpret_cast<::onnxruntime::IOBinding*>(binding);
+  return ToOrtStatus(io_binding->BindInput(name, *value));
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::BindOutput, _Inout_ OrtIoBinding* binding, _In_ const char* name,
+                    _In_ const OrtValue* value) {
+  API_IMPL_BEGIN
+  if (name == nullptr || name[0] == '\0') {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "output name cannot be empty");
+  }
+  auto io_binding = reinterpret_cast<::onnxruntime::IOBinding*>(binding);
+  return ToOrtStatus(io_binding->BindOutput(name, *value));
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::BindOutputToDevice, _Inout_ OrtIoBinding* binding, _In_ const char* name,
+                    _In_ const OrtMemoryInfo* mem_info) {
+  API_IMPL_BEGIN
+  if (name == nullptr || name[0] == '\0') {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "output name cannot be empty");
+  }
+  if (mem_info->device.Type() != OrtDevice::CPU) {
+    return OrtApis::CreateStatus(ORT_NOT_IMPLEMENTED,
+                                 "only CPU outputs can be bound without a value. bind a preallocated value instead.");
+  }
+  auto io_binding = reinterpret_cast<::onnxruntime::IOBinding*>(binding);
+  return ToOrtStatus(io_binding->BindOutput(name, OrtValue()));
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::GetBoundOutputNames, _In_ const OrtIoBinding* binding, _Inout_ OrtAllocator* allocator,
+                    _Out_ char** buffer, _Out_ size_t** lengths, _Out_ size_t* count) {
+  API_IMPL_BEGIN
+  auto io_binding = reinterpret_cast<const ::onnxruntime::IOBinding*>(binding);
+  const auto& output_names = io_binding->GetOutputNames();
+
+  *buffer = nullptr;
+  *lengths = nullptr;
+  *count = output_names.size();
+  if (output_names.empty()) {
+    return nullptr;
+  }
+
+  size_t total_length = 0;
+  for (const auto& name : output_names) {
+    total_length += name.size();
+  }
+
+  auto* names = reinterpret_cast<char*>(allocator->Alloc(allocator, total_length));
+  auto* name_lengths = reinterpret_cast<size_t*>(allocator->Alloc(allocator, output_names.size() * sizeof(size_t)));
+  char* dst = names;
+  for (size_t i = 0; i != output_names.size(); ++i) {
+    memcpy(dst, output_names[i].data(), output_names[i].size());
+    dst += output_names[i].size();
+    name_lengths[i] = output_names[i].size();
+  }
+
+  *buffer = names;
+  *lengths = name_lengths;
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::GetBoundOutputValues, _In_ const OrtIoBinding* binding, _Inout_ OrtAllocator* allocator,
+                    _Out_ OrtValue*** output, _Out_ size_t* count) {
+  API_IMPL_BEGIN
+  auto io_binding = reinterpret_cast<const ::onnxruntime::IOBinding*>(binding);
+  const auto& output_names = io_binding->GetOutputNames();
+  const auto& outputs = io_binding->GetOutputs();
+
+  *output = nullptr;
+  *count = outputs.size();
+  if (outputs.empty()) {
+    return nullptr;
+  }
+
+  for (size_t i = 0; i != outputs.size(); ++i) {
+    if (!outputs[i].IsAllocated()) {
+      std::string message = "output '" + output_names[i] + "' has no value. call RunWithBinding first.";
+      return OrtApis::CreateStatus(ORT_FAIL, message.c_str());
+    }
+  }
+
+  // the values share the buffers of the bound outputs
+  std::vector<std::unique_ptr<OrtValue>> values;
+  values.reserve(outputs.size());
+  for (const auto& value : outputs) {
+    values.push_back(onnxruntime::make_unique<OrtValue>(value));
+  }
+
+  auto* result = reinterpret_cast<OrtValue**>(allocator->Alloc(allocator, values.size() * sizeof(OrtValue*)));
+  for (size_t i = 0; i != values.size(); ++i) {
+    result[i] = values[i].release();
+  }
+  *output = result;
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API(void, OrtApis::ClearBoundInputs, _Inout_ OrtIoBinding* binding) {
+  reinterpret_cast<::onnxruntime::IOBinding*>(binding)->ClearInputs();
+}
+
+ORT_API(void, OrtApis::ClearBoundOutputs, _Inout_ OrtIoBinding* binding) {
+  reinterpret_cast<::onnxruntime::IOBinding*>(binding)->ClearOutputs();
+}
+
+ORT_API_STATUS_IMPL(OrtApis::RunWithBinding, _Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions* run_options,
+                    _Inout_ OrtIoBinding* binding) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<::onnxruntime::InferenceSession*>(sess);
+  auto io_binding = reinterpret_cast<::onnxruntime::IOBinding*>(binding);
+  Status status;
+  if (run_options == nullptr) {
+    OrtRunOptions op;
+    status = session->Run(op, *io_binding);
+  } else {
+    status = session->Run(*run_options, *io_binding);
+  }
+  return ToOrtStatus(status);
+  API_IMPL_END
+}
+
 ORT_API_STATUS_IMPL(OrtApis::IsTensor, _In_ const OrtValue* value, int* out) {
   auto v = reinterpret_cast<const ::OrtValue*>(value);
   *out = v->IsTensor() ? 1 : 0;
@@ -681,6 +825,23 @@ ORT_API_STATUS_IMPL(OrtApis::SessionEndProfiling, _In_ OrtSession* sess, _Inout_
   API_IMPL_END
 }
 
+ORT_API_STATUS_IMPL(OrtApis::SessionGetArenaStats, _In_ const OrtSession* sess, _In_ const char* provider_type,
+                    _Out_ int64_t* bytes_in_use, _Out_ int64_t* total_allocated_bytes,
+                    _Out_ int64_t* max_bytes_in_use, _Out_ int64_t* num_allocs) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<const ::onnxruntime::InferenceSession*>(sess);
+  onnxruntime::AllocatorStats stats;
+  auto status = session->GetArenaStats(provider_type, stats);
+  if (!status.IsOK())
+    return ToOrtStatus(status);
+  *bytes_in_use = stats.bytes_in_use;
+  *total_allocated_bytes = stats.total_allocated_bytes;
+  *max_bytes_in_use = stats.max_bytes_in_use;
+  *num_allocs = stats.num_allocs;
+  return nullptr;
+  API_IMPL_END
+}
+
 ORT_API_STATUS_IMPL(OrtApis::SessionGetModelMetadata, _In_ const OrtSession* sess,
                     _Outptr_ OrtModelMetadata** out) {
   API_IMPL_BEGIN
@@ -1515,7 +1676,18 @@ static constexpr OrtApi ort_api_1_to_3 = {
     &OrtApis::CreateEnvWithGlobalThreadPools,
     &OrtApis::DisablePerSessionThreads,
     &OrtApis::CreateThreadingOptions,
-    &OrtApis::ReleaseThreadingOptions};
+    &OrtApis::ReleaseThreadingOptions,
+    &OrtApis::CreateIoBinding,
+    &OrtApis::ReleaseIoBinding,
+    &OrtApis::BindInput,
+    &OrtApis::BindOutput,
+    &OrtApis::BindOutputToDevice,
+    &OrtApis::GetBoundOutputNames,
+    &OrtApis::GetBoundOutputValues,
+    &OrtApis::ClearBoundInputs,
+    &OrtApis::ClearBoundOutputs,
+    &OrtApis::RunWithBinding,
+    &OrtApis::SessionGetArenaStats};
 
 // Assert to do a limited check to ensure Version 1 of OrtApi never changes (will detect an addition or deletion but not if they cancel out each other)
 // If this assert hits, read the above 'Rules on how to add a new Ort API version'
@@ -1544,3 +1716,4 @@ DEFINE_RELEASE_ORT_OBJECT_FUNCTION(Value, OrtValue)
 DEFINE_RELEASE_ORT_OBJECT_FUNCTION(RunOptions, OrtRunOptions)
 DEFINE_RELEASE_ORT_OBJECT_FUNCTION(Session, ::onnxruntime::InferenceSession)
 DEFINE_RELEASE_ORT_OBJECT_FUNCTION(ModelMetadata, ::onnxruntime::ModelMetadata)
+DEFINE_RELEASE_ORT_OBJECT_FUNCTION(IoBinding, ::onnxruntime::IOBinding)
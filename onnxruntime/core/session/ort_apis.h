@@ -185,4 +185,22 @@ ORT_ALL_ARGS_NONNULL;
 ORT_API_STATUS_IMPL(DisablePerSessionThreads, _In_ OrtSessionOptions* options);
 ORT_API_STATUS_IMPL(CreateThreadingOptions, _Outptr_ OrtThreadingOptions** out);
 ORT_API(void, ReleaseThreadingOptions, _Frees_ptr_opt_ OrtThreadingOptions*);
+
+ORT_API_STATUS_IMPL(CreateIoBinding, _Inout_ OrtSession* sess, _Outptr_ OrtIoBinding** out);
+ORT_API(void, ReleaseIoBinding, _Frees_ptr_opt_ OrtIoBinding*);
+ORT_API_STATUS_IMPL(BindInput, _Inout_ OrtIoBinding* binding, _In_ const char* name, _In_ const OrtValue* value);
+ORT_API_STATUS_IMPL(BindOutput, _Inout_ OrtIoBinding* binding, _In_ const char* name, _In_ const OrtValue* value);
+ORT_API_STATUS_IMPL(BindOutputToDevice, _Inout_ OrtIoBinding* binding, _In_ const char* name,
+                    _In_ const OrtMemoryInfo* mem_info);
+ORT_API_STATUS_IMPL(GetBoundOutputNames, _In_ const OrtIoBinding* binding, _Inout_ OrtAllocator* allocator,
+                    _Out_ char** buffer, _Out_ size_t** lengths, _Out_ size_t* count);
+ORT_API_STATUS_IMPL(GetBoundOutputValues, _In_ const OrtIoBinding* binding, _Inout_ OrtAllocator* allocator,
+                    _Out_ OrtValue*** output, _Out_ size_t* count);
+ORT_API(void, ClearBoundInputs, _Inout_ OrtIoBinding* binding);
+ORT_API(void, ClearBoundOutputs, _Inout_ OrtIoBinding* binding);
+ORT_API_STATUS_IMPL(RunWithBinding, _Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions* run_options,
+                    _Inout_ OrtIoBinding* binding);
+ORT_API_STATUS_IMPL(SessionGetArenaStats, _In_ const OrtSession* sess, _In_ const char* provider_type,
+                    _Out_ int64_t* bytes_in_use, _Out_ int64_t* total_allocated_bytes,
+                    _Out_ int64_t* max_bytes_in_use, _Out_ int64_t* num_allocs);
 }  // namespace OrtApis
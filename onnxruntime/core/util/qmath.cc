@@ -60,4 +60,56 @@ void QGemmu8u8_s32(
   GemmlowpMultiplyu8u8_s32(lhs_data, rhs_data, result_data, lhs_offset, rhs_offset, M, N, K, thread_pool);
 #endif
 }
+
+void QGemmApplyColumnZeroPoints(
+    int M,
+    int N,
+    int K,
+    const uint8_t* lhs_data,
+    int lda,
+    const uint8_t lhs_offset,
+    const uint8_t* rhs_zero_points,
+    int32_t* result_data,
+    int ldc) {
+  // C[m][n] -= rhs_zero_points[n] * sum(A[m][k] - lhs_offset)
+  for (int m = 0; m < M; m++) {
+    int32_t row_sum = 0;
+    for (int k = 0; k < K; k++) {
+      row_sum += static_cast<int32_t>(lhs_data[k]) - lhs_offset;
+    }
+    for (int n = 0; n < N; n++) {
+      result_data[n] -= static_cast<int32_t>(rhs_zero_points[n]) * row_sum;
+    }
+    lhs_data += lda;
+    result_data += ldc;
+  }
+}
+
+void QGemmApplyRowZeroPoints(
+    int M,
+    int N,
+    int K,
+    const uint8_t* lhs_zero_points,
+    const uint8_t* rhs_data,
+    int ldb,
+    const uint8_t rhs_offset,
+    int32_t* column_sums,
+    int32_t* result_data,
+    int ldc) {
+  // C[m][n] -= lhs_zero_points[m] * sum(B[k][n] - rhs_offset)
+  std::fill_n(column_sums, N, -static_cast<int32_t>(rhs_offset) * K);
+  for (int k = 0; k < K; k++) {
+    for (int n = 0; n < N; n++) {
+      column_sums[n] += rhs_data[n];
+    }
+    rhs_data += ldb;
+  }
+  for (int m = 0; m < M; m++) {
+    const int32_t zero_point = lhs_zero_points[m];
+    for (int n = 0; n < N; n++) {
+      result_data[n] -= zero_point * column_sums[n];
+    }
+    result_data += ldc;
+  }
+}
 }  // namespace onnxruntime
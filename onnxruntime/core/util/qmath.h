@@ -39,4 +39,45 @@ void QGemmu8u8_s32(
     int ldc,
     concurrency::ThreadPool* thread_pool);
 
+// Adjusts the result of a GEMM that was computed with a zero right hand side
+// offset for per-column right hand side zero points, as used by weights that
+// are quantized per output channel.
+void QGemmApplyColumnZeroPoints(
+    int M,
+    int N,
+    int K,
+    const uint8_t* lhs_data,
+    int lda,
+    const uint8_t lhs_offset,
+    const uint8_t* rhs_zero_points,
+    int32_t* result_data,
+    int ldc);
+
+// Adjusts the result of a GEMM that was computed with a zero left hand side
+// offset for per-row left hand side zero points, as used by convolution
+// filters that are quantized per output channel. column_sums is scratch space
+// for N elements.
+void QGemmApplyRowZeroPoints(
+    int M,
+    int N,
+    int K,
+    const uint8_t* lhs_zero_points,
+    const uint8_t* rhs_data,
+    int ldb,
+    const uint8_t rhs_offset,
+    int32_t* column_sums,
+    int32_t* result_data,
+    int ldc);
+
+// Returns true if all of the zero points are the same value, in which case a
+// per channel zero point can be passed to the GEMM as a single offset.
+inline bool IsUniformZeroPoint(const uint8_t* zero_points, size_t count) {
+  for (size_t i = 1; i < count; i++) {
+    if (zero_points[i] != zero_points[0]) {
+      return false;
+    }
+  }
+  return true;
+}
+
 }  // namespace onnxruntime
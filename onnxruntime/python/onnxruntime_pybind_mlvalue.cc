@@ -98,7 +98,45 @@ bool PyObjectCheck_Array(PyObject* o) {
   return PyObject_HasAttrString(o, "__array_finalize__");
 }
 
+static bool IsNumericNumpyType(int npy_type) {
+  return npy_type != NPY_UNICODE && npy_type != NPY_STRING && npy_type != NPY_VOID && npy_type != NPY_OBJECT;
+}
+
+// Creates a tensor from a numeric array. Arrays that are C-contiguous, aligned and in native byte order are used
+// in place. Others are converted with a single copy into a buffer from 'alloc'.
+static std::unique_ptr<Tensor> CreateNumericTensor(AllocatorPtr alloc, const std::string& name_input,
+                                                   PyArrayObject* pyObject) {
+  const int npy_type = PyArray_TYPE(pyObject);
+  int ndim = PyArray_NDIM(pyObject);
+  npy_intp* npy_dims = PyArray_DIMS(pyObject);
+  std::vector<int64_t> dims(npy_dims, npy_dims + ndim);
+  TensorShape shape(dims);
+  auto element_type = NumpyToOnnxRuntimeTensorType(npy_type);
+
+  if (PyArray_ISCARRAY_RO(pyObject)) {
+    return onnxruntime::make_unique<Tensor>(element_type, shape, PyArray_DATA(pyObject), alloc->Info());
+  }
+
+  // view the tensor's buffer as a native, contiguous array and let numpy copy the strided or swapped input into it
+  auto p_tensor = onnxruntime::make_unique<Tensor>(element_type, shape, alloc);
+  PyObject* dst = PyArray_NewFromDescr(&PyArray_Type, PyArray_DescrFromType(npy_type), ndim, npy_dims, nullptr,
+                                       p_tensor->MutableDataRaw(), NPY_ARRAY_CARRAY, nullptr);
+  if (dst == nullptr) {
+    throw std::runtime_error("Unable to create a view over the tensor for input '" + name_input + "'.");
+  }
+  int ret = PyArray_CopyInto(reinterpret_cast<PyArrayObject*>(dst), pyObject);
+  Py_DECREF(dst);
+  if (ret != 0) {
+    throw std::runtime_error("Unable to copy the data of input '" + name_input + "'.");
+  }
+  return p_tensor;
+}
+
 std::unique_ptr<Tensor> CreateTensor(AllocatorPtr alloc, const std::string& name_input, PyArrayObject* pyObject) {
+  if (IsNumericNumpyType(PyArray_TYPE(pyObject))) {
+    return CreateNumericTensor(alloc, name_input, pyObject);
+  }
+
   PyArrayObject* darray = PyArray_GETCONTIGUOUS(pyObject);
   if (darray == NULL) {
     throw std::runtime_error(std::string("The object must be a contiguous array for input '") + name_input + std::string("'."));
@@ -117,71 +155,58 @@ std::unique_ptr<Tensor> CreateTensor(AllocatorPtr alloc, const std::string& name
 
     TensorShape shape(dims);
     auto element_type = NumpyToOnnxRuntimeTensorType(npy_type);
-    if (pyObject == darray && npy_type != NPY_UNICODE && npy_type != NPY_STRING &&
-        npy_type != NPY_VOID && npy_type != NPY_OBJECT) {
-      p_tensor = onnxruntime::make_unique<Tensor>(
-          element_type, shape, static_cast<void*>(PyArray_DATA(darray)), alloc->Info());
-    } else {
-      p_tensor = onnxruntime::make_unique<Tensor>(element_type, shape, alloc);
-      if (npy_type == NPY_UNICODE) {
-        // Copy string data which needs to be done after Tensor is allocated.
-        // Strings are Python strings or numpy.unicode string.
-        std::string* dst = p_tensor->MutableData<std::string>();
-        auto item_size = PyArray_ITEMSIZE(darray);
-        auto num_chars = item_size / PyUnicode_4BYTE_KIND;
-        char* src = static_cast<char*>(PyArray_DATA(darray));
-        const char* str;
-        Py_ssize_t size;
-        PyObject* pStr;
-        for (int i = 0; i < shape.Size(); i++, src += item_size) {
-          // Python unicode strings are assumed to be USC-4. Strings are stored as UTF-8.
-          pStr = PyUnicode_FromKindAndData(PyUnicode_4BYTE_KIND, src, num_chars);
-          str = PyUnicode_AsUTF8AndSize(pStr, &size);
-          if (str == NULL) {
-            dst[i] = "";
-          } else {
-            // Size is equal to the longest string size, numpy stores
-            // strings in a single array. Those code assumes a string ends with a final 0.
-            dst[i] = str;
-          }
-          Py_XDECREF(pStr);
-        }
-      } else if (npy_type == NPY_STRING || npy_type == NPY_VOID) {
-        // Copy string data which needs to be done after Tensor is allocated.
-        // Strings are given as bytes (encoded strings).
-        // NPY_VOID does not trim final 0.
-        // NPY_STRING assumes bytes string ends with a final 0.
-        std::string* dst = p_tensor->MutableData<std::string>();
-        auto item_size = PyArray_ITEMSIZE(darray);
-        char* src = static_cast<char*>(PyArray_DATA(darray));
-        for (int i = 0; i < shape.Size(); i++, src += item_size) {
-          if (npy_type == NPY_STRING) {
-            dst[i] = src;
-          } else {
-            dst[i].resize(item_size);
-            memcpy((void*)dst[i].c_str(), src, item_size);
-          }
+    p_tensor = onnxruntime::make_unique<Tensor>(element_type, shape, alloc);
+    if (npy_type == NPY_UNICODE) {
+      // Copy string data which needs to be done after Tensor is allocated.
+      // Strings are Python strings or numpy.unicode string.
+      std::string* dst = p_tensor->MutableData<std::string>();
+      auto item_size = PyArray_ITEMSIZE(darray);
+      auto num_chars = item_size / PyUnicode_4BYTE_KIND;
+      char* src = static_cast<char*>(PyArray_DATA(darray));
+      const char* str;
+      Py_ssize_t size;
+      PyObject* pStr;
+      for (int i = 0; i < shape.Size(); i++, src += item_size) {
+        // Python unicode strings are assumed to be USC-4. Strings are stored as UTF-8.
+        pStr = PyUnicode_FromKindAndData(PyUnicode_4BYTE_KIND, src, num_chars);
+        str = PyUnicode_AsUTF8AndSize(pStr, &size);
+        if (str == NULL) {
+          dst[i] = "";
+        } else {
+          // Size is equal to the longest string size, numpy stores
+          // strings in a single array. Those code assumes a string ends with a final 0.
+          dst[i] = str;
         }
-      } else if (npy_type == NPY_OBJECT) {
-        // Converts object into string.
-        std::string* dst = p_tensor->MutableData<std::string>();
-        auto item_size = PyArray_ITEMSIZE(darray);
-        char* src = static_cast<char*>(PyArray_DATA(darray));
-        PyObject *item, *pStr;
-        for (int i = 0; i < shape.Size(); ++i, src += item_size) {
-          // Python unicode strings are assumed to be USC-4. Strings are stored as UTF-8.
-          item = PyArray_GETITEM(darray, src);
-          pStr = PyObject_Str(item);
-          dst[i] = py::reinterpret_borrow<py::str>(pStr);
-          Py_XDECREF(pStr);
-        }
-      } else {
-        void* buffer = p_tensor->MutableDataRaw();
-        size_t len;
-        if (!IAllocator::CalcMemSizeForArray(element_type->Size(), shape.Size(), &len)) {
-          throw std::runtime_error("length overflow");
+        Py_XDECREF(pStr);
+      }
+    } else if (npy_type == NPY_STRING || npy_type == NPY_VOID) {
+      // Copy string data which needs to be done after Tensor is allocated.
+      // Strings are given as bytes (encoded strings).
+      // NPY_VOID does not trim final 0.
+      // NPY_STRING assumes bytes string ends with a final 0.
+      std::string* dst = p_tensor->MutableData<std::string>();
+      auto item_size = PyArray_ITEMSIZE(darray);
+      char* src = static_cast<char*>(PyArray_DATA(darray));
+      for (int i = 0; i < shape.Size(); i++, src += item_size) {
+        if (npy_type == NPY_STRING) {
+          dst[i] = src;
+        } else {
+          dst[i].resize(item_size);
+          memcpy((void*)dst[i].c_str(), src, item_size);
         }
-        memcpy(buffer, static_cast<void*>(PyArray_DATA(darray)), len);
+      }
+    } else {
+      // Converts object into string.
+      std::string* dst = p_tensor->MutableData<std::string>();
+      auto item_size = PyArray_ITEMSIZE(darray);
+      char* src = static_cast<char*>(PyArray_DATA(darray));
+      PyObject *item, *pStr;
+      for (int i = 0; i < shape.Size(); ++i, src += item_size) {
+        // Python unicode strings are assumed to be USC-4. Strings are stored as UTF-8.
+        item = PyArray_GETITEM(darray, src);
+        pStr = PyObject_Str(item);
+        dst[i] = py::reinterpret_borrow<py::str>(pStr);
+        Py_XDECREF(pStr);
       }
     }
   } catch (...) {
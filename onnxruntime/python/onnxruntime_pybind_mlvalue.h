@@ -22,6 +22,10 @@ namespace py = pybind11;
 
 int OnnxRuntimeTensorToNumpyType(const DataTypeImpl* tensor_type);
 
+const DataTypeImpl* NumpyToOnnxRuntimeTensorType(int numpy_type);
+
+bool PyObjectCheck_Array(PyObject* o);
+
 void CreateGenericMLValue(const onnxruntime::InputDefList* input_def_list, AllocatorPtr alloc, const std::string& name_input,
                           py::object& value, OrtValue* p_mlvalue);
 
@@ -15,6 +15,7 @@
 #include "core/common/logging/severity.h"
 #include "core/framework/TensorSeq.h"
 #include "core/framework/session_options.h"
+#include "core/session/IOBinding.h"
 
 #if USE_CUDA
 #define BACKEND_PROC "GPU"
@@ -228,12 +229,74 @@ void AddNonTensorAsPyObj(OrtValue& val, std::vector<py::object>& pyobjs) {
   }
 }
 
-void AddTensorAsPyObj(OrtValue& val, std::vector<py::object>& pyobjs) {
+// Creates a numpy array over the buffer of the tensor in 'val' without copying it. The array keeps a copy of 'val'
+// in a capsule as its base object, so the buffer is released once both ORT and Python are done with it.
+// Only tensors that own a CPU buffer of a numeric type can be shared; tensors that refer to memory owned by the
+// session (e.g. initializers returned as outputs) or by the caller are copied.
+bool GetPyObjSharingTensor(const OrtValue& val, py::object& obj) {
   const Tensor& rtensor = val.Get<Tensor>();
+  if (!rtensor.OwnsBuffer() || !rtensor.IsContiguous() || rtensor.IsDataTypeString() ||
+      rtensor.Location().device.Type() != OrtDevice::CPU) {
+    return false;
+  }
+
+  const TensorShape& shape = rtensor.Shape();
+  std::vector<npy_intp> npy_dims(shape.GetDims().cbegin(), shape.GetDims().cend());
+  const int numpy_type = OnnxRuntimeTensorToNumpyType(rtensor.DataType());
+
+  py::capsule base(new OrtValue(val), [](void* p) { delete static_cast<OrtValue*>(p); });
+  obj = py::reinterpret_steal<py::object>(PyArray_SimpleNewFromData(
+      static_cast<int>(npy_dims.size()), npy_dims.data(), numpy_type, const_cast<void*>(rtensor.DataRaw())));
+  if (!obj) {
+    throw std::runtime_error("Unable to create a numpy array over the output tensor.");
+  }
+  // PyArray_SetBaseObject steals the reference to the capsule
+  if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject*>(obj.ptr()), base.release().ptr()) != 0) {
+    throw std::runtime_error("Unable to set the base object of the numpy array over the output tensor.");
+  }
+  return true;
+}
+
+void AddTensorAsPyObj(OrtValue& val, std::vector<py::object>& pyobjs) {
   py::object obj;
-  GetPyObjFromTensor(rtensor, obj);
+  if (!GetPyObjSharingTensor(val, obj)) {
+    GetPyObjFromTensor(val.Get<Tensor>(), obj);
+  }
   pyobjs.push_back(obj);
 }
+// An IOBinding together with the Python objects whose memory the bound values refer to, which must stay alive
+// for as long as they are bound.
+struct SessionIOBinding {
+  InferenceSession* session;
+  std::unique_ptr<IOBinding> binding;
+  std::unordered_map<std::string, py::object> input_objects;
+  std::unordered_map<std::string, py::object> output_arrays;
+};
+
+// Wraps the memory of a numpy array in a tensor so that an output can be written directly into it.
+void CreateTensorMLValueOverArray(const std::string& name, py::object& array, OrtValue* p_mlvalue) {
+  if (!PyObjectCheck_Array(array.ptr())) {
+    throw std::runtime_error("Output '" + name + "' must be bound to a numpy array.");
+  }
+  PyArrayObject* darray = reinterpret_cast<PyArrayObject*>(array.ptr());
+  if (!PyArray_IS_C_CONTIGUOUS(darray) || !PyArray_ISWRITEABLE(darray)) {
+    throw std::runtime_error("Output '" + name + "' must be bound to a writeable contiguous numpy array.");
+  }
+  const int npy_type = PyArray_TYPE(darray);
+  if (npy_type == NPY_UNICODE || npy_type == NPY_STRING || npy_type == NPY_VOID || npy_type == NPY_OBJECT) {
+    throw std::runtime_error("Output '" + name + "' must be bound to a numpy array of a numeric type.");
+  }
+
+  int ndim = PyArray_NDIM(darray);
+  npy_intp* npy_dims = PyArray_DIMS(darray);
+  std::vector<int64_t> dims(npy_dims, npy_dims + ndim);
+
+  auto p_tensor = onnxruntime::make_unique<Tensor>(NumpyToOnnxRuntimeTensorType(npy_type), TensorShape(dims),
+                                                   PyArray_DATA(darray), GetAllocator()->Info());
+  auto ml_tensor = DataTypeImpl::GetType<Tensor>();
+  p_mlvalue->Init(p_tensor.release(), ml_tensor, ml_tensor->GetDeleteFunc());
+}
+
 class SessionObjectInitializer {
  public:
   typedef const SessionOptions& Arg1;
@@ -719,6 +782,66 @@ including arg name, arg type (contains both type and shape).)pbdoc")
           },
           "node shape (assuming the node holds a tensor)");
 
+  py::class_<SessionIOBinding>(m, "SessionIOBinding", R"pbdoc(Inputs and outputs bound to a session for repeated runs.)pbdoc")
+      .def(py::init([](InferenceSession* sess) {
+        auto io_binding = onnxruntime::make_unique<SessionIOBinding>();
+        io_binding->session = sess;
+        OrtPybindThrowIfError(sess->NewIOBinding(&io_binding->binding));
+        return io_binding;
+      }))
+      .def("bind_input", [](SessionIOBinding* io_binding, const std::string& name, py::object& value) -> void {
+        auto px = io_binding->session->GetModelInputs();
+        if (!px.first.IsOK() || !px.second) {
+          throw std::runtime_error("Either failed to get model inputs from the session object or the input def list was null");
+        }
+        OrtValue ml_value;
+        CreateGenericMLValue(px.second, GetAllocator(), name, value, &ml_value);
+        OrtPybindThrowIfError(io_binding->binding->BindInput(name, ml_value));
+        io_binding->input_objects[name] = value;
+      })
+      .def(
+          "bind_output", [](SessionIOBinding* io_binding, const std::string& name, py::object& array) -> void {
+            OrtValue ml_value;
+            if (array.is_none()) {
+              io_binding->output_arrays.erase(name);
+            } else {
+              CreateTensorMLValueOverArray(name, array, &ml_value);
+              io_binding->output_arrays[name] = array;
+            }
+            OrtPybindThrowIfError(io_binding->binding->BindOutput(name, ml_value));
+          },
+          py::arg("name"), py::arg("array") = py::none(),
+          R"pbdoc(Binds an output to a numpy array that runs write into, or to memory allocated by each run if array is None.)pbdoc")
+      .def("clear_binding_inputs", [](SessionIOBinding* io_binding) -> void {
+        io_binding->binding->ClearInputs();
+        io_binding->input_objects.clear();
+      })
+      .def("clear_binding_outputs", [](SessionIOBinding* io_binding) -> void {
+        io_binding->binding->ClearOutputs();
+        io_binding->output_arrays.clear();
+      })
+      .def("get_outputs", [](SessionIOBinding* io_binding) -> std::vector<py::object> {
+        const auto& output_names = io_binding->binding->GetOutputNames();
+        auto& outputs = io_binding->binding->GetOutputs();
+
+        std::vector<py::object> rfetch;
+        rfetch.reserve(outputs.size());
+        for (size_t i = 0; i < outputs.size(); ++i) {
+          // outputs bound to an array were written into it
+          auto array = io_binding->output_arrays.find(output_names[i]);
+          if (array != io_binding->output_arrays.end()) {
+            rfetch.push_back(array->second);
+          } else if (!outputs[i].IsAllocated()) {
+            rfetch.push_back(py::none());
+          } else if (outputs[i].IsTensor()) {
+            AddTensorAsPyObj(outputs[i], rfetch);
+          } else {
+            AddNonTensorAsPyObj(outputs[i], rfetch);
+          }
+        }
+        return rfetch;
+      });
+
   py::class_<SessionObjectInitializer>(m, "SessionObjectInitializer");
   py::class_<InferenceSession>(m, "InferenceSession", R"pbdoc(This is the main class used to run a model.)pbdoc")
       // In Python3, a Python bytes object will be passed to C++ functions that accept std::string or char*
@@ -789,12 +912,33 @@ including arg name, arg type (contains both type and shape).)pbdoc")
         }
         return rfetch;
       })
+      .def("run_with_iobinding", [](InferenceSession* sess, SessionIOBinding& io_binding, RunOptions* run_options = nullptr) -> void {
+        // release GIL to allow multiple python threads to invoke Run() in parallel.
+        py::gil_scoped_release release;
+        if (run_options != nullptr) {
+          OrtPybindThrowIfError(sess->Run(*run_options, *io_binding.binding));
+        } else {
+          OrtPybindThrowIfError(sess->Run(*io_binding.binding));
+        }
+      })
       .def("end_profiling", [](InferenceSession* sess) -> std::string {
         return sess->EndProfiling();
       })
       .def("get_providers", [](InferenceSession* sess) -> const std::vector<std::string>& {
         return sess->GetRegisteredProviderTypes();
       })
+      .def("get_arena_stats", [](InferenceSession* sess, const std::string& provider_type) -> py::dict {
+        AllocatorStats stats;
+        OrtPybindThrowIfError(sess->GetArenaStats(provider_type, stats));
+        py::dict result;
+        result["num_allocs"] = stats.num_allocs;
+        result["bytes_in_use"] = stats.bytes_in_use;
+        result["total_allocated_bytes"] = stats.total_allocated_bytes;
+        result["max_bytes_in_use"] = stats.max_bytes_in_use;
+        result["max_alloc_size"] = stats.max_alloc_size;
+        result["bytes_limit"] = stats.bytes_limit;
+        return result;
+      })
       .def_property_readonly("session_options", [](InferenceSession* sess) -> const SessionOptions& {
         return sess->GetSessionOptions();
       })
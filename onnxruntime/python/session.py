@@ -91,6 +91,16 @@ class InferenceSession:
         "Return list of registered execution providers."
         return self._providers
 
+    def get_arena_stats(self, provider='CPUExecutionProvider'):
+        """
+        Return the statistics of the memory arena of an execution provider as a dictionary with the keys
+        num_allocs, bytes_in_use, total_allocated_bytes, max_bytes_in_use, max_alloc_size and bytes_limit.
+        The values are zero if the provider doesn't use an arena.
+
+        :param provider: name of a registered execution provider
+        """
+        return self._sess.get_arena_stats(provider)
+
     def set_providers(self, providers):
         """
         Register the input list of execution providers. The underlying session is re-created.
@@ -153,6 +163,26 @@ class InferenceSession:
             else:
                 raise
 
+    def io_binding(self):
+        "Return an :class:`onnxruntime.IOBinding` object for this session."
+        return IOBinding(self)
+
+    def run_with_iobinding(self, iobinding, run_options=None):
+        """
+        Compute the predictions with the inputs and outputs bound to ``iobinding``.
+
+        :param iobinding: the :class:`onnxruntime.IOBinding` object created by :meth:`io_binding`
+        :param run_options: See :class:`onnxruntime.RunOptions`.
+
+        ::
+
+            binding = sess.io_binding()
+            binding.bind_input(input_name, x)
+            binding.bind_output(output_name, y)
+            sess.run_with_iobinding(binding)
+        """
+        self._sess.run_with_iobinding(iobinding._iobinding, run_options)
+
     def end_profiling(self):
         """
         End profiling and return results in a file.
@@ -161,3 +191,39 @@ class InferenceSession:
         :meth:`onnxruntime.SessionOptions.enable_profiling`.
         """
         return self._sess.end_profiling()
+
+
+class IOBinding:
+    """
+    Inputs and outputs bound to an :class:`onnxruntime.InferenceSession` once and reused by every
+    :meth:`InferenceSession.run_with_iobinding` call.
+    """
+
+    def __init__(self, session):
+        self._iobinding = C.SessionIOBinding(session._sess)
+
+    def bind_input(self, name, value):
+        """
+        :param name: input name
+        :param value: input value, see :meth:`InferenceSession.run`. Contiguous numpy arrays are not copied, so
+            changes to their content are seen by later runs.
+        """
+        self._iobinding.bind_input(name, value)
+
+    def bind_output(self, name, array=None):
+        """
+        :param name: output name
+        :param array: contiguous writeable numpy array with the type and shape of the output. Each run writes the output
+            into it. If None, each run allocates the output and it is returned by :meth:`get_outputs`.
+        """
+        self._iobinding.bind_output(name, array)
+
+    def get_outputs(self):
+        "Return the outputs of the last run, in the order they were bound."
+        return self._iobinding.get_outputs()
+
+    def clear_binding_inputs(self):
+        self._iobinding.clear_binding_inputs()
+
+    def clear_binding_outputs(self):
+        self._iobinding.clear_binding_outputs()
@@ -0,0 +1,368 @@
+#-------------------------------------------------------------------------
+# Copyright (c) Microsoft Corporation.  All rights reserved.
+# Licensed under the MIT License.
+#--------------------------------------------------------------------------
+
+# This tool runs the models listed in a manifest under a set of fixed session configurations, and records for each
+# model and configuration the session creation time, latency percentiles, throughput, peak RSS and arena high-water
+# mark. The results can be stored as a baseline, and later runs compared against it to catch performance regressions.
+# See README.md for the format of the manifest.
+#
+# Example commands:
+#   python model_benchmark.py --manifest testdata_manifest.json --save_baseline baseline.json
+#   python model_benchmark.py --manifest testdata_manifest.json --baseline baseline.json --tolerance 0.1
+
+import argparse
+import json
+import multiprocessing
+import os
+import platform
+import sys
+import timeit
+
+# Metrics recorded for each model and configuration, and whether a larger value is better.
+METRICS = {
+    "session_creation_ms": False,
+    "latency_mean_ms": False,
+    "latency_p50_ms": False,
+    "latency_p90_ms": False,
+    "latency_p95_ms": False,
+    "latency_p99_ms": False,
+    "throughput_per_sec": True,
+    "peak_rss_mb": False,
+    "arena_high_water_mb": False,
+}
+
+# Changes smaller than these are ignored, so that metrics of tiny models don't fail on timer or allocator noise.
+ABSOLUTE_TOLERANCE = {
+    "session_creation_ms": 1.0,
+    "latency_mean_ms": 0.005,
+    "latency_p50_ms": 0.005,
+    "latency_p90_ms": 0.005,
+    "latency_p95_ms": 0.005,
+    "latency_p99_ms": 0.005,
+    "throughput_per_sec": 0.0,
+    "peak_rss_mb": 1.0,
+    "arena_high_water_mb": 0.1,
+}
+
+GRAPH_OPTIMIZATION_LEVELS = {
+    "disable": "ORT_DISABLE_ALL",
+    "basic": "ORT_ENABLE_BASIC",
+    "extended": "ORT_ENABLE_EXTENDED",
+    "all": "ORT_ENABLE_ALL",
+}
+
+NUMPY_TYPES = {
+    "tensor(float)": "float32",
+    "tensor(double)": "float64",
+    "tensor(float16)": "float16",
+    "tensor(int8)": "int8",
+    "tensor(uint8)": "uint8",
+    "tensor(int16)": "int16",
+    "tensor(uint16)": "uint16",
+    "tensor(int32)": "int32",
+    "tensor(uint32)": "uint32",
+    "tensor(int64)": "int64",
+    "tensor(uint64)": "uint64",
+    "tensor(bool)": "bool",
+}
+
+
+def percentile(sorted_values, percent):
+    """
+    Return the value below which 'percent' percent of the values fall, using the nearest rank method.
+    """
+    if len(sorted_values) == 0:
+        return 0.0
+    rank = int(-(-percent * len(sorted_values) // 100))
+    return sorted_values[min(max(rank, 1), len(sorted_values)) - 1]
+
+
+def load_manifest(manifest_path):
+    with open(manifest_path) as f:
+        manifest = json.load(f)
+
+    # model paths are relative to the manifest
+    base_dir = os.path.dirname(os.path.abspath(manifest_path))
+    for model in manifest["models"]:
+        model["path"] = os.path.normpath(os.path.join(base_dir, model["path"]))
+        if "test_data_dir" in model:
+            model["test_data_dir"] = os.path.normpath(
+                os.path.join(os.path.dirname(model["path"]), model["test_data_dir"]))
+    return manifest
+
+
+def get_tolerance(manifest, model, metric, default_tolerance):
+    """
+    Return the relative tolerance of a metric. Model settings take precedence over manifest settings, which take
+    precedence over the default.
+    """
+    for tolerances in [model.get("tolerance", {}), manifest.get("tolerance", {})]:
+        if metric in tolerances:
+            return tolerances[metric]
+        if "default" in tolerances:
+            return tolerances["default"]
+    return default_tolerance
+
+
+def compare_results(baseline, current, tolerances):
+    """
+    Compare the current results with the baseline.
+    tolerances maps a result key and metric to the relative tolerance.
+    Return a list of (key, metric, baseline value, current value, relative change, status) where status is one of
+    'regression', 'improvement' or 'ok'. Results that are missing from either side are skipped.
+    """
+    comparison = []
+    for key in sorted(current):
+        if key not in baseline:
+            continue
+        for metric, higher_is_better in METRICS.items():
+            if metric not in baseline[key] or metric not in current[key]:
+                continue
+            base_value = baseline[key][metric]
+            value = current[key][metric]
+            change = (value - base_value) / base_value if base_value != 0 else 0.0
+            # a positive change means the metric got worse
+            worse = -change if higher_is_better else change
+            tolerance = tolerances(key, metric)
+
+            status = "ok"
+            if abs(value - base_value) > ABSOLUTE_TOLERANCE.get(metric, 0.0):
+                if worse > tolerance:
+                    status = "regression"
+                elif worse < -tolerance:
+                    status = "improvement"
+            comparison.append((key, metric, base_value, value, change, status))
+    return comparison
+
+
+def create_inputs(session, model, np):
+    """
+    Create the inputs of a model, either from the .pb files in its test data directory or with the generators given in
+    the manifest. Symbolic dimensions are set from the 'dims' of the model, or to its 'default_dim'.
+    """
+    if "test_data_dir" in model:
+        from onnx import numpy_helper, TensorProto
+        inputs = {}
+        input_names = [i.name for i in session.get_inputs()]
+        index = 0
+        while os.path.exists(os.path.join(model["test_data_dir"], "input_{}.pb".format(index))):
+            tensor = TensorProto()
+            with open(os.path.join(model["test_data_dir"], "input_{}.pb".format(index)), "rb") as f:
+                tensor.ParseFromString(f.read())
+            name = tensor.name if tensor.name else input_names[index]
+            inputs[name] = numpy_helper.to_array(tensor)
+            index += 1
+        return inputs
+
+    rng = np.random.RandomState(1234)
+    dims = model.get("dims", {})
+    default_dim = model.get("default_dim", 1)
+    settings = model.get("inputs", {})
+
+    inputs = {}
+    for meta in session.get_inputs():
+        if meta.type not in NUMPY_TYPES:
+            raise ValueError("Input {} of model {} has unsupported type {}".format(meta.name, model["name"],
+                                                                                  meta.type))
+        dtype = np.dtype(NUMPY_TYPES[meta.type])
+        setting = settings.get(meta.name, {})
+        shape = setting.get("shape")
+        if shape is None:
+            shape = [d if isinstance(d, int) else dims.get(d, default_dim) for d in meta.shape]
+
+        generator = setting.get("generator", "random")
+        if generator == "random":
+            if dtype.kind == "f":
+                low, high = setting.get("low", -1.0), setting.get("high", 1.0)
+                value = rng.uniform(low, high, shape)
+            else:
+                low, high = setting.get("low", 0), setting.get("high", 1)
+                value = rng.randint(low, high + 1, shape)
+        elif generator == "constant":
+            value = np.full(shape, setting.get("value", 0))
+        else:
+            raise ValueError("Unknown generator {} for input {} of model {}".format(generator, meta.name,
+                                                                                     model["name"]))
+        inputs[meta.name] = np.ascontiguousarray(value.astype(dtype))
+    return inputs
+
+
+def get_peak_rss_mb():
+    try:
+        import resource
+        peak = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+        # ru_maxrss is in kilobytes on Linux and in bytes on macOS
+        return peak / (1024.0 * 1024.0) if sys.platform == "darwin" else peak / 1024.0
+    except ImportError:
+        import psutil
+        return psutil.Process().memory_info().peak_wset / (1024.0 * 1024.0)
+
+
+def run_benchmark(model, config, settings):
+    # OpenMP environment variables shall be set before importing onnxruntime.
+    intra_op_num_threads = config.get("intra_op_num_threads", 0)
+    if intra_op_num_threads > 0:
+        os.environ["OMP_NUM_THREADS"] = str(intra_op_num_threads)
+
+    import numpy as np
+    import onnxruntime
+
+    sess_options = onnxruntime.SessionOptions()
+    sess_options.intra_op_num_threads = intra_op_num_threads
+    sess_options.inter_op_num_threads = config.get("inter_op_num_threads", 0)
+    if config.get("execution_mode", "sequential") == "parallel":
+        sess_options.execution_mode = onnxruntime.ExecutionMode.ORT_PARALLEL
+    else:
+        sess_options.execution_mode = onnxruntime.ExecutionMode.ORT_SEQUENTIAL
+    sess_options.graph_optimization_level = getattr(
+        onnxruntime.GraphOptimizationLevel, GRAPH_OPTIMIZATION_LEVELS[config.get("graph_optimization_level", "all")])
+    sess_options.enable_cpu_mem_arena = config.get("enable_cpu_mem_arena", True)
+    sess_options.enable_mem_pattern = config.get("enable_mem_pattern", True)
+
+    providers = config.get("providers", ["CPUExecutionProvider"])
+
+    start_time = timeit.default_timer()
+    session = onnxruntime.InferenceSession(model["path"], sess_options, providers=providers)
+    session_creation_ms = (timeit.default_timer() - start_time) * 1000
+
+    inputs = create_inputs(session, model, np)
+    output_names = [output.name for output in session.get_outputs()]
+
+    for _ in range(model.get("warmup_runs", settings["warmup_runs"])):
+        session.run(output_names, inputs)
+
+    runs = model.get("runs", settings["runs"])
+    latencies = []
+    start_time = timeit.default_timer()
+    for _ in range(runs):
+        run_start_time = timeit.default_timer()
+        session.run(output_names, inputs)
+        latencies.append((timeit.default_timer() - run_start_time) * 1000)
+    total_seconds = timeit.default_timer() - start_time
+
+    latencies.sort()
+    arena_stats = session.get_arena_stats(providers[0])
+
+    return {
+        "session_creation_ms": session_creation_ms,
+        "latency_mean_ms": sum(latencies) / len(latencies),
+        "latency_p50_ms": percentile(latencies, 50),
+        "latency_p90_ms": percentile(latencies, 90),
+        "latency_p95_ms": percentile(latencies, 95),
+        "latency_p99_ms": percentile(latencies, 99),
+        "throughput_per_sec": runs / total_seconds,
+        "peak_rss_mb": get_peak_rss_mb(),
+        "arena_high_water_mb": arena_stats["max_bytes_in_use"] / (1024.0 * 1024.0),
+        "onnxruntime_version": onnxruntime.__version__,
+    }
+
+
+def benchmark_process(model, config, settings, queue):
+    try:
+        queue.put(run_benchmark(model, config, settings))
+    except Exception as e:
+        queue.put({"error": str(e)})
+
+
+def launch_benchmark(model, config, settings):
+    # Each benchmark runs in its own process, so that the peak RSS is per model and the thread settings take effect.
+    queue = multiprocessing.Queue()
+    process = multiprocessing.Process(target=benchmark_process, args=(model, config, settings, queue))
+    process.start()
+    result = queue.get()
+    process.join()
+    return result
+
+
+def get_machine_info():
+    return {
+        "platform": platform.platform(),
+        "processor": platform.processor(),
+        "cpu_count": multiprocessing.cpu_count(),
+        "python": platform.python_version(),
+    }
+
+
+def parse_arguments(argv=None):
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--manifest", required=True, type=str, help="JSON file listing the models and configurations")
+    parser.add_argument("--models", nargs="+", type=str, default=None, help="only run these models of the manifest")
+    parser.add_argument("--configs", nargs="+", type=str, default=None, help="only run these configurations")
+    parser.add_argument("--runs", type=int, default=None, help="number of timed runs, overrides the manifest")
+    parser.add_argument("--output", type=str, default=None, help="write the results to this JSON file")
+    parser.add_argument("--baseline", type=str, default=None, help="compare the results with this JSON file")
+    parser.add_argument("--save_baseline", type=str, default=None, help="write the results as a new baseline")
+    parser.add_argument("--tolerance",
+                        type=float,
+                        default=None,
+                        help="relative tolerance of every metric, overrides the manifest (default 0.1)")
+    return parser.parse_args(argv)
+
+
+def main(argv=None):
+    args = parse_arguments(argv)
+    manifest = load_manifest(args.manifest)
+
+    settings = {"warmup_runs": 5, "runs": 100}
+    settings.update(manifest.get("defaults", {}))
+    if args.runs is not None:
+        settings["runs"] = args.runs
+        for model in manifest["models"]:
+            model.pop("runs", None)
+
+    models = [m for m in manifest["models"] if args.models is None or m["name"] in args.models]
+    configs = [c for c in manifest["configs"] if args.configs is None or c["name"] in args.configs]
+
+    results = {}
+    failed = []
+    for model in models:
+        for config in configs:
+            key = "{}/{}".format(model["name"], config["name"])
+            result = launch_benchmark(model, config, settings)
+            if "error" in result:
+                print("{}: failed: {}".format(key, result["error"]))
+                failed.append(key)
+                continue
+            results[key] = result
+            print("{}: create {:.1f} ms, p50 {:.3f} ms, p99 {:.3f} ms, {:.1f} runs/s, peak RSS {:.1f} MB, "
+                  "arena {:.2f} MB".format(key, result["session_creation_ms"], result["latency_p50_ms"],
+                                           result["latency_p99_ms"], result["throughput_per_sec"],
+                                           result["peak_rss_mb"], result["arena_high_water_mb"]))
+
+    report = {"machine": get_machine_info(), "settings": settings, "results": results}
+    for path in [args.output, args.save_baseline]:
+        if path:
+            with open(path, "w") as f:
+                json.dump(report, f, indent=2, sort_keys=True)
+
+    regressions = []
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        if baseline.get("machine") != report["machine"]:
+            print("Warning: the baseline was recorded on a different machine: {}".format(baseline.get("machine")))
+
+        models_by_name = {m["name"]: m for m in models}
+
+        def tolerances(key, metric):
+            if args.tolerance is not None:
+                return args.tolerance
+            return get_tolerance(manifest, models_by_name[key.split("/")[0]], metric, 0.1)
+
+        comparison = compare_results(baseline["results"], results, tolerances)
+        for key, metric, base_value, value, change, status in comparison:
+            if status != "ok":
+                print("{:12} {} {}: {:.3f} -> {:.3f} ({:+.1%})".format(status, key, metric, base_value, value, change))
+            if status == "regression":
+                regressions.append((key, metric))
+        for key in sorted(set(results) - set(baseline["results"])):
+            print("Warning: {} is not in the baseline".format(key))
+        print("{} metrics compared, {} regressions".format(len(comparison), len(regressions)))
+
+    return 1 if regressions or failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,54 @@
+#-------------------------------------------------------------------------
+# Copyright (c) Microsoft Corporation.  All rights reserved.
+# Licensed under the MIT License.
+#--------------------------------------------------------------------------
+
+import os
+import unittest
+
+from model_benchmark import compare_results, get_tolerance, load_manifest, percentile
+
+
+class TestModelBenchmark(unittest.TestCase):
+    def test_percentile(self):
+        values = [float(i) for i in range(1, 101)]
+        self.assertEqual(percentile(values, 50), 50.0)
+        self.assertEqual(percentile(values, 99), 99.0)
+        self.assertEqual(percentile(values, 100), 100.0)
+        self.assertEqual(percentile([3.0], 90), 3.0)
+        self.assertEqual(percentile([], 50), 0.0)
+
+    def test_compare_results(self):
+        baseline = {"m/c": {"latency_p50_ms": 10.0, "throughput_per_sec": 100.0, "peak_rss_mb": 50.0}}
+        current = {"m/c": {"latency_p50_ms": 12.0, "throughput_per_sec": 120.0, "peak_rss_mb": 50.5}}
+        comparison = compare_results(baseline, current, lambda key, metric: 0.1)
+        status = {metric: s for _, metric, _, _, _, s in comparison}
+        self.assertEqual(status["latency_p50_ms"], "regression")
+        self.assertEqual(status["throughput_per_sec"], "improvement")
+        # within the absolute tolerance
+        self.assertEqual(status["peak_rss_mb"], "ok")
+
+        comparison = compare_results(baseline, current, lambda key, metric: 0.25)
+        self.assertTrue(all(s == "ok" for _, _, _, _, _, s in comparison))
+
+        # results missing from the baseline are not compared
+        self.assertEqual(compare_results({}, current, lambda key, metric: 0.1), [])
+
+    def test_tolerance(self):
+        manifest = {"tolerance": {"default": 0.1, "latency_p99_ms": 0.3}}
+        model = {"name": "m", "tolerance": {"peak_rss_mb": 0.05}}
+        self.assertEqual(get_tolerance(manifest, model, "peak_rss_mb", 0.2), 0.05)
+        self.assertEqual(get_tolerance(manifest, model, "latency_p99_ms", 0.2), 0.3)
+        self.assertEqual(get_tolerance(manifest, model, "latency_p50_ms", 0.2), 0.1)
+        self.assertEqual(get_tolerance({}, {"name": "m"}, "latency_p50_ms", 0.2), 0.2)
+
+    def test_testdata_manifest(self):
+        manifest = load_manifest(os.path.join(os.path.dirname(os.path.abspath(__file__)), "testdata_manifest.json"))
+        for model in manifest["models"]:
+            self.assertTrue(os.path.isfile(model["path"]), model["path"])
+            if "test_data_dir" in model:
+                self.assertTrue(os.path.isdir(model["test_data_dir"]), model["test_data_dir"])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -444,10 +444,30 @@ class ONNXQuantizer:
         if not self.per_channel:
             return self._get_quantized_weight(initializer, qType)
 
+        # Quantize per output channel. Assuming (M x C/group x kH x kW) format where M is number of output channels.
+        return self._get_quantized_weight_per_channel(initializer, qType, 0)
+
+    def _get_quantized_weight_matmul(self, initializer, qType):
+        '''
+            :param initializer: initializer TypeProto to quantize
+            :param qType: type to quantize to
+            :return: Weight class object with quantization information for a given initializer
+        '''
+        if not self.per_channel or len(initializer.dims) != 2:
+            return self._get_quantized_weight(initializer, qType)
+
+        # Quantize per output column. Assuming (K x N) format where N is number of output columns.
+        return self._get_quantized_weight_per_channel(initializer, qType, 1)
+
+    def _get_quantized_weight_per_channel(self, initializer, qType, channel_index):
+        '''
+            :param initializer: initializer TypeProto to quantize
+            :param qType: type to quantize to
+            :param channel_index: axis of the initializer to compute quantization data along
+            :return: Weight class object with quantization information for a given initializer
+        '''
         weights = self.find_weight_data(initializer)
-        # Quantize per output channel
-        # Assuming (M x C/group x kH x kW) format where M is number of output channels.
-        channel_count = initializer.dims[0]
+        channel_count = initializer.dims[channel_index]
         np_data = np.reshape(weights, initializer.dims)
         rmin_list = []
         rmax_list = []
@@ -455,23 +475,22 @@ class ONNXQuantizer:
         scale_list = []
         quantized_per_channel_data_list = []
         for i in range(channel_count):
-            # for each channel, compute quantization data. Assuming (M x C/group x kH x kW)
-            per_channel_data = np_data[i, :, :, :].flatten()
+            # for each channel, compute quantization data.
+            per_channel_data = np_data.take(i, channel_index).flatten()
             rmin, rmax, zero_point, scale, quantized_per_channel_data = quantize_data(
-                per_channel_data.flatten().tolist(), _get_qrange_for_qType(qType), qType)
+                per_channel_data.tolist(), _get_qrange_for_qType(qType), qType)
             rmin_list.append(rmin)
             rmax_list.append(rmax)
             zero_point_list.append(zero_point)
             scale_list.append(scale)
             quantized_per_channel_data_list.append(quantized_per_channel_data)
-        channel_index = 0  # (M x C/group x kH x kW)
         # combine per_channel_data into one
         reshape_dims = list(initializer.dims)  # deep copy
         reshape_dims[channel_index] = 1  # only one per channel for reshape
         quantized_weights = np.asarray(quantized_per_channel_data_list[0]).reshape(reshape_dims)
         for i in range(1, len(quantized_per_channel_data_list)):
             channel_weights = np.asarray(quantized_per_channel_data_list[i]).reshape(reshape_dims)
-            quantized_weights = np.concatenate((quantized_weights, channel_weights), axis=0)
+            quantized_weights = np.concatenate((quantized_weights, channel_weights), axis=channel_index)
 
         weight = QuantizedInitializer(initializer.name, initializer, rmin_list, rmax_list, zero_point_list, scale_list,
                                       weights,
@@ -904,6 +923,8 @@ class ONNXQuantizer:
             if initializer is not None:
                 if node.op_type == "Conv":
                     weight = self._get_quantized_weight_convolution(initializer, self.weight_qType)
+                elif node.op_type == "MatMul" and input_index == 1:
+                    weight = self._get_quantized_weight_matmul(initializer, self.weight_qType)
                 else:
                     weight = self._get_quantized_weight(initializer, self.weight_qType)
 
@@ -0,0 +1,90 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test/perftest/latency_histogram.h"
+
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace test {
+
+using perftest::LatencyHistogram;
+
+namespace {
+
+// Percentiles are reported within 1% of the exact value.
+void ExpectNearRelative(double expected, double actual) {
+  EXPECT_NEAR(expected, actual, expected * 0.01);
+}
+
+}  // namespace
+
+TEST(LatencyHistogramTest, Empty) {
+  LatencyHistogram histogram;
+  EXPECT_EQ(histogram.Count(), 0u);
+  EXPECT_EQ(histogram.Min(), 0.0);
+  EXPECT_EQ(histogram.Max(), 0.0);
+  EXPECT_EQ(histogram.Mean(), 0.0);
+  EXPECT_EQ(histogram.Percentile(50), 0.0);
+}
+
+TEST(LatencyHistogramTest, UniformPercentiles) {
+  // 1ms, 2ms, ..., 1000ms, so the p-th percentile is p * 10ms.
+  LatencyHistogram histogram;
+  for (int i = 1; i <= 1000; ++i) {
+    histogram.Record(i * 1e-3);
+  }
+
+  EXPECT_EQ(histogram.Count(), 1000u);
+  ExpectNearRelative(1e-3, histogram.Min());
+  ExpectNearRelative(1.0, histogram.Max());
+  ExpectNearRelative(0.5005, histogram.Mean());
+
+  ExpectNearRelative(0.01, histogram.Percentile(1));
+  ExpectNearRelative(0.25, histogram.Percentile(25));
+  ExpectNearRelative(0.5, histogram.Percentile(50));
+  ExpectNearRelative(0.9, histogram.Percentile(90));
+  ExpectNearRelative(0.99, histogram.Percentile(99));
+  ExpectNearRelative(0.999, histogram.Percentile(99.9));
+
+  // the extremes are clamped to the range of the recorded values
+  ExpectNearRelative(1e-3, histogram.Percentile(0));
+  EXPECT_GE(histogram.Percentile(0), histogram.Min());
+  EXPECT_EQ(histogram.Percentile(100), histogram.Max());
+}
+
+TEST(LatencyHistogramTest, SkewedPercentiles) {
+  // 990 fast requests at 2ms and 10 slow requests at 300ms, so only the tail percentiles see the slow ones.
+  LatencyHistogram histogram;
+  for (int i = 0; i < 990; ++i) {
+    histogram.Record(2e-3);
+  }
+  for (int i = 0; i < 10; ++i) {
+    histogram.Record(0.3);
+  }
+
+  ExpectNearRelative(2e-3, histogram.Percentile(50));
+  ExpectNearRelative(2e-3, histogram.Percentile(99));
+  ExpectNearRelative(0.3, histogram.Percentile(99.1));
+  ExpectNearRelative(0.3, histogram.Percentile(100));
+}
+
+TEST(LatencyHistogramTest, Merge) {
+  // odd and even milliseconds recorded separately merge into the same distribution as UniformPercentiles.
+  LatencyHistogram odd;
+  LatencyHistogram even;
+  for (int i = 1; i <= 1000; ++i) {
+    (i % 2 == 0 ? even : odd).Record(i * 1e-3);
+  }
+
+  odd.Merge(even);
+  EXPECT_EQ(odd.Count(), 1000u);
+  ExpectNearRelative(1e-3, odd.Min());
+  ExpectNearRelative(1.0, odd.Max());
+  ExpectNearRelative(0.5005, odd.Mean());
+  ExpectNearRelative(0.5, odd.Percentile(50));
+  ExpectNearRelative(0.99, odd.Percentile(99));
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+// Y = Sigmoid(X + B) * X - S, with B broadcast along the last dimension and S a scalar.
+TEST(FusedElementwiseTest, BroadcastInputs) {
+  const std::vector<int64_t> dims{2, 3};
+  const std::vector<float> x{-1.0f, 0.5f, 2.0f, 3.0f, -0.25f, 1.5f};
+  const std::vector<float> b{0.1f, -0.2f, 0.3f};
+  const float s = 0.75f;
+
+  std::vector<float> expected(x.size());
+  for (size_t i = 0; i < x.size(); ++i) {
+    const float sigmoid = 1.0f / (1.0f + std::exp(-(x[i] + b[i % b.size()])));
+    expected[i] = sigmoid * x[i] - s;
+  }
+
+  OpTester test("FusedElementwise", 1, onnxruntime::kMSDomain);
+  test.AddAttribute("ops", std::vector<std::string>{"Add", "Sigmoid", "Mul", "Sub"});
+  test.AddAttribute("operands", std::vector<int64_t>{0, 1, 3, -1, 4, 0, 5, 2});
+  test.AddInput<float>("X", dims, x);
+  test.AddInput<float>("B", {3}, b);
+  test.AddInput<float>("S", {}, {s});
+  test.AddOutput<float>("Y", dims, expected);
+  test.Run();
+}
+
+// Large enough to span multiple tiles, with a bias that does not evenly divide the tile size.
+TEST(FusedElementwiseTest, MultipleTiles) {
+  const std::vector<int64_t> dims{3, 4000};
+  std::vector<float> x(3 * 4000);
+  std::vector<float> b(4000);
+  for (size_t i = 0; i < x.size(); ++i) {
+    x[i] = static_cast<float>(i % 97) * 0.01f;
+  }
+  for (size_t i = 0; i < b.size(); ++i) {
+    b[i] = static_cast<float>(i % 13) * 0.1f;
+  }
+
+  std::vector<float> expected(x.size());
+  for (size_t i = 0; i < x.size(); ++i) {
+    expected[i] = std::sqrt(x[i] * b[i % b.size()] + 1.0f);
+  }
+
+  OpTester test("FusedElementwise", 1, onnxruntime::kMSDomain);
+  test.AddAttribute("ops", std::vector<std::string>{"Mul", "Add", "Sqrt"});
+  test.AddAttribute("operands", std::vector<int64_t>{0, 1, 3, 2, 4, -1});
+  test.AddInput<float>("X", dims, x);
+  test.AddInput<float>("B", {4000}, b);
+  test.AddInput<float>("One", {1}, {1.0f});
+  test.AddOutput<float>("Y", dims, expected);
+  test.Run();
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,121 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <algorithm>
+#include <cmath>
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+struct QuantizedInput {
+  std::vector<int64_t> dims;
+  std::vector<uint8_t> data;
+  float scale;
+  uint8_t zero_point;
+};
+
+// Returns the flat index into an input with dims broadcast to the output position given by output_index.
+size_t BroadcastIndex(const std::vector<int64_t>& dims, const std::vector<int64_t>& output_dims,
+                      const std::vector<int64_t>& output_index) {
+  const size_t rank_offset = output_dims.size() - dims.size();
+  size_t index = 0;
+  for (size_t i = 0; i < dims.size(); i++) {
+    const int64_t coordinate = (dims[i] == 1) ? 0 : output_index[rank_offset + i];
+    index = index * static_cast<size_t>(dims[i]) + static_cast<size_t>(coordinate);
+  }
+  return index;
+}
+
+// Computes the expected output by dequantizing both inputs, adding them in float and quantizing the sum.
+std::vector<uint8_t> QLinearAddReference(const QuantizedInput& A, const QuantizedInput& B,
+                                         const std::vector<int64_t>& output_dims,
+                                         float C_scale, uint8_t C_zero_point) {
+  const int64_t output_size = TensorShape(output_dims).Size();
+  std::vector<uint8_t> output(static_cast<size_t>(output_size));
+  std::vector<int64_t> output_index(output_dims.size(), 0);
+
+  for (int64_t n = 0; n < output_size; n++) {
+    const uint8_t a = A.data[BroadcastIndex(A.dims, output_dims, output_index)];
+    const uint8_t b = B.data[BroadcastIndex(B.dims, output_dims, output_index)];
+    const float sum = A.scale * (static_cast<float>(a) - static_cast<float>(A.zero_point)) +
+                      B.scale * (static_cast<float>(b) - static_cast<float>(B.zero_point));
+    const float value = std::nearbyint(sum / C_scale) + static_cast<float>(C_zero_point);
+    output[static_cast<size_t>(n)] = static_cast<uint8_t>(std::min(std::max(value, 0.0f), 255.0f));
+
+    for (size_t i = output_dims.size(); i-- > 0;) {
+      if (++output_index[i] < output_dims[i]) {
+        break;
+      }
+      output_index[i] = 0;
+    }
+  }
+
+  return output;
+}
+
+void RunQLinearAdd(const QuantizedInput& A, const QuantizedInput& B, const std::vector<int64_t>& output_dims,
+                   float C_scale, uint8_t C_zero_point) {
+  OpTester test("QLinearAdd", 1, onnxruntime::kMSDomain);
+  test.AddInput<uint8_t>("A", A.dims, A.data);
+  test.AddInput<float>("A_scale", {}, {A.scale});
+  test.AddInput<uint8_t>("A_zero_point", {}, {A.zero_point});
+  test.AddInput<uint8_t>("B", B.dims, B.data);
+  test.AddInput<float>("B_scale", {}, {B.scale});
+  test.AddInput<uint8_t>("B_zero_point", {}, {B.zero_point});
+  test.AddInput<float>("C_scale", {}, {C_scale});
+  test.AddInput<uint8_t>("C_zero_point", {}, {C_zero_point});
+  test.AddOutput<uint8_t>("C", output_dims, QLinearAddReference(A, B, output_dims, C_scale, C_zero_point));
+  test.Run();
+}
+
+}  // namespace
+
+TEST(QLinearAddTest, SameShape) {
+  QuantizedInput A{{2, 4}, {0, 17, 64, 100, 128, 173, 230, 255}, 0.031f, 128};
+  QuantizedInput B{{2, 4}, {255, 3, 91, 128, 40, 200, 7, 66}, 0.047f, 90};
+  RunQLinearAdd(A, B, {2, 4}, 0.063f, 120);
+}
+
+TEST(QLinearAddTest, ScalarA) {
+  QuantizedInput A{{}, {143}, 0.029f, 100};
+  QuantizedInput B{{3, 3}, {0, 9, 31, 77, 128, 151, 199, 243, 255}, 0.041f, 133};
+  RunQLinearAdd(A, B, {3, 3}, 0.057f, 110);
+}
+
+TEST(QLinearAddTest, ScalarB) {
+  QuantizedInput A{{2, 5}, {1, 26, 51, 76, 101, 126, 151, 176, 201, 254}, 0.037f, 140};
+  QuantizedInput B{{1}, {61}, 0.023f, 17};
+  RunQLinearAdd(A, B, {2, 5}, 0.051f, 95);
+}
+
+TEST(QLinearAddTest, Broadcast) {
+  // B broadcasts along the last axis of A.
+  QuantizedInput A{{2, 3, 4},
+                   {0, 11, 23, 37, 49, 61, 73, 88, 97, 109, 121, 133,
+                    145, 157, 169, 181, 193, 205, 217, 229, 241, 250, 253, 255},
+                   0.033f,
+                   125};
+  QuantizedInput B{{4}, {13, 97, 181, 241}, 0.061f, 150};
+  RunQLinearAdd(A, B, {2, 3, 4}, 0.071f, 130);
+
+  // A and B broadcast against each other.
+  QuantizedInput C{{3, 1}, {6, 131, 249}, 0.043f, 128};
+  QuantizedInput D{{1, 4}, {2, 71, 163, 254}, 0.027f, 77};
+  RunQLinearAdd(C, D, {3, 4}, 0.039f, 121);
+}
+
+TEST(QLinearAddTest, Saturation) {
+  // the sums reach well past both ends of the output range, so the output saturates at 0 and 255.
+  QuantizedInput A{{2, 3}, {0, 0, 128, 255, 255, 10}, 0.5f, 128};
+  QuantizedInput B{{2, 3}, {0, 40, 128, 255, 200, 250}, 0.25f, 128};
+  EXPECT_EQ(QLinearAddReference(A, B, {2, 3}, 0.25f, 128), (std::vector<uint8_t>{0, 0, 128, 255, 255, 14}));
+  RunQLinearAdd(A, B, {2, 3}, 0.25f, 128);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -151,6 +151,9 @@ class PlannerTest : public ::testing::Test {
 
   std::unique_ptr<::onnxruntime::KernelDef> std_kernel_;       // a unary kernel with no-aliasing and no-in-place
   std::unique_ptr<::onnxruntime::KernelDef> in_place_kernel_;  // a unary kernel with in-place
+  std::unique_ptr<::onnxruntime::KernelDef> strided_transpose_kernel_;  // may produce a strided view of its input
+  std::unique_ptr<::onnxruntime::KernelDef> strided_expand_kernel_;     // may produce a strided view of its input
+  std::unique_ptr<::onnxruntime::KernelDef> strided_matmul_kernel_;     // accepts strided inputs
 
   std::unordered_map<std::string, onnxruntime::NodeArg*> name_to_arg_;
   std::vector<std::unique_ptr<UnaryNode>> nodes_;
@@ -171,15 +174,21 @@ class PlannerTest : public ::testing::Test {
     std_kernel_ = KernelDefBuilder().SetName("Transpose").Provider(kCpuExecutionProvider).SinceVersion(1, 10).Build();
     in_place_kernel_ =
         KernelDefBuilder().SetName("Relu").Provider(kCpuExecutionProvider).SinceVersion(1, 10).MayInplace(0, 0).Build();
+    strided_transpose_kernel_ = KernelDefBuilder().SetName("Transpose").Provider(kCpuExecutionProvider)
+                                    .SinceVersion(1, 10).MayStridedOutput(0, 0).Build();
+    strided_expand_kernel_ = KernelDefBuilder().SetName("Expand").Provider(kCpuExecutionProvider)
+                                 .SinceVersion(8, 10).MayStridedOutput(0, 0).Build();
+    strided_matmul_kernel_ = KernelDefBuilder().SetName("MatMul").Provider(kCpuExecutionProvider)
+                                 .SinceVersion(1, 10).MayStridedInput(0).MayStridedInput(1).Build();
     CPUExecutionProviderInfo epi;
     auto execution_provider = onnxruntime::make_unique<CPUExecutionProvider>(epi);
     execution_providers_.Add("CPUExecutionProvider", std::move(execution_provider));
   }
 
-  onnxruntime::NodeArg* Arg(const std::string& name) {
+  onnxruntime::NodeArg* Arg(const std::string& name, const TypeProto* type = nullptr) {
     auto iter = name_to_arg_.find(name);
     if (name_to_arg_.end() != iter) return iter->second;
-    return (name_to_arg_[name] = &graph_.GetOrCreateNodeArg(name, &float_type_.value));
+    return (name_to_arg_[name] = &graph_.GetOrCreateNodeArg(name, type != nullptr ? type : &float_type_.value));
   }
 
   onnxruntime::Node* AddNode(::onnxruntime::KernelDef& kernel_def, std::string& input, std::string& output) {
@@ -191,6 +200,32 @@ class PlannerTest : public ::testing::Test {
     return p_node;
   }
 
+  onnxruntime::Node* AddNode(::onnxruntime::KernelDef& kernel_def, const std::vector<std::string>& inputs,
+                             std::string& output) {
+    std::vector<onnxruntime::NodeArg*> input_args;
+    for (const auto& input : inputs) {
+      input_args.push_back(Arg(input));
+    }
+    std::vector<onnxruntime::NodeArg*> output_args{Arg(output)};
+    auto* p_node = &graph_.AddNode("node" + std::to_string(NodeCounter::Next()), kernel_def.OpName(), "test op",
+                                   input_args, output_args);
+    p_node->SetExecutionProviderType(onnxruntime::kCpuExecutionProvider);
+    kernel_bindings_.emplace_back(p_node, kernel_def);
+    return p_node;
+  }
+
+  onnxruntime::Node* AddStridedTransposeNode(std::string& input, std::string& output) {
+    return AddNode(*strided_transpose_kernel_, input, output);
+  }
+
+  onnxruntime::Node* AddStridedExpandNode(std::string& input, std::string& shape, std::string& output) {
+    return AddNode(*strided_expand_kernel_, {input, shape}, output);
+  }
+
+  onnxruntime::Node* AddStridedMatMulNode(std::string& input_a, std::string& input_b, std::string& output) {
+    return AddNode(*strided_matmul_kernel_, {input_a, input_b}, output);
+  }
+
   onnxruntime::Node* AddNormalNode(std::string& input, std::string& output) {
     return AddNode(*std_kernel_, input, output);
   }
@@ -254,6 +289,21 @@ class PlannerTest : public ::testing::Test {
     EXPECT_EQ(plan_->allocation_plan[id].alloc_kind, kind) << "Error in allocation kind for " << name;
   }
 
+  void CheckStridedView(const std::string& name, const std::string& viewed_name) {
+    int id, viewed_id;
+    index(name, id);
+    index(viewed_name, viewed_id);
+    const auto& alloc_plan = plan_->allocation_plan[id];
+    EXPECT_TRUE(alloc_plan.is_strided_view) << name << " is not a strided view";
+    EXPECT_EQ(alloc_plan.reused_buffer, viewed_id) << name << " is not a view of " << viewed_name;
+  }
+
+  void CheckNotStridedView(const std::string& name) {
+    int id;
+    index(name, id);
+    EXPECT_FALSE(plan_->allocation_plan[id].is_strided_view) << name << " should not be a strided view";
+  }
+
   void CheckFreed(int step_number, std::initializer_list<std::string> freed_items) {
     // create set and check equality
     std::unordered_set<int> expected;
@@ -416,6 +466,96 @@ TEST_F(PlannerTest, InPlaceSizeMismatchTest) {
   CheckFreed(3, {X2});
 }
 
+// StridedViewTest: Check that a Transpose consumed only by a kernel accepting strided inputs becomes a view
+// over the buffer of its input.
+TEST_F(PlannerTest, StridedViewTest) {
+  // tensor variables:
+  std::string X1("X1"), X2("X2"), X3("X3"), X4("X4"), W("W");
+
+  // graph structure:
+  AddInplaceNode(X1, X2);           // X1: input, not reused in-place; X2: temporary
+  AddStridedTransposeNode(X2, X3);  // X3: strided view of X2
+  AddStridedMatMulNode(X3, W, X4);  // accepts strided input; X4: output
+
+  // simulate shape-inference results:
+  Shape shape1{"M", "K"};
+  Shape shape2{"K", "M"};
+  Shape shape3{"M", "N"};
+  Shape shape4{"K", "N"};
+  SetShape({{X1, &shape1.value}, {X2, &shape1.value}, {X3, &shape2.value}, {W, &shape3.value},
+            {X4, &shape4.value}});
+
+  CreatePlan();
+
+  // check allocation kind:
+  CheckAllocKind(X2, AllocKind::kAllocate);
+  CheckAllocKind(X3, AllocKind::kReuse);
+  CheckAllocKind(X4, AllocKind::kAllocateOutput);
+  CheckStridedView(X3, X2);
+
+  // the buffer of X2 is kept alive until the consumer of its view has run
+  CheckFreed(0, {});
+  CheckFreed(1, {});
+  CheckFreed(2, {X2});
+}
+
+// StridedExpandViewTest: Check that an Expand consumed only by a kernel accepting strided inputs becomes a
+// broadcasting view over the buffer of its input.
+TEST_F(PlannerTest, StridedExpandViewTest) {
+  // tensor variables:
+  std::string X1("X1"), X2("X2"), X3("X3"), X4("X4"), S("S"), W("W");
+
+  TypeProto int64_type;
+  int64_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_INT64);
+  Arg(S, &int64_type);
+
+  // graph structure:
+  AddInplaceNode(X1, X2);           // X1: input, not reused in-place; X2: temporary
+  AddStridedExpandNode(X2, S, X3);  // X3: strided view of X2
+  AddStridedMatMulNode(X3, W, X4);  // accepts strided input; X4: output
+
+  // simulate shape-inference results:
+  Shape shape1{"K", "M"};
+  Shape shape2{"L", "M"};
+  Shape shape3{"N", "M"};
+  Shape shape4{"M", "P"};
+  Shape shape5{"N", "P"};
+  SetShape({{X1, &shape1.value}, {X2, &shape2.value}, {X3, &shape3.value}, {W, &shape4.value},
+            {X4, &shape5.value}});
+
+  CreatePlan();
+
+  // check allocation kind:
+  CheckAllocKind(X2, AllocKind::kAllocate);
+  CheckAllocKind(X3, AllocKind::kReuse);
+  CheckStridedView(X3, X2);
+}
+
+// StridedViewConsumerTest: Check that no strided view is made if any consumer requires contiguous input.
+TEST_F(PlannerTest, StridedViewConsumerTest) {
+  // tensor variables:
+  std::string X1("X1"), X2("X2"), X3("X3"), X4("X4"), X5("X5"), W("W");
+
+  // graph structure:
+  AddInplaceNode(X1, X2);           // X1: input, not reused in-place; X2: temporary
+  AddStridedTransposeNode(X2, X3);  // X3: consumed by a kernel that needs contiguous input
+  AddStridedMatMulNode(X3, W, X4);  // accepts strided input; X4: output
+  AddInplaceNode(X3, X5);           // doesn't accept strided input; X5: output
+
+  // simulate shape-inference results:
+  Shape shape1{"M", "K"};
+  Shape shape2{"K", "M"};
+  Shape shape3{"M", "N"};
+  Shape shape4{"K", "N"};
+  SetShape({{X1, &shape1.value}, {X2, &shape1.value}, {X3, &shape2.value}, {W, &shape3.value},
+            {X4, &shape4.value}, {X5, &shape2.value}});
+
+  CreatePlan();
+
+  CheckNotStridedView(X3);
+  CheckNotStridedView(X5);
+}
+
 // Test operator<< to output details of an allocation & execution plan.
 TEST_F(PlannerTest, PlanOutputTest) {
   // tensor variables:
@@ -7,6 +7,7 @@
 #include <cfloat>
 #include <functional>
 #include <iterator>
+#include <numeric>
 #include <thread>
 #include <fstream>
 
@@ -128,6 +129,10 @@ class InferenceSessionGetGraphWrapper : public InferenceSession {
   const Graph& GetGraph() {
     return model_->MainGraph();
   }
+
+  const SessionState& GetSessionState() {
+    return *session_state_;
+  }
 };
 
 namespace test {
@@ -2166,6 +2171,195 @@ TEST(InferenceSessionTests, LoadModelWithEnvVarSetToUnsupportedVal) {
 #endif
 }
 
+// Runs Relu(A) -> view node -> MatMul(view, B) with graph optimizations disabled. Checks that the output of the
+// view node is planned as a strided view over the Relu output and that the MatMul result is correct.
+static void TestStridedViewMatMul(const std::function<void(Graph&, NodeArg&, NodeArg&)>& add_view_node,
+                                  const std::vector<int64_t>& a_dims, const std::vector<float>& a_values,
+                                  const std::vector<int64_t>& b_dims, const std::vector<float>& b_values,
+                                  const std::vector<int64_t>& expected_dims,
+                                  const std::vector<float>& expected_values) {
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[onnxruntime::kOnnxDomain] = 10;
+  Model model("test", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(), domain_to_version,
+              {}, DefaultLoggingManager().DefaultLogger());
+  Graph& graph = model.MainGraph();
+
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  auto& input_a = graph.GetOrCreateNodeArg("A", &tensor_float);
+  auto& input_b = graph.GetOrCreateNodeArg("B", &tensor_float);
+  auto& relu_output = graph.GetOrCreateNodeArg("R", &tensor_float);
+  auto& view_output = graph.GetOrCreateNodeArg("V", &tensor_float);
+  auto& output_y = graph.GetOrCreateNodeArg("Y", &tensor_float);
+
+  graph.AddNode("relu", "Relu", "Relu", {&input_a}, {&relu_output});
+  add_view_node(graph, relu_output, view_output);
+  graph.AddNode("matmul", "MatMul", "MatMul", {&view_output, &input_b}, {&output_y});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  std::string model_data;
+  model.ToProto().SerializeToString(&model_data);
+  std::stringstream model_stream(model_data);
+
+  SessionOptions so;
+  so.session_logid = "TestStridedViewMatMul";
+  so.graph_optimization_level = TransformerLevel::Default;
+  InferenceSessionGetGraphWrapper session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(model_stream));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  const auto& session_state = session_object.GetSessionState();
+  int relu_output_idx;
+  int view_output_idx;
+  ASSERT_STATUS_OK(session_state.GetOrtValueNameIdxMap().GetIdx("R", relu_output_idx));
+  ASSERT_STATUS_OK(session_state.GetOrtValueNameIdxMap().GetIdx("V", view_output_idx));
+  const auto& view_plan = session_state.GetExecutionPlan()->allocation_plan[view_output_idx];
+  EXPECT_TRUE(view_plan.is_strided_view);
+  EXPECT_EQ(view_plan.alloc_kind, AllocKind::kReuse);
+  EXPECT_EQ(view_plan.reused_buffer, relu_output_idx);
+
+  auto allocator = TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault);
+  OrtValue value_a;
+  OrtValue value_b;
+  CreateMLValue<float>(allocator, a_dims, a_values, &value_a);
+  CreateMLValue<float>(allocator, b_dims, b_values, &value_b);
+  NameMLValMap feeds{{"A", value_a}, {"B", value_b}};
+
+  // run twice so the second run uses the memory pattern generated by the first
+  std::vector<std::string> output_names{"Y"};
+  for (int i = 0; i < 2; i++) {
+    std::vector<OrtValue> fetches;
+    ASSERT_STATUS_OK(session_object.Run(RunOptions(), feeds, output_names, &fetches));
+    VerifyOutputs(fetches, expected_dims, expected_values);
+  }
+}
+
+// The transposed view is consumed by the GEMM through its transpose flag.
+TEST(InferenceSessionTests, StridedViewTransposeMatMul) {
+  auto add_transpose = [](Graph& graph, NodeArg& input, NodeArg& output) {
+    auto& node = graph.AddNode("transpose", "Transpose", "Transpose", {&input}, {&output});
+    node.AddAttribute("perm", std::vector<int64_t>{0, 2, 1});
+  };
+
+  std::vector<float> a_values(24);
+  std::iota(a_values.begin(), a_values.end(), 1.f);
+  std::vector<float> b_values(12);
+  std::iota(b_values.begin(), b_values.end(), 1.f);
+
+  TestStridedViewMatMul(add_transpose, {2, 3, 4}, a_values, {2, 3, 2}, b_values, {2, 4, 2},
+                        {61.f, 76.f, 70.f, 88.f, 79.f, 100.f, 88.f, 112.f,
+                         475.f, 526.f, 502.f, 556.f, 529.f, 586.f, 556.f, 616.f});
+}
+
+// The transposed view has fewer dimensions than the other input, so it is broadcast over the batch dimension.
+TEST(InferenceSessionTests, StridedViewTransposeBroadcastMatMul) {
+  auto add_transpose = [](Graph& graph, NodeArg& input, NodeArg& output) {
+    auto& node = graph.AddNode("transpose", "Transpose", "Transpose", {&input}, {&output});
+    node.AddAttribute("perm", std::vector<int64_t>{1, 0});
+  };
+
+  std::vector<float> b_values(12);
+  std::iota(b_values.begin(), b_values.end(), 1.f);
+
+  TestStridedViewMatMul(add_transpose, {3, 2}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f}, {2, 3, 2}, b_values, {2, 2, 2},
+                        {35.f, 44.f, 44.f, 56.f, 89.f, 98.f, 116.f, 128.f});
+}
+
+static std::function<void(Graph&, NodeArg&, NodeArg&)> AddExpandNode(const std::vector<int64_t>& shape) {
+  return [shape](Graph& graph, NodeArg& input, NodeArg& output) {
+    ONNX_NAMESPACE::TensorProto shape_tensor;
+    shape_tensor.set_name("shape");
+    shape_tensor.set_data_type(TensorProto_DataType_INT64);
+    shape_tensor.add_dims(static_cast<int64_t>(shape.size()));
+    for (auto dim : shape) {
+      shape_tensor.add_int64_data(dim);
+    }
+    graph.AddInitializedTensor(shape_tensor);
+
+    TypeProto tensor_int64;
+    tensor_int64.mutable_tensor_type()->set_elem_type(TensorProto_DataType_INT64);
+    auto& shape_arg = graph.GetOrCreateNodeArg("shape", &tensor_int64);
+    graph.AddNode("expand", "Expand", "Expand", {&input, &shape_arg}, {&output});
+  };
+}
+
+// Only the batch dimension is broadcast, so the view is consumed by the GEMM directly.
+TEST(InferenceSessionTests, StridedViewExpandBatchMatMul) {
+  std::vector<float> b_values(12);
+  std::iota(b_values.begin(), b_values.end(), 1.f);
+
+  TestStridedViewMatMul(AddExpandNode({2, 2, 3}), {1, 2, 3}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f}, {2, 3, 2}, b_values,
+                        {2, 2, 2}, {22.f, 28.f, 49.f, 64.f, 58.f, 64.f, 139.f, 154.f});
+}
+
+// The rows of the matrices are broadcast, which the GEMM can't address, so MatMul copies the view to a
+// contiguous buffer first.
+TEST(InferenceSessionTests, StridedViewExpandRowsMatMul) {
+  std::vector<float> b_values(12);
+  std::iota(b_values.begin(), b_values.end(), 1.f);
+
+  TestStridedViewMatMul(AddExpandNode({2, 2, 3}), {1, 3}, {1.f, 2.f, 3.f}, {2, 3, 2}, b_values,
+                        {2, 2, 2}, {22.f, 28.f, 22.f, 28.f, 58.f, 64.f, 58.f, 64.f});
+}
+
+// Each new batch size gets a memory pattern computed from the symbolic shapes, which its first run validates.
+TEST(InferenceSessionTests, SymbolicMemoryPatternPerInputShape) {
+  Model model("test", false, DefaultLoggingManager().DefaultLogger());
+  Graph& graph = model.MainGraph();
+
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  tensor_float.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_param("batch");
+  tensor_float.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(3);
+  auto& input_x = graph.GetOrCreateNodeArg("X", &tensor_float);
+  auto& relu_output = graph.GetOrCreateNodeArg("R", &tensor_float);
+  auto& output_y = graph.GetOrCreateNodeArg("Y", &tensor_float);
+
+  graph.AddNode("relu", "Relu", "Relu", {&input_x}, {&relu_output});
+  graph.AddNode("neg", "Neg", "Neg", {&relu_output}, {&output_y});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  std::string model_data;
+  model.ToProto().SerializeToString(&model_data);
+  std::stringstream model_stream(model_data);
+
+  SessionOptions so;
+  so.session_logid = "SymbolicMemoryPatternPerInputShape";
+  so.enable_mem_pattern = true;
+  InferenceSessionGetGraphWrapper session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(model_stream));
+  ASSERT_STATUS_OK(session_object.Initialize());
+  const auto& session_state = session_object.GetSessionState();
+
+  auto allocator = TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault);
+  std::vector<std::string> output_names{"Y"};
+  for (int64_t batch : {2, 5}) {
+    std::vector<int64_t> dims{batch, 3};
+    std::vector<float> values(static_cast<size_t>(batch * 3));
+    std::vector<float> expected_values(values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+      values[i] = (i % 2 == 0) ? static_cast<float>(i) : -static_cast<float>(i);
+      expected_values[i] = -std::max(values[i], 0.f);
+    }
+
+    OrtValue value_x;
+    CreateMLValue<float>(allocator, dims, values, &value_x);
+    NameMLValMap feeds{{"X", value_x}};
+    TensorShape shape(dims);
+    std::vector<std::reference_wrapper<const TensorShape>> input_shapes{std::cref(shape)};
+    EXPECT_EQ(session_state.GetMemoryPatternGroup(input_shapes), nullptr);
+
+    // the first run of the shape uses the generated pattern without falling back to the allocator, which
+    // validates it, and the second run reuses it
+    for (int i = 0; i < 2; i++) {
+      std::vector<OrtValue> fetches;
+      ASSERT_STATUS_OK(session_object.Run(RunOptions(), feeds, output_names, &fetches));
+      VerifyOutputs(fetches, dims, expected_values);
+      EXPECT_TRUE(session_state.IsValidatedSymbolicMemoryPatternGroup(input_shapes));
+    }
+  }
+}
+
 // Global threadpool related tests
 // We test for 4 combinations
 class InferenceSessionTestGlobalThreadPools : public InferenceSession {
@@ -3,6 +3,7 @@
 
 #include "core/framework/tensor.h"
 #include "core/framework/allocatormgr.h"
+#include "core/providers/cpu/tensor/strided_copy.h"
 #include "test_utils.h"
 
 #include "gmock/gmock.h"
@@ -214,5 +215,37 @@ TEST(TensorTest, SizeOverflow) {
   ptrdiff_t offset = sizeof(float);  // one more element to push past max
   EXPECT_THROW(Tensor(type, shape2, alloc, offset), OnnxRuntimeException);
 }
+
+TEST(TensorTest, StridedView) {
+  auto alloc = TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault);
+  std::vector<float> data{1.f, 2.f, 3.f, 4.f, 5.f, 6.f};
+  Tensor t(DataTypeImpl::GetType<float>(), TensorShape({2, 3}), data.data(), alloc->Info());
+  EXPECT_TRUE(t.IsContiguous());
+  EXPECT_THAT(t.Strides(), testing::ElementsAre(3, 1));
+
+  // transposed view
+  t.SetShapeAndStrides(TensorShape({3, 2}), {1, 3});
+  EXPECT_FALSE(t.IsContiguous());
+  EXPECT_THAT(t.Strides(), testing::ElementsAre(1, 3));
+  EXPECT_THROW(t.Reshape(TensorShape({6})), OnnxRuntimeException);
+
+  Tensor transposed(DataTypeImpl::GetType<float>(), TensorShape({3, 2}), alloc);
+  ASSERT_TRUE(StridedCopyToContiguous(t, transposed).IsOK());
+  EXPECT_THAT(transposed.DataAsSpan<float>(), testing::ElementsAre(1.f, 4.f, 2.f, 5.f, 3.f, 6.f));
+
+  // broadcast view of the first row
+  t.SetShapeAndStrides(TensorShape({2, 3}), {0, 1});
+  EXPECT_FALSE(t.IsContiguous());
+  Tensor broadcast(DataTypeImpl::GetType<float>(), TensorShape({2, 3}), alloc);
+  ASSERT_TRUE(StridedCopyToContiguous(t, broadcast).IsOK());
+  EXPECT_THAT(broadcast.DataAsSpan<float>(), testing::ElementsAre(1.f, 2.f, 3.f, 1.f, 2.f, 3.f));
+
+  // strides matching the dense layout mark the tensor as contiguous again. size 1 dims can have any stride.
+  t.SetShapeAndStrides(TensorShape({1, 6}), {42, 1});
+  EXPECT_TRUE(t.IsContiguous());
+  EXPECT_THAT(t.Strides(), testing::ElementsAre(6, 1));
+
+  EXPECT_THROW(t.SetShapeAndStrides(TensorShape({6}), {1, 1}), OnnxRuntimeException);
+}
 }  // namespace test
 }  // namespace onnxruntime
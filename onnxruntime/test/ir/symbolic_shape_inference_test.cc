@@ -0,0 +1,124 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "core/graph/onnx_protobuf.h"
+#include "core/graph/model.h"
+#include "core/graph/symbolic_shape_inference.h"
+
+#include "test/test_environment.h"
+
+using namespace ONNX_NAMESPACE;
+
+namespace onnxruntime {
+namespace test {
+
+TEST(SymbolicShapeInferenceTest, DimExprArithmetic) {
+  DimExpr batch = DimExpr::Symbol("batch");
+  DimExpr seq = DimExpr::Symbol("seq");
+
+  DimExpr expr = DimExpr(8) * batch * seq + DimExpr(2) * batch;
+  EXPECT_FALSE(expr.IsConstant());
+  EXPECT_EQ((expr - expr), DimExpr(0));
+  EXPECT_TRUE((expr - expr).IsConstant());
+
+  DimExpr quotient;
+  ASSERT_TRUE(expr.DivideExact(DimExpr(2) * batch, quotient));
+  EXPECT_EQ(quotient, DimExpr(4) * seq + DimExpr(1));
+  EXPECT_FALSE(expr.DivideExact(seq, quotient));
+  EXPECT_FALSE(expr.DivideExact(DimExpr(3), quotient));
+
+  int64_t value;
+  ASSERT_TRUE(expr.Evaluate({{"batch", 3}, {"seq", 5}}, value));
+  EXPECT_EQ(value, 8 * 3 * 5 + 2 * 3);
+  EXPECT_FALSE(expr.Evaluate({{"batch", 3}}, value));
+}
+
+TEST(SymbolicShapeInferenceTest, ShapeSubgraphAndPooling) {
+  Model model("SymbolicShapeInference", false, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  TypeProto x_type;
+  x_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  x_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_param("batch");
+  x_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_param("seq");
+  x_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(8);
+
+  TypeProto p_type;
+  p_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  p_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1);
+  p_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(3);
+  p_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_param("height");
+  p_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(8);
+
+  TypeProto float_type;
+  float_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  TypeProto int64_type;
+  int64_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_INT64);
+
+  TensorProto index;
+  index.set_name("index");
+  index.set_data_type(TensorProto_DataType_INT64);
+  index.add_int64_data(0);
+  graph.AddInitializedTensor(index);
+
+  TensorProto minus_one;
+  minus_one.set_name("minus_one");
+  minus_one.set_data_type(TensorProto_DataType_INT64);
+  minus_one.add_dims(1);
+  minus_one.add_int64_data(-1);
+  graph.AddInitializedTensor(minus_one);
+
+  // Y = Reshape(X, Concat(Unsqueeze(Gather(Shape(X), 0)), [-1])) has the shape [batch, 8*seq]
+  auto& x = graph.GetOrCreateNodeArg("X", &x_type);
+  auto& index_arg = graph.GetOrCreateNodeArg("index", &int64_type);
+  auto& minus_one_arg = graph.GetOrCreateNodeArg("minus_one", &int64_type);
+  auto& shape_out = graph.GetOrCreateNodeArg("shape_out", &int64_type);
+  auto& gather_out = graph.GetOrCreateNodeArg("gather_out", &int64_type);
+  auto& unsqueeze_out = graph.GetOrCreateNodeArg("unsqueeze_out", &int64_type);
+  auto& concat_out = graph.GetOrCreateNodeArg("concat_out", &int64_type);
+  auto& y = graph.GetOrCreateNodeArg("Y", &float_type);
+
+  graph.AddNode("shape", "Shape", "", {&x}, {&shape_out});
+  graph.AddNode("gather", "Gather", "", {&shape_out, &index_arg}, {&gather_out});
+  graph.AddNode("unsqueeze", "Unsqueeze", "", {&gather_out}, {&unsqueeze_out})
+      .AddAttribute("axes", std::vector<int64_t>{0});
+  graph.AddNode("concat", "Concat", "", {&unsqueeze_out, &minus_one_arg}, {&concat_out})
+      .AddAttribute("axis", static_cast<int64_t>(0));
+  graph.AddNode("reshape", "Reshape", "", {&x, &concat_out}, {&y});
+
+  // Z = MaxPool(P) with a 2x2 kernel and stride 2 has the shape [1, 3, (height - 2) / 2 + 1, 4]
+  auto& p = graph.GetOrCreateNodeArg("P", &p_type);
+  auto& z = graph.GetOrCreateNodeArg("Z", &float_type);
+  auto& pool = graph.AddNode("pool", "MaxPool", "", {&p}, {&z});
+  pool.AddAttribute("kernel_shape", std::vector<int64_t>{2, 2});
+  pool.AddAttribute("strides", std::vector<int64_t>{2, 2});
+
+  graph.SetOutputs({&y, &z});
+  ASSERT_TRUE(graph.Resolve().IsOK());
+
+  SymbolicShapeInference inference(graph);
+  inference.Run();
+
+  const SymbolicShape* y_shape = inference.GetShape("Y");
+  ASSERT_NE(y_shape, nullptr);
+  ASSERT_EQ(y_shape->size(), 2u);
+  EXPECT_EQ((*y_shape)[0], DimExpr::Symbol("batch"));
+  EXPECT_EQ((*y_shape)[1], DimExpr(8) * DimExpr::Symbol("seq"));
+  EXPECT_EQ((*y_shape)[1].ToString(), "8*seq");
+
+  SymbolBindings bindings;
+  ASSERT_TRUE(inference.BindInputShape("X", {2, 5, 8}, bindings));
+  ASSERT_TRUE(inference.BindInputShape("P", {1, 3, 9, 8}, bindings));
+  EXPECT_FALSE(inference.BindInputShape("P", {1, 4, 9, 8}, bindings));
+  inference.ResolveDerivedSymbols(bindings);
+
+  std::vector<int64_t> dims;
+  ASSERT_TRUE(inference.EvaluateShape("Y", bindings, dims));
+  EXPECT_EQ(dims, (std::vector<int64_t>{2, 40}));
+  ASSERT_TRUE(inference.EvaluateShape("Z", bindings, dims));
+  EXPECT_EQ(dims, (std::vector<int64_t>{1, 3, 4, 4}));
+}
+
+}  // namespace test
+}  // namespace onnxruntime
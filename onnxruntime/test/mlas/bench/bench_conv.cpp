@@ -0,0 +1,230 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    bench_conv.cpp
+
+Abstract:
+
+    This module implements the benchmarks of the NCHW and NCHWc convolution
+    routines.
+
+--*/
+
+#include "bench_util.h"
+
+//
+// Two dimensional convolutions as (BatchCount, GroupCount, InputChannels per
+// group, InputHeight, InputWidth, FilterCount per group, KernelSize, Stride).
+// Padding keeps the spatial size for a unit stride.
+//
+
+static const int64_t ConvShapes[][8] = {
+    { 1, 1, 64, 56, 56, 64, 1, 1 },     // pointwise
+    { 1, 1, 64, 56, 56, 64, 3, 1 },
+    { 1, 1, 256, 14, 14, 256, 3, 1 },
+    { 1, 1, 3, 224, 224, 64, 7, 2 },    // first layer of image models
+    { 8, 1, 128, 28, 28, 128, 3, 1 },
+    { 1, 32, 8, 56, 56, 8, 3, 1 },      // grouped
+    { 1, 64, 1, 112, 112, 1, 3, 1 },    // depthwise
+    { 1, 144, 1, 56, 56, 1, 3, 2 },
+    { 1, 32, 4, 56, 56, 4, 3, 1 },
+};
+
+static
+void
+ConvArgs(
+    benchmark::internal::Benchmark* b
+    )
+{
+    b->ArgNames({"N", "G", "Cpg", "H", "W", "Fpg", "K", "S", "Threads"});
+
+    for (int64_t Threads : { 1, 4 }) {
+        for (const auto& Shape : ConvShapes) {
+            b->Args({Shape[0], Shape[1], Shape[2], Shape[3], Shape[4], Shape[5], Shape[6], Shape[7], Threads});
+        }
+    }
+}
+
+struct ConvShape {
+    explicit ConvShape(benchmark::State& state)
+        : BatchCount(state.range(0)),
+          GroupCount(state.range(1)),
+          InputChannels(state.range(2)),
+          InputHeight(state.range(3)),
+          InputWidth(state.range(4)),
+          FilterCount(state.range(5)),
+          KernelSize(state.range(6)),
+          Stride(state.range(7)),
+          Pad(KernelSize / 2),
+          OutputHeight((InputHeight + 2 * Pad - KernelSize) / Stride + 1),
+          OutputWidth((InputWidth + 2 * Pad - KernelSize) / Stride + 1)
+    {
+    }
+
+    double
+    Operations(
+        void
+        ) const
+    {
+        return 2.0 * BatchCount * GroupCount * FilterCount * OutputHeight * OutputWidth *
+               InputChannels * KernelSize * KernelSize;
+    }
+
+    double
+    Bytes(
+        void
+        ) const
+    {
+        return sizeof(float) * double(BatchCount * GroupCount * InputChannels * InputHeight * InputWidth +
+                                      GroupCount * FilterCount * InputChannels * KernelSize * KernelSize +
+                                      BatchCount * GroupCount * FilterCount * OutputHeight * OutputWidth);
+    }
+
+    int64_t BatchCount;
+    int64_t GroupCount;
+    int64_t InputChannels;
+    int64_t InputHeight;
+    int64_t InputWidth;
+    int64_t FilterCount;
+    int64_t KernelSize;
+    int64_t Stride;
+    int64_t Pad;
+    int64_t OutputHeight;
+    int64_t OutputWidth;
+};
+
+static
+void
+CONV(
+    benchmark::State& state
+    )
+{
+    const ConvShape Shape(state);
+    MLAS_THREADPOOL* ThreadPool = GetMlasThreadPool(state.range(8));
+
+    const int64_t InputShape[] = { Shape.InputHeight, Shape.InputWidth };
+    const int64_t KernelShape[] = { Shape.KernelSize, Shape.KernelSize };
+    const int64_t DilationShape[] = { 1, 1 };
+    const int64_t Padding[] = { Shape.Pad, Shape.Pad, Shape.Pad, Shape.Pad };
+    const int64_t StrideShape[] = { Shape.Stride, Shape.Stride };
+    const int64_t OutputShape[] = { Shape.OutputHeight, Shape.OutputWidth };
+
+    MLAS_ACTIVATION Activation;
+    Activation.ActivationKind = MlasIdentityActivation;
+
+    MLAS_CONV_PARAMETERS Parameters;
+    size_t WorkingBufferSize;
+
+    MlasConvPrepare(&Parameters,
+                    2,
+                    size_t(Shape.BatchCount),
+                    size_t(Shape.GroupCount),
+                    size_t(Shape.InputChannels),
+                    InputShape,
+                    KernelShape,
+                    DilationShape,
+                    Padding,
+                    StrideShape,
+                    OutputShape,
+                    size_t(Shape.FilterCount),
+                    &Activation,
+                    &WorkingBufferSize,
+                    ThreadPool);
+
+    auto Input = RandomVectorUniform<float>(
+        size_t(Shape.BatchCount * Shape.GroupCount * Shape.InputChannels * Shape.InputHeight * Shape.InputWidth), -1.0f, 1.0f);
+    auto Filter = RandomVectorUniform<float>(
+        size_t(Shape.GroupCount * Shape.FilterCount * Shape.InputChannels * Shape.KernelSize * Shape.KernelSize), -1.0f, 1.0f);
+    auto Bias = RandomVectorUniform<float>(size_t(Shape.GroupCount * Shape.FilterCount), -1.0f, 1.0f);
+    std::vector<float> WorkingBuffer(WorkingBufferSize);
+    std::vector<float> Output(size_t(Shape.BatchCount * Shape.GroupCount * Shape.FilterCount * Shape.OutputHeight * Shape.OutputWidth));
+
+    for (auto _ : state) {
+        MlasConv(&Parameters, Input.data(), Filter.data(), Bias.data(), WorkingBuffer.data(), Output.data(), ThreadPool);
+    }
+
+    static const char* AlgorithmNames[] = { "GemmDirect", "ExpandThenGemm", "ExpandThenGemmSegmented" };
+
+    ReportThroughput(state, Shape.Operations(), Shape.Bytes());
+    state.SetLabel(std::string(MlasBenchIsaLabel()) + "/" + AlgorithmNames[Parameters.Algorithm]);
+}
+
+BENCHMARK(CONV)->Apply(ConvArgs)->UseRealTime();
+
+static
+void
+NCHWC_CONV(
+    benchmark::State& state
+    )
+{
+    const ConvShape Shape(state);
+    MLAS_THREADPOOL* ThreadPool = GetMlasThreadPool(state.range(8));
+
+    const int64_t BlockSize = int64_t(MlasNchwcGetBlockSize());
+
+    if (BlockSize <= 1) {
+        state.SkipWithError("NCHWc is not supported on this platform");
+        return;
+    }
+
+    //
+    // The NCHWc kernels handle grouped convolutions only in the depthwise
+    // case, and need at least a block of input channels otherwise (smaller
+    // inputs use the NCHW kernel, which reads unreordered input).
+    //
+
+    const bool Depthwise = Shape.GroupCount > 1 && Shape.InputChannels == 1 && Shape.FilterCount == 1;
+
+    if (!Depthwise && (Shape.GroupCount > 1 || Shape.InputChannels < BlockSize)) {
+        state.SkipWithError("shape is not handled by the NCHWc kernels");
+        return;
+    }
+
+    const int64_t NchwcInputChannels = (Shape.GroupCount * Shape.InputChannels + BlockSize - 1) / BlockSize * BlockSize;
+    const int64_t NchwcOutputChannels = (Shape.GroupCount * Shape.FilterCount + BlockSize - 1) / BlockSize * BlockSize;
+    const int64_t FilterInputChannels = Depthwise ? 1 : NchwcInputChannels;
+
+    const int64_t InputShape[] = { Shape.BatchCount, NchwcInputChannels, Shape.InputHeight, Shape.InputWidth };
+    const int64_t KernelShape[] = { Shape.KernelSize, Shape.KernelSize };
+    const int64_t DilationShape[] = { 1, 1 };
+    const int64_t Padding[] = { Shape.Pad, Shape.Pad, Shape.Pad, Shape.Pad };
+    const int64_t StrideShape[] = { Shape.Stride, Shape.Stride };
+    const int64_t OutputShape[] = { Shape.BatchCount, NchwcOutputChannels, Shape.OutputHeight, Shape.OutputWidth };
+
+    auto Input = RandomVectorUniform<float>(
+        size_t(Shape.BatchCount * NchwcInputChannels * Shape.InputHeight * Shape.InputWidth), -1.0f, 1.0f);
+    auto Filter = RandomVectorUniform<float>(
+        size_t(NchwcOutputChannels * FilterInputChannels * Shape.KernelSize * Shape.KernelSize), -1.0f, 1.0f);
+    auto Bias = RandomVectorUniform<float>(size_t(NchwcOutputChannels), -1.0f, 1.0f);
+    std::vector<float> Output(size_t(Shape.BatchCount * NchwcOutputChannels * Shape.OutputHeight * Shape.OutputWidth));
+
+    MLAS_ACTIVATION Activation;
+    Activation.ActivationKind = MlasIdentityActivation;
+
+    for (auto _ : state) {
+        MlasNchwcConv(InputShape,
+                      KernelShape,
+                      DilationShape,
+                      Padding,
+                      StrideShape,
+                      OutputShape,
+                      size_t(Shape.GroupCount),
+                      Input.data(),
+                      Filter.data(),
+                      Bias.data(),
+                      Output.data(),
+                      &Activation,
+                      true,
+                      ThreadPool);
+    }
+
+    ReportThroughput(state, Shape.Operations(), Shape.Bytes());
+    state.SetLabel(std::string(MlasBenchIsaLabel()) + (Depthwise ? "/Depthwise" : "/Nchwc"));
+}
+
+BENCHMARK(NCHWC_CONV)->Apply(ConvArgs)->UseRealTime();
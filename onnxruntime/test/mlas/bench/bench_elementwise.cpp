@@ -0,0 +1,143 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    bench_elementwise.cpp
+
+Abstract:
+
+    This module implements the benchmarks of the activation, transcendental
+    function and quantization routines.
+
+--*/
+
+#include "bench_util.h"
+
+//
+// Element counts: one that fits in the L1 cache, one that fits in the L2 cache
+// and one that streams from memory.
+//
+
+static
+void
+ElementCountArgs(
+    benchmark::internal::Benchmark* b
+    )
+{
+    b->ArgNames({"N"});
+    b->Arg(4 * 1024)->Arg(256 * 1024)->Arg(16 * 1024 * 1024);
+}
+
+static
+void
+ActivationArgs(
+    benchmark::internal::Benchmark* b
+    )
+{
+    b->ArgNames({"Kind", "N"});
+
+    for (int64_t Kind : { MlasReluActivation, MlasLeakyReluActivation, MlasTanhActivation,
+                          MlasLogisticActivation, MlasClipActivation }) {
+        for (int64_t N : { 4 * 1024, 256 * 1024, 16 * 1024 * 1024 }) {
+            b->Args({Kind, N});
+        }
+    }
+}
+
+static
+void
+ACTIVATION(
+    benchmark::State& state
+    )
+{
+    MLAS_ACTIVATION Activation;
+    Activation.ActivationKind = static_cast<MLAS_ACTIVATION_KIND>(state.range(0));
+    Activation.Parameters.Values[0] = -1.0f;
+    Activation.Parameters.Values[1] = 1.0f;
+
+    const size_t N = static_cast<size_t>(state.range(1));
+    auto Buffer = RandomVectorUniform<float>(N, -5.0f, 5.0f);
+
+    //
+    // The activation is applied in place to the output of the previous
+    // iteration. The values stay finite, and the kernels don't depend on them.
+    //
+
+    for (auto _ : state) {
+        MlasActivation(&Activation, Buffer.data(), nullptr, 1, N, N);
+    }
+
+    ReportThroughput(state, double(N), 2.0 * sizeof(float) * N);
+    state.SetLabel(MlasBenchIsaLabel());
+}
+
+BENCHMARK(ACTIVATION)->Apply(ActivationArgs)->UseRealTime();
+
+template<void (MLASCALL *Function)(const float*, float*, size_t)>
+void
+ELEMENTWISE(
+    benchmark::State& state
+    )
+{
+    const size_t N = static_cast<size_t>(state.range(0));
+    auto Input = RandomVectorUniform<float>(N, -5.0f, 5.0f);
+    std::vector<float> Output(N);
+
+    for (auto _ : state) {
+        Function(Input.data(), Output.data(), N);
+    }
+
+    ReportThroughput(state, double(N), 2.0 * sizeof(float) * N);
+    state.SetLabel(MlasBenchIsaLabel());
+}
+
+BENCHMARK_TEMPLATE(ELEMENTWISE, MlasComputeErf)->Name("ERF")->Apply(ElementCountArgs)->UseRealTime();
+BENCHMARK_TEMPLATE(ELEMENTWISE, MlasComputeTanh)->Name("TANH")->Apply(ElementCountArgs)->UseRealTime();
+BENCHMARK_TEMPLATE(ELEMENTWISE, MlasComputeLogistic)->Name("LOGISTIC")->Apply(ElementCountArgs)->UseRealTime();
+
+template<typename OutputType>
+void
+QUANTIZE_LINEAR(
+    benchmark::State& state
+    )
+{
+    const size_t N = static_cast<size_t>(state.range(0));
+    auto Input = RandomVectorUniform<float>(N, -5.0f, 5.0f);
+    std::vector<OutputType> Output(N);
+
+    for (auto _ : state) {
+        MlasQuantizeLinear(Input.data(), Output.data(), N, 0.05f, OutputType(3));
+    }
+
+    ReportThroughput(state, double(N), double(sizeof(float) + sizeof(OutputType)) * N);
+    state.SetLabel(MlasBenchIsaLabel());
+}
+
+BENCHMARK_TEMPLATE(QUANTIZE_LINEAR, uint8_t)->Apply(ElementCountArgs)->UseRealTime();
+BENCHMARK_TEMPLATE(QUANTIZE_LINEAR, int8_t)->Apply(ElementCountArgs)->UseRealTime();
+
+static
+void
+REQUANTIZE_OUTPUT(
+    benchmark::State& state
+    )
+{
+    const size_t M = 64;
+    const size_t N = static_cast<size_t>(state.range(0)) / M;
+    auto Input = RandomVectorUniform<int32_t>(M * N, -100000, 100000);
+    auto Bias = RandomVectorUniform<int32_t>(N, -1000, 1000);
+    std::vector<uint8_t> Output(M * N);
+
+    for (auto _ : state) {
+        MlasRequantizeOutput(Input.data(), Output.data(), Bias.data(), M, N, 0.001f, uint8_t(128));
+    }
+
+    ReportThroughput(state, double(M * N), double(sizeof(int32_t) + sizeof(uint8_t)) * M * N);
+    state.SetLabel(MlasBenchIsaLabel());
+}
+
+BENCHMARK(REQUANTIZE_OUTPUT)->Apply(ElementCountArgs)->UseRealTime();
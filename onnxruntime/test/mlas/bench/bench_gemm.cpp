@@ -0,0 +1,151 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    bench_gemm.cpp
+
+Abstract:
+
+    This module implements the benchmarks of the single, double and quantized
+    matrix/matrix multiply routines.
+
+--*/
+
+#include "bench_util.h"
+
+//
+// Shapes (M, N, K) benchmarked with every transpose combination, followed by
+// skinny shapes typical of inference that are only benchmarked without
+// transposes.
+//
+
+static const int64_t GemmShapes[][3] = {
+    { 1, 1024, 1024 },
+    { 64, 1024, 1024 },
+    { 1024, 1024, 1024 },
+};
+
+static const int64_t GemmSkinnyShapes[][3] = {
+    { 1, 4096, 1024 },
+    { 16, 1024, 1024 },
+    { 128, 768, 3072 },
+    { 4096, 64, 64 },
+    { 64, 4096, 64 },
+    { 16, 16, 4096 },
+};
+
+static const int64_t ThreadCounts[] = { 1, 4 };
+
+static
+void
+GemmFloatArgs(
+    benchmark::internal::Benchmark* b
+    )
+{
+    b->ArgNames({"TransA", "TransB", "M", "N", "K", "Threads"});
+
+    for (int64_t Threads : ThreadCounts) {
+        for (int64_t TransA = 0; TransA < 2; TransA++) {
+            for (int64_t TransB = 0; TransB < 2; TransB++) {
+                for (const auto& Shape : GemmShapes) {
+                    b->Args({TransA, TransB, Shape[0], Shape[1], Shape[2], Threads});
+                }
+            }
+        }
+        for (const auto& Shape : GemmSkinnyShapes) {
+            b->Args({0, 0, Shape[0], Shape[1], Shape[2], Threads});
+        }
+    }
+}
+
+template<typename T>
+void
+GEMM(
+    benchmark::State& state
+    )
+{
+    const CBLAS_TRANSPOSE TransA = state.range(0) != 0 ? CblasTrans : CblasNoTrans;
+    const CBLAS_TRANSPOSE TransB = state.range(1) != 0 ? CblasTrans : CblasNoTrans;
+    const size_t M = static_cast<size_t>(state.range(2));
+    const size_t N = static_cast<size_t>(state.range(3));
+    const size_t K = static_cast<size_t>(state.range(4));
+    MLAS_THREADPOOL* ThreadPool = GetMlasThreadPool(state.range(5));
+
+    auto A = RandomVectorUniform<T>(M * K, T(-1), T(1));
+    auto B = RandomVectorUniform<T>(K * N, T(-1), T(1));
+    std::vector<T> C(M * N);
+
+    const size_t lda = (TransA == CblasNoTrans) ? K : M;
+    const size_t ldb = (TransB == CblasNoTrans) ? N : K;
+
+    for (auto _ : state) {
+        MlasGemm(TransA, TransB, M, N, K, T(1), A.data(), lda, B.data(), ldb, T(0), C.data(), N, ThreadPool);
+    }
+
+    ReportThroughput(state, 2.0 * M * N * K, sizeof(T) * (M * K + K * N + M * N));
+    state.SetLabel(MlasBenchIsaLabel());
+}
+
+BENCHMARK_TEMPLATE(GEMM, float)->Apply(GemmFloatArgs)->UseRealTime();
+
+#if defined(_M_AMD64) || defined(__x86_64__)
+
+BENCHMARK_TEMPLATE(GEMM, double)->Apply(GemmFloatArgs)->UseRealTime();
+
+#endif
+
+#if defined(_M_IX86) || defined(__i386__) || defined(_M_AMD64) || defined(__x86_64__)
+
+//
+// M == 1 selects the matrix/vector kernels (QGEMV) where available.
+//
+
+static
+void
+QGemmArgs(
+    benchmark::internal::Benchmark* b
+    )
+{
+    b->ArgNames({"M", "N", "K", "Threads"});
+
+    for (int64_t Threads : ThreadCounts) {
+        for (const auto& Shape : GemmShapes) {
+            b->Args({Shape[0], Shape[1], Shape[2], Threads});
+        }
+        for (const auto& Shape : GemmSkinnyShapes) {
+            b->Args({Shape[0], Shape[1], Shape[2], Threads});
+        }
+    }
+}
+
+template<typename BType>
+void
+QGEMM(
+    benchmark::State& state
+    )
+{
+    const size_t M = static_cast<size_t>(state.range(0));
+    const size_t N = static_cast<size_t>(state.range(1));
+    const size_t K = static_cast<size_t>(state.range(2));
+    MLAS_THREADPOOL* ThreadPool = GetMlasThreadPool(state.range(3));
+
+    auto A = RandomVectorUniform<uint8_t>(M * K, uint8_t(0), uint8_t(255));
+    auto B = RandomVectorUniform<BType>(K * N, std::numeric_limits<BType>::min(), std::numeric_limits<BType>::max());
+    std::vector<int32_t> C(M * N);
+
+    for (auto _ : state) {
+        MlasGemm(M, N, K, A.data(), K, uint8_t(7), B.data(), N, BType(3), C.data(), N, ThreadPool);
+    }
+
+    ReportThroughput(state, 2.0 * M * N * K, double(M * K + K * N) + sizeof(int32_t) * M * N);
+    state.SetLabel(MlasBenchIsaLabel());
+}
+
+BENCHMARK_TEMPLATE(QGEMM, int8_t)->Apply(QGemmArgs)->UseRealTime();
+BENCHMARK_TEMPLATE(QGEMM, uint8_t)->Apply(QGemmArgs)->UseRealTime();
+
+#endif
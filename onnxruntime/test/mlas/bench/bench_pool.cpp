@@ -0,0 +1,105 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    bench_pool.cpp
+
+Abstract:
+
+    This module implements the benchmarks of the NCHW and NCHWc pooling
+    routines.
+
+--*/
+
+#include "bench_util.h"
+
+//
+// Two dimensional pooling as (BatchCount, Channels, InputHeight, InputWidth,
+// KernelSize, Stride). Global pooling uses a kernel covering the input.
+//
+
+static const int64_t PoolShapes[][6] = {
+    { 1, 64, 112, 112, 3, 2 },
+    { 1, 256, 56, 56, 2, 2 },
+    { 8, 128, 28, 28, 3, 1 },
+    { 1, 2048, 7, 7, 7, 1 },    // global
+};
+
+static
+void
+PoolArgs(
+    benchmark::internal::Benchmark* b
+    )
+{
+    b->ArgNames({"Kind", "N", "C", "H", "W", "K", "S", "Threads"});
+
+    for (int64_t Threads : { 1, 4 }) {
+        for (int64_t Kind = 0; Kind < MlasPoolingKindCount; Kind++) {
+            for (const auto& Shape : PoolShapes) {
+                b->Args({Kind, Shape[0], Shape[1], Shape[2], Shape[3], Shape[4], Shape[5], Threads});
+            }
+        }
+    }
+}
+
+static const char* PoolingKindNames[] = { "Maximum", "AverageExcludePad", "AverageIncludePad" };
+
+template<bool Nchwc>
+void
+POOL(
+    benchmark::State& state
+    )
+{
+    const auto PoolingKind = static_cast<MLAS_POOLING_KIND>(state.range(0));
+    const int64_t BatchCount = state.range(1);
+    int64_t Channels = state.range(2);
+    const int64_t InputHeight = state.range(3);
+    const int64_t InputWidth = state.range(4);
+    const int64_t KernelSize = state.range(5);
+    const int64_t Stride = state.range(6);
+    MLAS_THREADPOOL* ThreadPool = GetMlasThreadPool(state.range(7));
+
+    const int64_t Pad = (KernelSize == InputHeight) ? 0 : (KernelSize - 1) / 2;
+    const int64_t OutputHeight = (InputHeight + 2 * Pad - KernelSize) / Stride + 1;
+    const int64_t OutputWidth = (InputWidth + 2 * Pad - KernelSize) / Stride + 1;
+
+    if (Nchwc) {
+        const int64_t BlockSize = int64_t(MlasNchwcGetBlockSize());
+        if (BlockSize <= 1) {
+            state.SkipWithError("NCHWc is not supported on this platform");
+            return;
+        }
+        Channels = (Channels + BlockSize - 1) / BlockSize * BlockSize;
+    }
+
+    const int64_t InputShape[] = { BatchCount, Channels, InputHeight, InputWidth };
+    const int64_t KernelShape[] = { KernelSize, KernelSize };
+    const int64_t Padding[] = { Pad, Pad, Pad, Pad };
+    const int64_t StrideShape[] = { Stride, Stride };
+    const int64_t OutputShape[] = { BatchCount, Channels, OutputHeight, OutputWidth };
+
+    auto Input = RandomVectorUniform<float>(size_t(BatchCount * Channels * InputHeight * InputWidth), -1.0f, 1.0f);
+    std::vector<float> Output(size_t(BatchCount * Channels * OutputHeight * OutputWidth));
+
+    for (auto _ : state) {
+        if (Nchwc) {
+            MlasNchwcPool(PoolingKind, InputShape, KernelShape, nullptr, Padding, StrideShape, OutputShape,
+                          Input.data(), Output.data(), ThreadPool);
+        } else {
+            MlasPool(PoolingKind, 2, InputShape, KernelShape, Padding, StrideShape, OutputShape,
+                     Input.data(), Output.data(), ThreadPool);
+        }
+    }
+
+    ReportThroughput(state,
+                     double(Output.size()) * KernelSize * KernelSize,
+                     sizeof(float) * double(Input.size() + Output.size()));
+    state.SetLabel(std::string(MlasBenchIsaLabel()) + "/" + PoolingKindNames[PoolingKind]);
+}
+
+BENCHMARK_TEMPLATE(POOL, false)->Apply(PoolArgs)->UseRealTime();
+BENCHMARK_TEMPLATE(POOL, true)->Apply(PoolArgs)->UseRealTime();
@@ -0,0 +1,92 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    bench_util.h
+
+Abstract:
+
+    This module contains the helpers shared by the MLAS benchmarks.
+
+--*/
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <mlas.h>
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+//
+// Returns a thread pool with the requested number of threads, or nullptr to
+// run single threaded. Thread pools are created once and reused across the
+// benchmarks.
+//
+
+MLAS_THREADPOOL*
+GetMlasThreadPool(
+    int64_t ThreadCount
+    );
+
+template<typename T>
+std::vector<T>
+RandomVectorUniform(
+    size_t N,
+    T MinValue,
+    T MaxValue
+    )
+{
+    static std::default_random_engine generator(static_cast<unsigned>(N));
+    std::vector<T> r(N);
+
+    if (std::is_floating_point<T>::value) {
+        std::uniform_real_distribution<double> distribution(static_cast<double>(MinValue), static_cast<double>(MaxValue));
+        for (auto& v : r) {
+            v = static_cast<T>(distribution(generator));
+        }
+    } else {
+        std::uniform_int_distribution<int64_t> distribution(static_cast<int64_t>(MinValue), static_cast<int64_t>(MaxValue));
+        for (auto& v : r) {
+            v = static_cast<T>(distribution(generator));
+        }
+    }
+
+    return r;
+}
+
+//
+// Reports the arithmetic and memory throughput of a benchmark. Operations and
+// bytes are per iteration. Bytes count each input read and each output written
+// once, so the rate is a lower bound of the memory traffic.
+//
+
+inline
+void
+ReportThroughput(
+    benchmark::State& state,
+    double Operations,
+    double Bytes
+    )
+{
+    state.counters["FLOPS"] = benchmark::Counter(Operations * state.iterations(), benchmark::Counter::kIsRate);
+    state.SetBytesProcessed(static_cast<int64_t>(Bytes * state.iterations()));
+}
+
+//
+// Labels the benchmark results with the instruction set extension limit
+// selected with the MLAS_MAXIMUM_ISA environment variable.
+//
+
+const char*
+MlasBenchIsaLabel(
+    void
+    );
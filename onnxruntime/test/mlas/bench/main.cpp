@@ -0,0 +1,89 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    main.cpp
+
+Abstract:
+
+    This module implements the entry point of the MLAS benchmarks.
+
+    The instruction set extensions used by MLAS can be limited by setting the
+    MLAS_MAXIMUM_ISA environment variable to SSE2, AVX, AVX2, AVX512F,
+    AVX512CORE or AVX512VNNI, so the kernels of each processor generation can
+    be measured on the same machine.
+
+--*/
+
+#include "bench_util.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+
+#if !defined(MLAS_NO_ONNXRUNTIME_THREADPOOL)
+#include "core/platform/threadpool.h"
+#endif
+
+MLAS_THREADPOOL*
+GetMlasThreadPool(
+    int64_t ThreadCount
+    )
+{
+#if !defined(MLAS_NO_ONNXRUNTIME_THREADPOOL)
+    static std::map<int64_t, std::unique_ptr<onnxruntime::concurrency::ThreadPool>> ThreadPools;
+
+    if (ThreadCount <= 1) {
+        return nullptr;
+    }
+
+    auto& ThreadPool = ThreadPools[ThreadCount];
+
+    if (ThreadPool == nullptr) {
+        ThreadPool.reset(new onnxruntime::concurrency::ThreadPool(
+            &onnxruntime::Env::Default(), onnxruntime::ThreadOptions(), nullptr, static_cast<int>(ThreadCount), true, nullptr));
+    }
+
+    return ThreadPool.get();
+#else
+    (void)ThreadCount;
+    return nullptr;
+#endif
+}
+
+const char*
+MlasBenchIsaLabel(
+    void
+    )
+{
+    static const char* Label = []() {
+        const char* Value = getenv("MLAS_MAXIMUM_ISA");
+        return Value != nullptr ? Value : "native";
+    }();
+
+    return Label;
+}
+
+int
+main(
+    int argc,
+    char** argv
+    )
+{
+    printf("MLAS_MAXIMUM_ISA: %s, NCHWc block size: %zu\n", MlasBenchIsaLabel(), MlasNchwcGetBlockSize());
+
+    benchmark::Initialize(&argc, argv);
+
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+
+    return 0;
+}
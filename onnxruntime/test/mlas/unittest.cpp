@@ -17,6 +17,7 @@ Abstract:
 #include <stdio.h>
 #include <memory.h>
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <mlas.h>
@@ -697,6 +698,8 @@ protected:
         float* Output = BufferOutput.GetBuffer(OutputElements);
         float* OutputReference = BufferOutputReference.GetBuffer(OutputElements);
 
+        Algorithm = MlasConvAlgorithmGemmDirect;
+
         MlasConv2D(BatchCount,
                    GroupCount,
                    InputChannels,
@@ -728,13 +731,56 @@ protected:
                         Bias,
                         OutputReference);
 
-        if (memcmp(Output, OutputReference, OutputElements * sizeof(float)) != 0) {
+        bool Matches;
+
+        if (Algorithm == MlasConvAlgorithmWinograd) {
+            Matches = CloseToReference(Output, OutputReference, OutputElements,
+                InputChannels * KernelSize);
+        } else {
+            Matches = memcmp(Output, OutputReference, OutputElements * sizeof(float)) == 0;
+        }
+
+        if (!Matches) {
             printf("mismatch: batch=%zd,group=%zd,input(%zd,%zd,%zd),filter=%zd,kernel(%zd,%zd)!!!\n",
                 BatchCount, GroupCount, InputChannels, InputHeight, InputWidth, FilterCount,
                 KernelHeight, KernelWidth);
         }
     }
 
+    static
+    bool
+    CloseToReference(
+        const float* Output,
+        const float* OutputReference,
+        size_t OutputElements,
+        size_t ReductionSize
+        )
+    {
+        //
+        // Winograd convolutions transform the input and filter with fractional
+        // coefficients, so the output is only exact to a tolerance relative to
+        // the magnitude of the output. The rounding error accumulates over the
+        // input channels and kernel elements summed for each output element.
+        //
+
+        float MaximumMagnitude = 0.0f;
+
+        for (size_t i = 0; i < OutputElements; i++) {
+            MaximumMagnitude = (std::max)(MaximumMagnitude, std::fabs(OutputReference[i]));
+        }
+
+        const float Tolerance = 4.0f * std::numeric_limits<float>::epsilon() *
+            float(ReductionSize) * (std::max)(MaximumMagnitude, 1.0f);
+
+        for (size_t i = 0; i < OutputElements; i++) {
+            if (!(std::fabs(Output[i] - OutputReference[i]) <= Tolerance)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     virtual
     void
     MlasConv2D(
@@ -791,6 +837,8 @@ protected:
                         &WorkingBufferSize,
                         nullptr);
 
+        Algorithm = Parameters.Algorithm;
+
         MlasConv(&Parameters,
                  Input,
                  Filter,
@@ -897,6 +945,7 @@ protected:
     MatrixGuardBuffer<float> BufferOutputReference;
     MatrixGuardBuffer<float> BufferWorking;
     MatrixGuardBuffer<float> BufferIm2Col;
+    MLAS_CONV_ALGORITHM Algorithm;
 
 public:
     void
@@ -912,7 +961,15 @@ public:
             Test(1, 1, 16, i, i, 32, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1);
             Test(1, 1, 16, i, i, 32, i, 1, 0, 0, 0, 0, 1, 1, 1, 1);
             Test(1, 1, 16, i, i, 32, 1, i, 0, 0, 0, 0, 1, 1, 1, 1);
+            Test(1, 32, 1, i, i, 1, 3, 3, 0, 0, 0, 0, 1, 1, 1, 1);
+            Test(1, 32, 1, i, i, 1, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1);
+            Test(1, 32, 1, i, i, 1, 3, 3, 1, 1, 1, 1, 1, 1, 2, 2);
+            Test(1, 32, 1, i, i, 1, 3, 3, 2, 2, 2, 2, 2, 2, 1, 1);
+            Test(2, 32, 1, i, i, 1, 5, 5, 2, 2, 2, 2, 1, 1, 1, 1);
+            Test(2, 1, 32, i, i + 3, 24, 3, 3, 1, 0, 1, 2, 1, 1, 1, 1);
         }
+
+        Test(1, 1, 256, 14, 14, 256, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1);
     }
 
     void
@@ -933,6 +990,12 @@ public:
             Test(b, 1, 64, 11, 11, 128, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1);
         }
 
+        for (unsigned gc = 1; gc <= 8; gc++) {
+            Test(2, 12, gc, 23, 19, gc, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1);
+            Test(2, 12, gc, 23, 19, 2 * gc, 3, 3, 0, 1, 2, 0, 1, 2, 2, 1);
+            Test(1, 24, 1, 17, 29, gc, 5, 3, 2, 1, 2, 1, 2, 1, 1, 2);
+        }
+
         for (unsigned ic = 0; ic < _countof(cs); ic++) {
             for (unsigned ih = 0; ih < _countof(is); ih++) {
                 for (unsigned iw = 0; iw < _countof(is); iw++) {
@@ -1190,6 +1253,451 @@ public:
 
 };
 
+class MlasNchwcQConv2DTest : public MlasTestBase
+{
+private:
+    void
+    Test(
+        size_t BatchCount,
+        size_t GroupCount,
+        size_t InputChannels,
+        size_t InputHeight,
+        size_t InputWidth,
+        size_t FilterCount,
+        size_t KernelHeight,
+        size_t KernelWidth,
+        size_t PaddingLeftHeight,
+        size_t PaddingLeftWidth,
+        size_t PaddingRightHeight,
+        size_t PaddingRightWidth,
+        size_t DilationHeight,
+        size_t DilationWidth,
+        size_t StrideHeight,
+        size_t StrideWidth,
+        uint8_t InputZeroPoint,
+        uint8_t FilterZeroPoint
+        )
+    {
+        int64_t OutputHeight64 =
+            ((int64_t(InputHeight) + int64_t(PaddingLeftHeight) + int64_t(PaddingRightHeight)) -
+            (int64_t(DilationHeight) * (int64_t(KernelHeight) - 1) + 1)) / int64_t(StrideHeight) + 1;
+        int64_t OutputWidth64 =
+            ((int64_t(InputWidth) + int64_t(PaddingLeftWidth) + int64_t(PaddingRightWidth)) -
+            (int64_t(DilationWidth) * (int64_t(KernelWidth) - 1) + 1)) / int64_t(StrideWidth) + 1;
+
+        if (OutputHeight64 <= 0 || OutputWidth64 <= 0) {
+            return;
+        }
+
+        size_t OutputHeight = size_t(OutputHeight64);
+        size_t OutputWidth = size_t(OutputWidth64);
+
+        size_t InputSize = InputHeight * InputWidth;
+        size_t KernelSize = KernelHeight * KernelWidth;
+        size_t OutputSize = OutputHeight * OutputWidth;
+
+        size_t InputElements = BatchCount * GroupCount * InputChannels * InputSize;
+        size_t FilterElements = GroupCount * FilterCount * InputChannels * KernelSize;
+        size_t BiasElements = GroupCount * FilterCount;
+        size_t OutputElements = BatchCount * GroupCount * FilterCount * OutputSize;
+
+        const uint8_t* Input = BufferInput.GetBuffer(InputElements);
+        const uint8_t* Filter = BufferFilter.GetBuffer(FilterElements);
+        const int32_t* Bias = BufferBias.GetBuffer(BiasElements);
+        uint8_t* Output = BufferOutput.GetBuffer(OutputElements);
+        uint8_t* OutputReference = BufferOutputReference.GetBuffer(OutputElements);
+
+        const float OutputScale = 1.0f / float(InputChannels * KernelSize * 64);
+        const uint8_t OutputZeroPoint = 128;
+
+        int64_t InputShape[] = { int64_t(BatchCount), int64_t(GroupCount * InputChannels), int64_t(InputHeight), int64_t(InputWidth) };
+        int64_t FilterShape[] = { int64_t(GroupCount * FilterCount), int64_t(InputChannels), int64_t(KernelHeight), int64_t(KernelWidth) };
+        int64_t OutputShape[] = { int64_t(BatchCount), int64_t(GroupCount * FilterCount), int64_t(OutputHeight), int64_t(OutputWidth) };
+
+        int64_t KernelShape[] = { int64_t(KernelHeight), int64_t(KernelWidth) };
+        int64_t DilationShape[] = { int64_t(DilationHeight), int64_t(DilationWidth) };
+        int64_t Padding[] = { int64_t(PaddingLeftHeight), int64_t(PaddingLeftWidth), int64_t(PaddingRightHeight), int64_t(PaddingRightWidth) };
+        int64_t StrideShape[] = { int64_t(StrideHeight), int64_t(StrideWidth) };
+
+        //
+        // Select the type of convolution that will be performed.
+        //
+
+        bool DoReorderInput;
+        bool ReorderFilterOIHWBo;
+
+        if (GroupCount > 1 && InputChannels == 1 && FilterCount == 1) {
+            // Depthwise convolution.
+            DoReorderInput = true;
+            ReorderFilterOIHWBo = true;
+        } else if (InputChannels >= BlockSize) {
+            // NCHWc or pointwise convolution;
+            DoReorderInput = true;
+            ReorderFilterOIHWBo = false;
+        } else {
+            // NCHW convolution.
+            DoReorderInput = false;
+            ReorderFilterOIHWBo = true;
+        }
+
+        size_t NchwcInputChannels = (GroupCount * InputChannels + BlockSize - 1) & ~(BlockSize - 1);
+        size_t NchwcOutputChannels = (GroupCount * FilterCount + BlockSize - 1) & ~(BlockSize - 1);
+
+        uint8_t* ReorderedFilter;
+
+        if (ReorderFilterOIHWBo) {
+            ReorderedFilter = BufferNchwcFilter.GetBuffer(NchwcOutputChannels * InputChannels * KernelSize);
+            MlasReorderFilterOIHWBo(FilterShape, Filter, ReorderedFilter);
+        } else {
+            ReorderedFilter = BufferNchwcFilter.GetBuffer(NchwcOutputChannels * NchwcInputChannels * KernelSize);
+            MlasReorderFilterOIHWBiBo(FilterShape, Filter, ReorderedFilter);
+        }
+
+        int32_t* AlignedBias = BufferNchwcBias.GetBuffer(NchwcOutputChannels);
+        std::fill_n(AlignedBias, NchwcOutputChannels, 0);
+        std::copy_n(Bias, BiasElements, AlignedBias);
+
+        const uint8_t* NchwcInput = Input;
+
+        if (DoReorderInput) {
+            uint8_t* ReorderedInput = BufferNchwcInput.GetBuffer(BatchCount * NchwcInputChannels * InputSize);
+            MlasReorderInput(InputShape, Input, ReorderedInput);
+            NchwcInput = ReorderedInput;
+            InputShape[1] = NchwcInputChannels;
+        }
+
+        int64_t NchwcOutputShape[] = { int64_t(BatchCount), int64_t(NchwcOutputChannels), int64_t(OutputHeight), int64_t(OutputWidth) };
+
+        uint8_t* NchwcOutput = BufferNchwcOutput.GetBuffer(BatchCount * NchwcOutputChannels * OutputSize);
+
+        MlasNchwcConv(InputShape,
+                      KernelShape,
+                      DilationShape,
+                      Padding,
+                      StrideShape,
+                      NchwcOutputShape,
+                      GroupCount,
+                      NchwcInput,
+                      InputZeroPoint,
+                      ReorderedFilter,
+                      FilterZeroPoint,
+                      AlignedBias,
+                      NchwcOutput,
+                      OutputScale,
+                      OutputZeroPoint,
+                      threadpool);
+
+        MlasReorderOutputNchw(OutputShape, NchwcOutput, Output);
+
+        //
+        // Compute the reference result.
+        //
+
+        const float MinimumValue = float(0 - int32_t(OutputZeroPoint));
+        const float MaximumValue = float(255 - int32_t(OutputZeroPoint));
+
+        uint8_t* y = OutputReference;
+
+        for (size_t b = 0; b < BatchCount; b++) {
+            for (size_t g = 0; g < GroupCount; g++) {
+                for (size_t fc = 0; fc < FilterCount; fc++) {
+                    for (size_t oh = 0; oh < OutputHeight; oh++) {
+                        for (size_t ow = 0; ow < OutputWidth; ow++) {
+
+                            int32_t Accumulator = Bias[g * FilterCount + fc];
+
+                            for (size_t ic = 0; ic < InputChannels; ic++) {
+
+                                const uint8_t* x = Input + ((b * GroupCount + g) * InputChannels + ic) * InputSize;
+                                const uint8_t* w = Filter + ((g * FilterCount + fc) * InputChannels + ic) * KernelSize;
+
+                                for (size_t kh = 0; kh < KernelHeight; kh++) {
+                                    for (size_t kw = 0; kw < KernelWidth; kw++) {
+
+                                        size_t ih = oh * StrideHeight + kh * DilationHeight - PaddingLeftHeight;
+                                        size_t iw = ow * StrideWidth + kw * DilationWidth - PaddingLeftWidth;
+
+                                        if (ih < InputHeight && iw < InputWidth) {
+                                            Accumulator += (int32_t(x[ih * InputWidth + iw]) - InputZeroPoint) *
+                                                (int32_t(w[kh * KernelWidth + kw]) - FilterZeroPoint);
+                                        }
+                                    }
+                                }
+                            }
+
+                            float FloatValue = float(Accumulator) * OutputScale;
+                            FloatValue = std::min(std::max(FloatValue, MinimumValue), MaximumValue);
+
+                            *y++ = uint8_t(int32_t(std::nearbyintf(FloatValue)) + OutputZeroPoint);
+                        }
+                    }
+                }
+            }
+        }
+
+        if (memcmp(Output, OutputReference, OutputElements) != 0) {
+            printf("mismatch: batch=%zd,group=%zd,input(%zd,%zd,%zd),filter=%zd,kernel(%zd,%zd),zp(%d,%d)!!!\n",
+                BatchCount, GroupCount, InputChannels, InputHeight, InputWidth, FilterCount,
+                KernelHeight, KernelWidth, InputZeroPoint, FilterZeroPoint);
+        }
+    }
+
+    const size_t BlockSize = MlasNchwcGetBlockSize();
+
+    MatrixGuardBuffer<uint8_t> BufferInput;
+    MatrixGuardBuffer<uint8_t> BufferFilter;
+    MatrixGuardBuffer<int32_t> BufferBias;
+    MatrixGuardBuffer<uint8_t> BufferOutput;
+    MatrixGuardBuffer<uint8_t> BufferOutputReference;
+    MatrixGuardBuffer<uint8_t> BufferNchwcInput;
+    MatrixGuardBuffer<uint8_t> BufferNchwcFilter;
+    MatrixGuardBuffer<int32_t> BufferNchwcBias;
+    MatrixGuardBuffer<uint8_t> BufferNchwcOutput;
+
+public:
+    void
+    ExecuteShort(
+        void
+        ) override
+    {
+        static const uint8_t zero_points[] = { 0, 18, 75, 128 };
+
+        for (unsigned i = 1; i < 64; i <<= 1) {
+            for (size_t z = 0; z < _countof(zero_points); z++) {
+                const uint8_t xzp = zero_points[z];
+                const uint8_t wzp = zero_points[_countof(zero_points) - z - 1];
+                Test(1, 1, 16, i, i, 32, 3, 3, 0, 0, 0, 0, 1, 1, 1, 1, xzp, wzp);
+                Test(1, 1, 16, i, i, 32, 3, 3, 1, 1, 1, 1, 1, 1, 2, 2, xzp, wzp);
+                Test(1, 1, 16, i, i, 32, 3, 3, 2, 2, 2, 2, 2, 2, 1, 1, xzp, wzp);
+                Test(1, 1, 32, i, i, 24, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, xzp, wzp);
+                Test(2, 1, 32, i, i + 3, 24, 3, 3, 1, 0, 1, 2, 1, 1, 1, 1, xzp, wzp);
+                Test(1, 1, 3, i, i, 32, 3, 3, 1, 1, 1, 1, 1, 1, 2, 2, xzp, wzp);
+                Test(1, 32, 1, i, i, 1, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, xzp, wzp);
+                Test(2, 32, 1, i, i, 1, 5, 5, 2, 2, 2, 2, 1, 1, 2, 2, xzp, wzp);
+                Test(1, 2, 16, i, i, 16, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, xzp, wzp);
+            }
+        }
+    }
+};
+
+class MlasConvTranspose2DTest : public MlasTestBase
+{
+protected:
+    void
+    Test(
+        size_t BatchCount,
+        size_t GroupCount,
+        size_t InputChannels,
+        size_t InputHeight,
+        size_t InputWidth,
+        size_t FilterCount,
+        size_t KernelHeight,
+        size_t KernelWidth,
+        size_t PaddingLeftHeight,
+        size_t PaddingLeftWidth,
+        size_t PaddingRightHeight,
+        size_t PaddingRightWidth,
+        size_t DilationHeight,
+        size_t DilationWidth,
+        size_t StrideHeight,
+        size_t StrideWidth
+        )
+    {
+        int64_t OutputHeight64 =
+            (int64_t(InputHeight) - 1) * int64_t(StrideHeight) +
+            int64_t(DilationHeight) * (int64_t(KernelHeight) - 1) + 1 -
+            int64_t(PaddingLeftHeight) - int64_t(PaddingRightHeight);
+        int64_t OutputWidth64 =
+            (int64_t(InputWidth) - 1) * int64_t(StrideWidth) +
+            int64_t(DilationWidth) * (int64_t(KernelWidth) - 1) + 1 -
+            int64_t(PaddingLeftWidth) - int64_t(PaddingRightWidth);
+
+        if (OutputHeight64 <= 0 || OutputWidth64 <= 0) {
+            return;
+        }
+
+        size_t OutputHeight = size_t(OutputHeight64);
+        size_t OutputWidth = size_t(OutputWidth64);
+
+        size_t InputSize = InputHeight * InputWidth;
+        size_t KernelSize = KernelHeight * KernelWidth;
+        size_t OutputSize = OutputHeight * OutputWidth;
+
+        size_t InputElements = BatchCount * GroupCount * InputChannels * InputSize;
+        size_t FilterElements = GroupCount * InputChannels * FilterCount * KernelSize;
+        size_t BiasElements = GroupCount * FilterCount;
+        size_t OutputElements = BatchCount * GroupCount * FilterCount * OutputSize;
+
+        const float* Input = BufferInput.GetBuffer(InputElements);
+        const float* Filter = BufferFilter.GetBuffer(FilterElements);
+        const float* Bias = BufferBias.GetBuffer(BiasElements);
+        float* Output = BufferOutput.GetBuffer(OutputElements);
+        float* OutputReference = BufferOutputReference.GetBuffer(OutputElements);
+
+        int64_t InputShape[] = { int64_t(InputHeight), int64_t(InputWidth) };
+        int64_t KernelShape[] = { int64_t(KernelHeight), int64_t(KernelWidth) };
+        int64_t DilationShape[] = { int64_t(DilationHeight), int64_t(DilationWidth) };
+        int64_t Padding[] = { int64_t(PaddingLeftHeight), int64_t(PaddingLeftWidth), int64_t(PaddingRightHeight), int64_t(PaddingRightWidth) };
+        int64_t StrideShape[] = { int64_t(StrideHeight), int64_t(StrideWidth) };
+        int64_t OutputShape[] = { int64_t(OutputHeight), int64_t(OutputWidth) };
+
+        MLAS_ACTIVATION Activation;
+        Activation.ActivationKind = MlasIdentityActivation;
+
+        MLAS_CONV_PARAMETERS Parameters;
+        size_t WorkingBufferSize;
+
+        MlasConvTransposePrepare(&Parameters,
+                                 2,
+                                 BatchCount,
+                                 GroupCount,
+                                 InputChannels,
+                                 InputShape,
+                                 KernelShape,
+                                 DilationShape,
+                                 Padding,
+                                 StrideShape,
+                                 OutputShape,
+                                 FilterCount,
+                                 &Activation,
+                                 &WorkingBufferSize,
+                                 nullptr);
+
+        MlasConvTranspose(&Parameters,
+                          Input,
+                          Filter,
+                          Bias,
+                          BufferWorking.GetBuffer(WorkingBufferSize),
+                          Output,
+                          nullptr);
+
+        ReferenceConvTranspose2D(BatchCount,
+                                 GroupCount,
+                                 InputChannels,
+                                 InputHeight, InputWidth,
+                                 FilterCount,
+                                 KernelHeight, KernelWidth,
+                                 PaddingLeftHeight, PaddingLeftWidth,
+                                 DilationHeight, DilationWidth,
+                                 StrideHeight, StrideWidth,
+                                 OutputHeight, OutputWidth,
+                                 Input,
+                                 Filter,
+                                 Bias,
+                                 OutputReference);
+
+        if (memcmp(Output, OutputReference, OutputElements * sizeof(float)) != 0) {
+            printf("mismatch: batch=%zd,group=%zd,input(%zd,%zd,%zd),filter=%zd,kernel(%zd,%zd),stride(%zd,%zd)!!!\n",
+                BatchCount, GroupCount, InputChannels, InputHeight, InputWidth, FilterCount,
+                KernelHeight, KernelWidth, StrideHeight, StrideWidth);
+        }
+    }
+
+    void
+    ReferenceConvTranspose2D(
+        size_t BatchCount,
+        size_t GroupCount,
+        size_t InputChannels,
+        size_t InputHeight,
+        size_t InputWidth,
+        size_t FilterCount,
+        size_t KernelHeight,
+        size_t KernelWidth,
+        size_t PaddingLeftHeight,
+        size_t PaddingLeftWidth,
+        size_t DilationHeight,
+        size_t DilationWidth,
+        size_t StrideHeight,
+        size_t StrideWidth,
+        size_t OutputHeight,
+        size_t OutputWidth,
+        const float* Input,
+        const float* Filter,
+        const float* Bias,
+        float* Output
+        )
+    {
+        size_t InputSize = InputHeight * InputWidth;
+        size_t OutputSize = OutputHeight * OutputWidth;
+        size_t KernelSize = KernelHeight * KernelWidth;
+
+        for (size_t b = 0; b < BatchCount; b++) {
+
+            for (size_t g = 0; g < GroupCount; g++) {
+
+                const float* filter = Filter + g * InputChannels * FilterCount * KernelSize;
+
+                //
+                // Initialize the output with the bias and scatter every input
+                // element through the kernel.
+                //
+
+                for (size_t f = 0; f < FilterCount; f++) {
+                    std::fill_n(Output + f * OutputSize, OutputSize, Bias[g * FilterCount + f]);
+                }
+
+                for (size_t c = 0; c < InputChannels; c++) {
+
+                    for (size_t ih = 0; ih < InputHeight; ih++) {
+
+                        for (size_t iw = 0; iw < InputWidth; iw++) {
+
+                            float InputValue = Input[c * InputSize + ih * InputWidth + iw];
+
+                            for (size_t f = 0; f < FilterCount; f++) {
+
+                                const float* filter_cf = filter + (c * FilterCount + f) * KernelSize;
+
+                                for (size_t ky = 0; ky < KernelHeight; ky++) {
+
+                                    size_t oh = ih * StrideHeight + ky * DilationHeight - PaddingLeftHeight;
+
+                                    for (size_t kx = 0; kx < KernelWidth; kx++) {
+
+                                        size_t ow = iw * StrideWidth + kx * DilationWidth - PaddingLeftWidth;
+
+                                        if (oh < OutputHeight && ow < OutputWidth) {
+                                            Output[f * OutputSize + oh * OutputWidth + ow] +=
+                                                InputValue * filter_cf[ky * KernelWidth + kx];
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+
+                Input += InputChannels * InputSize;
+                Output += FilterCount * OutputSize;
+            }
+        }
+    }
+
+    MatrixGuardBuffer<float> BufferInput;
+    MatrixGuardBuffer<float> BufferFilter;
+    MatrixGuardBuffer<float> BufferBias;
+    MatrixGuardBuffer<float> BufferOutput;
+    MatrixGuardBuffer<float> BufferOutputReference;
+    MatrixGuardBuffer<float> BufferWorking;
+
+public:
+    void
+    ExecuteShort(
+        void
+        ) override
+    {
+        for (unsigned i = 1; i < 64; i <<= 1) {
+            Test(1, 1, 16, i, i, 32, 4, 4, 1, 1, 1, 1, 1, 1, 2, 2);
+            Test(1, 1, 16, i, i, 32, 3, 3, 1, 1, 0, 0, 1, 1, 2, 2);
+            Test(1, 1, 16, i, i, 32, 3, 3, 0, 0, 0, 0, 2, 2, 1, 1);
+            Test(1, 1, 16, i, i, 32, 2, 2, 0, 0, 0, 0, 1, 1, 2, 2);
+            Test(1, 1, 8, i, i, 8, 1, 1, 0, 0, 0, 0, 1, 1, 2, 2);
+            Test(2, 4, 8, i, i + 3, 4, 3, 3, 1, 1, 1, 1, 1, 1, 2, 2);
+            Test(1, 1, 8, i, i, 8, 5, 3, 2, 1, 1, 2, 1, 2, 3, 2);
+        }
+    }
+};
+
 class MlasPool2DTest : public MlasTestBase
 {
 protected:
@@ -2069,6 +2577,71 @@ public:
     }
 };
 
+class MlasFp16Test : public MlasTestBase
+{
+private:
+    MatrixGuardBuffer<unsigned short> BufferHalf;
+    MatrixGuardBuffer<unsigned short> BufferHalf2;
+    MatrixGuardBuffer<float> BufferFloat;
+
+public:
+    void
+    ExecuteShort(
+        void
+        ) override
+    {
+        const size_t Count = 65536;
+
+        unsigned short* Half = BufferHalf.GetBuffer(Count);
+        unsigned short* Half2 = BufferHalf2.GetBuffer(Count);
+        float* Float = BufferFloat.GetBuffer(Count);
+
+        for (size_t i = 0; i < Count; i++) {
+            Half[i] = (unsigned short)i;
+        }
+
+        //
+        // Every half precision value, other than NaNs, converts to a single
+        // precision value that converts back to the same half.
+        //
+
+        MlasConvertHalfToFloatBuffer(Half, Float, Count);
+        MlasConvertFloatToHalfBuffer(Float, Half2, Count);
+
+        for (size_t i = 0; i < Count; i++) {
+            bool IsNaN = (i & 0x7C00) == 0x7C00 && (i & 0x03FF) != 0;
+            if (IsNaN ? !std::isnan(Float[i]) : Half2[i] != Half[i]) {
+                printf("mismatch fp16 round trip: half=%04zx float=%g half=%04x\n", i, Float[i], Half2[i]);
+            }
+        }
+
+        static const struct {
+            float Value;
+            unsigned short Half;
+        } TestData[] = {
+            { 1.0f, 0x3C00 },
+            { -2.5f, 0xC100 },
+            { 65504.0f, 0x7BFF },
+            { 65520.0f, 0x7C00 },
+            { 1.0f + 1.0f / 2048.0f, 0x3C00 },          // ties round to even
+            { 1.0f + 3.0f / 2048.0f, 0x3C02 },
+            { 5.9604645e-08f, 0x0001 },                 // smallest denormal
+            { 2.0e-08f, 0x0000 },
+            { -std::numeric_limits<float>::infinity(), 0xFC00 },
+        };
+
+        // Odd counts exercise the partial vector paths.
+        for (size_t i = 0; i < _countof(TestData); i++) {
+            float Source[3] = { TestData[i].Value, TestData[i].Value, TestData[i].Value };
+            unsigned short Destination[3];
+            MlasConvertFloatToHalfBuffer(Source, Destination, 3);
+            if (Destination[2] != TestData[i].Half) {
+                printf("mismatch fp16 conversion: float=%g half=%04x expected=%04x\n", TestData[i].Value, Destination[2], TestData[i].Half);
+            }
+        }
+    }
+};
+
 int
 #if defined(_WIN32)
 __cdecl
@@ -2096,8 +2669,12 @@ main(
         onnxruntime::make_unique<MlasConv2DTest>()->ExecuteShort();
         if (MlasNchwcGetBlockSize() > 1) {
           onnxruntime::make_unique<MlasNchwcConv2DTest>()->ExecuteShort();
+          onnxruntime::make_unique<MlasNchwcQConv2DTest>()->ExecuteShort();
         }
 
+        printf("ConvTranspose2D tests.\n");
+        onnxruntime::make_unique<MlasConvTranspose2DTest>()->ExecuteShort();
+
         printf("Pool2D tests.\n");
         onnxruntime::make_unique<MlasPool2DTest>()->ExecuteShort();
         if (MlasNchwcGetBlockSize() > 1) {
@@ -2123,6 +2700,9 @@ main(
     printf("Activation tests.\n");
     onnxruntime::make_unique<MlasActivationTest>()->ExecuteShort();
 
+    printf("FP16 tests.\n");
+    onnxruntime::make_unique<MlasFp16Test>()->ExecuteShort();
+
     printf("ReorderOutput tests.\n");
     if (MlasNchwcGetBlockSize() > 1) {
         onnxruntime::make_unique<MlasReorderOutputTest>()->ExecuteShort();
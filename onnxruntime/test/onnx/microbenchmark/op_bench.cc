@@ -0,0 +1,382 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// Benchmarks of individual CPU kernels. Each entry of OpBenchSpecs() describes a single node model that is run
+// both through InferenceSession::Run and by calling OpKernel::Compute directly, so that the framework overhead
+// can be told apart from the time spent in the kernel. Every benchmark is run with several intra-op thread counts
+// and reports the bytes read and written by the node, which can be compared with the memory bandwidth of the
+// machine to find kernels that are far from the roofline.
+//
+// Run a subset with e.g. --benchmark_filter=OpBench/Kernel/TopK
+
+#include <benchmark/benchmark.h>
+#include <core/common/make_unique.h>
+#include <core/framework/execution_frame.h>
+#include <core/framework/op_kernel_context_internal.h>
+#include <core/framework/session_state.h>
+#include <core/framework/tensor.h>
+#include <core/graph/model.h>
+#include <core/graph/onnx_protobuf.h>
+#include <core/session/inference_session.h>
+#include <core/session/ort_env.h>
+
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+extern OrtEnv* env;
+
+using namespace onnxruntime;
+using namespace ONNX_NAMESPACE;
+
+namespace {
+
+struct OpBenchInput {
+  std::vector<int64_t> shape;
+  TensorProto_DataType type;
+  // range of the random values used to fill a graph input
+  double min_value;
+  double max_value;
+  // if not empty the input is an initializer holding these values, e.g. the indices of a Gather or the K of a TopK
+  std::vector<double> constant_data;
+  // true for an initializer with no elements, e.g. the unused 'roi' input of Resize
+  bool empty_constant;
+};
+
+struct OpBenchSpec {
+  std::string name;
+  std::string op_type;
+  std::string domain;
+  int opset;
+  std::vector<OpBenchInput> inputs;
+  int num_outputs;
+  std::vector<AttributeProto> attributes;
+};
+
+OpBenchInput RandomInput(std::vector<int64_t> shape, TensorProto_DataType type = TensorProto_DataType_FLOAT,
+                         double min_value = -1.0, double max_value = 1.0) {
+  return {std::move(shape), type, min_value, max_value, {}, false};
+}
+
+OpBenchInput ConstantInput(std::vector<int64_t> shape, TensorProto_DataType type, std::vector<double> data) {
+  return {std::move(shape), type, 0.0, 0.0, std::move(data), false};
+}
+
+OpBenchInput EmptyInput(TensorProto_DataType type = TensorProto_DataType_FLOAT) {
+  return {{0}, type, 0.0, 0.0, {}, true};
+}
+
+AttributeProto MakeAttribute(const std::string& name, int64_t value) {
+  AttributeProto attr;
+  attr.set_name(name);
+  attr.set_type(AttributeProto_AttributeType_INT);
+  attr.set_i(value);
+  return attr;
+}
+
+AttributeProto MakeAttribute(const std::string& name, float value) {
+  AttributeProto attr;
+  attr.set_name(name);
+  attr.set_type(AttributeProto_AttributeType_FLOAT);
+  attr.set_f(value);
+  return attr;
+}
+
+AttributeProto MakeAttribute(const std::string& name, const std::string& value) {
+  AttributeProto attr;
+  attr.set_name(name);
+  attr.set_type(AttributeProto_AttributeType_STRING);
+  attr.set_s(value);
+  return attr;
+}
+
+AttributeProto MakeAttribute(const std::string& name, const std::vector<int64_t>& values) {
+  AttributeProto attr;
+  attr.set_name(name);
+  attr.set_type(AttributeProto_AttributeType_INTS);
+  for (int64_t value : values) {
+    attr.add_ints(value);
+  }
+  return attr;
+}
+
+// The nodes to benchmark. Shapes are taken from common vision and transformer models.
+const std::vector<OpBenchSpec>& OpBenchSpecs() {
+  static const std::vector<OpBenchSpec> specs = {
+      {"Gather_Embedding", "Gather", kOnnxDomain, 11,
+       {RandomInput({30522, 768}), RandomInput({8, 128}, TensorProto_DataType_INT64, 0, 30521)},
+       1,
+       {MakeAttribute("axis", int64_t{0})}},
+      {"Gather_Axis1", "Gather", kOnnxDomain, 11,
+       {RandomInput({64, 1024, 16}), RandomInput({256}, TensorProto_DataType_INT64, 0, 1023)},
+       1,
+       {MakeAttribute("axis", int64_t{1})}},
+      {"Resize_Linear_2x", "Resize", kOnnxDomain, 11,
+       {RandomInput({1, 64, 56, 56}), EmptyInput(), ConstantInput({4}, TensorProto_DataType_FLOAT, {1, 1, 2, 2})},
+       1,
+       {MakeAttribute("mode", std::string("linear"))}},
+      {"Resize_Nearest_2x", "Resize", kOnnxDomain, 11,
+       {RandomInput({1, 64, 56, 56}), EmptyInput(), ConstantInput({4}, TensorProto_DataType_FLOAT, {1, 1, 2, 2})},
+       1,
+       {MakeAttribute("mode", std::string("nearest"))}},
+      {"TopK_Classes", "TopK", kOnnxDomain, 11,
+       {RandomInput({64, 1000}), ConstantInput({1}, TensorProto_DataType_INT64, {5})},
+       2,
+       {MakeAttribute("axis", int64_t{-1})}},
+      {"TopK_Detections", "TopK", kOnnxDomain, 11,
+       {RandomInput({1, 120000}), ConstantInput({1}, TensorProto_DataType_INT64, {1000})},
+       2,
+       {MakeAttribute("axis", int64_t{-1})}},
+      {"LayerNormalization", "LayerNormalization", kOnnxDomain, 11,
+       {RandomInput({8, 128, 768}), RandomInput({768}), RandomInput({768})},
+       1,
+       {MakeAttribute("axis", int64_t{-1}), MakeAttribute("epsilon", 1e-5f)}},
+      {"Softmax", "Softmax", kOnnxDomain, 11,
+       {RandomInput({8, 12, 128, 128})},
+       1,
+       {MakeAttribute("axis", int64_t{3})}},
+      {"Transpose_0213", "Transpose", kOnnxDomain, 11,
+       {RandomInput({8, 128, 12, 64})},
+       1,
+       {MakeAttribute("perm", std::vector<int64_t>{0, 2, 1, 3})}},
+      {"Add_Broadcast", "Add", kOnnxDomain, 11,
+       {RandomInput({8, 128, 768}), RandomInput({768})},
+       1,
+       {}},
+      {"Concat_Channels", "Concat", kOnnxDomain, 11,
+       {RandomInput({1, 128, 56, 56}), RandomInput({1, 128, 56, 56})},
+       1,
+       {MakeAttribute("axis", int64_t{1})}},
+      {"Cast_FloatToInt64", "Cast", kOnnxDomain, 11,
+       {RandomInput({1 << 20})},
+       1,
+       {MakeAttribute("to", int64_t{TensorProto_DataType_INT64})}},
+      {"Pad_Constant", "Pad", kOnnxDomain, 11,
+       {RandomInput({1, 64, 112, 112}), ConstantInput({8}, TensorProto_DataType_INT64, {0, 0, 1, 1, 0, 0, 1, 1})},
+       1,
+       {}},
+  };
+  return specs;
+}
+
+template <typename T>
+void FillRandom(Tensor& tensor, const OpBenchInput& input, std::mt19937& generator) {
+  T* data = tensor.MutableData<T>();
+  const int64_t size = tensor.Shape().Size();
+  std::uniform_real_distribution<double> distribution(input.min_value, input.max_value);
+  for (int64_t i = 0; i < size; ++i) {
+    data[i] = static_cast<T>(distribution(generator));
+  }
+}
+
+Status CreateRandomValue(const OpBenchInput& input, std::mt19937& generator, OrtValue& value) {
+  MLDataType element_type = DataTypeImpl::TensorTypeFromONNXEnum(input.type)->GetElementType();
+  auto tensor = onnxruntime::make_unique<Tensor>(element_type, TensorShape(input.shape),
+                                                 std::make_shared<CPUAllocator>());
+  switch (input.type) {
+    case TensorProto_DataType_FLOAT:
+      FillRandom<float>(*tensor, input, generator);
+      break;
+    case TensorProto_DataType_INT32:
+      FillRandom<int32_t>(*tensor, input, generator);
+      break;
+    case TensorProto_DataType_INT64:
+      FillRandom<int64_t>(*tensor, input, generator);
+      break;
+    case TensorProto_DataType_UINT8:
+      FillRandom<uint8_t>(*tensor, input, generator);
+      break;
+    case TensorProto_DataType_INT8:
+      FillRandom<int8_t>(*tensor, input, generator);
+      break;
+    default:
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Unsupported input type ", input.type);
+  }
+  auto ml_tensor = DataTypeImpl::GetType<Tensor>();
+  value.Init(tensor.release(), ml_tensor, ml_tensor->GetDeleteFunc());
+  return Status::OK();
+}
+
+TensorProto CreateInitializer(const std::string& name, const OpBenchInput& input) {
+  TensorProto initializer;
+  initializer.set_name(name);
+  initializer.set_data_type(input.type);
+  for (int64_t dim : input.shape) {
+    initializer.add_dims(dim);
+  }
+  for (double value : input.constant_data) {
+    if (input.type == TensorProto_DataType_INT64) {
+      initializer.add_int64_data(static_cast<int64_t>(value));
+    } else {
+      initializer.add_float_data(static_cast<float>(value));
+    }
+  }
+  return initializer;
+}
+
+// InferenceSession wrapper in order to gain access to the session state.
+class OpBenchSession : public InferenceSession {
+ public:
+  using InferenceSession::InferenceSession;
+
+  const SessionState& GetSessionState() const { return *session_state_; }
+};
+
+// The session, inputs and outputs of one benchmarked node.
+struct OpBenchFixture {
+  std::unique_ptr<OpBenchSession> session;
+  NameMLValMap feeds;
+  std::vector<std::string> feed_names;
+  std::vector<OrtValue> feed_values;
+  std::vector<std::string> output_names;
+  std::vector<OrtValue> fetches;
+  // bytes read from the inputs plus bytes written to the outputs by one run of the node
+  int64_t bytes{0};
+
+  Status Create(const OpBenchSpec& spec, int threads) {
+    auto logger = env->GetLoggingManager()->CreateLogger("OpBench");
+
+    std::unordered_map<std::string, int> domain_to_version;
+    domain_to_version[spec.domain] = spec.opset;
+    Model model(spec.name, false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                domain_to_version, {}, *logger);
+    Graph& graph = model.MainGraph();
+
+    std::mt19937 generator(1234);
+    std::vector<NodeArg*> input_args;
+    for (size_t i = 0; i < spec.inputs.size(); ++i) {
+      const OpBenchInput& input = spec.inputs[i];
+      const std::string name = "input_" + std::to_string(i);
+
+      TypeProto type;
+      type.mutable_tensor_type()->set_elem_type(input.type);
+      for (int64_t dim : input.shape) {
+        type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(dim);
+      }
+      input_args.push_back(&graph.GetOrCreateNodeArg(name, &type));
+
+      if (input.empty_constant || !input.constant_data.empty()) {
+        graph.AddInitializedTensor(CreateInitializer(name, input));
+      } else {
+        OrtValue value;
+        ORT_RETURN_IF_ERROR(CreateRandomValue(input, generator, value));
+        feeds.emplace(name, value);
+        feed_names.push_back(name);
+        feed_values.push_back(value);
+      }
+
+      int64_t size = 1;
+      for (int64_t dim : input.shape) {
+        size *= dim;
+      }
+      bytes += size * DataTypeImpl::TensorTypeFromONNXEnum(input.type)->GetElementType()->Size();
+    }
+
+    std::vector<NodeArg*> output_args;
+    for (int i = 0; i < spec.num_outputs; ++i) {
+      output_names.push_back("output_" + std::to_string(i));
+      output_args.push_back(&graph.GetOrCreateNodeArg(output_names.back(), nullptr));
+    }
+
+    Node& node = graph.AddNode(spec.name, spec.op_type, "", input_args, output_args, nullptr, spec.domain);
+    for (const auto& attr : spec.attributes) {
+      node.AddAttribute(attr.name(), attr);
+    }
+    ORT_RETURN_IF_ERROR(graph.Resolve());
+
+    std::string model_data;
+    model.ToProto().SerializeToString(&model_data);
+
+    // Optimizations are disabled so that the node runs exactly as specified.
+    SessionOptions so;
+    so.session_logid = "OpBench";
+    so.graph_optimization_level = TransformerLevel::Default;
+    so.intra_op_param.thread_pool_size = threads;
+    session = onnxruntime::make_unique<OpBenchSession>(so, env->GetEnvironment());
+    ORT_RETURN_IF_ERROR(session->Load(model_data.data(), static_cast<int>(model_data.size())));
+    ORT_RETURN_IF_ERROR(session->Initialize());
+
+    // The first run allocates the outputs, which are reused by the following runs.
+    ORT_RETURN_IF_ERROR(session->Run(feeds, output_names, &fetches));
+    for (const auto& fetch : fetches) {
+      bytes += static_cast<int64_t>(fetch.Get<Tensor>().SizeInBytes());
+    }
+    return Status::OK();
+  }
+};
+
+void ReportOpBench(benchmark::State& state, const OpBenchFixture& fixture) {
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * fixture.bytes);
+  state.counters["Bytes"] = benchmark::Counter(static_cast<double>(fixture.bytes));
+}
+
+void BM_OpBenchSession(benchmark::State& state, const OpBenchSpec& spec) {
+  OpBenchFixture fixture;
+  auto status = fixture.Create(spec, static_cast<int>(state.range(0)));
+  if (!status.IsOK()) {
+    state.SkipWithError(status.ErrorMessage().c_str());
+    return;
+  }
+
+  for (auto _ : state) {
+    status = fixture.session->Run(fixture.feeds, fixture.output_names, &fixture.fetches);
+    if (!status.IsOK()) {
+      state.SkipWithError(status.ErrorMessage().c_str());
+      break;
+    }
+  }
+  ReportOpBench(state, fixture);
+}
+
+// Calls the kernel directly with an execution frame and kernel context that are prepared once, so only the
+// time spent in OpKernel::Compute is measured.
+void BM_OpBenchKernel(benchmark::State& state, const OpBenchSpec& spec) {
+  OpBenchFixture fixture;
+  auto status = fixture.Create(spec, static_cast<int>(state.range(0)));
+  if (!status.IsOK()) {
+    state.SkipWithError(status.ErrorMessage().c_str());
+    return;
+  }
+
+  const SessionState& session_state = fixture.session->GetSessionState();
+  const OrtValueNameIdxMap& name_idx_map = session_state.GetOrtValueNameIdxMap();
+  std::vector<int> feed_idxs(fixture.feed_names.size());
+  for (size_t i = 0; i < fixture.feed_names.size(); ++i) {
+    ORT_THROW_IF_ERROR(name_idx_map.GetIdx(fixture.feed_names[i], feed_idxs[i]));
+  }
+  std::vector<int> fetch_idxs(fixture.output_names.size());
+  for (size_t i = 0; i < fixture.output_names.size(); ++i) {
+    ORT_THROW_IF_ERROR(name_idx_map.GetIdx(fixture.output_names[i], fetch_idxs[i]));
+  }
+
+  const NodeIndex node_index = session_state.GetGraphViewer()->GetNodesInTopologicalOrder().front();
+  const OpKernel* kernel = session_state.GetKernel(node_index);
+  const bool terminate_flag = false;
+
+  ExecutionFrame frame(feed_idxs, fixture.feed_values, fetch_idxs, fixture.fetches, {}, session_state);
+  OpKernelContextInternal context(session_state, frame, *kernel, session_state.Logger(), terminate_flag);
+
+  for (auto _ : state) {
+    status = kernel->Compute(&context);
+    if (!status.IsOK()) {
+      state.SkipWithError(status.ErrorMessage().c_str());
+      break;
+    }
+  }
+  ReportOpBench(state, fixture);
+}
+
+bool RegisterOpBenchmarks() {
+  for (const auto& spec : OpBenchSpecs()) {
+    for (auto* bench : {benchmark::RegisterBenchmark(("OpBench/Session/" + spec.name).c_str(), BM_OpBenchSession, spec),
+                        benchmark::RegisterBenchmark(("OpBench/Kernel/" + spec.name).c_str(), BM_OpBenchKernel, spec)}) {
+      bench->ArgName("Threads")->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+    }
+  }
+  return true;
+}
+
+const bool op_benchmarks_registered = RegisterOpBenchmarks();
+
+}  // namespace
@@ -14,8 +14,10 @@
 #include "core/optimizer/conv_add_fusion.h"
 #include "core/optimizer/conv_activation_fusion.h"
 #include "core/optimizer/dropout_elimination.h"
+#include "core/optimizer/elementwise_fusion.h"
 #include "core/optimizer/gemm_activation_fusion.h"
 #include "core/optimizer/bias_gelu_fusion.h"
+#include "core/optimizer/common_subexpression_elimination.h"
 #include "core/optimizer/gelu_fusion.h"
 #include "core/optimizer/gelu_approximation.h"
 #include "core/optimizer/layer_norm_fusion.h"
@@ -30,6 +32,7 @@
 #include "core/optimizer/rule_based_graph_transformer.h"
 #include "core/optimizer/shape_to_initializer.h"
 #include "core/optimizer/slice_elimination.h"
+#include "core/optimizer/transpose_optimizer.h"
 #include "core/optimizer/unsqueeze_elimination.h"
 #include "core/optimizer/reshape_fusion.h"
 #include "core/optimizer/attention_fusion.h"
@@ -1667,7 +1670,274 @@ TEST(GraphTransformationTests, EmbedLayerNormFusionFormat5) {
   }
 }
 
+TEST(GraphTransformationTests, ElementwiseFusion) {
+  Model model("ElementwiseFusion", false, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  TypeProto input_tensor_type;
+  input_tensor_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  input_tensor_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_param("batch");
+  input_tensor_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(3);
+
+  TypeProto bias_tensor_type;
+  bias_tensor_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  bias_tensor_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(3);
+
+  // Y = Mul(Tanh(Add(X, B)), X) is fused. Z = Sqrt(Y) is not, as Y is a graph output.
+  auto& x = graph.GetOrCreateNodeArg("X", &input_tensor_type);
+  auto& b = graph.GetOrCreateNodeArg("B", &bias_tensor_type);
+  auto& add_out = graph.GetOrCreateNodeArg("add_out", &input_tensor_type);
+  auto& tanh_out = graph.GetOrCreateNodeArg("tanh_out", &input_tensor_type);
+  auto& y = graph.GetOrCreateNodeArg("Y", &input_tensor_type);
+  auto& z = graph.GetOrCreateNodeArg("Z", &input_tensor_type);
+
+  graph.AddNode("add", "Add", "", {&x, &b}, {&add_out});
+  graph.AddNode("tanh", "Tanh", "", {&add_out}, {&tanh_out});
+  graph.AddNode("mul", "Mul", "", {&tanh_out, &x}, {&y});
+  graph.AddNode("sqrt", "Sqrt", "", {&y}, {&z});
+  graph.SetOutputs({&y, &z});
+
+  ASSERT_STATUS_OK(graph.Resolve());
+  for (auto& node : graph.Nodes()) {
+    node.SetExecutionProviderType(kCpuExecutionProvider);
+  }
+
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  graph_transformation_mgr.Register(
+      onnxruntime::make_unique<ElementwiseFusion>(std::unordered_set<std::string>{kCpuExecutionProvider}),
+      TransformerLevel::Level2);
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level2,
+                                                              DefaultLoggingManager().DefaultLogger()));
+
+  std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+  EXPECT_EQ(op_to_count["FusedElementwise"], 1);
+  EXPECT_EQ(op_to_count["Add"], 0);
+  EXPECT_EQ(op_to_count["Tanh"], 0);
+  EXPECT_EQ(op_to_count["Mul"], 0);
+  EXPECT_EQ(op_to_count["Sqrt"], 1);
+
+  for (const auto& node : graph.Nodes()) {
+    if (node.OpType() == "FusedElementwise") {
+      ASSERT_EQ(node.InputDefs().size(), 2u);
+      EXPECT_EQ(node.InputDefs()[0]->Name(), "X");
+      EXPECT_EQ(node.InputDefs()[1]->Name(), "B");
+      EXPECT_EQ(node.OutputDefs()[0]->Name(), "Y");
+
+      const auto& ops = graph_utils::GetNodeAttribute(node, "ops")->strings();
+      EXPECT_EQ(std::vector<std::string>(ops.begin(), ops.end()), (std::vector<std::string>{"Add", "Tanh", "Mul"}));
+      const auto& operands = graph_utils::GetNodeAttribute(node, "operands")->ints();
+      EXPECT_EQ(std::vector<int64_t>(operands.begin(), operands.end()), (std::vector<int64_t>{0, 1, 2, -1, 3, 0}));
+    }
+  }
+}
+
 #endif
 
+TEST(GraphTransformationTests, TransposeOptimizerCancel) {
+  Model model("TransposeOptimizerCancel", false, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  TypeProto float_tensor_type;
+  float_tensor_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+
+  TypeProto input_tensor_type(float_tensor_type);
+  input_tensor_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+  input_tensor_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(3);
+  input_tensor_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(4);
+
+  TypeProto scalar_tensor_type(float_tensor_type);
+  scalar_tensor_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1);
+
+  // The first Transpose is pushed through Relu and Add, then cancels with the second one.
+  auto& x = graph.GetOrCreateNodeArg("X", &input_tensor_type);
+  auto& b = graph.GetOrCreateNodeArg("B", &scalar_tensor_type);
+  auto& transpose1_out = graph.GetOrCreateNodeArg("transpose1_out", &float_tensor_type);
+  auto& relu_out = graph.GetOrCreateNodeArg("relu_out", &float_tensor_type);
+  auto& add_out = graph.GetOrCreateNodeArg("add_out", &float_tensor_type);
+  auto& transpose2_out = graph.GetOrCreateNodeArg("transpose2_out", &float_tensor_type);
+  auto& y = graph.GetOrCreateNodeArg("Y", &float_tensor_type);
+
+  graph.AddNode("transpose1", "Transpose", "", {&x}, {&transpose1_out})
+      .AddAttribute("perm", std::vector<int64_t>{2, 0, 1});
+  graph.AddNode("relu", "Relu", "", {&transpose1_out}, {&relu_out});
+  graph.AddNode("add", "Add", "", {&relu_out, &b}, {&add_out});
+  graph.AddNode("transpose2", "Transpose", "", {&add_out}, {&transpose2_out})
+      .AddAttribute("perm", std::vector<int64_t>{1, 2, 0});
+  graph.AddNode("sigmoid", "Sigmoid", "", {&transpose2_out}, {&y});
+
+  ASSERT_STATUS_OK(graph.Resolve());
+  for (auto& node : graph.Nodes()) {
+    node.SetExecutionProviderType(kCpuExecutionProvider);
+  }
+
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  graph_transformation_mgr.Register(
+      onnxruntime::make_unique<TransposeOptimizer>(std::unordered_set<std::string>{kCpuExecutionProvider}),
+      TransformerLevel::Level2);
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level2,
+                                                              DefaultLoggingManager().DefaultLogger()));
+
+  std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+  EXPECT_EQ(op_to_count["Transpose"], 0);
+  EXPECT_EQ(op_to_count["Relu"], 1);
+  EXPECT_EQ(op_to_count["Add"], 1);
+  EXPECT_EQ(op_to_count["Sigmoid"], 1);
+
+  for (const auto& node : graph.Nodes()) {
+    if (node.OpType() == "Relu") {
+      EXPECT_EQ(node.InputDefs()[0]->Name(), "X");
+    }
+  }
+}
+
+TEST(GraphTransformationTests, TransposeOptimizerReduceAndGemm) {
+  Model model("TransposeOptimizerReduceAndGemm", false, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  TypeProto float_tensor_type;
+  float_tensor_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+
+  auto make_type = [&float_tensor_type](std::initializer_list<int64_t> dims) {
+    TypeProto type(float_tensor_type);
+    for (auto dim : dims) {
+      type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(dim);
+    }
+    return type;
+  };
+  TypeProto x_type = make_type({2, 3, 4});
+  TypeProto a_type = make_type({4, 3});
+  TypeProto w_type = make_type({4, 5});
+  TypeProto c_type = make_type({5});
+
+  // Y = ReduceSum(Transpose(X)) becomes Transpose(ReduceSum(X)) on a smaller tensor.
+  // Z = Gemm(Transpose(A), W, C) becomes Gemm(A, W, C, transA=1).
+  auto& x = graph.GetOrCreateNodeArg("X", &x_type);
+  auto& a = graph.GetOrCreateNodeArg("A", &a_type);
+  auto& w = graph.GetOrCreateNodeArg("W", &w_type);
+  auto& c = graph.GetOrCreateNodeArg("C", &c_type);
+  auto& transpose_x_out = graph.GetOrCreateNodeArg("transpose_x_out", &float_tensor_type);
+  auto& transpose_a_out = graph.GetOrCreateNodeArg("transpose_a_out", &float_tensor_type);
+  auto& y = graph.GetOrCreateNodeArg("Y", &float_tensor_type);
+  auto& z = graph.GetOrCreateNodeArg("Z", &float_tensor_type);
+
+  graph.AddNode("transpose_x", "Transpose", "", {&x}, {&transpose_x_out})
+      .AddAttribute("perm", std::vector<int64_t>{1, 2, 0});
+  auto& reduce = graph.AddNode("reduce", "ReduceSum", "", {&transpose_x_out}, {&y});
+  reduce.AddAttribute("axes", std::vector<int64_t>{1});
+  reduce.AddAttribute("keepdims", static_cast<int64_t>(0));
+  graph.AddNode("transpose_a", "Transpose", "", {&a}, {&transpose_a_out});
+  graph.AddNode("gemm", "Gemm", "", {&transpose_a_out, &w, &c}, {&z});
+
+  ASSERT_STATUS_OK(graph.Resolve());
+  for (auto& node : graph.Nodes()) {
+    node.SetExecutionProviderType(kCpuExecutionProvider);
+  }
+
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  graph_transformation_mgr.Register(
+      onnxruntime::make_unique<TransposeOptimizer>(std::unordered_set<std::string>{kCpuExecutionProvider}),
+      TransformerLevel::Level2);
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level2,
+                                                              DefaultLoggingManager().DefaultLogger()));
+
+  std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+  EXPECT_EQ(op_to_count["Transpose"], 1);
+
+  for (const auto& node : graph.Nodes()) {
+    if (node.OpType() == "ReduceSum") {
+      EXPECT_EQ(node.InputDefs()[0]->Name(), "X");
+      const auto& axes = graph_utils::GetNodeAttribute(node, "axes")->ints();
+      EXPECT_EQ(std::vector<int64_t>(axes.begin(), axes.end()), std::vector<int64_t>{2});
+    } else if (node.OpType() == "Transpose") {
+      EXPECT_EQ(node.OutputDefs()[0]->Name(), "Y");
+      const auto& perm = graph_utils::GetNodeAttribute(node, "perm")->ints();
+      EXPECT_EQ(std::vector<int64_t>(perm.begin(), perm.end()), (std::vector<int64_t>{1, 0}));
+    } else if (node.OpType() == "Gemm") {
+      EXPECT_EQ(node.InputDefs()[0]->Name(), "A");
+      EXPECT_EQ(graph_utils::GetNodeAttribute(node, "transA")->i(), 1);
+    }
+  }
+}
+
+TEST(GraphTransformationTests, CommonSubexpressionElimination) {
+  Model model("CommonSubexpressionElimination", false, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  TypeProto float_tensor_type;
+  float_tensor_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+
+  TypeProto input_tensor_type(float_tensor_type);
+  input_tensor_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+  input_tensor_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(3);
+
+  // W1 and W2 have the same content, so Add(X, W1) and Add(X, W2) are equivalent once the initializers are merged.
+  for (const char* name : {"W1", "W2"}) {
+    TensorProto weight;
+    Initializer initializer(TensorProto_DataType_FLOAT, name, {3});
+    float* data = initializer.data<float>();
+    data[0] = 1.f;
+    data[1] = 2.f;
+    data[2] = 3.f;
+    initializer.ToProto(weight);
+    graph.AddInitializedTensor(weight);
+  }
+
+  TypeProto int64_tensor_type;
+  int64_tensor_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_INT64);
+
+  auto& x = graph.GetOrCreateNodeArg("X", &input_tensor_type);
+  auto& w1 = graph.GetOrCreateNodeArg("W1", &float_tensor_type);
+  auto& w2 = graph.GetOrCreateNodeArg("W2", &float_tensor_type);
+  auto& add1_out = graph.GetOrCreateNodeArg("add1_out", &float_tensor_type);
+  auto& add2_out = graph.GetOrCreateNodeArg("add2_out", &float_tensor_type);
+  auto& shape1_out = graph.GetOrCreateNodeArg("shape1_out", &int64_tensor_type);
+  auto& shape2_out = graph.GetOrCreateNodeArg("shape2_out", &int64_tensor_type);
+  auto& cast1_out = graph.GetOrCreateNodeArg("cast1_out", &float_tensor_type);
+  auto& cast2_out = graph.GetOrCreateNodeArg("cast2_out", &float_tensor_type);
+  auto& neg_out = graph.GetOrCreateNodeArg("neg_out", &float_tensor_type);
+  auto& y = graph.GetOrCreateNodeArg("Y", &float_tensor_type);
+  auto& z = graph.GetOrCreateNodeArg("Z", &float_tensor_type);
+
+  graph.AddNode("add1", "Add", "", {&x, &w1}, {&add1_out});
+  graph.AddNode("add2", "Add", "", {&x, &w2}, {&add2_out});
+  graph.AddNode("mul", "Mul", "", {&add1_out, &add2_out}, {&y});
+
+  // duplicated Shape->Cast chain
+  graph.AddNode("shape1", "Shape", "", {&x}, {&shape1_out});
+  graph.AddNode("shape2", "Shape", "", {&x}, {&shape2_out});
+  graph.AddNode("cast1", "Cast", "", {&shape1_out}, {&cast1_out})
+      .AddAttribute("to", static_cast<int64_t>(TensorProto_DataType_FLOAT));
+  graph.AddNode("cast2", "Cast", "", {&shape2_out}, {&cast2_out})
+      .AddAttribute("to", static_cast<int64_t>(TensorProto_DataType_FLOAT));
+  graph.AddNode("sum", "Sum", "", {&cast1_out, &cast2_out}, {&z});
+
+  // unused
+  graph.AddNode("neg", "Neg", "", {&x}, {&neg_out});
+
+  graph.SetOutputs({&y, &z});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  graph_transformation_mgr.Register(onnxruntime::make_unique<CommonSubexpressionElimination>(),
+                                    TransformerLevel::Level1);
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level1,
+                                                              DefaultLoggingManager().DefaultLogger()));
+
+  std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+  EXPECT_EQ(op_to_count["Add"], 1);
+  EXPECT_EQ(op_to_count["Mul"], 1);
+  EXPECT_EQ(op_to_count["Shape"], 1);
+  EXPECT_EQ(op_to_count["Cast"], 1);
+  EXPECT_EQ(op_to_count["Sum"], 1);
+  EXPECT_EQ(op_to_count["Neg"], 0);
+  EXPECT_EQ(graph.GetAllInitializedTensors().size(), 1u);
+
+  for (const auto& node : graph.Nodes()) {
+    if (node.OpType() == "Mul" || node.OpType() == "Sum") {
+      EXPECT_EQ(node.InputDefs()[0]->Name(), node.InputDefs()[1]->Name());
+    }
+  }
+}
+
 }  // namespace test
 }  // namespace onnxruntime
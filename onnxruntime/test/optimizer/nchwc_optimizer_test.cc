@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #include "core/graph/onnx_protobuf.h"
 
+#include "core/framework/data_types_internal.h"
 #include "core/session/inference_session.h"
 #include "core/graph/model.h"
 #include "test/test_environment.h"
@@ -70,6 +71,25 @@ struct NchwcTestHelper {
     return MakeInput(shape, type_proto);
   }
 
+  NodeArg* MakeQuantizedInput(const std::vector<int64_t>& shape) {
+    ONNX_NAMESPACE::TypeProto type_proto;
+    type_proto.mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_UINT8);
+
+    int64_t num_elements = 1;
+    for (auto& dim : shape) {
+      type_proto.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(dim);
+      num_elements *= dim;
+    }
+
+    OrtValue input_value;
+    CreateMLValue<uint8_t>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), shape,
+                           FillRandomData<uint8_t>(static_cast<size_t>(num_elements), 128), &input_value);
+    std::string name = graph_.GenerateNodeArgName("input");
+    feeds_.insert(std::make_pair(name, input_value));
+
+    return &graph_.GetOrCreateNodeArg(name, &type_proto);
+  }
+
   NodeArg* MakeOutput() {
     std::string name = graph_.GenerateNodeArgName("output");
     output_names_.push_back(name);
@@ -108,14 +128,40 @@ struct NchwcTestHelper {
     return MakeInitializer({static_cast<int64_t>(data.size())}, data);
   }
 
+  template <typename T>
+  NodeArg* MakeRawInitializer(const std::vector<int64_t>& shape, const std::vector<T>& data) {
+    std::string name = graph_.GenerateNodeArgName("constant");
+    ONNX_NAMESPACE::TensorProto tensor_proto;
+    tensor_proto.set_name(name);
+    tensor_proto.set_data_type(utils::ToTensorProtoElementType<T>());
+
+    for (auto& dim : shape) {
+      tensor_proto.add_dims(dim);
+    }
+
+    tensor_proto.set_raw_data(data.data(), data.size() * sizeof(T));
+
+    graph_.AddInitializedTensor(tensor_proto);
+
+    return &graph_.GetOrCreateNodeArg(name, nullptr);
+  }
+
+  template <typename T>
+  NodeArg* MakeScalarInitializer(T data) {
+    return MakeRawInitializer<T>({}, {data});
+  }
+
   Node& AddNode(const std::string& op_type,
                 const std::vector<NodeArg*>& input_args,
-                const std::vector<NodeArg*>& output_args) {
+                const std::vector<NodeArg*>& output_args,
+                const std::string& domain = kOnnxDomain) {
     return graph_.AddNode(graph_.GenerateNodeName("node"),
                           op_type,
                           "description",
                           input_args,
-                          output_args);
+                          output_args,
+                          nullptr,
+                          domain);
   }
 
   Node& AddConvNode(NodeArg* input_arg, NodeArg* output_arg, const std::vector<int64_t>& weights_shape, bool no_bias = false) {
@@ -128,6 +174,18 @@ struct NchwcTestHelper {
     return AddNode("Conv", input_args, {output_arg});
   }
 
+  Node& AddQLinearConvNode(NodeArg* input_arg, NodeArg* output_arg, const std::vector<int64_t>& weights_shape) {
+    int64_t num_weights = std::accumulate(weights_shape.begin(), weights_shape.end(), int64_t(1), std::multiplies<int64_t>{});
+    auto* weights_arg = MakeRawInitializer<uint8_t>(weights_shape, FillRandomData<uint8_t>(static_cast<size_t>(num_weights), 128));
+    auto* biases_arg = MakeRawInitializer<int32_t>({weights_shape[0]}, FillRandomData<int32_t>(static_cast<size_t>(weights_shape[0]), 0));
+    return AddNode("QLinearConv",
+                   {input_arg, MakeScalarInitializer<float>(0.05f), MakeScalarInitializer<uint8_t>(128),
+                    weights_arg, MakeScalarInitializer<float>(0.01f), MakeScalarInitializer<uint8_t>(128),
+                    MakeScalarInitializer<float>(0.04f), MakeScalarInitializer<uint8_t>(120),
+                    biases_arg},
+                   {output_arg});
+  }
+
   Node& AddClipNode(NodeArg* input_arg, NodeArg* output_arg, float min, float max) {
     int opset_version = graph_.DomainToVersionMap().find(kOnnxDomain)->second;
     std::vector<NodeArg*> input_args{input_arg};
@@ -162,13 +220,18 @@ struct NchwcTestHelper {
   }
 
   std::vector<float> FillRandomData(size_t count) {
+    return FillRandomData<float>(count, 0);
+  }
+
+  template <typename T>
+  std::vector<T> FillRandomData(size_t count, int offset) {
     constexpr int min_fill_value = -23;
     constexpr int max_fill_value = 23;
 
-    std::vector<float> random_data;
+    std::vector<T> random_data;
     random_data.resize(count);
     for (size_t n = 0; n < count; n++) {
-      random_data[n] = static_cast<float>(fill_value_);
+      random_data[n] = static_cast<T>(fill_value_ + offset);
       fill_value_++;
       if (fill_value_ == max_fill_value) {
         fill_value_ = min_fill_value;
@@ -195,6 +258,7 @@ void NchwcOptimizerTester(const std::function<void(NchwcTestHelper& helper)>& bu
   // Build the model for this test.
   std::unordered_map<std::string, int> domain_to_version;
   domain_to_version[kOnnxDomain] = opset_version;
+  domain_to_version[kMSDomain] = 1;
   Model model("nchwc", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
               domain_to_version, {}, DefaultLoggingManager().DefaultLogger());
   NchwcTestHelper helper(model.MainGraph());
@@ -656,6 +720,51 @@ TEST(NchwcOptimizerTests, FusedConvAddFusion) {
   test_case(true, true, 1);
 }
 
+TEST(NchwcOptimizerTests, ResidualAddReluFusion) {
+  auto build_test_case = [&](NchwcTestHelper& helper) {
+    auto* input_arg = helper.MakeInput({1, 32, 28, 28});
+    auto* conv1_output_arg = helper.MakeIntermediate();
+    auto* relu1_output_arg = helper.MakeIntermediate();
+    auto* conv2_output_arg = helper.MakeIntermediate();
+    auto* add_output_arg = helper.MakeIntermediate();
+    auto* output_arg = helper.MakeOutput();
+
+    helper.AddConvNode(input_arg, conv1_output_arg, {32, 32, 3, 3});
+    helper.AddNode("Relu", {conv1_output_arg}, {relu1_output_arg});
+    helper.AddConvNode(relu1_output_arg, conv2_output_arg, {32, 32, 3, 3});
+    helper.AddNode("Add", {conv2_output_arg, relu1_output_arg}, {add_output_arg});
+    helper.AddNode("Relu", {add_output_arg}, {output_arg});
+  };
+
+  auto check_nchwc_graph = [&](NchwcInferenceSession& session) {
+    auto op_to_count = session.CountOpsInGraph();
+    EXPECT_EQ(op_to_count["nchwc.Conv"], 2);
+    EXPECT_EQ(op_to_count["nchwc.ReorderInput"], 1);
+    EXPECT_EQ(op_to_count["nchwc.ReorderOutput"], 1);
+    EXPECT_EQ(op_to_count["Add"], 0);
+    EXPECT_EQ(op_to_count["Relu"], 0);
+    EXPECT_EQ(op_to_count["FusedElementwise"], 0);
+
+    // The second Conv takes the residual as its Sum input and applies the
+    // trailing Relu.
+    int sum_conv_count = 0;
+    for (auto& node : session.GetGraph().Nodes()) {
+      if (node.Domain() == kMSNchwcDomain && node.OpType() == "Conv" && node.InputDefs().size() == 4) {
+        sum_conv_count++;
+        const auto& attributes = node.GetAttributes();
+        auto activation = attributes.find("activation");
+        ASSERT_TRUE(activation != attributes.end());
+        EXPECT_EQ(activation->second.s(), "Relu");
+      }
+    }
+    EXPECT_EQ(sum_conv_count, 1);
+  };
+
+  // Verify that the residual Add and Relu of a ResNet style block are fused
+  // into the NCHWc Conv node instead of an elementwise fusion.
+  NchwcOptimizerTester(build_test_case, check_nchwc_graph);
+}
+
 TEST(NchwcOptimizerTests, ConvBinary) {
   auto test_case = [&](const std::string& op_type) {
     auto build_test_case = [&](NchwcTestHelper& helper) {
@@ -694,6 +803,44 @@ TEST(NchwcOptimizerTests, ConvBinary) {
   }
 }
 
+TEST(NchwcOptimizerTests, QLinearConvMaxPoolAdd) {
+  auto build_test_case = [&](NchwcTestHelper& helper) {
+    auto* input_arg = helper.MakeQuantizedInput({1, 32, 28, 28});
+    auto* conv1_output_arg = helper.MakeIntermediate();
+    auto* pool_output_arg = helper.MakeIntermediate();
+    auto* conv2_output_arg = helper.MakeIntermediate();
+    auto* output_arg = helper.MakeOutput();
+
+    auto& conv1_node = helper.AddQLinearConvNode(input_arg, conv1_output_arg, {64, 32, 3, 3});
+    conv1_node.AddAttribute("pads", std::vector<int64_t>{1, 1, 1, 1});
+
+    auto& pool_node = helper.AddNode("MaxPool", {conv1_output_arg}, {pool_output_arg});
+    pool_node.AddAttribute("pads", std::vector<int64_t>{1, 1, 1, 1});
+    pool_node.AddAttribute("kernel_shape", std::vector<int64_t>{3, 3});
+
+    auto& conv2_node = helper.AddQLinearConvNode(pool_output_arg, conv2_output_arg, {64, 64, 3, 3});
+    conv2_node.AddAttribute("pads", std::vector<int64_t>{1, 1, 1, 1});
+
+    helper.AddNode("QLinearAdd",
+                   {pool_output_arg, helper.MakeScalarInitializer<float>(0.04f), helper.MakeScalarInitializer<uint8_t>(120),
+                    conv2_output_arg, helper.MakeScalarInitializer<float>(0.04f), helper.MakeScalarInitializer<uint8_t>(120),
+                    helper.MakeScalarInitializer<float>(0.08f), helper.MakeScalarInitializer<uint8_t>(128)},
+                   {output_arg},
+                   kMSDomain);
+  };
+
+  auto check_nchwc_graph = [&](NchwcInferenceSession& session) {
+    auto op_to_count = session.CountOpsInGraph();
+    EXPECT_EQ(op_to_count["nchwc.QLinearConv"], 2);
+    EXPECT_EQ(op_to_count["nchwc.MaxPool"], 1);
+    EXPECT_EQ(op_to_count["nchwc.ReorderInput"], 1);
+    EXPECT_EQ(op_to_count["nchwc.ReorderOutput"], 1);
+    EXPECT_EQ(op_to_count["QLinearAdd"], 1);
+  };
+
+  NchwcOptimizerTester(build_test_case, check_nchwc_graph, 12);
+}
+
 TEST(NchwcOptimizerTests, ConvConcat) {
   auto test_case = [&](int axis, int channel_count, int reorder_output_count) {
     auto build_test_case = [&](NchwcTestHelper& helper) {
@@ -27,11 +27,15 @@ namespace perftest {
   printf(
       "perf_test [options...] model_path result_file\n"
       "Options:\n"
-      "\t-m [test_mode]: Specifies the test mode. Value could be 'duration' or 'times'.\n"
+      "\t-m [test_mode]: Specifies the test mode. Value could be 'duration', 'times' or 'open_loop'.\n"
       "\t\tProvide 'duration' to run the test for a fix duration, and 'times' to repeated for a certain times. \n"
+      "\t\tProvide 'open_loop' to issue requests with Poisson arrivals at the rates given by -q, each for the duration given by -t.\n"
       "\t-M: Disable memory pattern.\n"
       "\t-A: Disable memory arena\n"
       "\t-c [parallel runs]: Specifies the (max) number of runs to invoke simultaneously. Default:1.\n"
+      "\t-q [qps[,qps...]]: Specifies the target requests per second of the 'open_loop' mode. A list sweeps the rates in order.\n"
+      "\t-i [seconds]: Specifies the interval at which throughput is reported in 'open_loop' mode. Default:1.\n"
+      "\t-j [json_file]: Writes the latency percentiles and throughput to a JSON file.\n"
       "\t-e [cpu|cuda|dnnl|tensorrt|ngraph|openvino|nuphar|dml|acl]: Specifies the provider 'cpu','cuda','dnnl','tensorrt', "
       "'ngraph', 'openvino', 'nuphar', 'dml' or 'acl'. "
       "Default:'cpu'.\n"
@@ -52,13 +56,15 @@ namespace perftest {
 
 /*static*/ bool CommandLineParser::ParseArguments(PerformanceTestConfig& test_config, int argc, ORTCHAR_T* argv[]) {
   int ch;
-  while ((ch = getopt(argc, argv, ORT_TSTR("b:m:e:r:t:p:x:y:c:o:u:AMPvhs"))) != -1) {
+  while ((ch = getopt(argc, argv, ORT_TSTR("b:m:e:r:t:p:x:y:c:o:u:q:i:j:AMPvhs"))) != -1) {
     switch (ch) {
       case 'm':
         if (!CompareCString(optarg, ORT_TSTR("duration"))) {
           test_config.run_config.test_mode = TestMode::kFixDurationMode;
         } else if (!CompareCString(optarg, ORT_TSTR("times"))) {
           test_config.run_config.test_mode = TestMode::KFixRepeatedTimesMode;
+        } else if (!CompareCString(optarg, ORT_TSTR("open_loop"))) {
+          test_config.run_config.test_mode = TestMode::kOpenLoopMode;
         } else {
           return false;
         }
@@ -112,7 +118,10 @@ namespace perftest {
         if (test_config.run_config.repeated_times <= 0) {
           return false;
         }
-        test_config.run_config.test_mode = TestMode::kFixDurationMode;
+        // the open loop mode runs each target rate for the duration
+        if (test_config.run_config.test_mode != TestMode::kOpenLoopMode) {
+          test_config.run_config.test_mode = TestMode::kFixDurationMode;
+        }
         break;
       case 's':
         test_config.run_config.f_dump_statistics = true;
@@ -170,6 +179,38 @@ namespace perftest {
       case 'u':
         test_config.run_config.optimized_model_path = optarg;
         break;
+      case 'q': {
+        test_config.run_config.target_qps.clear();
+        ORTCHAR_T* current = optarg;
+        while (true) {
+          ORTCHAR_T* end = nullptr;
+          long qps = OrtStrtol<PATH_CHAR_TYPE>(current, &end);
+          if (end == current || qps <= 0) {
+            return false;
+          }
+          test_config.run_config.target_qps.push_back(static_cast<size_t>(qps));
+          if (*end == 0) {
+            break;
+          }
+          if (*end != ',') {
+            return false;
+          }
+          current = end + 1;
+        }
+        test_config.run_config.test_mode = TestMode::kOpenLoopMode;
+        break;
+      }
+      case 'i': {
+        long interval = OrtStrtol<PATH_CHAR_TYPE>(optarg, nullptr);
+        if (interval <= 0) {
+          return false;
+        }
+        test_config.run_config.report_interval_in_seconds = static_cast<size_t>(interval);
+        break;
+      }
+      case 'j':
+        test_config.run_config.json_result_file = optarg;
+        break;
       case '?':
       case 'h':
       default:
@@ -185,6 +226,10 @@ namespace perftest {
   test_config.model_info.model_file_path = argv[0];
   test_config.model_info.result_file_path = argv[1];
 
+  if (test_config.run_config.test_mode == TestMode::kOpenLoopMode && test_config.run_config.target_qps.empty()) {
+    return false;
+  }
+
   return true;
 }
 
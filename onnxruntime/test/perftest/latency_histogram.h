@@ -0,0 +1,111 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace onnxruntime {
+namespace perftest {
+
+/**
+ * Histogram of latencies in the style of HdrHistogram.
+ * Values are recorded in nanoseconds. Each power of two is split into kSubBucketCount linear sub-buckets, so a
+ * percentile is reported within 1/kSubBucketCount (< 1%) of the recorded value, using constant memory regardless
+ * of the number of samples. Not thread safe.
+ */
+class LatencyHistogram {
+ public:
+  LatencyHistogram() : counts_(kBucketCount, 0) {}
+
+  void Record(double seconds) {
+    uint64_t value = static_cast<uint64_t>(std::max(0.0, seconds) * 1e9);
+    if (value > kMaxValue) {
+      value = kMaxValue;
+    }
+    ++counts_[BucketIndex(value)];
+    ++count_;
+    sum_ += seconds;
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+  }
+
+  void Merge(const LatencyHistogram& other) {
+    for (size_t i = 0; i < counts_.size(); ++i) {
+      counts_[i] += other.counts_[i];
+    }
+    count_ += other.count_;
+    sum_ += other.sum_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+  }
+
+  uint64_t Count() const { return count_; }
+  double Min() const { return count_ == 0 ? 0.0 : min_ * 1e-9; }
+  double Max() const { return count_ == 0 ? 0.0 : max_ * 1e-9; }
+  double Mean() const { return count_ == 0 ? 0.0 : sum_ / count_; }
+
+  /** Returns the latency in seconds below which 'percentile' percent of the recorded values fall. */
+  double Percentile(double percentile) const {
+    if (count_ == 0) {
+      return 0.0;
+    }
+    auto target = static_cast<uint64_t>(std::ceil(percentile / 100.0 * count_));
+    target = std::min(std::max<uint64_t>(target, 1), count_);
+
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < counts_.size(); ++i) {
+      cumulative += counts_[i];
+      if (cumulative >= target) {
+        return std::min(std::max(BucketValue(i), min_), max_) * 1e-9;
+      }
+    }
+    return Max();
+  }
+
+ private:
+  static constexpr int kSubBucketBits = 7;
+  static constexpr uint64_t kSubBucketCount = uint64_t{1} << kSubBucketBits;
+  // 2^45ns is about 9.7 hours, far beyond any inference latency
+  static constexpr int kMaxValueBits = 45;
+  static constexpr uint64_t kMaxValue = (uint64_t{1} << kMaxValueBits) - 1;
+  static constexpr size_t kBucketCount = static_cast<size_t>(kSubBucketCount * (kMaxValueBits - kSubBucketBits + 1));
+
+  // Values below kSubBucketCount have a bucket each. Larger values with their highest set bit at position 'e' fall
+  // in the range [2^e, 2^(e+1)) which is split into kSubBucketCount buckets of width 2^(e - kSubBucketBits).
+  static size_t BucketIndex(uint64_t value) {
+    if (value < kSubBucketCount) {
+      return static_cast<size_t>(value);
+    }
+    int e = kSubBucketBits;
+    while ((value >> (e + 1)) != 0) {
+      ++e;
+    }
+    const int shift = e - kSubBucketBits;
+    const uint64_t sub_bucket = (value >> shift) - kSubBucketCount;
+    return static_cast<size_t>(kSubBucketCount * (shift + 1) + sub_bucket);
+  }
+
+  // Returns the middle of the range of values held by a bucket.
+  static uint64_t BucketValue(size_t index) {
+    if (index < kSubBucketCount) {
+      return index;
+    }
+    const int shift = static_cast<int>(index / kSubBucketCount) - 1;
+    const uint64_t sub_bucket = index % kSubBucketCount + kSubBucketCount;
+    return (sub_bucket << shift) + ((uint64_t{1} << shift) >> 1);
+  }
+
+  std::vector<uint64_t> counts_;
+  uint64_t count_{0};
+  double sum_{0};
+  uint64_t min_{std::numeric_limits<uint64_t>::max()};
+  uint64_t max_{0};
+};
+
+}  // namespace perftest
+}  // namespace onnxruntime
@@ -7,7 +7,11 @@
 #endif
 
 #include "performance_runner.h"
+#include <condition_variable>
+#include <deque>
+#include <iomanip>
 #include <iostream>
+#include <thread>
 
 #include "TestCase.h"
 #include "TFModelInfo.h"
@@ -61,6 +65,9 @@ Status PerformanceRunner::Run() {
     case TestMode::KFixRepeatedTimesMode:
       ORT_RETURN_IF_ERROR(RepeatedTimesTest());
       break;
+    case TestMode::kOpenLoopMode:
+      ORT_RETURN_IF_ERROR(OpenLoopTest());
+      break;
     default:
       return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "unknown test mode.");
   }
@@ -74,12 +81,14 @@ Status PerformanceRunner::Run() {
   // if (!performance_test_config_.run_config.profile_file.empty()) session_object->EndProfiling();
   std::chrono::duration<double> inference_duration = performance_result_.end_ - performance_result_.start_;
 
-  std::cout << "Session creation time cost:" << session_create_duration.count() << " s" << std::endl
-            << "Total inference time cost:" << performance_result_.total_time_cost << " s" << std::endl  // sum of time taken by each request
-            << "Total inference requests:" << performance_result_.time_costs.size() << std::endl
-            << "Average inference time cost:" << performance_result_.total_time_cost / performance_result_.time_costs.size() * 1000 << " ms" << std::endl
-            // Time between start and end of run. Less than Total time cost when running requests in parallel.
-            << "Total inference run time:" << inference_duration.count() << " s" << std::endl;
+  std::cout << "Session creation time cost:" << session_create_duration.count() << " s" << std::endl;
+  if (performance_test_config_.run_config.test_mode != TestMode::kOpenLoopMode) {
+    std::cout << "Total inference time cost:" << performance_result_.total_time_cost << " s" << std::endl  // sum of time taken by each request
+              << "Total inference requests:" << performance_result_.time_costs.size() << std::endl
+              << "Average inference time cost:" << performance_result_.total_time_cost / performance_result_.time_costs.size() * 1000 << " ms" << std::endl;
+  }
+  // Time between start and end of run. Less than Total time cost when running requests in parallel.
+  std::cout << "Total inference run time:" << inference_duration.count() << " s" << std::endl;
   return Status::OK();
 }
 
@@ -168,6 +177,239 @@ Status PerformanceRunner::ForkJoinRepeat() {
   return Status::OK();
 }
 
+Status PerformanceRunner::OpenLoopTest() {
+  for (size_t target_qps : performance_test_config_.run_config.target_qps) {
+    OpenLoopStepResult result;
+    ORT_RETURN_IF_ERROR(RunOpenLoop(target_qps, result));
+
+    const auto& latency = result.latency;
+    std::cout << "Target QPS:" << target_qps
+              << " Achieved QPS:" << (result.duration > 0 ? latency.Count() / result.duration : 0.0)
+              << " Requests:" << result.issued << " Errors:" << result.errors << std::endl
+              << "  Latency P50:" << latency.Percentile(50) << "s P90:" << latency.Percentile(90)
+              << "s P99:" << latency.Percentile(99) << "s P999:" << latency.Percentile(99.9)
+              << "s Max:" << latency.Max() << "s" << std::endl
+              << "  Service time P50:" << result.service_time.Percentile(50)
+              << "s P99:" << result.service_time.Percentile(99) << "s" << std::endl;
+
+    performance_result_.open_loop_steps.push_back(std::move(result));
+  }
+  return Status::OK();
+}
+
+Status PerformanceRunner::RunOpenLoop(size_t target_qps, OpenLoopStepResult& result) {
+  using Clock = std::chrono::steady_clock;
+  const auto& run_config = performance_test_config_.run_config;
+  const std::chrono::duration<double> duration(static_cast<double>(run_config.duration_in_seconds));
+  const std::chrono::duration<double> interval(static_cast<double>(run_config.report_interval_in_seconds));
+
+  result.target_qps = target_qps;
+
+  // Arrival times of the requests waiting for a runner. Latency is measured from the arrival rather than from the
+  // start of execution, so the time spent queued when the session can't keep up with the rate is included.
+  std::deque<Clock::time_point> arrivals;
+  bool done = false;
+  std::mutex m;
+  std::condition_variable cv;
+
+  const auto start = Clock::now();
+  auto last_completion = start;
+
+  auto runner = [&]() {
+    while (true) {
+      Clock::time_point arrival;
+      {
+        std::unique_lock<std::mutex> lock(m);
+        cv.wait(lock, [&]() { return done || !arrivals.empty(); });
+        if (arrivals.empty()) {
+          return;
+        }
+        arrival = arrivals.front();
+        arrivals.pop_front();
+      }
+
+      std::chrono::duration<double> service_time{0};
+      bool failed = false;
+      try {
+        service_time = session_->Run();
+      } catch (const std::exception& ex) {
+        std::cerr << "PerformanceRunner::RunOpenLoop caught exception: " << ex.what() << std::endl;
+        failed = true;
+      }
+      const auto completion = Clock::now();
+
+      std::lock_guard<std::mutex> guard(results_mutex_);
+      if (failed) {
+        ++result.errors;
+        continue;
+      }
+      result.latency.Record(std::chrono::duration<double>(completion - arrival).count());
+      result.service_time.Record(service_time.count());
+      auto index = static_cast<size_t>(std::chrono::duration<double>(completion - start) / interval);
+      if (index >= result.completions_per_interval.size()) {
+        result.completions_per_interval.resize(index + 1, 0);
+      }
+      ++result.completions_per_interval[index];
+      last_completion = std::max(last_completion, completion);
+    }
+  };
+
+  std::vector<std::thread> runners;
+  for (size_t i = 0; i != run_config.concurrent_session_runs; ++i) {
+    runners.emplace_back(runner);
+  }
+
+  // Poisson arrivals: exponentially distributed gaps between requests. The seed is fixed so that runs being compared
+  // see the same arrival times.
+  std::mt19937 engine(static_cast<std::mt19937::result_type>(target_qps));
+  std::exponential_distribution<double> inter_arrival(static_cast<double>(target_qps));
+  auto next = start;
+  while (true) {
+    next += std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(inter_arrival(engine)));
+    if (next - start >= duration) {
+      break;
+    }
+    std::this_thread::sleep_until(next);
+    {
+      std::lock_guard<std::mutex> lock(m);
+      arrivals.push_back(next);
+    }
+    cv.notify_one();
+    ++result.issued;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m);
+    done = true;
+  }
+  cv.notify_all();
+  for (auto& thread : runners) {
+    thread.join();
+  }
+
+  result.duration = std::chrono::duration<double>(last_completion - start).count();
+  return Status::OK();
+}
+
+void PerformanceRunner::SerializeResult() const {
+  const auto& run_config = performance_test_config_.run_config;
+  if (run_config.test_mode == TestMode::kOpenLoopMode) {
+    DumpOpenLoopResult(performance_test_config_.model_info.result_file_path);
+  } else {
+    performance_result_.DumpToFile(performance_test_config_.model_info.result_file_path,
+                                   run_config.f_dump_statistics);
+  }
+
+  if (!run_config.json_result_file.empty()) {
+    DumpJsonResult(run_config.json_result_file);
+  }
+}
+
+void PerformanceRunner::DumpOpenLoopResult(const std::basic_string<ORTCHAR_T>& path) const {
+  std::ofstream outfile;
+  outfile.open(path, std::ofstream::out | std::ofstream::app);
+  if (!outfile.good()) {
+    printf("failed to open result file");
+    return;
+  }
+
+  // one line per target rate: model,target_qps,achieved_qps,requests,errors,p50,p90,p95,p99,p999,max
+  for (const auto& step : performance_result_.open_loop_steps) {
+    const auto& latency = step.latency;
+    outfile << performance_result_.model_name << "," << step.target_qps << ","
+            << (step.duration > 0 ? latency.Count() / step.duration : 0.0) << "," << step.issued << ","
+            << step.errors << "," << latency.Percentile(50) << "," << latency.Percentile(90) << ","
+            << latency.Percentile(95) << "," << latency.Percentile(99) << "," << latency.Percentile(99.9) << ","
+            << latency.Max() << std::endl;
+  }
+}
+
+static void WriteJsonString(std::ostream& out, const std::string& value) {
+  out << '"';
+  for (char c : value) {
+    if (c == '"' || c == '\\') {
+      out << '\\' << c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+    } else {
+      out << c;
+    }
+  }
+  out << '"';
+}
+
+static void WriteJsonLatency(std::ostream& out, const LatencyHistogram& histogram) {
+  out << "{\"count\": " << histogram.Count()
+      << ", \"min\": " << histogram.Min()
+      << ", \"mean\": " << histogram.Mean()
+      << ", \"p50\": " << histogram.Percentile(50)
+      << ", \"p90\": " << histogram.Percentile(90)
+      << ", \"p95\": " << histogram.Percentile(95)
+      << ", \"p99\": " << histogram.Percentile(99)
+      << ", \"p999\": " << histogram.Percentile(99.9)
+      << ", \"max\": " << histogram.Max() << "}";
+}
+
+void PerformanceRunner::DumpJsonResult(const std::basic_string<ORTCHAR_T>& path) const {
+  std::ofstream outfile;
+  outfile.open(path, std::ofstream::out | std::ofstream::trunc);
+  if (!outfile.good()) {
+    printf("failed to open json result file");
+    return;
+  }
+
+  const auto& run_config = performance_test_config_.run_config;
+  const char* mode = run_config.test_mode == TestMode::kOpenLoopMode
+                         ? "open_loop"
+                         : run_config.test_mode == TestMode::kFixDurationMode ? "duration" : "times";
+  std::chrono::duration<double> session_create_duration = session_create_end_ - session_create_start_;
+
+  outfile << std::setprecision(9) << "{\n  \"model\": ";
+  WriteJsonString(outfile, performance_result_.model_name);
+  outfile << ",\n  \"mode\": \"" << mode << "\""
+          << ",\n  \"concurrency\": " << run_config.concurrent_session_runs
+          << ",\n  \"session_creation_time\": " << session_create_duration.count()
+          << ",\n  \"peak_workingset_size\": " << performance_result_.peak_workingset_size
+          << ",\n  \"steps\": [";
+
+  if (run_config.test_mode == TestMode::kOpenLoopMode) {
+    const char* separator = "\n";
+    for (const auto& step : performance_result_.open_loop_steps) {
+      outfile << separator << "    {\"target_qps\": " << step.target_qps
+              << ", \"achieved_qps\": " << (step.duration > 0 ? step.latency.Count() / step.duration : 0.0)
+              << ", \"requests\": " << step.issued
+              << ", \"errors\": " << step.errors
+              << ", \"duration\": " << step.duration
+              << ",\n     \"latency\": ";
+      WriteJsonLatency(outfile, step.latency);
+      outfile << ",\n     \"service_time\": ";
+      WriteJsonLatency(outfile, step.service_time);
+      outfile << ",\n     \"interval\": " << run_config.report_interval_in_seconds << ", \"qps_per_interval\": [";
+      for (size_t i = 0; i < step.completions_per_interval.size(); ++i) {
+        outfile << (i == 0 ? "" : ", ")
+                << static_cast<double>(step.completions_per_interval[i]) / run_config.report_interval_in_seconds;
+      }
+      outfile << "]}";
+      separator = ",\n";
+    }
+  } else {
+    LatencyHistogram latency;
+    for (double time_cost : performance_result_.time_costs) {
+      latency.Record(time_cost);
+    }
+    std::chrono::duration<double> inference_duration = performance_result_.end_ - performance_result_.start_;
+    outfile << "\n    {\"achieved_qps\": "
+            << (inference_duration.count() > 0 ? latency.Count() / inference_duration.count() : 0.0)
+            << ", \"requests\": " << latency.Count()
+            << ", \"duration\": " << inference_duration.count()
+            << ",\n     \"latency\": ";
+    WriteJsonLatency(outfile, latency);
+    outfile << "}";
+  }
+
+  outfile << "\n  ]\n}\n";
+}
+
 static TestModelInfo* CreateModelInfo(const PerformanceTestConfig& performance_test_config_) {
   if (CompareCString(performance_test_config_.backend.c_str(), ORT_TSTR("ort")) == 0) {
     return TestModelInfo::LoadOnnxModel(performance_test_config_.model_info.model_file_path.c_str());
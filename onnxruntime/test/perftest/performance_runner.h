@@ -16,6 +16,7 @@
 #include <core/common/status.h>
 #include <core/platform/env.h>
 #include <core/session/onnxruntime_cxx_api.h>
+#include "latency_histogram.h"
 #include "test_configuration.h"
 #include "heap_buffer.h"
 #include "test_session.h"
@@ -27,6 +28,20 @@ class TestModelInfo;
 namespace onnxruntime {
 namespace perftest {
 
+// Result of running the open loop mode at one target request rate.
+struct OpenLoopStepResult {
+  size_t target_qps{0};
+  size_t issued{0};
+  size_t errors{0};
+  // time from the first arrival to the last completion
+  double duration{0};
+  // time from the arrival of a request to its completion, including the time it waited for a free runner
+  LatencyHistogram latency;
+  // time spent executing the request
+  LatencyHistogram service_time;
+  std::vector<size_t> completions_per_interval;
+};
+
 struct PerformanceResult {
   std::chrono::time_point<std::chrono::high_resolution_clock> start_;
   std::chrono::time_point<std::chrono::high_resolution_clock> end_;
@@ -34,6 +49,7 @@ struct PerformanceResult {
   short average_CPU_usage{0};
   double total_time_cost{0};
   std::vector<double> time_costs;
+  std::vector<OpenLoopStepResult> open_loop_steps;
   std::string model_name;
 
   void DumpToFile(const std::basic_string<ORTCHAR_T>& path, bool f_include_statistics = false) const {
@@ -88,10 +104,7 @@ class PerformanceRunner {
 
   inline const PerformanceResult& GetResult() const { return performance_result_; }
 
-  inline void SerializeResult() const {
-    performance_result_.DumpToFile(performance_test_config_.model_info.result_file_path,
-                                   performance_test_config_.run_config.f_dump_statistics);
-  }
+  void SerializeResult() const;
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(PerformanceRunner);
 
  private:
@@ -123,6 +136,10 @@ class PerformanceRunner {
   Status RepeatedTimesTest();
   Status ForkJoinRepeat();
   Status RunParallelDuration();
+  Status OpenLoopTest();
+  Status RunOpenLoop(size_t target_qps, OpenLoopStepResult& result);
+  void DumpOpenLoopResult(const std::basic_string<ORTCHAR_T>& path) const;
+  void DumpJsonResult(const std::basic_string<ORTCHAR_T>& path) const;
 
   inline Status RunFixDuration() {
     while (performance_result_.total_time_cost < performance_test_config_.run_config.duration_in_seconds) {
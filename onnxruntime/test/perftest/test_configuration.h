@@ -5,6 +5,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "core/graph/constants.h"
 #include "core/framework/session_options.h"
@@ -14,7 +15,9 @@ namespace perftest {
 
 enum class TestMode : std::uint8_t {
   kFixDurationMode = 0,
-  KFixRepeatedTimesMode
+  KFixRepeatedTimesMode,
+  // Requests arrive as a Poisson process at a target rate, independently of when earlier requests complete
+  kOpenLoopMode
 };
 
 enum class Platform : std::uint8_t {
@@ -49,6 +52,10 @@ struct RunConfig {
   int inter_op_num_threads{0};
   GraphOptimizationLevel optimization_level{ORT_ENABLE_ALL};
   std::basic_string<ORTCHAR_T> optimized_model_path;
+  // Target request rates of the open loop mode, each run for duration_in_seconds
+  std::vector<size_t> target_qps;
+  size_t report_interval_in_seconds{1};
+  std::basic_string<ORTCHAR_T> json_result_file;
 };
 
 struct PerformanceTestConfig {
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "gtest/gtest.h"
+#include "core/framework/session_options.h"
 #include "test/providers/provider_test_utils.h"
 #include "test/util/include/default_providers.h"
 #include "core/util/math.h"
@@ -314,6 +315,55 @@ TEST(MathOpTest, Add_Invalid_Broadcast) {
            {}, nullptr, &execution_providers);
 }
 
+// Outputs larger than a chunk are broadcast in parallel, each chunk continuing from its own offset into the inputs
+TEST(MathOpTest, Add_Broadcast_Parallel) {
+  SessionOptions so;
+  so.session_logid = "MathOpTest.Add_Broadcast_Parallel";
+  so.intra_op_param.thread_pool_size = 4;
+
+  // A {4, 3, 100, 50} + B {3, 1, 50}: short spans, B is revisited in every chunk
+  {
+    OpTester test("Add");
+    std::vector<float> a(4 * 3 * 100 * 50), b(3 * 50), c(a.size());
+    for (size_t i = 0; i < a.size(); ++i) a[i] = static_cast<float>(i % 1013);
+    for (size_t i = 0; i < b.size(); ++i) b[i] = static_cast<float>(i) * 10000.0f;
+    for (size_t i = 0; i < c.size(); ++i) c[i] = a[i] + b[(i / 5000) % 3 * 50 + i % 50];
+    test.AddInput<float>("A", {4, 3, 100, 50}, a);
+    test.AddInput<float>("B", {3, 1, 50}, b);
+    test.AddOutput<float>("C", {4, 3, 100, 50}, c);
+    test.Run(so);
+  }
+
+  // A {64, 1024} + B {}: a single span that is split between the threads
+  {
+    OpTester test("Add");
+    std::vector<float> a(64 * 1024), c(a.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+      a[i] = static_cast<float>(i);
+      c[i] = a[i] + 0.5f;
+    }
+    test.AddInput<float>("A", {64, 1024}, a);
+    test.AddInput<float>("B", {}, {0.5f});
+    test.AddOutput<float>("C", {64, 1024}, c);
+    test.Run(so);
+  }
+
+  // A {257, 263} + B {257, 263}: a single span without a suitable divisor runs in one piece
+  {
+    OpTester test("Add");
+    std::vector<float> a(257 * 263), b(a.size()), c(a.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+      a[i] = static_cast<float>(i);
+      b[i] = static_cast<float>(i % 7);
+      c[i] = a[i] + b[i];
+    }
+    test.AddInput<float>("A", {257, 263}, a);
+    test.AddInput<float>("B", {257, 263}, b);
+    test.AddOutput<float>("C", {257, 263}, c);
+    test.Run(so);
+  }
+}
+
 TEST(MathOpTest, Sub_int32) {
   OpTester test("Sub");
   test.AddInput<int32_t>("A", {3}, {1, 4, 3});
@@ -3,6 +3,7 @@
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "core/framework/session_options.h"
 #include "test/providers/provider_test_utils.h"
 
 namespace onnxruntime {
@@ -532,5 +533,52 @@ TEST(TopKOperator, BigArrayBigTopKSorted) {
   RunTest(11, 9000, input_vals, input_dimensions, expected_vals, expected_indices, expected_dimensions, false, 0, 1, 1);
 }
 
+// Runs TopK over 'rows' rows of 'cols' values with an intra-op thread pool and checks it against a full sort
+static void RunParallelTest(int64_t rows, int64_t cols, int64_t k, bool largest) {
+  std::vector<float> input_vals(rows * cols);
+  for (size_t i = 0; i < input_vals.size(); ++i) {
+    // many ties, so the index tie break is checked as well
+    input_vals[i] = static_cast<float>((i * 7919) % 1000);
+  }
+
+  std::vector<float> expected_vals;
+  std::vector<int64_t> expected_indices;
+  for (int64_t r = 0; r < rows; ++r) {
+    std::vector<int64_t> order(cols);
+    std::iota(order.begin(), order.end(), 0);
+    const float* row = input_vals.data() + r * cols;
+    std::stable_sort(order.begin(), order.end(), [row, largest](int64_t a, int64_t b) {
+      return largest ? row[a] > row[b] : row[a] < row[b];
+    });
+    for (int64_t l = 0; l < k; ++l) {
+      expected_vals.push_back(row[order[l]]);
+      expected_indices.push_back(order[l]);
+    }
+  }
+
+  OpTester test("TopK", 11);
+  if (!largest)
+    test.AddAttribute("largest", static_cast<int64_t>(0));
+  test.AddInput<float>("X", {rows, cols}, input_vals);
+  test.AddInput<int64_t>("K", {1}, {k});
+  test.AddOutput<float>("Values", {rows, k}, expected_vals);
+  test.AddOutput<int64_t>("Indices", {rows, k}, expected_indices);
+
+  SessionOptions so;
+  so.session_logid = "TopKOperator.Parallel";
+  so.intra_op_param.thread_pool_size = 4;
+  test.Run(so);
+}
+
+TEST(TopKOperator, ParallelRows) {
+  RunParallelTest(64, 5000, 10, true);
+  RunParallelTest(64, 5000, 1000, false);
+}
+
+TEST(TopKOperator, ParallelChunksOfLongRow) {
+  RunParallelTest(1, 300000, 20, true);
+  RunParallelTest(2, 100000, 5, false);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
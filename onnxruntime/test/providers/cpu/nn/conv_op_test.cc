@@ -608,6 +608,51 @@ TEST(ConvTest, Conv2D_group) {
   TestConvOp(attrs, {X, W}, {X_shape, W_shape}, expected_vals, Y_shape);
 }
 
+// Conv with a constant 3x3 filter and enough channels to select the Winograd
+// algorithm, where the transformed filter is cached by the CPU kernel.
+TEST(ConvTest, Conv2D_ConstantFilter_3x3) {
+  const int64_t N = 1, C = 16, M = 16, H = 16, W = 16;
+
+  vector<float> X(static_cast<size_t>(N * C * H * W));
+  for (size_t i = 0; i < X.size(); i++) {
+    X[i] = static_cast<float>(static_cast<int>(i % 7) - 3) * 0.25f;
+  }
+  vector<float> filter(static_cast<size_t>(M * C * 3 * 3));
+  for (size_t i = 0; i < filter.size(); i++) {
+    filter[i] = static_cast<float>(static_cast<int>(i % 5) - 2) * 0.125f;
+  }
+
+  vector<float> Y(static_cast<size_t>(N * M * H * W), 0.0f);
+  for (int64_t m = 0; m < M; m++) {
+    for (int64_t oh = 0; oh < H; oh++) {
+      for (int64_t ow = 0; ow < W; ow++) {
+        float sum = 0.0f;
+        for (int64_t c = 0; c < C; c++) {
+          for (int64_t kh = 0; kh < 3; kh++) {
+            for (int64_t kw = 0; kw < 3; kw++) {
+              const int64_t ih = oh + kh - 1;
+              const int64_t iw = ow + kw - 1;
+              if (ih >= 0 && ih < H && iw >= 0 && iw < W) {
+                sum += X[static_cast<size_t>((c * H + ih) * W + iw)] *
+                       filter[static_cast<size_t>(((m * C + c) * 3 + kh) * 3 + kw)];
+              }
+            }
+          }
+        }
+        Y[static_cast<size_t>((m * H + oh) * W + ow)] = sum;
+      }
+    }
+  }
+
+  OpTester test("Conv");
+  test.AddAttribute("kernel_shape", vector<int64_t>{3, 3});
+  test.AddAttribute("pads", vector<int64_t>{1, 1, 1, 1});
+  test.AddInput<float>("X", {N, C, H, W}, X);
+  test.AddInput<float>("W", {M, C, 3, 3}, filter, true);
+  test.AddOutput<float>("Y", {N, M, H, W}, Y);
+  test.Run();
+}
+
 TEST(ConvTest, ConvDimWithZero) {
   ConvOpAndTestAttributes attrs = {
       "",                           // auto_pad
@@ -552,5 +552,58 @@ TEST(ConvTransposeTest, ConvTranspose_2D_NonDefaultStridesAndDilations) {
   TestConvTransposeOp(attrs, {X, W}, {X_shape, W_shape}, expected_vals, Y_shape);
 }
 
+// ConvTranspose with a constant filter, which the CPU kernel repacks once for
+// every output phase of the stride.
+TEST(ConvTransposeTest, ConvTranspose_2D_ConstantFilter_Stride2) {
+  const int64_t N = 1, C = 3, M = 4, H = 5, W = 5, K = 4, S = 2, P = 1;
+  const int64_t OH = (H - 1) * S + K - 2 * P, OW = (W - 1) * S + K - 2 * P;
+
+  vector<float> X(static_cast<size_t>(N * C * H * W));
+  for (size_t i = 0; i < X.size(); i++) {
+    X[i] = static_cast<float>(static_cast<int>(i % 7) - 3) * 0.5f;
+  }
+  vector<float> filter(static_cast<size_t>(C * M * K * K));
+  for (size_t i = 0; i < filter.size(); i++) {
+    filter[i] = static_cast<float>(static_cast<int>(i % 5) - 2) * 0.25f;
+  }
+  vector<float> B = {0.5f, -1.0f, 0.0f, 2.0f};
+
+  vector<float> Y(static_cast<size_t>(N * M * OH * OW));
+  for (int64_t m = 0; m < M; m++) {
+    for (int64_t i = 0; i < OH * OW; i++) {
+      Y[static_cast<size_t>(m * OH * OW + i)] = B[static_cast<size_t>(m)];
+    }
+  }
+  for (int64_t c = 0; c < C; c++) {
+    for (int64_t ih = 0; ih < H; ih++) {
+      for (int64_t iw = 0; iw < W; iw++) {
+        for (int64_t m = 0; m < M; m++) {
+          for (int64_t kh = 0; kh < K; kh++) {
+            for (int64_t kw = 0; kw < K; kw++) {
+              const int64_t oh = ih * S + kh - P;
+              const int64_t ow = iw * S + kw - P;
+              if (oh >= 0 && oh < OH && ow >= 0 && ow < OW) {
+                Y[static_cast<size_t>((m * OH + oh) * OW + ow)] +=
+                    X[static_cast<size_t>((c * H + ih) * W + iw)] *
+                    filter[static_cast<size_t>(((c * M + m) * K + kh) * K + kw)];
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  OpTester test("ConvTranspose");
+  test.AddAttribute("kernel_shape", vector<int64_t>{K, K});
+  test.AddAttribute("pads", vector<int64_t>{P, P, P, P});
+  test.AddAttribute("strides", vector<int64_t>{S, S});
+  test.AddInput<float>("X", {N, C, H, W}, X);
+  test.AddInput<float>("W", {C, M, K, K}, filter, true);
+  test.AddInput<float>("B", {M}, B, true);
+  test.AddOutput<float>("Y", {N, M, OH, OW}, Y);
+  test.Run();
+}
+
 }  // namespace test
 }  // namespace onnxruntime
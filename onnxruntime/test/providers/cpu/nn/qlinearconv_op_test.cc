@@ -239,6 +239,28 @@ TEST(QLinearConvTest, WithGroup_2D) {
                     {kNGraphExecutionProvider});
 }
 
+TEST(QLinearConvTest, PerChannel_2D) {
+  OpTester test("QLinearConv", 10);
+
+  test.AddInput<uint8_t>("x", {1, 1, 3, 3}, {10, 20, 30, 40, 50, 60, 70, 80, 90});
+  test.AddInput<float>("x_scale", {}, {0.05f});
+  test.AddInput<uint8_t>("x_zero_point", {}, {50});
+
+  // The filter scale and zero point are supplied per output channel.
+  test.AddInput<uint8_t>("w", {2, 1, 2, 2}, {100, 140, 120, 160, 30, 0, 90, 60});
+  test.AddInput<float>("w_scale", {2}, {0.02f, 0.033f});
+  test.AddInput<uint8_t>("w_zero_point", {2}, {128, 40});
+
+  test.AddInput<float>("y_scale", {}, {0.07f});
+  test.AddInput<uint8_t>("y_zero_point", {}, {120});
+
+  test.AddInput<int32_t>("b", {2}, {100, -200});
+
+  test.AddOutput<uint8_t>("y", {1, 2, 2, 2}, {133, 135, 137, 138, 141, 146, 155, 160});
+
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kNGraphExecutionProvider});
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace onnxruntime
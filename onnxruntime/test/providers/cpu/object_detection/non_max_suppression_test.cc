@@ -3,6 +3,11 @@
 
 #include "gtest/gtest.h"
 #include "test/providers/provider_test_utils.h"
+#include "core/framework/session_options.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
 
 namespace onnxruntime {
 namespace test {
@@ -176,6 +181,26 @@ TEST(NonMaxSuppressionOpTest, WithoutScoreThreshold) {
   test.Run();
 }
 
+TEST(NonMaxSuppressionOpTest, WithoutScoreThresholdNaNScores) {
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  OpTester test("NonMaxSuppression", 10, kOnnxDomain);
+  test.AddInput<float>("boxes", {1, 6, 4},
+                       {0.0f, 0.0f, 1.0f, 1.0f,
+                        0.0f, 0.1f, 1.0f, 1.1f,
+                        0.0f, -0.1f, 1.0f, 0.9f,
+                        0.0f, 10.0f, 1.0f, 11.0f,
+                        0.0f, 10.1f, 1.0f, 11.1f,
+                        0.0f, 100.0f, 1.0f, 101.0f});
+  test.AddInput<float>("scores", {1, 1, 6}, {nan, 0.75f, 0.6f, 0.95f, nan, 0.3f});
+  test.AddInput<int64_t>("max_output_boxes_per_class", {}, {3L});
+  test.AddInput<float>("iou_threshold", {}, {0.5f});
+  test.AddOutput<int64_t>("selected_indices", {3, 3},
+                          {0L, 0L, 3L,
+                           0L, 0L, 1L,
+                           0L, 0L, 5L});
+  test.Run();
+}
+
 TEST(NonMaxSuppressionOpTest, WithScoreThresholdZeroScores) {
   OpTester test("NonMaxSuppression", 10, kOnnxDomain);
   test.AddInput<float>("boxes", {1, 6, 4},
@@ -383,5 +408,58 @@ TEST(NonMaxSuppressionOpTest, WithIOUThresholdOpset11) {
   test.Run();
 }
 
+TEST(NonMaxSuppressionOpTest, ParallelBatchesAndClasses) {
+  // Pairs of overlapping boxes, far from the other pairs. Each class keeps the box of a pair with the higher score,
+  // and the top scoring ones when there are too many.
+  constexpr int64_t num_batches = 2;
+  constexpr int64_t num_classes = 16;
+  constexpr int64_t num_boxes = 40;
+  constexpr int64_t max_output_boxes_per_class = 5;
+
+  std::vector<float> boxes;
+  for (int64_t batch = 0; batch < num_batches; ++batch) {
+    for (int64_t box = 0; box < num_boxes; ++box) {
+      const float x = 10.0f * (box / 2) + 0.1f * (box % 2);
+      boxes.insert(boxes.end(), {0.0f, x, 1.0f, x + 1.0f});
+    }
+  }
+
+  std::vector<float> scores;
+  std::vector<int64_t> expected;
+  for (int64_t batch = 0; batch < num_batches; ++batch) {
+    for (int64_t class_index = 0; class_index < num_classes; ++class_index) {
+      // A different permutation of the scores for every batch and class
+      std::vector<float> class_scores;
+      for (int64_t box = 0; box < num_boxes; ++box) {
+        class_scores.push_back(((box * 7 + class_index * 3 + batch) % num_boxes + 1) / 41.0f);
+      }
+      scores.insert(scores.end(), class_scores.begin(), class_scores.end());
+
+      std::vector<std::pair<float, int64_t>> winners;
+      for (int64_t box = 0; box < num_boxes; box += 2) {
+        const int64_t winner = class_scores[box] > class_scores[box + 1] ? box : box + 1;
+        winners.emplace_back(class_scores[winner], winner);
+      }
+      std::sort(winners.begin(), winners.end(), std::greater<std::pair<float, int64_t>>());
+      for (int64_t i = 0; i < max_output_boxes_per_class; ++i) {
+        expected.insert(expected.end(), {batch, class_index, winners[i].second});
+      }
+    }
+  }
+
+  OpTester test("NonMaxSuppression", 11, kOnnxDomain);
+  test.AddInput<float>("boxes", {num_batches, num_boxes, 4}, boxes);
+  test.AddInput<float>("scores", {num_batches, num_classes, num_boxes}, scores);
+  test.AddInput<int64_t>("max_output_boxes_per_class", {}, {max_output_boxes_per_class});
+  test.AddInput<float>("iou_threshold", {}, {0.5f});
+  test.AddInput<float>("score_threshold", {}, {0.0f});
+  test.AddOutput<int64_t>("selected_indices", {static_cast<int64_t>(expected.size() / 3), 3}, expected);
+
+  SessionOptions so;
+  so.session_logid = "NonMaxSuppressionOpTest.ParallelBatchesAndClasses";
+  so.intra_op_param.thread_pool_size = 4;
+  test.Run(so);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "gtest/gtest.h"
+#include "core/framework/session_options.h"
 #include "test/providers/provider_test_utils.h"
 
 namespace onnxruntime {
@@ -489,5 +490,51 @@ TEST(TensorOpTest, Pad_Reflect_DimWithZeroInput) {
                                "Cannot use 'reflect' mode to pad dimension with a value of 0. Input shape:{0,2,1}");
 }
 
+TEST(TensorOpTest, Pad_Parallel) {
+  // The slices of the outermost axis are padded in parallel, then the outermost axis itself is padded
+  const std::vector<int64_t> input_dims{64, 5, 40};
+  const std::vector<int64_t> pads{2, 1, 3, 3, 2, 1};
+  const std::vector<int64_t> output_dims{69, 8, 44};
+
+  std::vector<float> input(64 * 5 * 40);
+  for (size_t i = 0; i < input.size(); ++i) input[i] = static_cast<float>(i);
+
+  SessionOptions so;
+  so.session_logid = "TensorOpTest.Pad_Parallel";
+  so.intra_op_param.thread_pool_size = 4;
+
+  for (const std::string mode : {"constant", "edge", "reflect"}) {
+    // Maps an output coordinate to the input coordinate, or -1 for constant padding
+    auto source = [&mode](int64_t o, int64_t pre_pad, int64_t dim) -> int64_t {
+      int64_t c = o - pre_pad;
+      if (c >= 0 && c < dim) return c;
+      if (mode == "constant") return -1;
+      if (mode == "edge") return c < 0 ? 0 : dim - 1;
+      return c < 0 ? -c : 2 * (dim - 1) - c;
+    };
+
+    std::vector<float> output;
+    for (int64_t i = 0; i < output_dims[0]; ++i) {
+      for (int64_t j = 0; j < output_dims[1]; ++j) {
+        for (int64_t k = 0; k < output_dims[2]; ++k) {
+          int64_t si = source(i, pads[0], input_dims[0]);
+          int64_t sj = source(j, pads[1], input_dims[1]);
+          int64_t sk = source(k, pads[2], input_dims[2]);
+          output.push_back(si < 0 || sj < 0 || sk < 0 ? 7.0f : input[(si * input_dims[1] + sj) * input_dims[2] + sk]);
+        }
+      }
+    }
+
+    OpTester test("Pad", 11);
+    if (mode != "constant")
+      test.AddAttribute("mode", mode);
+    test.AddInput<float>("data", input_dims, input);
+    test.AddInput<int64_t>("pads", {static_cast<int64_t>(pads.size())}, pads);
+    test.AddInput<float>("value", {1}, {7.0f});
+    test.AddOutput<float>("output", output_dims, output);
+    test.Run(so);
+  }
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "core/providers/cpu/tensor/resize.h"
+#include "core/framework/session_options.h"
 #include "gtest/gtest.h"
 #include "test/providers/provider_test_utils.h"
 
@@ -172,6 +173,34 @@ TEST(ResizeOpTest, ResizeOpLineartUpSampleTest_4DBilinear_asymmetric) {
   test.Run();
 }
 
+TEST(ResizeOpTest, ResizeOpLineartUpSampleTest_4DBilinear_asymmetric_NHWC) {
+  OpTester test("Resize", 11);
+  std::vector<float> roi{};
+  std::vector<float> scales{1.0f, 2.0f, 4.0f, 1.0f};
+
+  test.AddAttribute("mode", "linear");
+  test.AddAttribute("coordinate_transformation_mode", "asymmetric");
+
+  // The 2 images of the NCHW test above as 2 channels
+  const int64_t N = 1, H = 2, W = 2, C = 2;
+  std::vector<float> X = {1.0f, 6.0f, 3.0f, 2.0f,
+                          4.0f, 7.0f, 8.0f, 11.0f};
+
+  test.AddInput<float>("X", {N, H, W, C}, X);
+  test.AddInput<float>("roi", {0}, roi);
+  test.AddInput<float>("scales", {4}, scales);
+
+  std::vector<float> Y = {
+      1.0f, 6.0f, 1.5f, 5.0f, 2.0f, 4.0f, 2.5f, 3.0f, 3.0f, 2.0f, 3.0f, 2.0f, 3.0f, 2.0f, 3.0f, 2.0f,
+      2.5f, 6.5f, 3.25f, 6.5f, 4.0f, 6.5f, 4.75f, 6.5f, 5.5f, 6.5f, 5.5f, 6.5f, 5.5f, 6.5f, 5.5f, 6.5f,
+      4.0f, 7.0f, 5.0f, 8.0f, 6.0f, 9.0f, 7.0f, 10.0f, 8.0f, 11.0f, 8.0f, 11.0f, 8.0f, 11.0f, 8.0f, 11.0f,
+      4.0f, 7.0f, 5.0f, 8.0f, 6.0f, 9.0f, 7.0f, 10.0f, 8.0f, 11.0f, 8.0f, 11.0f, 8.0f, 11.0f, 8.0f, 11.0f};
+
+  test.AddOutput<float>("Y", {N, static_cast<int64_t>(H * scales[1]), static_cast<int64_t>(W * scales[2]), C}, Y);
+  // CUDA only supports the NCHW layout in 'linear' mode
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kCudaExecutionProvider, kTensorrtExecutionProvider});
+}
+
 TEST(ResizeOpTest, ResizeOpLineartUpSampleTest_2DBilinear_align_corners) {
   OpTester test("Resize", 11);
   std::vector<float> roi{};
@@ -945,5 +974,46 @@ TEST(UpsampleOpTest, ResizeOpNearestNoScaleTest_Ver10) {
   test.Run();
 }
 
+TEST(ResizeOpTest, ResizeOpLinearParallelPlanes) {
+  OpTester test("Resize", 11);
+  std::vector<float> scales{};
+  std::vector<float> roi{};
+
+  test.AddAttribute("mode", "linear");
+  test.AddAttribute("coordinate_transformation_mode", "align_corners");
+
+  // Every plane is an affine function of the coordinates, which bilinear interpolation reproduces exactly
+  const int64_t N = 2, C = 3, H = 8, W = 10;
+  const int64_t OH = 15, OW = 19;
+  std::vector<int64_t> sizes{N, C, OH, OW};
+  std::vector<float> X;
+  std::vector<float> Y;
+  for (int64_t plane = 0; plane < N * C; ++plane) {
+    for (int64_t y = 0; y < H; ++y) {
+      for (int64_t x = 0; x < W; ++x) {
+        X.push_back(10.0f * plane + 2.0f * y + 3.0f * x);
+      }
+    }
+    for (int64_t y = 0; y < OH; ++y) {
+      for (int64_t x = 0; x < OW; ++x) {
+        const float in_y = static_cast<float>(y) * (H - 1) / (OH - 1);
+        const float in_x = static_cast<float>(x) * (W - 1) / (OW - 1);
+        Y.push_back(10.0f * plane + 2.0f * in_y + 3.0f * in_x);
+      }
+    }
+  }
+
+  test.AddInput<float>("X", {N, C, H, W}, X);
+  test.AddInput<float>("roi", {0}, roi);
+  test.AddInput<float>("scales", {0}, scales);
+  test.AddInput<int64_t>("sizes", {4}, sizes);
+  test.AddOutput<float>("Y", sizes, Y);
+
+  SessionOptions so;
+  so.session_logid = "ResizeOpTest.ResizeOpLinearParallelPlanes";
+  so.intra_op_param.thread_pool_size = 4;
+  test.Run(so);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
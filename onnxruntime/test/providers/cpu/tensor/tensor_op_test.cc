@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "gtest/gtest.h"
+#include "core/framework/session_options.h"
 #include "test/common/tensor_op_test_utils.h"
 
 
@@ -263,6 +264,37 @@ TEST(TensorOpTest, CastFromFloat16) {
   TestCastOp(input, int64_t_data, shape, TensorProto::INT64);
 }
 
+TEST(TensorOpTest, CastFloat16Parallel) {
+  // Large casts are split across the intra-op thread pool, with uneven tails for the SIMD converters
+  const int64_t count = 65536 + 13;
+  std::vector<float> float_data(count);
+  std::vector<MLFloat16> float16_data(count);
+  for (int64_t i = 0; i < count; ++i) {
+    // Exactly representable in half precision
+    float_data[i] = static_cast<float>(i % 2048) * ((i & 1) ? -0.25f : 0.5f);
+    float16_data[i] = MLFloat16(math::floatToHalf(float_data[i]));
+  }
+
+  SessionOptions so;
+  so.session_logid = "TensorOpTest.CastFloat16Parallel";
+  so.intra_op_param.thread_pool_size = 4;
+
+  {
+    OpTester test("Cast", 9);
+    test.AddAttribute("to", static_cast<int64_t>(TensorProto::FLOAT16));
+    test.AddInput<float>("input", {count}, float_data);
+    test.AddOutput<MLFloat16>("output", {count}, float16_data);
+    test.Run(so);
+  }
+  {
+    OpTester test("Cast", 9);
+    test.AddAttribute("to", static_cast<int64_t>(TensorProto::FLOAT));
+    test.AddInput<MLFloat16>("input", {count}, float16_data);
+    test.AddOutput<float>("output", {count}, float_data);
+    test.Run(so);
+  }
+}
+
 TEST(TensorOpTest, CastFromString) {
   const std::vector<int64_t> shape{2, 2, 2};
   std::initializer_list<std::string> string_data = {"-inf", "+INF", "0.9767611f", "0.28280696f",
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "gtest/gtest.h"
+#include "core/framework/session_options.h"
 #include "test/providers/provider_test_utils.h"
 
 namespace onnxruntime {
@@ -106,5 +107,31 @@ TEST(TensorOpTest, TileUint64Type) {
 TEST(TensorOpTest, TileBoolType) {
   RunTestWrapper<bool>();
 }
+TEST(TensorOpTest, TileParallel) {
+  // Rows of 80 floats are tiled in parallel on the intra-op thread pool
+  const std::vector<int64_t> input_dims{32, 7, 40};
+  const std::vector<int64_t> repeats{2, 3, 2};
+  const std::vector<int64_t> output_dims{64, 21, 80};
+
+  std::vector<float> input(32 * 7 * 40);
+  for (size_t i = 0; i < input.size(); ++i) input[i] = static_cast<float>(i);
+
+  std::vector<float> output;
+  for (int64_t i = 0; i < output_dims[0]; ++i)
+    for (int64_t j = 0; j < output_dims[1]; ++j)
+      for (int64_t k = 0; k < output_dims[2]; ++k)
+        output.push_back(input[((i % 32) * 7 + j % 7) * 40 + k % 40]);
+
+  SessionOptions so;
+  so.session_logid = "TensorOpTest.TileParallel";
+  so.intra_op_param.thread_pool_size = 4;
+
+  OpTester test("Tile");
+  test.AddInput<float>("input", input_dims, input);
+  test.AddInput<int64_t>("repeats", {3}, repeats);
+  test.AddOutput<float>("output", output_dims, output);
+  test.Run(so);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -83,6 +83,60 @@ class TestInferenceSession(unittest.TestCase):
         output_expected = np.array([[1.0, 4.0], [9.0, 16.0], [25.0, 36.0]], dtype=np.float32)
         np.testing.assert_allclose(output_expected, res[0], rtol=1e-05, atol=1e-08)
 
+    def testRunModelNonNativeInputs(self):
+        sess = onnxrt.InferenceSession(self.get_name("mul_1.onnx"))
+        x = np.array([[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]], dtype=np.float32)
+        output_expected = np.array([[1.0, 4.0], [9.0, 16.0], [25.0, 36.0]], dtype=np.float32)
+        # inputs that can't be used in place are converted with a single copy
+        for feed in [np.asfortranarray(x), x.astype('>f4'), np.ascontiguousarray(x.T).T]:
+            res = sess.run([], {"X": feed})
+            np.testing.assert_allclose(output_expected, res[0], rtol=1e-05, atol=1e-08)
+
+    def testOutputOutlivesSession(self):
+        sess = onnxrt.InferenceSession(self.get_name("mul_1.onnx"))
+        x = np.array([[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]], dtype=np.float32)
+        res = sess.run([], {"X": x})
+        # the output shares the buffer of the ORT tensor instead of copying it
+        self.assertIsNotNone(res[0].base)
+        del sess
+        output_expected = np.array([[1.0, 4.0], [9.0, 16.0], [25.0, 36.0]], dtype=np.float32)
+        np.testing.assert_allclose(output_expected, res[0], rtol=1e-05, atol=1e-08)
+
+    def testArenaStats(self):
+        sess = onnxrt.InferenceSession(self.get_name("mul_1.onnx"))
+        x = np.array([[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]], dtype=np.float32)
+        sess.run([], {"X": x})
+        stats = sess.get_arena_stats()
+        self.assertGreater(stats["num_allocs"], 0)
+        self.assertGreaterEqual(stats["max_bytes_in_use"], x.nbytes)
+        self.assertGreaterEqual(stats["total_allocated_bytes"], stats["max_bytes_in_use"])
+        with self.assertRaises(Exception):
+            sess.get_arena_stats("UnknownExecutionProvider")
+
+    def testRunModelWithIOBinding(self):
+        sess = onnxrt.InferenceSession(self.get_name("mul_1.onnx"))
+        x = np.array([[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]], dtype=np.float32)
+        y = np.zeros((3, 2), dtype=np.float32)
+        binding = sess.io_binding()
+        binding.bind_input("X", x)
+        binding.bind_output("Y", y)
+        sess.run_with_iobinding(binding)
+        output_expected = np.array([[1.0, 4.0], [9.0, 16.0], [25.0, 36.0]], dtype=np.float32)
+        np.testing.assert_allclose(output_expected, y, rtol=1e-05, atol=1e-08)
+        self.assertIs(binding.get_outputs()[0], y)
+
+        # the bound arrays are reused by the next run
+        x[0, 0] = 7.0
+        sess.run_with_iobinding(binding)
+        self.assertEqual(y[0, 0], 49.0)
+
+        binding.clear_binding_outputs()
+        binding.bind_output("Y")
+        sess.run_with_iobinding(binding)
+        res = binding.get_outputs()
+        self.assertEqual(res[0].shape, (3, 2))
+        self.assertEqual(res[0][0, 0], 49.0)
+
     def testRunModelFromBytes(self):
         with open(self.get_name("mul_1.onnx"), "rb") as f:
             content = f.read()
@@ -424,6 +424,47 @@ TEST(CApiTest, create_tensor_with_data) {
   ASSERT_EQ(1u, tensor_info.GetDimensionsCount());
 }
 
+TEST(CApiTest, io_binding) {
+  Ort::MemoryInfo info("Cpu", OrtDeviceAllocator, 0, OrtMemTypeDefault);
+  Ort::Session session(*ort_env, MODEL_URI, Ort::SessionOptions{});
+
+  std::array<float, 6> x_values = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  std::array<int64_t, 2> x_shape = {3, 2};
+  Ort::Value x = Ort::Value::CreateTensor<float>(info, x_values.data(), x_values.size(),
+                                                 x_shape.data(), x_shape.size());
+
+  std::array<float, 6> y_values{};
+  Ort::Value y = Ort::Value::CreateTensor<float>(info, y_values.data(), y_values.size(),
+                                                 x_shape.data(), x_shape.size());
+
+  Ort::IoBinding binding(session);
+  binding.BindInput("X", x);
+  binding.BindOutput("Y", y);
+
+  // the output is written into the bound buffer on each run
+  session.Run(Ort::RunOptions{}, binding);
+  ASSERT_EQ(y_values, (std::array<float, 6>{1.0f, 4.0f, 9.0f, 16.0f, 25.0f, 36.0f}));
+
+  x_values[0] = 7.0f;
+  session.Run(Ort::RunOptions{}, binding);
+  ASSERT_EQ(y_values[0], 49.0f);
+
+  // an output bound without a buffer is allocated by the run
+  binding.ClearBoundOutputs();
+  binding.BindOutput("Y", info);
+  session.Run(Ort::RunOptions{}, binding);
+
+  std::vector<std::string> output_names = binding.GetOutputNames();
+  ASSERT_EQ(output_names, std::vector<std::string>{"Y"});
+  std::vector<Ort::Value> outputs = binding.GetOutputValues();
+  ASSERT_EQ(outputs.size(), 1u);
+  ASSERT_EQ(outputs[0].GetTensorTypeAndShapeInfo().GetShape(), (std::vector<int64_t>{3, 2}));
+  float* output_data = outputs[0].GetTensorMutableData<float>();
+  ASSERT_NE(output_data, y_values.data());
+  ASSERT_EQ(output_data[0], 49.0f);
+  ASSERT_EQ(output_data[5], 36.0f);
+}
+
 TEST(CApiTest, override_initializer) {
   Ort::MemoryInfo info("Cpu", OrtDeviceAllocator, 0, OrtMemTypeDefault);
   auto allocator = onnxruntime::make_unique<MockedOrtAllocator>();
@@ -1,6 +1,11 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <cstring>
+#include <unordered_set>
+
+#include <google/protobuf/io/coded_stream.h>
+
 #include "onnxruntime_cxx_api.h"
 
 #include "onnx-ml.pb.h"
@@ -230,5 +235,120 @@ void MLValueToTensorProto(Ort::Value& ml_value, bool using_raw_data,
 
   return;
 }
+
+// Size of the elements that MLValueToTensorProto writes to raw_data, 0 for the other types.
+static size_t RawDataElementSize(onnx::TensorProto_DataType data_type) {
+  switch (data_type) {
+    case onnx::TensorProto_DataType_BOOL:
+    case onnx::TensorProto_DataType_INT8:
+    case onnx::TensorProto_DataType_UINT8:
+      return 1;
+    case onnx::TensorProto_DataType_INT16:
+    case onnx::TensorProto_DataType_UINT16:
+      return 2;
+    case onnx::TensorProto_DataType_FLOAT:
+    case onnx::TensorProto_DataType_INT32:
+    case onnx::TensorProto_DataType_UINT32:
+      return 4;
+    case onnx::TensorProto_DataType_DOUBLE:
+    case onnx::TensorProto_DataType_INT64:
+    case onnx::TensorProto_DataType_UINT64:
+      return 8;
+    default:
+      return 0;
+  }
+}
+
+void SerializePredictResponse(const std::vector<std::string>& output_names, std::vector<Ort::Value>& outputs,
+                              bool using_raw_data, const std::shared_ptr<spdlog::logger>& logger,
+                              /* out */ std::string& serialized) {
+  using google::protobuf::io::CodedOutputStream;
+
+  // PredictResponse.outputs is a map, which is encoded as repeated entries with the key in field 1 and the value
+  // in field 2. The raw_data field (9) of each TensorProto is appended after its other fields, which is valid since
+  // protobuf fields may come in any order.
+  constexpr uint32_t kOutputsTag = (1 << 3) | 2;
+  constexpr uint32_t kKeyTag = (1 << 3) | 2;
+  constexpr uint32_t kValueTag = (2 << 3) | 2;
+  constexpr uint32_t kRawDataTag = (9 << 3) | 2;
+
+  struct Entry {
+    onnx::TensorProto tensor_proto;  // all fields but raw_data
+    const void* raw_data;
+    size_t raw_data_size;
+    size_t tensor_size;
+    size_t entry_size;
+  };
+  std::vector<Entry> entries(outputs.size());
+  std::unordered_set<std::string> names;
+
+  size_t total_size = 0;
+  for (size_t i = 0; i < outputs.size(); ++i) {
+    if (!names.insert(output_names[i]).second) {
+      logger->error("SerializePredictResponse() failed. Output name: {}. Trying to overwrite existing output value", output_names[i]);
+      throw Ort::Exception("Cannot have two outputs with the same name", OrtErrorCode::ORT_INVALID_ARGUMENT);
+    }
+
+    Entry& entry = entries[i];
+    entry.raw_data = nullptr;
+    entry.raw_data_size = 0;
+
+    size_t element_size = 0;
+    if (using_raw_data && outputs[i].IsTensor()) {
+      const auto& shape = outputs[i].GetTensorTypeAndShapeInfo();
+      onnx::TensorProto_DataType data_type = MLDataTypeToTensorProtoDataType(shape.GetElementType());
+      element_size = RawDataElementSize(data_type);
+      if (element_size != 0) {
+        for (const auto& dim : shape.GetShape()) {
+          entry.tensor_proto.add_dims(dim);
+        }
+        entry.tensor_proto.set_data_type(data_type);
+        entry.tensor_proto.set_data_location(onnx::TensorProto_DataLocation_DEFAULT);
+        entry.raw_data = outputs[i].GetTensorMutableData<void>();
+        entry.raw_data_size = element_size * shape.GetElementCount();
+      }
+    }
+    if (element_size == 0) {
+      MLValueToTensorProto(outputs[i], using_raw_data, logger, entry.tensor_proto);
+    }
+
+    entry.tensor_size = entry.tensor_proto.ByteSizeLong();
+    if (entry.raw_data != nullptr) {
+      entry.tensor_size += CodedOutputStream::VarintSize32(kRawDataTag) +
+                           CodedOutputStream::VarintSize64(entry.raw_data_size) + entry.raw_data_size;
+    }
+    const std::string& name = output_names[i];
+    entry.entry_size = CodedOutputStream::VarintSize32(kKeyTag) + CodedOutputStream::VarintSize64(name.size()) +
+                       name.size() +
+                       CodedOutputStream::VarintSize32(kValueTag) + CodedOutputStream::VarintSize64(entry.tensor_size) +
+                       entry.tensor_size;
+    total_size += CodedOutputStream::VarintSize32(kOutputsTag) + CodedOutputStream::VarintSize64(entry.entry_size) +
+                  entry.entry_size;
+  }
+
+  serialized.resize(total_size);
+  auto* target = reinterpret_cast<google::protobuf::uint8*>(&serialized[0]);
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const Entry& entry = entries[i];
+    const std::string& name = output_names[i];
+    target = CodedOutputStream::WriteTagToArray(kOutputsTag, target);
+    target = CodedOutputStream::WriteVarint64ToArray(entry.entry_size, target);
+    target = CodedOutputStream::WriteTagToArray(kKeyTag, target);
+    target = CodedOutputStream::WriteVarint64ToArray(name.size(), target);
+    memcpy(target, name.data(), name.size());
+    target += name.size();
+    target = CodedOutputStream::WriteTagToArray(kValueTag, target);
+    target = CodedOutputStream::WriteVarint64ToArray(entry.tensor_size, target);
+    target = entry.tensor_proto.SerializeWithCachedSizesToArray(target);
+    if (entry.raw_data != nullptr) {
+      target = CodedOutputStream::WriteTagToArray(kRawDataTag, target);
+      target = CodedOutputStream::WriteVarint64ToArray(entry.raw_data_size, target);
+      if (entry.raw_data_size != 0) {
+        memcpy(target, entry.raw_data, entry.raw_data_size);
+      }
+      target += entry.raw_data_size;
+    }
+  }
+}
 }  // namespace server
 }  // namespace onnxruntime
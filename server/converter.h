@@ -22,5 +22,11 @@ void MLValueToTensorProto(Ort::Value& ml_value, bool using_raw_data,
                           const std::shared_ptr<spdlog::logger>& logger,
                           /* out */ onnx::TensorProto& tensor_proto);
 
+// Serialize the outputs as a PredictResponse in the protobuf wire format.
+// Tensors put in raw_data are written straight from the ORT buffers instead of being copied into a TensorProto first.
+void SerializePredictResponse(const std::vector<std::string>& output_names, std::vector<Ort::Value>& outputs,
+                              bool using_raw_data, const std::shared_ptr<spdlog::logger>& logger,
+                              /* out */ std::string& serialized);
+
 }  // namespace server
 }  // namespace onnxruntime
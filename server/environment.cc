@@ -1,6 +1,7 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <algorithm>
 #include <memory>
 #include "environment.h"
 #include "onnxruntime_cxx_api.h"
@@ -64,6 +65,7 @@ ServerEnvironment::ServerEnvironment(OrtLoggingLevel severity, spdlog::sinks_ini
   spdlog::set_automatic_registration(false);
   spdlog::set_level(Convert(severity_));
   spdlog::initialize_logger(default_logger_);
+  RegisterExecutionProviders();
 }
 
 void ServerEnvironment::RegisterExecutionProviders(){
@@ -86,47 +88,78 @@ void ServerEnvironment::RegisterExecutionProviders(){
 
 }
 
-void ServerEnvironment::InitializeModel(const std::string& model_path, const std::string& model_name, const std::string& model_version) {
-  RegisterExecutionProviders();
-  auto result = sessions_.emplace(std::piecewise_construct, std::forward_as_tuple(model_name, model_version), std::forward_as_tuple(runtime_environment_, model_path.c_str(), options_));
-
-  if (!result.second) {
-    throw Ort::Exception("Model of that name already loaded.", ORT_INVALID_ARGUMENT);
-  }
-
-  auto iterator = result.first;
-  auto output_count = (iterator->second).session.GetOutputCount();
+ModelSession::ModelSession(Ort::Env& env, const std::string& path, const Ort::SessionOptions& options)
+    : session(env, path.c_str(), options) {
+  auto output_count = session.GetOutputCount();
 
   Ort::AllocatorWithDefaultOptions allocator;
   for (size_t i = 0; i < output_count; i++) {
-    auto name = (iterator->second).session.GetOutputName(i, allocator);
-    (iterator->second).output_names.push_back(name);
+    auto name = session.GetOutputName(i, allocator);
+    output_names.push_back(name);
     allocator.Free(name);
   }
 }
 
-const std::vector<std::string>& ServerEnvironment::GetModelOutputNames(const std::string& model_name, const std::string& model_version) const {
-  auto identifier = std::make_pair(model_name, model_version);
-  auto it = sessions_.find(identifier);
-  if (it == sessions_.end()) {
-    throw Ort::Exception("No model loaded of that name.", ORT_NO_MODEL);
+// Versions made of digits compare as numbers, others as strings
+static bool VersionLess(const std::string& a, const std::string& b) {
+  auto is_number = [](const std::string& v) {
+    return !v.empty() && std::all_of(v.begin(), v.end(), [](char c) { return c >= '0' && c <= '9'; });
+  };
+  if (is_number(a) && is_number(b) && a.size() != b.size()) {
+    return a.size() < b.size();
   }
+  return a < b;
+}
+
+void ServerEnvironment::InitializeModel(const std::string& model_path, const std::string& model_name, const std::string& model_version) {
+  auto model = CreateModel(model_path);
 
-  return it->second.output_names;
+  std::lock_guard<std::mutex> lock(sessions_mutex_);
+  auto result = sessions_.emplace(std::make_pair(model_name, model_version), std::move(model));
+  if (!result.second) {
+    throw Ort::Exception("Model of that name already loaded.", ORT_INVALID_ARGUMENT);
+  }
+}
+
+std::shared_ptr<ModelSession> ServerEnvironment::CreateModel(const std::string& model_path) {
+  return std::make_shared<ModelSession>(runtime_environment_, model_path, options_);
+}
+
+void ServerEnvironment::SwapModel(const std::string& model_name, const std::string& model_version, std::shared_ptr<ModelSession> model) {
+  std::shared_ptr<ModelSession> previous;
+  {
+    std::lock_guard<std::mutex> lock(sessions_mutex_);
+    auto& entry = sessions_[std::make_pair(model_name, model_version)];
+    previous = std::move(entry);
+    entry = std::move(model);
+  }
+  // 'previous' is destroyed outside of the lock, or by the last request still using it
 }
 
 OrtLoggingLevel ServerEnvironment::GetLogSeverity() const {
   return severity_;
 }
 
-const Ort::Session& ServerEnvironment::GetSession(const std::string& model_name, const std::string& model_version) const {
-  auto identifier = std::make_pair(model_name, model_version);
-  auto it = sessions_.find(identifier);
-  if (it == sessions_.end()) {
-    throw Ort::Exception("No model loaded of that name.", ORT_NO_MODEL);
+std::shared_ptr<ModelSession> ServerEnvironment::GetModel(const std::string& model_name, const std::string& model_version) const {
+  std::lock_guard<std::mutex> lock(sessions_mutex_);
+  if (!model_version.empty()) {
+    auto it = sessions_.find(std::make_pair(model_name, model_version));
+    if (it != sessions_.end()) {
+      return it->second;
+    }
+  } else {
+    const std::pair<const std::pair<std::string, std::string>, std::shared_ptr<ModelSession>>* latest = nullptr;
+    for (const auto& entry : sessions_) {
+      if (entry.first.first == model_name && (latest == nullptr || VersionLess(latest->first.second, entry.first.second))) {
+        latest = &entry;
+      }
+    }
+    if (latest != nullptr) {
+      return latest->second;
+    }
   }
 
-  return it->second.session;
+  throw Ort::Exception("No model loaded of that name.", ORT_NO_MODEL);
 }
 
 std::shared_ptr<spdlog::logger> ServerEnvironment::GetLogger(const std::string& request_id) const {
@@ -139,14 +172,38 @@ std::shared_ptr<spdlog::logger> ServerEnvironment::GetAppLogger() const {
   return default_logger_;
 }
 
-void ServerEnvironment::UnloadModel(const std::string& model_name, const std::string& model_version) {
-  auto identifier = std::make_pair(model_name, model_version);
-  auto it = sessions_.find(identifier);
-  if (it == sessions_.end()) {
-    throw Ort::Exception("No model loaded of that name.", ORT_NO_MODEL);
+ServerMetrics& ServerEnvironment::GetMetrics() {
+  return metrics_;
+}
+
+std::vector<ModelArenaStats> ServerEnvironment::GetArenaStats() const {
+  std::vector<std::pair<std::pair<std::string, std::string>, std::shared_ptr<ModelSession>>> models;
+  {
+    std::lock_guard<std::mutex> lock(sessions_mutex_);
+    models.assign(sessions_.begin(), sessions_.end());
+  }
+
+  std::vector<ModelArenaStats> result;
+  result.reserve(models.size());
+  for (const auto& entry : models) {
+    result.push_back(ModelArenaStats{entry.first.first, entry.first.second,
+                                     entry.second->session.GetArenaStats("CPUExecutionProvider")});
   }
+  return result;
+}
 
-  sessions_.erase(it);
+void ServerEnvironment::UnloadModel(const std::string& model_name, const std::string& model_version) {
+  std::shared_ptr<ModelSession> model;
+  {
+    std::lock_guard<std::mutex> lock(sessions_mutex_);
+    auto it = sessions_.find(std::make_pair(model_name, model_version));
+    if (it == sessions_.end()) {
+      throw Ort::Exception("No model loaded of that name.", ORT_NO_MODEL);
+    }
+
+    model = std::move(it->second);
+    sessions_.erase(it);
+  }
 }
 
 }  // namespace server
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "onnxruntime_cxx_api.h"
@@ -11,9 +12,22 @@
 #include <unordered_map>
 #include <boost/functional/hash.hpp>
 
+#include "metrics.h"
+
 namespace onnxruntime {
 namespace server {
 
+// A loaded version of a model. Requests hold a reference to it while they run, so replacing or unloading the version
+// does not affect the requests already running on it.
+struct ModelSession {
+  Ort::Session session;
+  std::vector<std::string> output_names;
+
+  ModelSession(Ort::Env& env, const std::string& path, const Ort::SessionOptions& options);
+  ModelSession(const ModelSession&) = delete;
+  ModelSession& operator=(const ModelSession&) = delete;
+};
+
 class ServerEnvironment {
  public:
   explicit ServerEnvironment(OrtLoggingLevel severity, spdlog::sinks_init_list sink);
@@ -22,14 +36,22 @@ class ServerEnvironment {
 
   OrtLoggingLevel GetLogSeverity() const;
 
-  const Ort::Session& GetSession(const std::string& model_name, const std::string& model_version) const;
+  // Returns the model of that name and version. An empty version selects the latest version of the model.
+  std::shared_ptr<ModelSession> GetModel(const std::string& model_name, const std::string& model_version) const;
   void InitializeModel(const std::string& model_path, const std::string& model_name, const std::string& model_version);
-  const std::vector<std::string>& GetModelOutputNames(const std::string& model_name, const std::string& model_version) const;
+  // Loads a model without serving it, e.g. to warm it up before calling SwapModel
+  std::shared_ptr<ModelSession> CreateModel(const std::string& model_path);
+  // Serves 'model' as the version, replacing the model currently serving it if any
+  void SwapModel(const std::string& model_name, const std::string& model_version, std::shared_ptr<ModelSession> model);
   std::shared_ptr<spdlog::logger> GetLogger(const std::string& request_id) const;
   std::shared_ptr<spdlog::logger> GetAppLogger() const;
   void UnloadModel(const std::string& model_name, const std::string& model_version);
   void RegisterExecutionProviders();
 
+  ServerMetrics& GetMetrics();
+  // Arena statistics of the CPU execution provider of every loaded model
+  std::vector<ModelArenaStats> GetArenaStats() const;
+
  private:
   const OrtLoggingLevel severity_;
   const std::string logger_id_;
@@ -38,20 +60,11 @@ class ServerEnvironment {
 
   Ort::Env runtime_environment_;
   Ort::SessionOptions options_;
+  ServerMetrics metrics_;
 
-  struct SessionHolder {
-    Ort::Session session;
-    std::vector<std::string> output_names;
-    explicit SessionHolder(Ort::Env& env, std::string path, const Ort::SessionOptions& options) : session(nullptr) {
-      session = Ort::Session(env, path.c_str(), options);
-    };
-    ~SessionHolder() = default;
-    SessionHolder(const SessionHolder&) = delete;
-    SessionHolder(const SessionHolder&&) = delete;
-    SessionHolder& operator=(const SessionHolder&) = delete;
-  };
-
-  std::unordered_map<std::pair<std::string, std::string>, ServerEnvironment::SessionHolder, boost::hash<std::pair<std::string, std::string>>> sessions_;
+  // Guards sessions_. Held only to look up, insert or remove a model, never while a model is loaded or run.
+  mutable std::mutex sessions_mutex_;
+  std::unordered_map<std::pair<std::string, std::string>, std::shared_ptr<ModelSession>, boost::hash<std::pair<std::string, std::string>>> sessions_;
 };
 
 }  // namespace server
@@ -23,6 +23,16 @@ protobufutil::Status Executor::SetMLValue(const onnx::TensorProto& input_tensor,
                                           /* out */ Ort::Value& ml_value) {
   auto logger = env_->GetLogger(request_id_);
 
+  // raw_data is used in place when possible, the request outlives the run
+  try {
+    if (onnxruntime::server::TryWrapRawDataAsMLValue(input_tensor, *cpu_memory_info, ml_value)) {
+      return protobufutil::Status::OK;
+    }
+  } catch (const Ort::Exception& e) {
+    logger->error("TryWrapRawDataAsMLValue() failed. Message: {}", e.what());
+    return GenerateProtobufStatus(e.GetOrtErrorCode(), e.what());
+  }
+
   size_t cpu_tensor_length = 0;
   try {
     onnxruntime::server::GetSizeInBytesFromTensorProto<0>(input_tensor, &cpu_tensor_length);
@@ -97,17 +107,32 @@ std::vector<Ort::Value> Run(const Ort::Session& session, const Ort::RunOptions&
   return const_cast<Ort::Session&>(session).Run(options, input_ptrs.data(), const_cast<Ort::Value*>(input_values.data()), input_count, output_ptrs.data(), output_count);
 }
 
-protobufutil::Status Executor::Predict(const std::string& model_name,
-                                       const std::string& model_version,
-                                       const onnxruntime::server::PredictRequest& request,
-                                       /* out */ onnxruntime::server::PredictResponse& response) {
-  auto logger = env_->GetLogger(request_id_);
+protobufutil::Status Executor::Run(const std::string& model_name,
+                                   const std::string& model_version,
+                                   const onnxruntime::server::PredictRequest& request,
+                                   /* out */ std::vector<std::string>& output_names,
+                                   /* out */ std::vector<Ort::Value>& outputs) {
+  std::shared_ptr<ModelSession> model;
+  try {
+    model = env_->GetModel(model_name, model_version);
+  } catch (const Ort::Exception& e) {
+    return GenerateProtobufStatus(e.GetOrtErrorCode(), e.what());
+  }
+
+  return Run(model, request, output_names, outputs);
+}
+
+protobufutil::Status Executor::Run(const std::shared_ptr<ModelSession>& model,
+                                   const onnxruntime::server::PredictRequest& request,
+                                   /* out */ std::vector<std::string>& output_names,
+                                   /* out */ std::vector<Ort::Value>& outputs) {
+  // The outputs may be allocated by the session, so it is kept alive with the executor
+  model_ = model;
 
   // Convert PredictRequest to NameMLValMap
-  MemBufferArray buffer_array;
   std::vector<std::string> input_names;
   std::vector<Ort::Value> input_values;
-  auto conversion_status = SetNameMLValueMap(input_names, input_values, request, buffer_array);
+  auto conversion_status = SetNameMLValueMap(input_names, input_values, request, buffers_);
   if (conversion_status != protobufutil::Status::OK) {
     return conversion_status;
   }
@@ -117,41 +142,53 @@ protobufutil::Status Executor::Predict(const std::string& model_name,
   run_options.SetRunTag(request_id_.c_str());
 
   // Prepare the output names
-  std::vector<std::string> output_names;
-
+  output_names.clear();
   if (!request.output_filter().empty()) {
     output_names.reserve(request.output_filter_size());
     for (const auto& name : request.output_filter()) {
       output_names.push_back(name);
     }
   } else {
-    output_names = env_->GetModelOutputNames(model_name, model_version);
+    output_names = model->output_names;
   }
 
-  std::vector<Ort::Value> outputs;
   try {
-    outputs = Run(env_->GetSession(model_name, model_version), run_options, input_names, input_values, output_names);
+    outputs = server::Run(model->session, run_options, input_names, input_values, output_names);
   } catch (const Ort::Exception& e) {
     return GenerateProtobufStatus(e.GetOrtErrorCode(), e.what());
   }
 
-  // Build the response
+  return protobufutil::Status::OK;
+}
+
+protobufutil::Status Executor::Predict(const std::string& model_name,
+                                       const std::string& model_version,
+                                       const onnxruntime::server::PredictRequest& request,
+                                       /* out */ onnxruntime::server::PredictResponse& response) {
+  auto logger = env_->GetLogger(request_id_);
+
+  std::vector<std::string> output_names;
+  std::vector<Ort::Value> outputs;
+  auto status = Run(model_name, model_version, request, output_names, outputs);
+  if (status != protobufutil::Status::OK) {
+    return status;
+  }
+
+  // Build the response, the tensors are created in place in the map
+  auto& response_outputs = *response.mutable_outputs();
   for (size_t i = 0, sz = outputs.size(); i < sz; ++i) {
-    onnx::TensorProto output_tensor{};
+    if (response_outputs.count(output_names[i]) != 0) {
+      logger->error("SetNameMLValueMap() failed. Output name: {}. Trying to overwrite existing output value", output_names[i]);
+      return protobufutil::Status(protobufutil::error::Code::INVALID_ARGUMENT, "SetNameMLValueMap() failed: Cannot have two outputs with the same name");
+    }
+
     try {
-      MLValueToTensorProto(outputs[i], using_raw_data_, logger, output_tensor);
+      MLValueToTensorProto(outputs[i], using_raw_data_, logger, response_outputs[output_names[i]]);
     } catch (const Ort::Exception& e) {
       logger = env_->GetLogger(request_id_);
       logger->error("MLValueToTensorProto() failed. Output name: {}. Error Message: {}", output_names[i], e.what());
       return GenerateProtobufStatus(e.GetOrtErrorCode(), e.what());
     }
-
-    auto insertion_result = response.mutable_outputs()->insert({output_names[i], output_tensor});
-
-    if (!insertion_result.second) {
-      logger->error("SetNameMLValueMap() failed. Output name: {}. Trying to overwrite existing output value", output_names[i]);
-      return protobufutil::Status(protobufutil::error::Code::INVALID_ARGUMENT, "SetNameMLValueMap() failed: Cannot have two outputs with the same name");
-    }
   }
 
   return protobufutil::Status::OK;
@@ -25,10 +25,31 @@ class Executor {
                                          const onnxruntime::server::PredictRequest& request,
                                          /* out */ onnxruntime::server::PredictResponse& response);
 
+  // Runs the prediction without building a PredictResponse. The outputs are returned as OrtValues so that they
+  // can be serialized straight from the ORT buffers with SerializePredictResponse().
+  google::protobuf::util::Status Run(const std::string& model_name,
+                                     const std::string& model_version,
+                                     const onnxruntime::server::PredictRequest& request,
+                                     /* out */ std::vector<std::string>& output_names,
+                                     /* out */ std::vector<Ort::Value>& outputs);
+
+  // Runs the prediction on 'model', which need not be served by the environment, e.g. to warm it up
+  google::protobuf::util::Status Run(const std::shared_ptr<ModelSession>& model,
+                                     const onnxruntime::server::PredictRequest& request,
+                                     /* out */ std::vector<std::string>& output_names,
+                                     /* out */ std::vector<Ort::Value>& outputs);
+
+  // True if all the inputs of the request used raw_data, in which case the outputs are returned in raw_data too.
+  bool UsingRawData() const { return using_raw_data_; }
+
  private:
   ServerEnvironment* env_;
   const std::string request_id_;
   bool using_raw_data_;
+  // the model that ran the request, kept alive with the executor even if it stops being served
+  std::shared_ptr<ModelSession> model_;
+  // buffers of the converted inputs, kept alive with the executor since outputs may share them
+  MemBufferArray buffers_;
 
   google::protobuf::util::Status SetMLValue(const onnx::TensorProto& input_tensor,
                                             MemBufferArray& buffers,
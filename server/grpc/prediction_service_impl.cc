@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "prediction_service_impl.h"
+#include "metrics.h"
 #include "request_id.h"
 
 namespace onnxruntime {
@@ -11,10 +12,16 @@ namespace grpc {
 PredictionServiceImpl::PredictionServiceImpl(const std::shared_ptr<onnxruntime::server::ServerEnvironment>& env) : environment_(env) {}
 
 ::grpc::Status PredictionServiceImpl::Predict(::grpc::ServerContext* context, const ::onnxruntime::server::PredictRequest* request, ::onnxruntime::server::PredictResponse* response) {
+  InFlightRequest in_flight(environment_->GetMetrics(), false);
   auto request_id = SetRequestContext(context);
   onnxruntime::server::Executor executor(environment_.get(), request_id);
   //TODO: (csteegz) Add modelspec for both paths.
-  auto status = executor.Predict("default", "1", *request, *response);  // Currently only support one model so hard coded.
+  // The request is deserialized by gRPC, so only the run is timed
+  RequestTimer timer(environment_->GetMetrics(), "default", "latest");
+  timer.Start(RequestPhase::Run);
+  auto status = executor.Predict("default", "", *request, *response);  // Currently only the latest version of the default model.
+  timer.Stop();
+  timer.SetFailed(!status.ok());
   if (!status.ok()) {
     return ::grpc::Status(::grpc::StatusCode(status.error_code()), status.error_message());
   }
@@ -41,6 +41,7 @@ class App {
   App& NumThreads(int threads);
   App& RegisterStartup(const StartFn& fn);
   App& RegisterPost(const std::string& route, const HandlerFn& fn);
+  App& RegisterGet(const std::string& route, const HandlerFn& fn);
   App& RegisterError(const ErrorFn& fn);
   App& Run();
 
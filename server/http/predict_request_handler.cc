@@ -1,12 +1,15 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <google/protobuf/arena.h>
 #include <google/protobuf/stubs/status.h>
 
+#include "converter.h"
 #include "environment.h"
 #include "http_server.h"
 #include "json_handling.h"
 #include "executor.h"
+#include "metrics.h"
 #include "util.h"
 
 namespace onnxruntime {
@@ -31,17 +34,31 @@ namespace protobufutil = google::protobuf::util;
 static bool ParseRequestPayload(const HttpContext& context, SupportedContentType request_type,
                                 /* out */ PredictRequest& predictRequest, /* out */ http::status& error_code, /* out */ std::string& error_message);
 
+static void PredictImpl(const std::string& effective_name, const std::string& effective_version,
+                        HttpContext& context, const std::shared_ptr<ServerEnvironment>& env,
+                        const std::shared_ptr<spdlog::logger>& logger, RequestTimer& timer);
+
 void Predict(const std::string& name,
              const std::string& version,
              const std::string& action,
              /* in, out */ HttpContext& context,
              const std::shared_ptr<ServerEnvironment>& env) {
+  InFlightRequest in_flight(env->GetMetrics(), true);
   auto logger = env->GetLogger(context.request_id);
   logger->info("Model Name: {}, Version: {}, Action: {}", name, version, action);
 
   auto effective_name = name.empty() ? "default" : name;
-  auto effective_version = version.empty() ? "1" : version;
+  // An empty version selects the latest version of the model
+  const auto& effective_version = version;
+
+  RequestTimer timer(env->GetMetrics(), effective_name, effective_version.empty() ? "latest" : effective_version);
+  PredictImpl(effective_name, effective_version, context, env, logger, timer);
+  timer.SetFailed(context.response.result() != http::status::ok);
+}
 
+static void PredictImpl(const std::string& effective_name, const std::string& effective_version,
+                        HttpContext& context, const std::shared_ptr<ServerEnvironment>& env,
+                        const std::shared_ptr<spdlog::logger>& logger, RequestTimer& timer) {
   if (!context.client_request_id.empty()) {
     logger->info("{}: [{}]", util::MS_CLIENT_REQUEST_ID_HEADER, context.client_request_id);
   }
@@ -53,29 +70,33 @@ void Predict(const std::string& name,
     GenerateErrorResponse(logger, http::status::bad_request, "Unknown 'Accept' header field in the request", context);
   }
 
-  // Deserialize the payload
-  auto body = context.request.body();
-  PredictRequest predict_request{};
+  // Deserialize the payload. The request and its tensor messages are allocated from an arena, and the raw_data of
+  // the tensors is used in place as model inputs. The raw_data strings are not arena allocated, so the arena only
+  // holds the messages and keeps its default block size.
+  timer.Start(RequestPhase::Deserialize);
+  google::protobuf::Arena arena;
+  auto* predict_request = google::protobuf::Arena::CreateMessage<PredictRequest>(&arena);
   http::status error_code;
   std::string error_message;
-  bool parse_succeeded = ParseRequestPayload(context, request_type, predict_request, error_code, error_message);
+  bool parse_succeeded = ParseRequestPayload(context, request_type, *predict_request, error_code, error_message);
   if (!parse_succeeded) {
     GenerateErrorResponse(logger, error_code, error_message, context);
     return;
   }
 
   // Run Prediction
+  timer.Start(RequestPhase::Run);
   Executor executor(env.get(), context.request_id);
-  PredictResponse predict_response{};
-  auto status = executor.Predict(effective_name, effective_version, predict_request, predict_response);
-  if (!status.ok()) {
-    GenerateErrorResponse(logger, GetHttpStatusCode((status)), status.error_message(), context);
-    return;
-  }
-
-  // Serialize to proper output format
   std::string response_body{};
   if (response_type == SupportedContentType::Json) {
+    PredictResponse predict_response{};
+    auto status = executor.Predict(effective_name, effective_version, *predict_request, predict_response);
+    if (!status.ok()) {
+      GenerateErrorResponse(logger, GetHttpStatusCode((status)), status.error_message(), context);
+      return;
+    }
+
+    timer.Start(RequestPhase::Serialize);
     status = GenerateResponseInJson(predict_response, response_body);
     if (!status.ok()) {
       GenerateErrorResponse(logger, http::status::internal_server_error, status.error_message(), context);
@@ -83,25 +104,49 @@ void Predict(const std::string& name,
     }
     context.response.set(http::field::content_type, "application/json");
   } else {
-    response_body = predict_response.SerializeAsString();
+    // The outputs are serialized straight from the ORT buffers
+    std::vector<std::string> output_names;
+    std::vector<Ort::Value> outputs;
+    auto status = executor.Run(effective_name, effective_version, *predict_request, output_names, outputs);
+    if (!status.ok()) {
+      GenerateErrorResponse(logger, GetHttpStatusCode((status)), status.error_message(), context);
+      return;
+    }
+
+    timer.Start(RequestPhase::Serialize);
+    try {
+      SerializePredictResponse(output_names, outputs, executor.UsingRawData(), logger, response_body);
+    } catch (const Ort::Exception& e) {
+      status = GenerateProtobufStatus(e.GetOrtErrorCode(), e.what());
+      GenerateErrorResponse(logger, GetHttpStatusCode((status)), status.error_message(), context);
+      return;
+    }
+
     if (context.request.find("Accept") != context.request.end() && context.request["Accept"] != "*/*") {
       context.response.set(http::field::content_type, context.request["Accept"].to_string());
     } else {
       context.response.set(http::field::content_type, "application/octet-stream");
     }
   }
+  timer.Stop();
 
   // Build HTTP response
   context.response.insert(util::MS_REQUEST_ID_HEADER, context.request_id);
   if (!context.client_request_id.empty()) {
     context.response.insert(util::MS_CLIENT_REQUEST_ID_HEADER, context.client_request_id);
   }
-  context.response.body() = response_body;
+  context.response.body() = std::move(response_body);
   context.response.result(http::status::ok);
 };
 
+void GetMetrics(HttpContext& context, const std::shared_ptr<ServerEnvironment>& env) {
+  context.response.body() = env->GetMetrics().Render(env->GetArenaStats());
+  context.response.set(http::field::content_type, "text/plain; version=0.0.4");
+  context.response.result(http::status::ok);
+}
+
 static bool ParseRequestPayload(const HttpContext& context, SupportedContentType request_type, PredictRequest& predictRequest, http::status& error_code, std::string& error_message) {
-  auto body = context.request.body();
+  const auto& body = context.request.body();
   protobufutil::Status status;
   switch (request_type) {
     case SupportedContentType::Json: {
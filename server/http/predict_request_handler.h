@@ -19,5 +19,9 @@ void Predict(const std::string& name,
              /* in, out */ HttpContext& context,
              const std::shared_ptr<ServerEnvironment>& env);
 
+// Responds with the request, thread and arena metrics in the Prometheus text format
+void GetMetrics(/* in, out */ HttpContext& context,
+                const std::shared_ptr<ServerEnvironment>& env);
+
 }  // namespace server
 }  // namespace onnxruntime
@@ -3,6 +3,7 @@
 
 #include "environment.h"
 #include "http_server.h"
+#include "model_repository.h"
 #include "predict_request_handler.h"
 #include "server_configuration.h"
 #include "grpc/grpc_app.h"
@@ -60,16 +61,33 @@ int main(int argc, char* argv[]) {
 
   const auto env = std::make_shared<server::ServerEnvironment>(config.logging_level, spdlog::sinks_init_list{std::make_shared<spdlog::sinks::stdout_sink_mt>(), std::make_shared<spdlog::sinks::syslog_sink_mt>()});
   auto logger = env->GetAppLogger();
-  logger->info("Model path: {}, ", config.model_path);
-  logger->info("Model name: {}", config.model_name);
-  logger->info("Model version: {}", config.model_version);
-
-  try {
-    env->InitializeModel(config.model_path, config.model_name, config.model_version);
-    logger->debug("Initialize Model Successfully!");
-  } catch (const Ort::Exception& ex) {
-    logger->critical("Initialize Model Failed: {} ---- Error: [{}]", ex.GetOrtErrorCode(), ex.what());
-    exit(EXIT_FAILURE);
+  std::unique_ptr<server::ModelRepository> repository;
+  if (!config.model_repository.empty()) {
+    logger->info("Model repository: {}", config.model_repository);
+
+    server::ModelRepositoryOptions repository_options;
+    repository_options.path = config.model_repository;
+    repository_options.poll_interval = std::chrono::seconds(config.model_poll_interval);
+    repository_options.warmup_runs = config.warmup_runs;
+    repository = std::make_unique<server::ModelRepository>(env, repository_options);
+
+    // The models found at startup are loaded and warmed up before the server starts listening
+    if (repository->Poll() != 0) {
+      logger->warn("Some models of the repository failed to load");
+    }
+    repository->Start();
+  } else {
+    logger->info("Model path: {}, ", config.model_path);
+    logger->info("Model name: {}", config.model_name);
+    logger->info("Model version: {}", config.model_version);
+
+    try {
+      env->InitializeModel(config.model_path, config.model_name, config.model_version);
+      logger->debug("Initialize Model Successfully!");
+    } catch (const Ort::Exception& ex) {
+      logger->critical("Initialize Model Failed: {} ---- Error: [{}]", ex.GetOrtErrorCode(), ex.what());
+      exit(EXIT_FAILURE);
+    }
   }
 
   //Setup GRPC Server
@@ -118,6 +136,14 @@ int main(int argc, char* argv[]) {
       }
   );
 
+  app.RegisterGet(
+      R"(/metrics()()())",
+      [&env](const auto& /*name*/, const auto& /*version*/, const auto& /*action*/, auto& context) -> void {
+        server::GetMetrics(context, env);
+      });
+
+  env->GetMetrics().SetHttpThreads(config.num_http_threads);
+
   app.Bind(boost_address, config.http_port)
       .NumThreads(config.num_http_threads)
       .Run();
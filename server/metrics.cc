@@ -0,0 +1,274 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <algorithm>
+#include <sstream>
+#include <thread>
+
+#include "metrics.h"
+
+namespace onnxruntime {
+namespace server {
+
+static const char* const kPhaseNames[] = {"deserialize", "run", "serialize"};
+static const char* const kOtherModel = "other";
+
+// Each thread records into its own shard as long as there are no more threads than shards
+static size_t ThreadShardIndex(size_t num_shards) {
+  static std::atomic<size_t> next_index{0};
+  thread_local size_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+  return index % num_shards;
+}
+
+// Label values escape backslash, double quote and line feed
+static std::string EscapeLabel(const std::string& value) {
+  std::string escaped;
+  escaped.reserve(value.size());
+  for (char c : value) {
+    switch (c) {
+      case '\\':
+        escaped += "\\\\";
+        break;
+      case '"':
+        escaped += "\\\"";
+        break;
+      case '\n':
+        escaped += "\\n";
+        break;
+      default:
+        escaped += c;
+    }
+  }
+  return escaped;
+}
+
+static std::string ModelLabels(const std::string& name, const std::string& version) {
+  return "model=\"" + EscapeLabel(name) + "\",version=\"" + EscapeLabel(version) + "\"";
+}
+
+static void WriteHeader(std::ostringstream& out, const char* name, const char* type, const char* help) {
+  out << "# HELP " << name << " " << help << "\n"
+      << "# TYPE " << name << " " << type << "\n";
+}
+
+const std::vector<double>& ServerMetrics::LatencyBuckets() {
+  static const std::vector<double> buckets{0.0001, 0.00025, 0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025,
+                                           0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10};
+  return buckets;
+}
+
+void ServerMetrics::Histogram::Observe(double value) {
+  const auto& buckets = LatencyBuckets();
+  if (counts.empty()) {
+    counts.resize(buckets.size() + 1);
+  }
+
+  size_t i = 0;
+  while (i < buckets.size() && value > buckets[i]) {
+    ++i;
+  }
+  ++counts[i];
+  sum += value;
+  ++count;
+}
+
+void ServerMetrics::Histogram::Merge(const Histogram& other) {
+  if (other.counts.empty()) {
+    return;
+  }
+  if (counts.empty()) {
+    counts.resize(other.counts.size());
+  }
+  for (size_t i = 0; i < counts.size(); ++i) {
+    counts[i] += other.counts[i];
+  }
+  sum += other.sum;
+  count += other.count;
+}
+
+ServerMetrics::ServerMetrics(size_t max_models) : max_models_(max_models) {
+}
+
+void ServerMetrics::RequestStarted(bool http) {
+  in_flight_.fetch_add(1, std::memory_order_relaxed);
+  if (http) {
+    http_in_flight_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void ServerMetrics::RequestFinished(bool http) {
+  in_flight_.fetch_sub(1, std::memory_order_relaxed);
+  if (http) {
+    http_in_flight_.fetch_sub(1, std::memory_order_relaxed);
+  }
+}
+
+ServerMetrics::ModelKey ServerMetrics::AdmitModel(const ModelKey& key) {
+  std::lock_guard<std::mutex> lock(models_mutex_);
+  if (models_.count(key) != 0) {
+    return key;
+  }
+  if (models_.size() < max_models_) {
+    models_.insert(key);
+    return key;
+  }
+  return ModelKey(kOtherModel, "");
+}
+
+void ServerMetrics::Record(const RequestRecord& record) {
+  auto& shard = shards_[ThreadShardIndex(kNumShards)];
+  ModelKey key(record.model_name, record.model_version);
+
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto it = shard.models.find(key);
+  if (it == shard.models.end()) {
+    if (shard.other_models.count(key) != 0) {
+      it = shard.models.find(ModelKey(kOtherModel, ""));
+    } else {
+      // First request for this model in the shard
+      ModelKey admitted = AdmitModel(key);
+      if (admitted != key && shard.other_models.size() < max_models_) {
+        shard.other_models.insert(key);
+      }
+      it = shard.models.emplace(admitted, ModelCounters{}).first;
+    }
+  }
+
+  auto& counters = it->second;
+  ++counters.requests;
+  if (record.failed) {
+    ++counters.errors;
+  }
+  for (size_t phase = 0; phase < record.phase_seconds.size(); ++phase) {
+    if (record.phase_ran[phase]) {
+      counters.phases[phase].Observe(record.phase_seconds[phase]);
+    }
+  }
+}
+
+std::string ServerMetrics::Render(const std::vector<ModelArenaStats>& arena_stats) const {
+  // Merge the shards. Each shard is locked only while it is copied.
+  std::map<ModelKey, ModelCounters> models;
+  for (const auto& shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    for (const auto& entry : shard.models) {
+      auto& merged = models[entry.first];
+      merged.requests += entry.second.requests;
+      merged.errors += entry.second.errors;
+      for (size_t phase = 0; phase < merged.phases.size(); ++phase) {
+        merged.phases[phase].Merge(entry.second.phases[phase]);
+      }
+    }
+  }
+
+  std::ostringstream out;
+  out.precision(10);
+  WriteHeader(out, "onnxruntime_server_requests_total", "counter", "Number of prediction requests.");
+  for (const auto& entry : models) {
+    out << "onnxruntime_server_requests_total{" << ModelLabels(entry.first.first, entry.first.second) << "} "
+        << entry.second.requests << "\n";
+  }
+
+  WriteHeader(out, "onnxruntime_server_request_errors_total", "counter", "Number of failed prediction requests.");
+  for (const auto& entry : models) {
+    out << "onnxruntime_server_request_errors_total{" << ModelLabels(entry.first.first, entry.first.second) << "} "
+        << entry.second.errors << "\n";
+  }
+
+  const auto& buckets = LatencyBuckets();
+  WriteHeader(out, "onnxruntime_server_request_phase_seconds", "histogram",
+              "Latency of the phases of prediction requests.");
+  for (const auto& entry : models) {
+    auto labels = ModelLabels(entry.first.first, entry.first.second);
+    for (size_t phase = 0; phase < entry.second.phases.size(); ++phase) {
+      const auto& histogram = entry.second.phases[phase];
+      if (histogram.count == 0) {
+        continue;
+      }
+
+      auto phase_labels = labels + ",phase=\"" + kPhaseNames[phase] + "\"";
+      uint64_t cumulative = 0;
+      for (size_t i = 0; i < buckets.size(); ++i) {
+        cumulative += histogram.counts[i];
+        out << "onnxruntime_server_request_phase_seconds_bucket{" << phase_labels << ",le=\"" << buckets[i] << "\"} "
+            << cumulative << "\n";
+      }
+      out << "onnxruntime_server_request_phase_seconds_bucket{" << phase_labels << ",le=\"+Inf\"} "
+          << histogram.count << "\n";
+      out << "onnxruntime_server_request_phase_seconds_sum{" << phase_labels << "} " << histogram.sum << "\n";
+      out << "onnxruntime_server_request_phase_seconds_count{" << phase_labels << "} " << histogram.count << "\n";
+    }
+  }
+
+  WriteHeader(out, "onnxruntime_server_requests_in_flight", "gauge", "Number of prediction requests being handled.");
+  out << "onnxruntime_server_requests_in_flight " << InFlight() << "\n";
+
+  if (http_threads_ > 0) {
+    WriteHeader(out, "onnxruntime_server_http_threads", "gauge", "Number of threads handling HTTP requests.");
+    out << "onnxruntime_server_http_threads " << http_threads_ << "\n";
+    WriteHeader(out, "onnxruntime_server_http_thread_utilization", "gauge",
+                "Fraction of the HTTP threads busy with a prediction request.");
+    out << "onnxruntime_server_http_thread_utilization "
+        << std::min(1.0, static_cast<double>(http_in_flight_.load(std::memory_order_relaxed)) / http_threads_) << "\n";
+  }
+
+  WriteHeader(out, "onnxruntime_server_arena_bytes_in_use", "gauge", "Bytes allocated from the arena of a model.");
+  for (const auto& arena : arena_stats) {
+    out << "onnxruntime_server_arena_bytes_in_use{" << ModelLabels(arena.model_name, arena.model_version) << "} "
+        << arena.stats.bytes_in_use << "\n";
+  }
+  WriteHeader(out, "onnxruntime_server_arena_reserved_bytes", "gauge", "Bytes reserved by the arena of a model.");
+  for (const auto& arena : arena_stats) {
+    out << "onnxruntime_server_arena_reserved_bytes{" << ModelLabels(arena.model_name, arena.model_version) << "} "
+        << arena.stats.total_allocated_bytes << "\n";
+  }
+  WriteHeader(out, "onnxruntime_server_arena_max_bytes_in_use", "gauge",
+              "Largest number of bytes in use in the arena of a model.");
+  for (const auto& arena : arena_stats) {
+    out << "onnxruntime_server_arena_max_bytes_in_use{" << ModelLabels(arena.model_name, arena.model_version) << "} "
+        << arena.stats.max_bytes_in_use << "\n";
+  }
+  WriteHeader(out, "onnxruntime_server_arena_allocations_total", "counter",
+              "Number of allocations from the arena of a model.");
+  for (const auto& arena : arena_stats) {
+    out << "onnxruntime_server_arena_allocations_total{" << ModelLabels(arena.model_name, arena.model_version) << "} "
+        << arena.stats.num_allocs << "\n";
+  }
+
+  return out.str();
+}
+
+RequestTimer::RequestTimer(ServerMetrics& metrics, const std::string& model_name, const std::string& model_version)
+    : metrics_(metrics) {
+  record_.model_name = model_name;
+  record_.model_version = model_version;
+  record_.failed = true;
+}
+
+RequestTimer::~RequestTimer() {
+  Stop();
+  metrics_.Record(record_);
+}
+
+void RequestTimer::Start(RequestPhase phase) {
+  Stop();
+  phase_ = phase;
+  timing_ = true;
+  phase_start_ = std::chrono::steady_clock::now();
+}
+
+void RequestTimer::Stop() {
+  if (timing_) {
+    SetPhase(phase_, std::chrono::steady_clock::now() - phase_start_);
+    timing_ = false;
+  }
+}
+
+void RequestTimer::SetPhase(RequestPhase phase, std::chrono::steady_clock::duration duration) {
+  auto index = static_cast<size_t>(phase);
+  record_.phase_seconds[index] += std::chrono::duration<double>(duration).count();
+  record_.phase_ran[index] = true;
+}
+
+}  // namespace server
+}  // namespace onnxruntime
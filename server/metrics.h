@@ -0,0 +1,149 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "onnxruntime_cxx_api.h"
+
+namespace onnxruntime {
+namespace server {
+
+// Phases of a prediction request
+enum class RequestPhase {
+  Deserialize = 0,
+  Run,
+  Serialize,
+};
+
+// Measurements of a single prediction request, recorded once when the request finishes
+struct RequestRecord {
+  std::string model_name;
+  std::string model_version;
+  bool failed{false};
+  std::array<double, 3> phase_seconds{};  // indexed by RequestPhase, 0 for phases that did not run
+  std::array<bool, 3> phase_ran{};
+};
+
+// Memory statistics of the session of one model version, reported when the metrics are scraped
+struct ModelArenaStats {
+  std::string model_name;
+  std::string model_version;
+  Ort::ArenaStats stats;
+};
+
+// Request metrics of the server in the Prometheus text format.
+// Requests are recorded into one of a fixed number of shards, picked per thread, so recording threads do not
+// contend with each other. The shards are only merged when the metrics are rendered.
+class ServerMetrics {
+ public:
+  // Upper bounds of the latency histogram buckets, in seconds
+  static const std::vector<double>& LatencyBuckets();
+
+  // 'max_models' bounds the number of model and version label pairs. Requests for further models, e.g. unknown
+  // names sent by clients, are counted under model="other".
+  explicit ServerMetrics(size_t max_models = 256);
+  ~ServerMetrics() = default;
+  ServerMetrics(const ServerMetrics&) = delete;
+  ServerMetrics& operator=(const ServerMetrics&) = delete;
+
+  void Record(const RequestRecord& record);
+
+  // 'http' requests also count towards the utilization of the HTTP threads
+  void RequestStarted(bool http);
+  void RequestFinished(bool http);
+  int64_t InFlight() const { return in_flight_.load(std::memory_order_relaxed); }
+
+  void SetHttpThreads(int threads) { http_threads_ = threads; }
+
+  // Renders all metrics, adding the arena statistics of the loaded models
+  std::string Render(const std::vector<ModelArenaStats>& arena_stats) const;
+
+ private:
+  struct Histogram {
+    std::vector<uint64_t> counts;  // per bucket, not cumulative, with a last bucket for +Inf
+    double sum{0};
+    uint64_t count{0};
+
+    void Observe(double value);
+    void Merge(const Histogram& other);
+  };
+
+  struct ModelCounters {
+    uint64_t requests{0};
+    uint64_t errors{0};
+    std::array<Histogram, 3> phases;
+  };
+
+  using ModelKey = std::pair<std::string, std::string>;
+
+  struct Shard {
+    mutable std::mutex mutex;
+    std::map<ModelKey, ModelCounters> models;  // keyed by the labels the model is counted under
+    // Models counted under model="other", so their requests don't take models_mutex_ again. The names come from
+    // clients, so at most max_models_ of them are remembered per shard.
+    std::set<ModelKey> other_models;
+  };
+
+  static constexpr size_t kNumShards = 16;
+
+  // Returns the labels to count a model under, admitting it if there is room
+  ModelKey AdmitModel(const ModelKey& key);
+
+  const size_t max_models_;
+  std::mutex models_mutex_;
+  std::set<ModelKey> models_;
+  std::array<Shard, kNumShards> shards_;
+  std::atomic<int64_t> in_flight_{0};
+  std::atomic<int64_t> http_in_flight_{0};
+  int http_threads_{0};
+};
+
+// Marks a request as in flight for the lifetime of the object
+class InFlightRequest {
+ public:
+  InFlightRequest(ServerMetrics& metrics, bool http) : metrics_(metrics), http_(http) { metrics_.RequestStarted(http_); }
+  ~InFlightRequest() { metrics_.RequestFinished(http_); }
+  InFlightRequest(const InFlightRequest&) = delete;
+  InFlightRequest& operator=(const InFlightRequest&) = delete;
+
+ private:
+  ServerMetrics& metrics_;
+  const bool http_;
+};
+
+// Times the phases of a request and records it into the metrics when destroyed.
+// A request counts as failed unless SetFailed(false) is called.
+class RequestTimer {
+ public:
+  RequestTimer(ServerMetrics& metrics, const std::string& model_name, const std::string& model_version);
+  ~RequestTimer();
+  RequestTimer(const RequestTimer&) = delete;
+  RequestTimer& operator=(const RequestTimer&) = delete;
+
+  // Starts timing 'phase', stopping the phase being timed if any
+  void Start(RequestPhase phase);
+  void Stop();
+  void SetPhase(RequestPhase phase, std::chrono::steady_clock::duration duration);
+  void SetFailed(bool failed) { record_.failed = failed; }
+
+ private:
+  ServerMetrics& metrics_;
+  RequestRecord record_;
+  bool timing_{false};
+  RequestPhase phase_{RequestPhase::Deserialize};
+  std::chrono::steady_clock::time_point phase_start_;
+};
+
+}  // namespace server
+}  // namespace onnxruntime
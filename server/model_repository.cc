@@ -0,0 +1,216 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include <boost/filesystem.hpp>
+
+#include "executor.h"
+#include "json_handling.h"
+#include "model_repository.h"
+
+namespace onnxruntime {
+namespace server {
+
+namespace fs = boost::filesystem;
+
+static const char* const kModelFileName = "model.onnx";
+static const char* const kWarmupDirName = "warmup";
+// Upper bound of the number of polls skipped between retries of a version that keeps failing to load
+static const int kMaxRetryBackoffPolls = 32;
+
+static bool IsVersionName(const std::string& name) {
+  return !name.empty() && std::all_of(name.begin(), name.end(), [](char c) { return c >= '0' && c <= '9'; });
+}
+
+ModelRepository::ModelRepository(std::shared_ptr<ServerEnvironment> env, ModelRepositoryOptions options)
+    : env_(std::move(env)), options_(std::move(options)) {
+}
+
+ModelRepository::~ModelRepository() {
+  Stop();
+}
+
+std::vector<RepositoryModel> ModelRepository::Scan(const std::string& path) {
+  std::vector<RepositoryModel> models;
+  boost::system::error_code ec;
+  for (fs::directory_iterator model_it(path, ec), end; !ec && model_it != end; model_it.increment(ec)) {
+    if (!fs::is_directory(model_it->status())) {
+      continue;
+    }
+
+    auto name = model_it->path().filename().string();
+    for (fs::directory_iterator version_it(model_it->path(), ec); !ec && version_it != end; version_it.increment(ec)) {
+      auto version = version_it->path().filename().string();
+      auto model_path = version_it->path() / kModelFileName;
+      if (!fs::is_directory(version_it->status()) || !IsVersionName(version) || !fs::is_regular_file(model_path)) {
+        continue;
+      }
+
+      boost::system::error_code time_ec;
+      boost::system::error_code size_ec;
+      auto last_write_time = fs::last_write_time(model_path, time_ec);
+      auto file_size = fs::file_size(model_path, size_ec);
+      if (time_ec || size_ec) {
+        continue;
+      }
+      models.push_back(RepositoryModel{name, version, model_path.string(),
+                                       (version_it->path() / kWarmupDirName).string(), last_write_time, file_size});
+    }
+    // A model directory that cannot be read is skipped, the other models are still listed
+    ec.clear();
+  }
+
+  return models;
+}
+
+size_t ModelRepository::Poll() {
+  std::lock_guard<std::mutex> poll_lock(poll_mutex_);
+  auto logger = env_->GetAppLogger();
+  auto found = Scan(options_.path);
+
+  size_t failed = 0;
+  std::map<std::pair<std::string, std::string>, VersionState> versions;
+  for (const auto& model : found) {
+    auto key = std::make_pair(model.name, model.version);
+    auto it = versions_.find(key);
+    bool unchanged = it != versions_.end() && it->second.last_write_time == model.last_write_time &&
+                     it->second.file_size == model.file_size;
+    if (unchanged && it->second.failures == 0) {
+      // Unchanged
+      versions.emplace(key, it->second);
+      continue;
+    }
+    if (unchanged && it->second.polls_until_retry > 0) {
+      // The model file failed to load and is waiting to be retried
+      VersionState state = it->second;
+      --state.polls_until_retry;
+      versions.emplace(key, state);
+      continue;
+    }
+
+    bool was_loaded = it != versions_.end() && it->second.loaded;
+    VersionState state{model.last_write_time, model.file_size, was_loaded, 0, 0};
+    if (LoadVersion(model)) {
+      state.loaded = true;
+    } else {
+      ++failed;
+      // The first retry is on the next poll, then the number of polls skipped doubles up to kMaxRetryBackoffPolls
+      state.failures = unchanged ? it->second.failures + 1 : 1;
+      state.polls_until_retry = std::min((1 << std::min(state.failures - 1, 6)) - 1, kMaxRetryBackoffPolls);
+    }
+    versions.emplace(key, state);
+  }
+
+  // Versions removed from the repository stop being served
+  for (const auto& entry : versions_) {
+    if (versions.count(entry.first) == 0 && entry.second.loaded) {
+      logger->info("Unloading model: {}, version: {}", entry.first.first, entry.first.second);
+      try {
+        env_->UnloadModel(entry.first.first, entry.first.second);
+      } catch (const Ort::Exception& e) {
+        logger->warn("Unloading model: {}, version: {} failed: {}", entry.first.first, entry.first.second, e.what());
+      }
+    }
+  }
+
+  versions_ = std::move(versions);
+  return failed;
+}
+
+bool ModelRepository::LoadVersion(const RepositoryModel& model) {
+  auto logger = env_->GetAppLogger();
+  logger->info("Loading model: {}, version: {}, path: {}", model.name, model.version, model.model_path);
+
+  auto start = std::chrono::steady_clock::now();
+  try {
+    auto session = env_->CreateModel(model.model_path);
+    WarmUp(model, session);
+    env_->SwapModel(model.name, model.version, std::move(session));
+  } catch (const std::exception& e) {
+    logger->error("Loading model: {}, version: {} failed: {}", model.name, model.version, e.what());
+    return false;
+  }
+
+  auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+  logger->info("Serving model: {}, version: {}, loaded in {} ms", model.name, model.version, elapsed.count());
+  return true;
+}
+
+void ModelRepository::WarmUp(const RepositoryModel& model, const std::shared_ptr<ModelSession>& session) const {
+  boost::system::error_code ec;
+  if (options_.warmup_runs <= 0 || !fs::is_directory(model.warmup_dir, ec)) {
+    return;
+  }
+
+  // Requests run in the order of their file names
+  std::vector<fs::path> files;
+  for (fs::directory_iterator it(model.warmup_dir, ec), end; !ec && it != end; it.increment(ec)) {
+    auto extension = it->path().extension().string();
+    if (fs::is_regular_file(it->status()) && (extension == ".pb" || extension == ".json")) {
+      files.push_back(it->path());
+    }
+  }
+  std::sort(files.begin(), files.end());
+
+  for (const auto& file : files) {
+    std::ifstream stream(file.string(), std::ios::binary);
+    std::stringstream content;
+    content << stream.rdbuf();
+    if (!stream) {
+      throw std::runtime_error("Cannot read warm-up request " + file.string());
+    }
+
+    PredictRequest request;
+    if (file.extension() == ".json") {
+      auto status = GetRequestFromJson(content.str(), request);
+      if (!status.ok()) {
+        throw std::runtime_error("Invalid warm-up request " + file.string() + ": " + status.error_message());
+      }
+    } else if (!request.ParseFromString(content.str())) {
+      throw std::runtime_error("Invalid warm-up request " + file.string());
+    }
+
+    for (int run = 0; run < options_.warmup_runs; ++run) {
+      Executor executor(env_.get(), "warmup");
+      std::vector<std::string> output_names;
+      std::vector<Ort::Value> outputs;
+      auto status = executor.Run(session, request, output_names, outputs);
+      if (!status.ok()) {
+        throw std::runtime_error("Warm-up request " + file.string() + " failed: " + status.error_message());
+      }
+    }
+  }
+}
+
+void ModelRepository::Start() {
+  if (options_.poll_interval.count() <= 0 || thread_.joinable()) {
+    return;
+  }
+
+  stop_ = false;
+  thread_ = std::thread([this]() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_condition_.wait_for(lock, options_.poll_interval, [this]() { return stop_; })) {
+      lock.unlock();
+      Poll();
+      lock.lock();
+    }
+  });
+}
+
+void ModelRepository::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  stop_condition_.notify_all();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+}  // namespace server
+}  // namespace onnxruntime
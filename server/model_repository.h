@@ -0,0 +1,98 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <condition_variable>
+#include <ctime>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "environment.h"
+
+namespace onnxruntime {
+namespace server {
+
+struct ModelRepositoryOptions {
+  std::string path;
+  // How often the repository is checked for new, changed or removed versions. 0 only loads it once.
+  std::chrono::seconds poll_interval{30};
+  // How many times each warm-up request runs before a version is served
+  int warmup_runs{1};
+};
+
+// A model version found in the repository
+struct RepositoryModel {
+  std::string name;
+  std::string version;
+  std::string model_path;
+  std::string warmup_dir;
+  // The modification time only has a resolution of a second, so a file that is still being copied is also told
+  // apart by its size
+  std::time_t last_write_time;
+  uintmax_t file_size;
+};
+
+// Serves the models of a model repository directory:
+//
+//   <path>/<model name>/<version>/model.onnx
+//   <path>/<model name>/<version>/warmup/*.pb or *.json   (optional PredictRequests)
+//
+// Versions are directories named with a number. Every version is served, and a request without a version uses the
+// latest one. New and changed versions are loaded on the polling thread and run their warm-up requests before they
+// are swapped in, so serving never waits for a load and the first requests do not pay for the arena growth and
+// memory pattern planning. A version that fails to load or warm up is not served; the version it would have replaced
+// stays in service. It is retried on later polls, backing off exponentially while it keeps failing, e.g. in case
+// its model file was still being written. Requests that are running on a replaced or removed version finish on it.
+class ModelRepository {
+ public:
+  ModelRepository(std::shared_ptr<ServerEnvironment> env, ModelRepositoryOptions options);
+  ~ModelRepository();
+  ModelRepository(const ModelRepository&) = delete;
+  ModelRepository& operator=(const ModelRepository&) = delete;
+
+  // Lists the versions in the repository
+  static std::vector<RepositoryModel> Scan(const std::string& path);
+
+  // Synchronizes the served models with the repository once. Returns the number of versions that failed to load.
+  size_t Poll();
+
+  // Starts polling the repository on a background thread
+  void Start();
+  void Stop();
+
+ private:
+  struct VersionState {
+    std::time_t last_write_time;
+    uintmax_t file_size;
+    bool loaded;  // some model file of the version is being served
+    // Consecutive failures to load the current model file, and the number of polls to skip before retrying it
+    int failures;
+    int polls_until_retry;
+  };
+
+  bool LoadVersion(const RepositoryModel& model);
+  void WarmUp(const RepositoryModel& model, const std::shared_ptr<ModelSession>& session) const;
+
+  const std::shared_ptr<ServerEnvironment> env_;
+  const ModelRepositoryOptions options_;
+  // Serializes polls, guards versions_
+  std::mutex poll_mutex_;
+  std::map<std::pair<std::string, std::string>, VersionState> versions_;
+
+  std::thread thread_;
+  // Guards stop_
+  std::mutex mutex_;
+  std::condition_variable stop_condition_;
+  bool stop_{false};
+};
+
+}  // namespace server
+}  // namespace onnxruntime
@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <algorithm>
+#include <cstdint>
 #include <limits>
 #include <sstream>
 #include "onnx-ml.pb.h"
@@ -378,6 +379,39 @@ void TensorProtoToMLValue(const onnx::TensorProto& tensor_proto, const MemBuffer
   value = Ort::Value::CreateTensor(&allocator, tensor_data, m.GetLen(), tensor_shape_vec.data(), tensor_shape_vec.size(), (ONNXTensorElementDataType)tensor_proto.data_type());
   return;
 }
+bool TryWrapRawDataAsMLValue(const onnx::TensorProto& tensor_proto, const OrtMemoryInfo& memory_info,
+                             Ort::Value& value) {
+  if (!tensor_proto.has_raw_data() || !IsLittleEndianOrder() ||
+      tensor_proto.data_type() == onnx::TensorProto_DataType::TensorProto_DataType_STRING ||
+      tensor_proto.data_location() == onnx::TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL) {
+    return false;
+  }
+
+  size_t size_in_bytes;
+  GetSizeInBytesFromTensorProto<0>(tensor_proto, &size_in_bytes);
+  const std::string& raw_data = tensor_proto.raw_data();
+  if (size_in_bytes == 0 || raw_data.size() != size_in_bytes) {
+    // let TensorProtoToMLValue handle empty tensors and report the size mismatch
+    return false;
+  }
+
+  // the element sizes are powers of two, so the data is aligned if its address is a multiple of the element size
+  size_t element_count = 1;
+  for (auto dim : tensor_proto.dims()) {
+    element_count *= static_cast<size_t>(dim);
+  }
+  const size_t element_size = size_in_bytes / element_count;
+  if (reinterpret_cast<uintptr_t>(raw_data.data()) % element_size != 0) {
+    return false;
+  }
+
+  std::vector<int64_t> tensor_shape_vec = GetTensorShapeFromTensorProto(tensor_proto);
+  value = Ort::Value::CreateTensor(&memory_info, const_cast<char*>(raw_data.data()), raw_data.size(),
+                                   tensor_shape_vec.data(), tensor_shape_vec.size(),
+                                   GetTensorElementType(tensor_proto));
+  return true;
+}
+
 template void GetSizeInBytesFromTensorProto<256>(const onnx::TensorProto& tensor_proto,
                                                  size_t* out);
 template void GetSizeInBytesFromTensorProto<0>(const onnx::TensorProto& tensor_proto, size_t* out);
@@ -27,6 +27,14 @@ void GetSizeInBytesFromTensorProto(const onnx::TensorProto& tensor_proto, size_t
  */
 void TensorProtoToMLValue(const onnx::TensorProto& input, const server::MemBuffer& m, /* out */ Ort::Value& value);
 
+/**
+ * Create a tensor over the raw_data of a TensorProto without copying it. The TensorProto must outlive the value.
+ * Returns false if the data can't be used in place: there is no raw_data, the tensor is a string or empty tensor,
+ * the host is big endian or the data is not aligned to the element size. TensorProtoToMLValue must be used then.
+ */
+bool TryWrapRawDataAsMLValue(const onnx::TensorProto& input, const OrtMemoryInfo& memory_info,
+                             /* out */ Ort::Value& value);
+
 template <typename T>
 void UnpackTensor(const onnx::TensorProto& tensor, const void* raw_data, size_t raw_data_len,
                   /*out*/ T* p_data, int64_t expected_size);
@@ -39,6 +39,9 @@ class ServerConfiguration {
  public:
   const std::string full_desc = "ONNX Server: host an ONNX model with ONNX Runtime";
   std::string model_path;
+  std::string model_repository;
+  int model_poll_interval = 30;
+  int warmup_runs = 1;
   std::string model_name = "default";
   std::string model_version = "1";
   std::string address = "0.0.0.0";
@@ -50,7 +53,10 @@ class ServerConfiguration {
   ServerConfiguration() {
     desc.add_options()("help,h", "Shows a help message and exits");
     desc.add_options()("log_level", po::value(&log_level_str)->default_value(log_level_str), "Logging level. Allowed options (case sensitive): verbose, info, warning, error, fatal");
-    desc.add_options()("model_path", po::value(&model_path)->required(), "Path to ONNX model");
+    desc.add_options()("model_path", po::value(&model_path), "Path to ONNX model");
+    desc.add_options()("model_repository", po::value(&model_repository), "Directory of models to host instead of model_path, laid out as <model name>/<version>/model.onnx");
+    desc.add_options()("model_poll_interval", po::value(&model_poll_interval)->default_value(model_poll_interval), "Seconds between checks of the model repository for new versions. 0 disables the checks");
+    desc.add_options()("warmup_runs", po::value(&warmup_runs)->default_value(warmup_runs), "Runs of each warm-up request in <model name>/<version>/warmup before a version of the model repository is served");
     desc.add_options()("model_name", po::value(&model_name)->default_value(model_name), "ONNX model name");
     desc.add_options()("model_version", po::value(&model_version)->default_value(model_version), "ONNX model version");
     desc.add_options()("address", po::value(&address)->default_value(address), "The base HTTP address");
@@ -103,9 +109,15 @@ class ServerConfiguration {
     } else if (num_http_threads <= 0) {
       PrintHelp(std::cerr, "num_http_threads must be greater than 0");
       return Result::ExitFailure;
-    } else if (!file_exists(model_path)) {
+    } else if (model_path.empty() == model_repository.empty()) {
+      PrintHelp(std::cerr, "Exactly one of model_path and model_repository must be given");
+      return Result::ExitFailure;
+    } else if (!model_path.empty() && !file_exists(model_path)) {
       PrintHelp(std::cerr, "model_path must be the location of a valid file");
       return Result::ExitFailure;
+    } else if (model_poll_interval < 0) {
+      PrintHelp(std::cerr, "model_poll_interval must not be negative");
+      return Result::ExitFailure;
     } else {
       return Result::ContinueSuccess;
     }
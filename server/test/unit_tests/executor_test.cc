@@ -5,6 +5,7 @@
 
 #include "gtest/gtest.h"
 
+#include "converter.h"
 #include "executor.h"
 #include "http/json_handling.h"
 #include <spdlog/spdlog.h>
@@ -52,6 +53,46 @@ TEST_F(ExecutorTest, TestMul_1) {
   EXPECT_EQ(expected, body);
 }
 
+TEST_F(ExecutorTest, TestMul_1_RawData) {
+  const std::vector<float> input{1, 2, 3, 4, 5, 6};
+  const std::vector<float> expected{1, 4, 9, 16, 25, 36};
+
+  onnxruntime::server::ServerEnvironment* env = ServerEnv();
+
+  onnxruntime::server::PredictRequest request{};
+  auto& tensor = (*request.mutable_inputs())["X"];
+  tensor.add_dims(3);
+  tensor.add_dims(2);
+  tensor.set_data_type(onnx::TensorProto_DataType_FLOAT);
+  tensor.set_raw_data(input.data(), input.size() * sizeof(float));
+
+  // Run keeps the outputs as OrtValues, and the serialized response matches the one built by protobuf
+  onnxruntime::server::Executor executor(env, "RequestId");
+  std::vector<std::string> output_names;
+  std::vector<Ort::Value> outputs;
+  auto status = executor.Run("Name", "version", request, output_names, outputs);
+  ASSERT_TRUE(status.ok());
+  ASSERT_TRUE(executor.UsingRawData());
+
+  std::string serialized;
+  SerializePredictResponse(output_names, outputs, executor.UsingRawData(), env->GetLogger("RequestId"), serialized);
+
+  onnxruntime::server::PredictResponse response{};
+  ASSERT_TRUE(response.ParseFromString(serialized));
+  ASSERT_EQ(response.outputs().count("Y"), 1u);
+  const auto& output = response.outputs().at("Y");
+  EXPECT_EQ(output.dims_size(), 2);
+  EXPECT_EQ(output.data_type(), onnx::TensorProto_DataType_FLOAT);
+  ASSERT_EQ(output.raw_data().size(), expected.size() * sizeof(float));
+  EXPECT_EQ(0, memcmp(output.raw_data().data(), expected.data(), output.raw_data().size()));
+
+  onnxruntime::server::Executor predict_executor(env, "RequestId");
+  onnxruntime::server::PredictResponse predict_response{};
+  status = predict_executor.Predict("Name", "version", request, predict_response);
+  ASSERT_TRUE(status.ok());
+  EXPECT_EQ(predict_response.outputs().at("Y").SerializeAsString(), output.SerializeAsString());
+}
+
 }  // namespace test
 }  // namespace server
 }  // namespace onnxruntime
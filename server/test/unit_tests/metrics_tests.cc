@@ -0,0 +1,152 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "metrics.h"
+
+namespace onnxruntime {
+namespace server {
+namespace test {
+
+static bool Contains(const std::string& text, const std::string& line) {
+  return text.find(line + "\n") != std::string::npos;
+}
+
+static RequestRecord MakeRecord(const std::string& name, const std::string& version, bool failed, double run_seconds) {
+  RequestRecord record;
+  record.model_name = name;
+  record.model_version = version;
+  record.failed = failed;
+  record.phase_seconds[static_cast<size_t>(RequestPhase::Run)] = run_seconds;
+  record.phase_ran[static_cast<size_t>(RequestPhase::Run)] = true;
+  return record;
+}
+
+TEST(MetricsTests, CountsAndHistogram) {
+  ServerMetrics metrics;
+  metrics.Record(MakeRecord("mnist", "1", false, 0.0002));
+  metrics.Record(MakeRecord("mnist", "1", true, 0.003));
+  metrics.Record(MakeRecord("mnist", "2", false, 20));
+
+  auto text = metrics.Render({});
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_requests_total{model="mnist",version="1"} 2)"));
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_request_errors_total{model="mnist",version="1"} 1)"));
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_requests_total{model="mnist",version="2"} 1)"));
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_request_errors_total{model="mnist",version="2"} 0)"));
+
+  // Buckets are cumulative
+  const std::string bucket = R"(onnxruntime_server_request_phase_seconds_bucket{model="mnist",version="1",phase="run",)";
+  EXPECT_TRUE(Contains(text, bucket + R"(le="0.0001"} 0)"));
+  EXPECT_TRUE(Contains(text, bucket + R"(le="0.00025"} 1)"));
+  EXPECT_TRUE(Contains(text, bucket + R"(le="0.005"} 2)"));
+  EXPECT_TRUE(Contains(text, bucket + R"(le="+Inf"} 2)"));
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_request_phase_seconds_count{model="mnist",version="1",phase="run"} 2)"));
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_request_phase_seconds_bucket{model="mnist",version="2",phase="run",le="10"} 0)"));
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_request_phase_seconds_bucket{model="mnist",version="2",phase="run",le="+Inf"} 1)"));
+
+  // Phases that did not run have no histogram
+  EXPECT_EQ(text.find(R"(phase="deserialize")"), std::string::npos);
+}
+
+TEST(MetricsTests, MergesThreads) {
+  ServerMetrics metrics;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([&metrics]() {
+      for (int i = 0; i < 100; ++i) {
+        metrics.Record(MakeRecord("model", "1", i % 10 == 0, 0.001));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto text = metrics.Render({});
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_requests_total{model="model",version="1"} 800)"));
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_request_errors_total{model="model",version="1"} 80)"));
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_request_phase_seconds_count{model="model",version="1",phase="run"} 800)"));
+}
+
+TEST(MetricsTests, LimitsModelsAndEscapesLabels) {
+  ServerMetrics metrics(2);
+  metrics.Record(MakeRecord("a\"b\\c", "1", false, 0.001));
+  metrics.Record(MakeRecord("b", "1", false, 0.001));
+  metrics.Record(MakeRecord("c", "1", true, 0.001));
+  metrics.Record(MakeRecord("d", "1", true, 0.001));
+
+  auto text = metrics.Render({});
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_requests_total{model="a\"b\\c",version="1"} 1)"));
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_requests_total{model="b",version="1"} 1)"));
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_requests_total{model="other",version=""} 2)"));
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_request_errors_total{model="other",version=""} 2)"));
+}
+
+TEST(MetricsTests, RepeatedOtherModels) {
+  ServerMetrics metrics(1);
+  metrics.Record(MakeRecord("a", "1", false, 0.001));
+  for (int i = 0; i < 10; ++i) {
+    metrics.Record(MakeRecord("b", "1", false, 0.001));
+    metrics.Record(MakeRecord("c", std::to_string(i), false, 0.001));
+  }
+
+  auto text = metrics.Render({});
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_requests_total{model="a",version="1"} 1)"));
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_requests_total{model="other",version=""} 20)"));
+  EXPECT_EQ(text.find(R"(model="b")"), std::string::npos);
+}
+
+TEST(MetricsTests, InFlightAndThreads) {
+  ServerMetrics metrics;
+  metrics.SetHttpThreads(4);
+  {
+    InFlightRequest http_request(metrics, true);
+    InFlightRequest grpc_request(metrics, false);
+    auto text = metrics.Render({});
+    EXPECT_TRUE(Contains(text, "onnxruntime_server_requests_in_flight 2"));
+    EXPECT_TRUE(Contains(text, "onnxruntime_server_http_threads 4"));
+    EXPECT_TRUE(Contains(text, "onnxruntime_server_http_thread_utilization 0.25"));
+  }
+  EXPECT_EQ(metrics.InFlight(), 0);
+}
+
+TEST(MetricsTests, RequestTimer) {
+  ServerMetrics metrics;
+  {
+    RequestTimer timer(metrics, "model", "1");
+    timer.SetPhase(RequestPhase::Deserialize, std::chrono::milliseconds(2));
+    timer.Start(RequestPhase::Run);
+    timer.SetFailed(false);
+  }
+  {
+    // Fails unless told otherwise
+    RequestTimer timer(metrics, "model", "1");
+  }
+
+  auto text = metrics.Render({});
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_requests_total{model="model",version="1"} 2)"));
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_request_errors_total{model="model",version="1"} 1)"));
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_request_phase_seconds_bucket{model="model",version="1",phase="deserialize",le="0.001"} 0)"));
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_request_phase_seconds_bucket{model="model",version="1",phase="deserialize",le="0.0025"} 1)"));
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_request_phase_seconds_count{model="model",version="1",phase="deserialize"} 1)"));
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_request_phase_seconds_count{model="model",version="1",phase="run"} 1)"));
+  EXPECT_EQ(text.find(R"(phase="serialize")"), std::string::npos);
+}
+
+TEST(MetricsTests, ArenaStats) {
+  ServerMetrics metrics;
+  ModelArenaStats arena{"model", "1", Ort::ArenaStats{100, 1024, 512, 7}};
+  auto text = metrics.Render({arena});
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_arena_bytes_in_use{model="model",version="1"} 100)"));
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_arena_reserved_bytes{model="model",version="1"} 1024)"));
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_arena_max_bytes_in_use{model="model",version="1"} 512)"));
+  EXPECT_TRUE(Contains(text, R"(onnxruntime_server_arena_allocations_total{model="model",version="1"} 7)"));
+}
+
+}  // namespace test
+}  // namespace server
+}  // namespace onnxruntime
@@ -0,0 +1,190 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <fstream>
+#include <set>
+
+#include <boost/filesystem.hpp>
+
+#include "gtest/gtest.h"
+
+#include "executor.h"
+#include "http/json_handling.h"
+#include "model_repository.h"
+#include "test_server_environment.h"
+
+namespace onnxruntime {
+namespace server {
+namespace test {
+
+namespace fs = boost::filesystem;
+
+static const auto model_file = "testdata/mul_1.onnx";
+static const auto warmup_json = R"({"inputs":{"X":{"dims":[3,2],"dataType":1,"floatData":[1,2,3,4,5,6]}}})";
+
+class ModelRepositoryTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    root_ = fs::temp_directory_path() / fs::unique_path("model_repository_%%%%-%%%%");
+    fs::create_directories(root_);
+  }
+
+  void TearDown() override {
+    fs::remove_all(root_);
+  }
+
+  fs::path AddVersion(const std::string& name, const std::string& version) {
+    auto dir = root_ / name / version;
+    fs::create_directories(dir);
+    fs::copy_file(model_file, dir / "model.onnx");
+    return dir;
+  }
+
+  static void WriteFile(const fs::path& path, const std::string& content) {
+    fs::create_directories(path.parent_path());
+    std::ofstream stream(path.string(), std::ios::binary);
+    stream << content;
+  }
+
+  std::shared_ptr<ServerEnvironment> Env() {
+    // The environment is owned by the test main
+    return std::shared_ptr<ServerEnvironment>(ServerEnv(), [](ServerEnvironment*) {});
+  }
+
+  fs::path root_;
+};
+
+static std::vector<float> RunMul(const std::shared_ptr<ModelSession>& model) {
+  PredictRequest request{};
+  EXPECT_TRUE(GetRequestFromJson(warmup_json, request).ok());
+
+  Executor executor(ServerEnv(), "RequestId");
+  std::vector<std::string> output_names;
+  std::vector<Ort::Value> outputs;
+  EXPECT_TRUE(executor.Run(model, request, output_names, outputs).ok());
+  EXPECT_EQ(outputs.size(), 1u);
+  const float* data = outputs[0].GetTensorMutableData<float>();
+  return std::vector<float>(data, data + 6);
+}
+
+TEST_F(ModelRepositoryTest, Scan) {
+  AddVersion("a", "1");
+  AddVersion("a", "12");
+  AddVersion("b", "3");
+  // not a version, and a version without a model
+  AddVersion("b", "latest");
+  fs::create_directories(root_ / "b" / "4");
+  WriteFile(root_ / "README.md", "not a model");
+
+  auto models = ModelRepository::Scan(root_.string());
+  std::set<std::pair<std::string, std::string>> found;
+  for (const auto& model : models) {
+    found.emplace(model.name, model.version);
+    EXPECT_EQ(fs::path(model.model_path).filename().string(), "model.onnx");
+    EXPECT_EQ(model.file_size, fs::file_size(model_file));
+  }
+  std::set<std::pair<std::string, std::string>> expected{{"a", "1"}, {"a", "12"}, {"b", "3"}};
+  EXPECT_EQ(found, expected);
+
+  EXPECT_TRUE(ModelRepository::Scan((root_ / "does_not_exist").string()).empty());
+}
+
+TEST_F(ModelRepositoryTest, LoadSwapAndUnload) {
+  auto env = Env();
+  AddVersion("repo_mul", "2");
+  auto v10 = AddVersion("repo_mul", "10");
+  WriteFile(v10 / "warmup" / "request.json", warmup_json);
+
+  ModelRepositoryOptions options;
+  options.path = root_.string();
+  options.poll_interval = std::chrono::seconds(0);
+  ModelRepository repository(env, options);
+  EXPECT_EQ(repository.Poll(), 0u);
+
+  // The latest version is chosen numerically
+  auto latest = env->GetModel("repo_mul", "");
+  EXPECT_EQ(latest, env->GetModel("repo_mul", "10"));
+  EXPECT_NE(latest, env->GetModel("repo_mul", "2"));
+
+  // Nothing changed, nothing is reloaded
+  EXPECT_EQ(repository.Poll(), 0u);
+  EXPECT_EQ(latest, env->GetModel("repo_mul", "10"));
+
+  // A changed model is swapped in, requests holding the previous one can still run on it
+  auto model_path = v10 / "model.onnx";
+  fs::last_write_time(model_path, fs::last_write_time(model_path) + 10);
+  EXPECT_EQ(repository.Poll(), 0u);
+  EXPECT_NE(latest, env->GetModel("repo_mul", "10"));
+  EXPECT_EQ(RunMul(latest), (std::vector<float>{1, 4, 9, 16, 25, 36}));
+
+  // A removed version stops being served
+  fs::remove_all(v10);
+  EXPECT_EQ(repository.Poll(), 0u);
+  EXPECT_THROW(env->GetModel("repo_mul", "10"), Ort::Exception);
+  EXPECT_EQ(env->GetModel("repo_mul", ""), env->GetModel("repo_mul", "2"));
+
+  env->UnloadModel("repo_mul", "2");
+}
+
+TEST_F(ModelRepositoryTest, FailedWarmupKeepsServedVersion) {
+  auto env = Env();
+  auto v1 = AddVersion("repo_warmup", "1");
+
+  ModelRepositoryOptions options;
+  options.path = root_.string();
+  options.poll_interval = std::chrono::seconds(0);
+  ModelRepository repository(env, options);
+  EXPECT_EQ(repository.Poll(), 0u);
+  auto served = env->GetModel("repo_warmup", "1");
+
+  // The new model fails its warm-up, so the version keeps being served by the previous one
+  WriteFile(v1 / "warmup" / "bad.json", R"({"inputs":{"X":{"dims":[4],"dataType":1,"floatData":[1,2,3,4]}}})");
+  auto model_path = v1 / "model.onnx";
+  fs::last_write_time(model_path, fs::last_write_time(model_path) + 10);
+  EXPECT_EQ(repository.Poll(), 1u);
+  EXPECT_EQ(served, env->GetModel("repo_warmup", "1"));
+
+  // A new version that fails its warm-up is not served. The failed version 1 is retried and fails again.
+  auto v2 = AddVersion("repo_warmup", "2");
+  WriteFile(v2 / "warmup" / "bad.pb", "not a request");
+  EXPECT_EQ(repository.Poll(), 2u);
+  EXPECT_THROW(env->GetModel("repo_warmup", "2"), Ort::Exception);
+  EXPECT_EQ(served, env->GetModel("repo_warmup", ""));
+
+  env->UnloadModel("repo_warmup", "1");
+}
+
+TEST_F(ModelRepositoryTest, RetriesFailedVersion) {
+  auto env = Env();
+  auto v1 = AddVersion("repo_retry", "1");
+  auto bad_warmup = v1 / "warmup" / "bad.json";
+  WriteFile(bad_warmup, R"({"inputs":{"X":{"dims":[4],"dataType":1,"floatData":[1,2,3,4]}}})");
+
+  ModelRepositoryOptions options;
+  options.path = root_.string();
+  options.poll_interval = std::chrono::seconds(0);
+  ModelRepository repository(env, options);
+  EXPECT_EQ(repository.Poll(), 1u);
+  EXPECT_THROW(env->GetModel("repo_retry", "1"), Ort::Exception);
+
+  // Retried on the next poll, then after skipping one poll
+  EXPECT_EQ(repository.Poll(), 1u);
+  EXPECT_EQ(repository.Poll(), 0u);
+  EXPECT_EQ(repository.Poll(), 1u);
+
+  // The version loads once the problem is fixed, although its model file did not change. It first waits out
+  // its backoff of three polls.
+  fs::remove(bad_warmup);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(repository.Poll(), 0u);
+    EXPECT_THROW(env->GetModel("repo_retry", "1"), Ort::Exception);
+  }
+  EXPECT_EQ(repository.Poll(), 0u);
+  EXPECT_EQ(RunMul(env->GetModel("repo_retry", "1")), (std::vector<float>{1, 4, 9, 16, 25, 36}));
+
+  env->UnloadModel("repo_retry", "1");
+}
+
+}  // namespace test
+}  // namespace server
+}  // namespace onnxruntime